@@ -1,6 +1,6 @@
 // font.cpp
 // Implementation of FontAtlas: uses FreeType to rasterize glyphs, pack them into an atlas,
-// export a PNG (via stb_image_write), and write/read a simple binary format.
+// export a PNG, and write/read a simple binary format.
 //
 // Binary format (FNTC):
 //  - 4 bytes: magic 'F','N','T','C'
@@ -21,51 +21,116 @@
 //  - Glyph bitmaps are rasterized as 8-bit gray; stored into atlas alpha channel. RGB left white (255,255,255).
 //  - Advance is stored as pixel advance (unsigned int).
 //
-// Dependencies: FreeType2, stb_image_write (included below), glm (for ivec2/vec2).
+// Dependencies: FreeType2, stb_image (decoding, from the engine's dependencies), glm (for ivec2/vec2).
 //
 
 
-#include "../Include/freetype/ft2build.h"
-#include "../Include/freetype/freetype.h"
+#include <ft2build.h>
 #include FT_FREETYPE_H
 
 #include <algorithm>
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <cassert>
+#include <cctype>
 #include <sstream>
 
-// stb_image_write (single header) - used to write atlas PNG for inspection/extraction
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include "stb_image_write.h"
+// static so the engine's own stb_image (R_Texture.cpp) does not clash when linked together
+#define STB_IMAGE_STATIC
 #define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
+#include <STB_IMAGE/stb_image.h>
 
 #include "FontCompiler.h"
 
 
 
-// png encoding helper: we use stb_image_write's memory write to produce PNG bytes in memory.
-static bool EncodePNGToMemory(const unsigned char* rgba, int w, int h, std::vector<unsigned char>& outPng)
-{
-    struct MemWriter {
-        std::vector<unsigned char>* out;
-        static void write(void* context, void* data, int size) {
-            auto o = reinterpret_cast<std::vector<unsigned char>*>(context);
-            unsigned char* d = (unsigned char*)data;
-            o->insert(o->end(), d, d + size);
+// png encoding helper: the atlas is written as stored (uncompressed) deflate blocks,
+// which every PNG decoder reads, so no image writer library is needed.
+namespace {
+
+    uint32_t Crc32(const unsigned char* data, size_t size, uint32_t crc = 0)
+    {
+        static const std::array<uint32_t, 256> table = [] {
+            std::array<uint32_t, 256> t{};
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                t[n] = c;
+            }
+            return t;
+        }();
+
+        crc = ~crc;
+        for (size_t i = 0; i < size; ++i) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    void PutU32BE(std::vector<unsigned char>& out, uint32_t v)
+    {
+        out.push_back(static_cast<unsigned char>(v >> 24));
+        out.push_back(static_cast<unsigned char>(v >> 16));
+        out.push_back(static_cast<unsigned char>(v >> 8));
+        out.push_back(static_cast<unsigned char>(v));
+    }
+
+    void PutChunk(std::vector<unsigned char>& out, const char* type, const std::vector<unsigned char>& data)
+    {
+        PutU32BE(out, static_cast<uint32_t>(data.size()));
+        const size_t start = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data.begin(), data.end());
+        PutU32BE(out, Crc32(out.data() + start, out.size() - start));
+    }
+
+    bool EncodePNGToMemory(const unsigned char* rgba, int w, int h, std::vector<unsigned char>& outPng)
+    {
+        outPng.clear();
+        if (!rgba || w <= 0 || h <= 0) return false;
+
+        // every scanline starts with filter type 0 (none)
+        const size_t stride = static_cast<size_t>(w) * 4;
+        std::vector<unsigned char> raw;
+        raw.reserve((stride + 1) * static_cast<size_t>(h));
+        for (int y = 0; y < h; ++y) {
+            raw.push_back(0);
+            raw.insert(raw.end(), rgba + y * stride, rgba + (y + 1) * stride);
+        }
+
+        // zlib stream of stored blocks, each at most 65535 bytes
+        std::vector<unsigned char> zlib{ 0x78, 0x01 };
+        size_t offset = 0;
+        do {
+            const size_t length = std::min<size_t>(raw.size() - offset, 65535);
+            const bool last = offset + length == raw.size();
+            zlib.push_back(last ? 1 : 0);
+            zlib.push_back(static_cast<unsigned char>(length));
+            zlib.push_back(static_cast<unsigned char>(length >> 8));
+            zlib.push_back(static_cast<unsigned char>(~length));
+            zlib.push_back(static_cast<unsigned char>(~length >> 8));
+            zlib.insert(zlib.end(), raw.begin() + static_cast<std::ptrdiff_t>(offset), raw.begin() + static_cast<std::ptrdiff_t>(offset + length));
+            offset += length;
+        } while (offset < raw.size());
+
+        uint32_t a = 1, b = 0;
+        for (unsigned char byte : raw) {
+            a = (a + byte) % 65521;
+            b = (b + a) % 65521;
         }
-    };
-
-    outPng.clear();
-    int stride = w * 4;
-    // Use stb_image_write to write to memory
-    stbi_write_func* func = [](void* context, void* data, int size) {
-        MemWriter::write(context, data, size);
-        };
-    // Unfortunately stb_image_write provides a wrapper stbi_write_png_to_func
-    stbi_write_png_to_func(func, &outPng, w, h, 4, rgba, stride);
-    return !outPng.empty();
+        PutU32BE(zlib, (b << 16) | a);
+
+        std::vector<unsigned char> header;
+        PutU32BE(header, static_cast<uint32_t>(w));
+        PutU32BE(header, static_cast<uint32_t>(h));
+        header.insert(header.end(), { 8, 6, 0, 0, 0 }); // 8 bit RGBA, no interlace
+
+        static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        outPng.assign(signature, signature + 8);
+        PutChunk(outPng, "IHDR", header);
+        PutChunk(outPng, "IDAT", zlib);
+        PutChunk(outPng, "IEND", {});
+        return true;
+    }
 }
 
 namespace text {
@@ -78,15 +143,16 @@ namespace text {
         m_characters.clear();
         m_atlasRGBA.clear();
         m_atlasWidth = m_atlasHeight = 0;
+        m_error.clear();
 
         FT_Library ft;
         if (FT_Init_FreeType(&ft)) {
-            std::cerr << "ERROR::FREETYPE: Could not init FreeType Library\n";
+            m_error = "Could not init FreeType Library";
             return false;
         }
         FT_Face face;
         if (FT_New_Face(ft, ttfPath.c_str(), 0, &face)) {
-            std::cerr << "ERROR::FREETYPE: Failed to load font: " << ttfPath << "\n";
+            m_error = "Failed to load font: " + ttfPath;
             FT_Done_FreeType(ft);
             return false;
         }
@@ -194,8 +260,10 @@ namespace text {
             cd.m_size = glm::ivec2(p.w, p.h);
             cd.m_bearing = glm::ivec2(p.bearingX, p.bearingY);
             cd.m_advance = p.advance;
-            cd.m_topLeftTexCoords = glm::vec2(static_cast<float>(p.x) / m_atlasWidth, static_cast<float>(p.y) / m_atlasHeight);
-            cd.m_bottomRightTexCoords = glm::vec2(static_cast<float>(p.x + p.w) / m_atlasWidth, static_cast<float>(p.y + p.h) / m_atlasHeight);
+            const float texW = static_cast<float>(m_atlasWidth);
+            const float texH = static_cast<float>(m_atlasHeight);
+            cd.m_topLeftTexCoords = glm::vec2(static_cast<float>(p.x) / texW, static_cast<float>(p.y) / texH);
+            cd.m_bottomRightTexCoords = glm::vec2(static_cast<float>(p.x + p.w) / texW, static_cast<float>(p.y + p.h) / texH);
             m_characters[p.ch] = cd;
         }
 
@@ -209,7 +277,10 @@ namespace text {
         if (m_atlasRGBA.empty()) return false;
         // stb_image_write expects row-major RGBA bytes
         int w = m_atlasWidth, h = m_atlasHeight;
-        if (stbi_write_png(pngPath.c_str(), w, h, 4, m_atlasRGBA.data(), w * 4) == 0) {
+        std::vector<unsigned char> pngBytes;
+        std::ofstream ofs(pngPath, std::ios::binary);
+        if (!EncodePNGToMemory(m_atlasRGBA.data(), w, h, pngBytes) ||
+            !ofs.write(reinterpret_cast<const char*>(pngBytes.data()), static_cast<std::streamsize>(pngBytes.size()))) {
             std::cerr << "Failed to write PNG: " << pngPath << "\n";
             return false;
         }
@@ -221,13 +292,13 @@ namespace text {
         // encode atlas to PNG bytes in memory
         std::vector<unsigned char> pngBytes;
         if (!EncodePNGToMemory(m_atlasRGBA.empty() ? nullptr : m_atlasRGBA.data(), m_atlasWidth, m_atlasHeight, pngBytes)) {
-            std::cerr << "ERROR: failed to encode atlas PNG to memory\n";
+            m_error = "failed to encode atlas PNG to memory";
             return false;
         }
 
         std::ofstream ofs(outPath, std::ios::binary);
         if (!ofs) {
-            std::cerr << "ERROR: cannot open output file: " << outPath << "\n";
+            m_error = "cannot open output file: " + outPath;
             return false;
         }
 
@@ -265,6 +336,10 @@ namespace text {
         }
 
         ofs.close();
+        if (!ofs) {
+            m_error = "failed to write output file: " + outPath;
+            return false;
+        }
         return true;
     }
 
@@ -350,3 +425,24 @@ namespace text {
     }
 
 } // namespace text
+
+namespace fontcompiler {
+
+    bool CompileFont(const std::filesystem::path& input, const std::filesystem::path& output, std::string& error, int pixelHeight)
+    {
+        std::string ext = input.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (ext != ".ttf" && ext != ".otf") {
+            error = "Unrecognized extension: " + ext;
+            return false;
+        }
+
+        text::FontAtlas atlas;
+        if (!atlas.GenerateFromTTF(input.string(), pixelHeight) || !atlas.SaveToFile(output.string())) {
+            error = atlas.GetError();
+            return false;
+        }
+        return true;
+    }
+
+} // namespace fontcompiler
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <filesystem>
 #include <map>
 #include <string>
 #include <vector>
@@ -56,7 +57,7 @@ namespace text {
         // Load from custom .fntc file (binary)
         bool LoadFromFile(const std::string& inPath);
 
-        // optionally export the atlas to a PNG (uses stb_image_write)
+        // optionally export the atlas to a PNG
         bool ExportAtlasPNG(const std::string& pngPath) const;
 
         // Accessors
@@ -64,6 +65,7 @@ namespace text {
         int GetAtlasWidth() const { return m_atlasWidth; }
         int GetAtlasHeight() const { return m_atlasHeight; }
         const std::vector<unsigned char>& GetAtlasRGBA() const { return m_atlasRGBA; } // RGBA bytes
+        const std::string& GetError() const { return m_error; } // why the last Generate/Save failed
 
     private:
         // packing helper
@@ -73,5 +75,16 @@ namespace text {
         int m_atlasHeight{ 0 };
         std::vector<unsigned char> m_atlasRGBA; // RGBA image bytes (width*height*4)
         FontMap m_characters;
+        mutable std::string m_error;
     };
 } // namespace text
+
+namespace fontcompiler {
+
+    // size glyphs are rasterized at, same as the FontCompiler executable always used
+    constexpr int DEFAULT_PIXEL_HEIGHT = 48;
+
+    // Rasterizes a .ttf/.otf and writes the .fntc package, used in process by the asset pipeline
+    bool CompileFont(const std::filesystem::path& input, const std::filesystem::path& output, std::string& error, int pixelHeight = DEFAULT_PIXEL_HEIGHT);
+
+} // namespace fontcompiler
@@ -26,45 +26,14 @@ int main(int argc, char** argv)
         }
     }
 
-    // Check extension of input
-    std::string ext;
-    {
-        auto p = std::filesystem::path(fontPath);
-        ext = p.extension().string();
-        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-    }
-
-    if (ext == ".ttf" || ext == ".otf") {
-        int pxSize = 48; // default size
-        text::FontAtlas atlas;
-        std::cout << "Generating atlas from: " << fontPath << " (size " << pxSize << "px)...\n";
+    std::cout << "Generating atlas from: " << fontPath << " (size " << fontcompiler::DEFAULT_PIXEL_HEIGHT << "px)...\n";
 
-        if (!atlas.GenerateFromTTF(fontPath, pxSize)) {
-            std::cerr << "Failed to generate atlas\n";
-            return 1;
-        }
-
-        // Save binary package (.fntc)
-        if (!atlas.SaveToFile(outputPath)) {
-            std::cerr << "Failed to save file: " << outputPath << "\n";
-            return 1;
-        }
-        std::cout << "Wrote font package: " << outputPath << "\n";
-
-        //Save atlas image next to output
-        //
-       /* std::filesystem::path pngPath = std::filesystem::path(outputPath).replace_extension(".atlas.png");
-        if (!atlas.ExportAtlasPNG(pngPath.string())) {
-            std::cerr << "Failed to export atlas PNG: " << pngPath.string() << "\n";
-        }
-        else {
-            std::cout << "Wrote atlas PNG: " << pngPath.string() << "\n";
-        }*/
-
-        return 0;
-    }
-    else {
-        std::cerr << "Unrecognized extension: " << ext << "\n";
+    std::string error;
+    if (!fontcompiler::CompileFont(fontPath, outputPath, error)) {
+        std::cerr << error << "\n";
         return 1;
     }
+    std::cout << "Wrote font package: " << outputPath << "\n";
+
+    return 0;
 }
\ No newline at end of file
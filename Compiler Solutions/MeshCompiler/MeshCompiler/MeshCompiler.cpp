@@ -0,0 +1,103 @@
+/******************************************************************/
+/*!
+\file      MeshCompiler.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the mesh compiler core.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "MeshCompiler.h"
+
+#include <fstream>
+
+#include "BinaryParser.h"
+#include "Model.h"
+
+namespace meshcompiler {
+
+	std::string SerializeMesh(const Model& model) {
+		BinaryReader br;
+		std::string serializedVertex;
+
+		serializedVertex += br.EncodeBinary(model.meshes.size());
+		for (const Mesh& mesh : model.meshes) {
+			//Add vertexes inside
+			serializedVertex += br.EncodeBinary(mesh.vertices.size());
+			for (const Vertex& vert : mesh.vertices) {
+				//Encode position
+				serializedVertex += br.EncodeBinary(vert.Position.x);
+				serializedVertex += br.EncodeBinary(vert.Position.y);
+				serializedVertex += br.EncodeBinary(vert.Position.z);
+				//Encode Normal
+				serializedVertex += br.EncodeBinary(vert.Normal.x);
+				serializedVertex += br.EncodeBinary(vert.Normal.y);
+				serializedVertex += br.EncodeBinary(vert.Normal.z);
+				//Encode Texcoords
+				serializedVertex += br.EncodeBinary(vert.TexCoords.x);
+				serializedVertex += br.EncodeBinary(vert.TexCoords.y);
+				//Encode Tangent
+				serializedVertex += br.EncodeBinary(vert.Tangent.x);
+				serializedVertex += br.EncodeBinary(vert.Tangent.y);
+				serializedVertex += br.EncodeBinary(vert.Tangent.z);
+				//Encode Bitangent
+				serializedVertex += br.EncodeBinary(vert.Bitangent.x);
+				serializedVertex += br.EncodeBinary(vert.Bitangent.y);
+				serializedVertex += br.EncodeBinary(vert.Bitangent.z);
+
+				//Encode bone ID and weight ID
+				for (int i = 0; i < MAX_BONE_INFLUENCE; ++i) {
+					serializedVertex += br.EncodeBinary(vert.m_BoneIDs[i]);
+				}
+				for (int i = 0; i < MAX_BONE_INFLUENCE; ++i) {
+					serializedVertex += br.EncodeBinary(vert.m_Weights[i]);
+				}
+			}
+			//Add indices inside
+			serializedVertex += br.EncodeBinary(mesh.indices.size());
+			for (unsigned int indice : mesh.indices) {
+				serializedVertex += br.EncodeBinary(indice);
+			}
+		}
+
+		const auto& bm = model.GetBoneMap();
+		serializedVertex += br.EncodeBinary(bm.size());
+		for (const auto& pair : bm) {
+			serializedVertex += br.EncodeBinary(pair.first.size());
+			for (char ch : pair.first) {
+				serializedVertex += br.EncodeBinary(ch);
+			}
+			serializedVertex += br.EncodeBinary(pair.second);
+		}
+
+		const auto& bim = model.GetBoneInfo();
+		serializedVertex += br.EncodeBinary(bim.size());
+		for (const BoneInfo& bi : bim) {
+			serializedVertex += br.EncodeBinary(bi.offsetMatrix);
+			serializedVertex += br.EncodeBinary(bi.finalTransformation);
+		}
+		return serializedVertex;
+	}
+
+	bool CompileMesh(const std::filesystem::path& input, const std::filesystem::path& output, std::string& error) {
+		Model model(input.string().c_str());
+		if (!model.GetError().empty()) {
+			error = model.GetError();
+			return false;
+		}
+
+		const std::string serialized = SerializeMesh(model);
+
+		std::ofstream file(output, std::ios::binary | std::ios::trunc);
+		file.write(serialized.data(), static_cast<std::streamsize>(serialized.size()));
+		if (!file) {
+			error = "Failed to write " + output.string();
+			return false;
+		}
+		return true;
+	}
+}
@@ -1 +1,30 @@
+/******************************************************************/
+/*!
+\file      MeshCompiler.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Mesh compiler core. Loads a model through Assimp and writes
+		   the .mesh layout R_Model reads, without needing a window or
+		   an OpenGL context.
+		   - SerializeMesh: Encodes the meshes, bone map and bone info.
+		   - CompileMesh: Loads the source and writes the .mesh file.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
 #pragma once
+
+#include <filesystem>
+#include <string>
+
+class Model;
+
+namespace meshcompiler {
+
+	std::string SerializeMesh(const Model& model);
+
+	bool CompileMesh(const std::filesystem::path& input, const std::filesystem::path& output, std::string& error);
+}
@@ -6,62 +6,10 @@ Mesh::Mesh(std::vector<Vertex> newVert, std::vector<unsigned int> newIndices)
 	:vertices{newVert}
 	,indices{newIndices}
 {
-    //set up mesh based on data
-    SetupMesh();
 }
 
-void Mesh::SetupMesh()
-{
-    // create buffers/arrays
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    glBindVertexArray(VAO);
-    // load data into vertex buffers
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    // A great thing about structs is that their memory layout is sequential for all its items.
-    // The effect is that we can simply pass a pointer to the struct and it translates perfectly to a glm::vec3/2 array which
-    // again translates to 3/2 floats which translates to a byte array
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-    // set the vertex attribute pointers
-    // vertex Positions
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-    // vertex normals
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
-    // vertex texture coords
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
-    // vertex tangent
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
-    // vertex bitangent
-    glEnableVertexAttribArray(4);
-    glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Bitangent));
-    // ids
-    glEnableVertexAttribArray(5);
-    glVertexAttribIPointer(5, 4, GL_INT, sizeof(Vertex), (void*)offsetof(Vertex, m_BoneIDs));
-
-    // weights
-    glEnableVertexAttribArray(6);
-    glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, m_Weights));
-    glBindVertexArray(0);
-}
-
-
-
-
-
-
-
-
 //Process meshes
-Mesh Model::ProcessMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4& transform) {
+Mesh Model::ProcessMesh(aiMesh* mesh, const aiScene* /*scene*/, const aiMatrix4x4& transform) {
     std::vector<Vertex> vertices;
     std::vector<unsigned int> indices;
     const aiMatrix3x3 transform3x3 = aiMatrix3x3(transform);
@@ -109,7 +57,7 @@ Mesh Model::ProcessMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4& t
         else
             vertex.TexCoords = glm::vec2(0.0f, 0.0f);
 
-            vertices.push_back(vertex);
+        vertices.push_back(vertex);
     }
     // process indices
     for (unsigned int i = 0; i < mesh->mNumFaces; i++)
@@ -119,7 +67,7 @@ Mesh Model::ProcessMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4& t
             indices.push_back(face.mIndices[j]);
     } 
     // process materials
-    aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
+    //aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
 
     // 1. diffuse maps
     //std:: vector<Texture> diffuseMaps = LoadMaterialTextures(material, aiTextureType_DIFFUSE, DIFFUSE);
@@ -136,10 +84,8 @@ Mesh Model::ProcessMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4& t
     //std::vector<Texture> roughnessMaps = LoadMaterialTextures("roughness.jpg", ROUGHNESS);
     //textures.insert(textures.end(), roughnessMaps.begin(), roughnessMaps.end());
 
-    std::cout << "BONES LOADED BEFORE" << bones_loaded.size() << std::endl;
     // Extract bones and weights here
     ExtractBoneWeights(mesh, vertices);
-    std::cout <<  "BONES LOADED AT THE END" << bones_loaded.size() << std::endl;
     // return a mesh object created from the extracted mesh data
     return Mesh(vertices, indices);
 }
@@ -147,7 +93,6 @@ Mesh Model::ProcessMesh(aiMesh* mesh, const aiScene* scene, const aiMatrix4x4& t
 //Process all nodes of the mesh
 void Model::ProcessNode(aiNode* node, const aiScene* scene, const aiMatrix4x4& transform)
 {
-    std::cout << "BONES LOADED BEFORE BEFORE" << bones_loaded.size() << std::endl;
     const aiMatrix4x4 accTransform = transform * node->mTransformation ;
     // process all the node's meshes (if any)
     for (unsigned int i = 0; i < node->mNumMeshes; i++)
@@ -183,7 +128,6 @@ void Model::ExtractBoneWeights(aiMesh* mesh, std::vector<Vertex>& vertices)
             v.m_Weights[i] = 0.0f;
         }
     }
-    std::cout << "Number of bones" << mesh->mNumBones << std::endl;
     for (unsigned int i = 0; i < mesh->mNumBones; i++)
     {
         std::string boneName = mesh->mBones[i]->mName.C_Str();
@@ -223,7 +167,6 @@ void Model::ExtractBoneWeights(aiMesh* mesh, std::vector<Vertex>& vertices)
         }
     }
 
-    std::cout << "BONES LOADED TOTAL: " << bones_loaded.size() << std::endl;
 
 
     for (auto& v : vertices)
@@ -259,14 +202,11 @@ void Model::LoadModel(std::string path)
 
     if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
     {
-        //std::cout << "ERROR::ASSIMP::" << import.GetErrorString() << std::endl;
-        std::cout<<"Error loading model: "<< import.GetErrorString() <<'\n';
+        loadError = std::string("Error loading model: ") + import.GetErrorString();
         return;
     }
     directory = path.substr(0, path.find_last_of('/'));
-    std::cout << "Bones..." << bones_loaded.size() << std::endl;
     ProcessNode(scene->mRootNode, scene, aiMatrix4x4{});
-    std::cout << "Loaded model" << '\n';
 }
 
 /*------------------------------------------------------------------------------------------*/
@@ -467,7 +407,7 @@ void Animator::Update(float dt, glm::mat4 parentTransform)
     }
 
     m_CurrentTime += m_CurrentAnimation->GetTicksPerSecond() * dt;
-    m_CurrentTime = fmod(m_CurrentTime, m_CurrentAnimation->GetDuration());
+    m_CurrentTime = std::fmod(m_CurrentTime, m_CurrentAnimation->GetDuration());
 
     CalculateBoneTransform(m_CurrentAnimation->GetRootNode(), parentTransform);
 }
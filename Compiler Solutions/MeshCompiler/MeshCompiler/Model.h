@@ -1,15 +1,16 @@
 #pragma once
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include <iostream>
 #define MAX_BONE_INFLUENCE 4
 
@@ -56,12 +57,6 @@ public:
     std::vector<unsigned int> indices;
 
     Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices);
-
-private:
-    //  render data
-    unsigned int VAO, VBO, EBO;
-
-    void SetupMesh();
 };
 
 class Animation
@@ -145,7 +140,7 @@ public:
     {
         LoadModel(path);
     }
-    Model(const char* path, int i) {
+    Model(const char* path, int) {
         LoadAnimations(path);
     }
 
@@ -153,6 +148,8 @@ public:
     const std::vector<BoneInfo>& GetBoneInfo() const { return bone_info; }
     const std::unordered_map<std::string, int>& GetBoneMap() const { return bones_loaded; }
     glm::mat4 GetGlobalInverse() const { return globalInverseTransform; }
+    //empty unless Assimp failed to read the file
+    const std::string& GetError() const { return loadError; }
 
     /// <summary>
     /// TEMPORARY HERE
@@ -167,6 +164,7 @@ private:
     std::vector<BoneInfo> bone_info{}; // Only contains the matrices of the bones not the bone itself
     // model data    
     std::string directory;
+    std::string loadError;
 
     //For animation purposes
     glm::mat4 globalInverseTransform{ 1.f };
@@ -0,0 +1,633 @@
+/******************************************************************/
+/*!
+\file      BlockCompression.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the BC1/BC3/BC4/BC5/BC7 block encoders and
+		   decoders.
+
+		   Endpoints are fitted along the principal axis of the block,
+		   quantized, and refined once with a least squares solve over the
+		   chosen indices. Every step is deterministic so the same input
+		   always produces the same bytes regardless of thread count.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace bc {
+
+	namespace {
+
+		constexpr int PIXELS = 16;
+
+		struct Vec4 {
+			float v[4]{};
+
+			float& operator[](size_t i) { return v[i]; }
+			float operator[](size_t i) const { return v[i]; }
+		};
+
+		inline int Clamp(int value, int low, int high) {
+			return std::min(std::max(value, low), high);
+		}
+
+		/******************************************************************/
+		/*!
+		\fn      FitPrincipalAxis
+		\brief   Finds the line through the block that best describes the
+				 first "channels" components and returns the two extreme
+				 points of the block projected onto that line.
+		*/
+		/******************************************************************/
+		void FitPrincipalAxis(const uint8_t* rgba, size_t channels, Vec4& low, Vec4& high) {
+			Vec4 mean;
+			for (int i = 0; i < PIXELS; ++i) {
+				for (size_t c = 0; c < channels; ++c) {
+					mean[c] += rgba[i * 4 + c];
+				}
+			}
+			for (size_t c = 0; c < channels; ++c) {
+				mean[c] /= PIXELS;
+			}
+
+			float covariance[4][4]{};
+			for (int i = 0; i < PIXELS; ++i) {
+				for (size_t a = 0; a < channels; ++a) {
+					float da = rgba[i * 4 + a] - mean[a];
+					for (size_t b = a; b < channels; ++b) {
+						covariance[a][b] += da * (rgba[i * 4 + b] - mean[b]);
+					}
+				}
+			}
+			for (size_t a = 0; a < channels; ++a) {
+				for (size_t b = 0; b < a; ++b) {
+					covariance[a][b] = covariance[b][a];
+				}
+			}
+
+			//power iteration, seeded with the bounding box diagonal
+			Vec4 axis;
+			for (size_t c = 0; c < channels; ++c) {
+				uint8_t lo = 255, hi = 0;
+				for (int i = 0; i < PIXELS; ++i) {
+					lo = std::min(lo, rgba[i * 4 + c]);
+					hi = std::max(hi, rgba[i * 4 + c]);
+				}
+				axis[c] = static_cast<float>(hi - lo);
+			}
+
+			for (int iteration = 0; iteration < 8; ++iteration) {
+				Vec4 next;
+				for (size_t a = 0; a < channels; ++a) {
+					for (size_t b = 0; b < channels; ++b) {
+						next[a] += covariance[a][b] * axis[b];
+					}
+				}
+				float length = 0.f;
+				for (size_t c = 0; c < channels; ++c) {
+					length = std::max(length, std::fabs(next[c]));
+				}
+				if (length < 1e-6f) break;
+				for (size_t c = 0; c < channels; ++c) {
+					axis[c] = next[c] / length;
+				}
+			}
+
+			float lengthSq = 0.f;
+			for (size_t c = 0; c < channels; ++c) {
+				lengthSq += axis[c] * axis[c];
+			}
+
+			if (lengthSq < 1e-6f) {
+				//flat block
+				low = mean;
+				high = mean;
+				return;
+			}
+
+			float tMin = std::numeric_limits<float>::max();
+			float tMax = std::numeric_limits<float>::lowest();
+			for (int i = 0; i < PIXELS; ++i) {
+				float t = 0.f;
+				for (size_t c = 0; c < channels; ++c) {
+					t += (rgba[i * 4 + c] - mean[c]) * axis[c];
+				}
+				t /= lengthSq;
+				tMin = std::min(tMin, t);
+				tMax = std::max(tMax, t);
+			}
+
+			for (size_t c = 0; c < channels; ++c) {
+				low[c] = mean[c] + axis[c] * tMin;
+				high[c] = mean[c] + axis[c] * tMax;
+			}
+		}
+
+		/******************************************************************/
+		/*!
+		\fn      SolveEndpoints
+		\brief   Least squares fit of two endpoints given the interpolation
+				 weight (towards the second endpoint) of every pixel.
+		\return  false if the system is singular
+		*/
+		/******************************************************************/
+		bool SolveEndpoints(const uint8_t* rgba, size_t channels, const float* weights, const bool* mask, Vec4& e0, Vec4& e1) {
+			float a = 0.f, b = 0.f, c = 0.f;
+			Vec4 x0, x1;
+			for (int i = 0; i < PIXELS; ++i) {
+				if (mask && !mask[i]) continue;
+				float w = weights[i];
+				float iw = 1.f - w;
+				a += iw * iw;
+				b += iw * w;
+				c += w * w;
+				for (size_t ch = 0; ch < channels; ++ch) {
+					x0[ch] += iw * rgba[i * 4 + ch];
+					x1[ch] += w * rgba[i * 4 + ch];
+				}
+			}
+
+			float det = a * c - b * b;
+			if (std::fabs(det) < 1e-6f) return false;
+
+			for (size_t ch = 0; ch < channels; ++ch) {
+				e0[ch] = (c * x0[ch] - b * x1[ch]) / det;
+				e1[ch] = (a * x1[ch] - b * x0[ch]) / det;
+			}
+			return true;
+		}
+
+		/**************************************BC1*****************************************/
+
+		inline uint16_t PackRGB565(const Vec4& color) {
+			int r = Clamp(static_cast<int>(std::lround(color[0] * 31.f / 255.f)), 0, 31);
+			int g = Clamp(static_cast<int>(std::lround(color[1] * 63.f / 255.f)), 0, 63);
+			int b = Clamp(static_cast<int>(std::lround(color[2] * 31.f / 255.f)), 0, 31);
+			return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+		}
+
+		inline std::array<int, 3> UnpackRGB565(uint16_t packed) {
+			int r = (packed >> 11) & 31;
+			int g = (packed >> 5) & 63;
+			int b = packed & 31;
+			return { (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2) };
+		}
+
+		//builds the 4 entry palette exactly as the decoder does
+		void BuildBC1Palette(uint16_t c0, uint16_t c1, int palette[4][4]) {
+			auto a = UnpackRGB565(c0);
+			auto b = UnpackRGB565(c1);
+			for (int ch = 0; ch < 3; ++ch) {
+				palette[0][ch] = a[ch];
+				palette[1][ch] = b[ch];
+				if (c0 > c1) {
+					palette[2][ch] = (2 * a[ch] + b[ch]) / 3;
+					palette[3][ch] = (a[ch] + 2 * b[ch]) / 3;
+				}
+				else {
+					palette[2][ch] = (a[ch] + b[ch]) / 2;
+					palette[3][ch] = 0;
+				}
+			}
+			palette[0][3] = palette[1][3] = palette[2][3] = 255;
+			palette[3][3] = (c0 > c1) ? 255 : 0;
+		}
+
+		//returns total squared error, fills the 2 bit indices
+		int SelectBC1Indices(const uint8_t* rgba, uint16_t c0, uint16_t c1, const bool* transparent, uint8_t* indices) {
+			int palette[4][4];
+			BuildBC1Palette(c0, c1, palette);
+			const int usable = (c0 > c1) ? 4 : 3;
+
+			int totalError = 0;
+			for (int i = 0; i < PIXELS; ++i) {
+				if (transparent && transparent[i]) {
+					indices[i] = 3;
+					continue;
+				}
+				int bestError = std::numeric_limits<int>::max();
+				uint8_t best = 0;
+				for (int p = 0; p < usable; ++p) {
+					int dr = rgba[i * 4 + 0] - palette[p][0];
+					int dg = rgba[i * 4 + 1] - palette[p][1];
+					int db = rgba[i * 4 + 2] - palette[p][2];
+					int error = dr * dr + dg * dg + db * db;
+					if (error < bestError) {
+						bestError = error;
+						best = static_cast<uint8_t>(p);
+					}
+				}
+				indices[i] = best;
+				totalError += bestError;
+			}
+			return totalError;
+		}
+
+		void WriteBC1(uint16_t c0, uint16_t c1, const uint8_t* indices, uint8_t* block) {
+			block[0] = static_cast<uint8_t>(c0 & 0xFF);
+			block[1] = static_cast<uint8_t>(c0 >> 8);
+			block[2] = static_cast<uint8_t>(c1 & 0xFF);
+			block[3] = static_cast<uint8_t>(c1 >> 8);
+			uint32_t bits = 0;
+			for (int i = 0; i < PIXELS; ++i) {
+				bits |= static_cast<uint32_t>(indices[i]) << (i * 2);
+			}
+			std::memcpy(block + 4, &bits, sizeof(bits));
+		}
+
+		/**************************************BC7*****************************************/
+
+		constexpr int BC7_WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		struct BitWriter {
+			uint8_t* data;
+			int position = 0;
+
+			void Write(uint32_t value, int count) {
+				for (int i = 0; i < count; ++i) {
+					if (value & (1u << i)) {
+						data[position >> 3] |= static_cast<uint8_t>(1u << (position & 7));
+					}
+					++position;
+				}
+			}
+		};
+
+		struct BitReader {
+			const uint8_t* data;
+			int position = 0;
+
+			uint32_t Read(int count) {
+				uint32_t value = 0;
+				for (int i = 0; i < count; ++i) {
+					if (data[position >> 3] & (1u << (position & 7))) {
+						value |= 1u << i;
+					}
+					++position;
+				}
+				return value;
+			}
+		};
+
+		struct BC7Endpoint {
+			int quantized[4]{}; //7 bits per channel
+			int pbit{};
+
+			int Expanded(size_t channel) const {
+				return (quantized[channel] << 1) | pbit;
+			}
+		};
+
+		BC7Endpoint QuantizeBC7(const Vec4& color, int pbit) {
+			BC7Endpoint endpoint;
+			endpoint.pbit = pbit;
+			for (size_t ch = 0; ch < 4; ++ch) {
+				endpoint.quantized[ch] = Clamp(static_cast<int>(std::lround((color[ch] - static_cast<float>(pbit)) * 0.5f)), 0, 127);
+			}
+			return endpoint;
+		}
+
+		int SelectBC7Indices(const uint8_t* rgba, const BC7Endpoint& e0, const BC7Endpoint& e1, uint8_t* indices) {
+			int palette[16][4];
+			for (int p = 0; p < 16; ++p) {
+				for (size_t ch = 0; ch < 4; ++ch) {
+					palette[p][ch] = ((64 - BC7_WEIGHTS[p]) * e0.Expanded(ch) + BC7_WEIGHTS[p] * e1.Expanded(ch) + 32) >> 6;
+				}
+			}
+
+			int totalError = 0;
+			for (int i = 0; i < PIXELS; ++i) {
+				int bestError = std::numeric_limits<int>::max();
+				uint8_t best = 0;
+				for (int p = 0; p < 16; ++p) {
+					int error = 0;
+					for (size_t ch = 0; ch < 4; ++ch) {
+						int d = rgba[i * 4 + ch] - palette[p][ch];
+						error += d * d;
+					}
+					if (error < bestError) {
+						bestError = error;
+						best = static_cast<uint8_t>(p);
+					}
+				}
+				indices[i] = best;
+				totalError += bestError;
+			}
+			return totalError;
+		}
+
+		//tries all four p-bit combinations and keeps the best
+		int FitBC7(const uint8_t* rgba, const Vec4& low, const Vec4& high, BC7Endpoint& e0, BC7Endpoint& e1, uint8_t* indices) {
+			int bestError = std::numeric_limits<int>::max();
+			for (int p0 = 0; p0 < 2; ++p0) {
+				for (int p1 = 0; p1 < 2; ++p1) {
+					BC7Endpoint q0 = QuantizeBC7(low, p0);
+					BC7Endpoint q1 = QuantizeBC7(high, p1);
+					uint8_t candidate[PIXELS];
+					int error = SelectBC7Indices(rgba, q0, q1, candidate);
+					if (error < bestError) {
+						bestError = error;
+						e0 = q0;
+						e1 = q1;
+						std::memcpy(indices, candidate, PIXELS);
+					}
+				}
+			}
+			return bestError;
+		}
+	}
+
+	void EncodeBC1(const uint8_t* rgba, uint8_t* block, bool allowPunchThrough) {
+		bool transparent[PIXELS]{};
+		bool hasTransparent = false;
+		if (allowPunchThrough) {
+			for (int i = 0; i < PIXELS; ++i) {
+				transparent[i] = rgba[i * 4 + 3] < 128;
+				hasTransparent = hasTransparent || transparent[i];
+			}
+		}
+
+		if (hasTransparent) {
+			//3 color mode, fit against the opaque pixels only
+			bool allTransparent = std::all_of(std::begin(transparent), std::end(transparent), [](bool t) { return t; });
+			uint8_t opaque[PIXELS * 4];
+			int count = 0;
+			for (int i = 0; i < PIXELS; ++i) {
+				if (!transparent[i]) {
+					std::memcpy(opaque + count * 4, rgba + i * 4, 4);
+					++count;
+				}
+			}
+			//pad with the first opaque pixel so the axis fit sees 16 pixels
+			for (int i = count; i < PIXELS; ++i) {
+				std::memcpy(opaque + i * 4, allTransparent ? rgba : opaque, 4);
+			}
+
+			Vec4 low, high;
+			FitPrincipalAxis(opaque, 3, low, high);
+			uint16_t c0 = PackRGB565(low);
+			uint16_t c1 = PackRGB565(high);
+			if (c0 > c1) std::swap(c0, c1);
+
+			uint8_t indices[PIXELS];
+			SelectBC1Indices(rgba, c0, c1, transparent, indices);
+			WriteBC1(c0, c1, indices, block);
+			return;
+		}
+
+		Vec4 low, high;
+		FitPrincipalAxis(rgba, 3, low, high);
+
+		uint16_t c0 = PackRGB565(high);
+		uint16_t c1 = PackRGB565(low);
+		uint8_t indices[PIXELS];
+		int error = SelectBC1Indices(rgba, std::max(c0, c1), std::min(c0, c1), nullptr, indices);
+		if (c0 < c1) std::swap(c0, c1);
+
+		//refine once against the selected indices
+		if (c0 != c1) {
+			constexpr float weightOf[4] = { 0.f, 1.f, 1.f / 3.f, 2.f / 3.f };
+			float weights[PIXELS];
+			for (int i = 0; i < PIXELS; ++i) {
+				weights[i] = weightOf[indices[i]];
+			}
+			Vec4 e0, e1;
+			if (SolveEndpoints(rgba, 3, weights, nullptr, e0, e1)) {
+				uint16_t r0 = PackRGB565(e0);
+				uint16_t r1 = PackRGB565(e1);
+				if (r0 != r1) {
+					if (r0 < r1) std::swap(r0, r1);
+					uint8_t refined[PIXELS];
+					int refinedError = SelectBC1Indices(rgba, r0, r1, nullptr, refined);
+					if (refinedError < error) {
+						c0 = r0;
+						c1 = r1;
+						std::memcpy(indices, refined, PIXELS);
+					}
+				}
+			}
+		}
+
+		if (c0 == c1) {
+			//solid block, c0 == c1 decodes as 3 color mode so index 0 is exact
+			std::fill(std::begin(indices), std::end(indices), uint8_t{ 0 });
+		}
+
+		WriteBC1(c0, c1, indices, block);
+	}
+
+	void EncodeBC4(const uint8_t* rgba, size_t channel, uint8_t* block) {
+		int low = 255, high = 0;
+		for (int i = 0; i < PIXELS; ++i) {
+			low = std::min(low, static_cast<int>(rgba[i * 4 + channel]));
+			high = std::max(high, static_cast<int>(rgba[i * 4 + channel]));
+		}
+
+		std::memset(block, 0, 8);
+		block[0] = static_cast<uint8_t>(high);
+		block[1] = static_cast<uint8_t>(low);
+		if (high == low) return;
+
+		//8 value mode, endpoint 0 > endpoint 1
+		int palette[8];
+		palette[0] = high;
+		palette[1] = low;
+		for (int p = 1; p < 7; ++p) {
+			palette[p + 1] = ((7 - p) * high + p * low) / 7;
+		}
+
+		uint64_t bits = 0;
+		for (int i = 0; i < PIXELS; ++i) {
+			int value = rgba[i * 4 + channel];
+			int bestError = std::numeric_limits<int>::max();
+			uint64_t best = 0;
+			for (int p = 0; p < 8; ++p) {
+				int error = std::abs(value - palette[p]);
+				if (error < bestError) {
+					bestError = error;
+					best = static_cast<uint64_t>(p);
+				}
+			}
+			bits |= best << (i * 3);
+		}
+
+		for (int b = 0; b < 6; ++b) {
+			block[2 + b] = static_cast<uint8_t>((bits >> (b * 8)) & 0xFF);
+		}
+	}
+
+	void EncodeBC3(const uint8_t* rgba, uint8_t* block) {
+		EncodeBC4(rgba, 3, block);
+		EncodeBC1(rgba, block + 8, false);
+	}
+
+	void EncodeBC5(const uint8_t* rgba, uint8_t* block) {
+		EncodeBC4(rgba, 0, block);
+		EncodeBC4(rgba, 1, block + 8);
+	}
+
+	void EncodeBC7(const uint8_t* rgba, uint8_t* block) {
+		Vec4 low, high;
+		FitPrincipalAxis(rgba, 4, low, high);
+
+		BC7Endpoint e0, e1;
+		uint8_t indices[PIXELS];
+		int error = FitBC7(rgba, low, high, e0, e1, indices);
+
+		//refine once against the selected indices
+		if (error > 0) {
+			float weights[PIXELS];
+			for (int i = 0; i < PIXELS; ++i) {
+				weights[i] = static_cast<float>(BC7_WEIGHTS[indices[i]]) / 64.f;
+			}
+			Vec4 r0, r1;
+			if (SolveEndpoints(rgba, 4, weights, nullptr, r0, r1)) {
+				for (size_t ch = 0; ch < 4; ++ch) {
+					r0[ch] = std::clamp(r0[ch], 0.f, 255.f);
+					r1[ch] = std::clamp(r1[ch], 0.f, 255.f);
+				}
+				BC7Endpoint q0, q1;
+				uint8_t refined[PIXELS];
+				int refinedError = FitBC7(rgba, r0, r1, q0, q1, refined);
+				if (refinedError < error) {
+					e0 = q0;
+					e1 = q1;
+					std::memcpy(indices, refined, PIXELS);
+				}
+			}
+		}
+
+		//anchor index must have its top bit clear
+		if (indices[0] & 0x8) {
+			std::swap(e0, e1);
+			for (int i = 0; i < PIXELS; ++i) {
+				indices[i] = static_cast<uint8_t>(15 - indices[i]);
+			}
+		}
+
+		std::memset(block, 0, 16);
+		BitWriter writer{ block };
+		writer.Write(1u << 6, 7); //mode 6
+		for (size_t ch = 0; ch < 4; ++ch) {
+			writer.Write(static_cast<uint32_t>(e0.quantized[ch]), 7);
+			writer.Write(static_cast<uint32_t>(e1.quantized[ch]), 7);
+		}
+		writer.Write(static_cast<uint32_t>(e0.pbit), 1);
+		writer.Write(static_cast<uint32_t>(e1.pbit), 1);
+		writer.Write(indices[0], 3);
+		for (int i = 1; i < PIXELS; ++i) {
+			writer.Write(indices[i], 4);
+		}
+	}
+
+	void EncodeBlock(Format format, const uint8_t* rgba, uint8_t* block) {
+		switch (format) {
+		case Format::BC1: EncodeBC1(rgba, block); break;
+		case Format::BC3: EncodeBC3(rgba, block); break;
+		case Format::BC5: EncodeBC5(rgba, block); break;
+		case Format::BC7: EncodeBC7(rgba, block); break;
+		}
+	}
+
+	void DecodeBC1(const uint8_t* block, uint8_t* rgba) {
+		uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+		uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+		int palette[4][4];
+		BuildBC1Palette(c0, c1, palette);
+
+		uint32_t bits;
+		std::memcpy(&bits, block + 4, sizeof(bits));
+		for (int i = 0; i < PIXELS; ++i) {
+			int index = (bits >> (i * 2)) & 3;
+			for (int ch = 0; ch < 4; ++ch) {
+				rgba[i * 4 + ch] = static_cast<uint8_t>(palette[index][ch]);
+			}
+		}
+	}
+
+	void DecodeBC4(const uint8_t* block, size_t channel, uint8_t* rgba) {
+		int e0 = block[0];
+		int e1 = block[1];
+		int palette[8];
+		palette[0] = e0;
+		palette[1] = e1;
+		if (e0 > e1) {
+			for (int p = 1; p < 7; ++p) {
+				palette[p + 1] = ((7 - p) * e0 + p * e1) / 7;
+			}
+		}
+		else {
+			for (int p = 1; p < 5; ++p) {
+				palette[p + 1] = ((5 - p) * e0 + p * e1) / 5;
+			}
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+
+		uint64_t bits = 0;
+		for (int b = 0; b < 6; ++b) {
+			bits |= static_cast<uint64_t>(block[2 + b]) << (b * 8);
+		}
+		for (int i = 0; i < PIXELS; ++i) {
+			rgba[i * 4 + channel] = static_cast<uint8_t>(palette[(bits >> (i * 3)) & 7]);
+		}
+	}
+
+	void DecodeBC3(const uint8_t* block, uint8_t* rgba) {
+		DecodeBC1(block + 8, rgba);
+		DecodeBC4(block, 3, rgba);
+	}
+
+	void DecodeBC5(const uint8_t* block, uint8_t* rgba) {
+		DecodeBC4(block, 0, rgba);
+		DecodeBC4(block + 8, 1, rgba);
+		for (int i = 0; i < PIXELS; ++i) {
+			rgba[i * 4 + 2] = 0;
+			rgba[i * 4 + 3] = 255;
+		}
+	}
+
+	void DecodeBC7(const uint8_t* block, uint8_t* rgba) {
+		BitReader reader{ block };
+		if (reader.Read(7) != (1u << 6)) {
+			//only mode 6 is produced by the encoder
+			std::memset(rgba, 0, PIXELS * 4);
+			return;
+		}
+
+		BC7Endpoint e0, e1;
+		for (size_t ch = 0; ch < 4; ++ch) {
+			e0.quantized[ch] = static_cast<int>(reader.Read(7));
+			e1.quantized[ch] = static_cast<int>(reader.Read(7));
+		}
+		e0.pbit = static_cast<int>(reader.Read(1));
+		e1.pbit = static_cast<int>(reader.Read(1));
+
+		for (int i = 0; i < PIXELS; ++i) {
+			int index = static_cast<int>(reader.Read(i == 0 ? 3 : 4));
+			for (size_t ch = 0; ch < 4; ++ch) {
+				rgba[i * 4 + ch] = static_cast<uint8_t>(((64 - BC7_WEIGHTS[index]) * e0.Expanded(ch) + BC7_WEIGHTS[index] * e1.Expanded(ch) + 32) >> 6);
+			}
+		}
+	}
+
+	void DecodeBlock(Format format, const uint8_t* block, uint8_t* rgba) {
+		switch (format) {
+		case Format::BC1: DecodeBC1(block, rgba); break;
+		case Format::BC3: DecodeBC3(block, rgba); break;
+		case Format::BC5: DecodeBC5(block, rgba); break;
+		case Format::BC7: DecodeBC7(block, rgba); break;
+		}
+	}
+}
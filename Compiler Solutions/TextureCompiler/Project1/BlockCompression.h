@@ -0,0 +1,58 @@
+/******************************************************************/
+/*!
+\file      BlockCompression.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Block compression encoders and decoders used by the texture
+		   compiler. Every encoder works on a single 4x4 block of RGBA8
+		   pixels (64 bytes, row major) and writes the packed block.
+		   - BC1: RGB 5:6:5 endpoints, 2 bit indices, 1 bit alpha
+		   - BC3: BC1 color + BC4 alpha
+		   - BC4: single channel, 3 bit indices
+		   - BC5: two BC4 blocks (red, green) for normal maps
+		   - BC7: mode 6 (RGBA 7.7.7.7 + p-bit, 4 bit indices)
+
+		   The decoders mirror the encoders and are used to validate the
+		   output without a GPU.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace bc {
+
+	enum class Format {
+		BC1,
+		BC3,
+		BC5,
+		BC7
+	};
+
+	//bytes taken by one 4x4 block
+	constexpr size_t BlockSize(Format format) {
+		return (format == Format::BC1) ? 8 : 16;
+	}
+
+	void EncodeBC1(const uint8_t* rgba, uint8_t* block, bool allowPunchThrough = true);
+	void EncodeBC3(const uint8_t* rgba, uint8_t* block);
+	void EncodeBC4(const uint8_t* rgba, size_t channel, uint8_t* block);
+	void EncodeBC5(const uint8_t* rgba, uint8_t* block);
+	void EncodeBC7(const uint8_t* rgba, uint8_t* block);
+
+	void EncodeBlock(Format format, const uint8_t* rgba, uint8_t* block);
+
+	void DecodeBC1(const uint8_t* block, uint8_t* rgba);
+	void DecodeBC3(const uint8_t* block, uint8_t* rgba);
+	void DecodeBC4(const uint8_t* block, size_t channel, uint8_t* rgba);
+	void DecodeBC5(const uint8_t* block, uint8_t* rgba);
+	void DecodeBC7(const uint8_t* block, uint8_t* rgba);
+
+	void DecodeBlock(Format format, const uint8_t* block, uint8_t* rgba);
+}
@@ -0,0 +1,477 @@
+/******************************************************************/
+/*!
+\file      TextureCompiler.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the native texture compiler pipeline.
+
+		   Filtering (resize and mip generation) is done in linear space so
+		   sRGB textures do not darken towards the smaller mips. Encoding is
+		   split across threads by rows of blocks; every block is encoded
+		   independently so the output does not depend on the thread count.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "TextureCompiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <RAPIDJSON/document.h>
+
+//static so the engine's own stb_image (R_Texture.cpp) does not clash when linked together
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include <STB_IMAGE/stb_image.h>
+
+namespace texturecompiler {
+
+	namespace {
+
+		//DDS constants
+		constexpr uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+		constexpr uint32_t DDSD_CAPS = 0x1;
+		constexpr uint32_t DDSD_HEIGHT = 0x2;
+		constexpr uint32_t DDSD_WIDTH = 0x4;
+		constexpr uint32_t DDSD_PIXELFORMAT = 0x1000;
+		constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+		constexpr uint32_t DDSD_LINEARSIZE = 0x80000;
+		constexpr uint32_t DDPF_FOURCC = 0x4;
+		constexpr uint32_t DDSCAPS_COMPLEX = 0x8;
+		constexpr uint32_t DDSCAPS_TEXTURE = 0x1000;
+		constexpr uint32_t DDSCAPS_MIPMAP = 0x400000;
+		constexpr uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+		constexpr uint32_t DXGI_FORMAT_BC5_UNORM = 83;
+		constexpr uint32_t DXGI_FORMAT_BC7_UNORM = 98;
+
+		constexpr uint32_t MakeFourCC(char a, char b, char c, char d) {
+			return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+		}
+
+		float SRGBToLinear(float value) {
+			return (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+		}
+
+		float LinearToSRGB(float value) {
+			return (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+		}
+
+		const std::array<float, 256>& SRGBTable() {
+			static const std::array<float, 256> table = [] {
+				std::array<float, 256> t{};
+				for (size_t i = 0; i < t.size(); ++i) {
+					t[i] = SRGBToLinear(static_cast<float>(i) / 255.f);
+				}
+				return t;
+				}();
+			return table;
+		}
+
+		//BC5 stores vectors, never gamma convert it
+		bool InputIsSRGB(const Settings& settings) {
+			if (settings.Compression == TC_BC5) return false;
+			return settings.ColorSpace == CS_SRGB || settings.ColorSpace == CS_SRGBI;
+		}
+
+		bool OutputIsSRGB(const Settings& settings) {
+			if (settings.Compression == TC_BC5) return false;
+			return settings.ColorSpace == CS_SRGB || settings.ColorSpace == CS_SRGBO;
+		}
+
+		int Address(int index, int size, WrapMode wrap) {
+			if (wrap == WRAP_MIRROR) {
+				int period = size * 2;
+				int m = index % period;
+				if (m < 0) m += period;
+				return (m < size) ? m : period - 1 - m;
+			}
+			return std::clamp(index, 0, size - 1);
+		}
+
+		struct Tap {
+			int index;
+			float weight;
+		};
+
+		//triangle filter taps for one axis, widens with the minification ratio
+		std::vector<std::vector<Tap>> BuildTaps(int sourceSize, int targetSize, WrapMode wrap) {
+			std::vector<std::vector<Tap>> taps(static_cast<size_t>(targetSize));
+			const float scale = static_cast<float>(sourceSize) / static_cast<float>(targetSize);
+			const float radius = std::max(1.f, scale);
+
+			for (int x = 0; x < targetSize; ++x) {
+				float center = (static_cast<float>(x) + 0.5f) * scale - 0.5f;
+				int first = static_cast<int>(std::floor(center - radius));
+				int last = static_cast<int>(std::ceil(center + radius));
+
+				float total = 0.f;
+				auto& list = taps[static_cast<size_t>(x)];
+				for (int s = first; s <= last; ++s) {
+					float weight = 1.f - std::fabs(static_cast<float>(s) - center) / radius;
+					if (weight <= 0.f) continue;
+					list.push_back({ Address(s, sourceSize, wrap), weight });
+					total += weight;
+				}
+				for (auto& tap : list) {
+					tap.weight /= total;
+				}
+			}
+			return taps;
+		}
+
+		void GatherBlock(const Surface& surface, int blockX, int blockY, uint8_t* rgba) {
+			for (int y = 0; y < 4; ++y) {
+				//replicate the edge for partial blocks
+				int sy = std::min(blockY * 4 + y, surface.height - 1);
+				for (int x = 0; x < 4; ++x) {
+					int sx = std::min(blockX * 4 + x, surface.width - 1);
+					std::memcpy(rgba + (y * 4 + x) * 4, surface.data.data() + (static_cast<size_t>(sy) * surface.width + sx) * 4, 4);
+				}
+			}
+		}
+
+		template <typename Function>
+		void ParallelRows(int rows, unsigned int threadCount, Function&& function) {
+			if (threadCount == 0) {
+				threadCount = std::max(1u, std::thread::hardware_concurrency());
+			}
+			threadCount = std::min(threadCount, static_cast<unsigned int>(std::max(rows, 1)));
+
+			if (threadCount <= 1) {
+				function(0, rows);
+				return;
+			}
+
+			std::vector<std::thread> workers;
+			workers.reserve(threadCount);
+			for (unsigned int t = 0; t < threadCount; ++t) {
+				int begin = static_cast<int>(static_cast<long long>(rows) * t / threadCount);
+				int end = static_cast<int>(static_cast<long long>(rows) * (t + 1) / threadCount);
+				workers.emplace_back([&function, begin, end]() { function(begin, end); });
+			}
+			for (auto& worker : workers) {
+				worker.join();
+			}
+		}
+
+		void WriteU32(std::vector<uint8_t>& out, uint32_t value) {
+			for (int i = 0; i < 4; ++i) {
+				out.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+			}
+		}
+	}
+
+	bc::Format ToBlockFormat(TextureCompression compression) {
+		switch (compression) {
+		case TC_BC1: return bc::Format::BC1;
+		case TC_BC5: return bc::Format::BC5;
+		case TC_BC7: return bc::Format::BC7;
+		case TC_BC3:
+		default: return bc::Format::BC3;
+		}
+	}
+
+	Settings ReadSettings(const std::filesystem::path& metaPath) {
+		Settings settings;
+
+		std::ifstream ifs(metaPath);
+		if (!ifs.is_open()) {
+			return settings;
+		}
+		std::stringstream buffer;
+		buffer << ifs.rdbuf();
+		std::string jsonStr = buffer.str();
+
+		rapidjson::Document doc;
+		doc.Parse(jsonStr.c_str());
+		if (doc.HasParseError() || !doc.IsArray()) {
+			return settings;
+		}
+
+		for (rapidjson::SizeType i = 0; i < doc.Size(); ++i) {
+			const auto& entry = doc[i];
+			if (!entry.IsObject() || !entry.HasMember("TextureCompilerData")) continue;
+
+			const auto& data = entry["TextureCompilerData"];
+			auto readBool = [&](const char* key, bool& value) {
+				if (data.HasMember(key) && data[key].IsBool()) value = data[key].GetBool();
+				};
+			auto readFloat = [&](const char* key, float& value) {
+				if (data.HasMember(key) && data[key].IsNumber()) value = static_cast<float>(data[key].GetDouble());
+				};
+			auto readInt = [&](const char* key, int& value) {
+				if (data.HasMember(key) && data[key].IsInt()) value = data[key].GetInt();
+				};
+
+			int wrap = settings.Wrap, colorSpace = settings.ColorSpace, compression = settings.Compression;
+			readBool("HoriztonalFlip", settings.HoriztonalFlip);
+			readBool("VerticalFlip", settings.VerticalFlip);
+			readFloat("Width", settings.Width);
+			readFloat("Height", settings.Height);
+			readInt("MipLevels", settings.MipLevels);
+			readInt("Wrap", wrap);
+			readInt("ColorSpace", colorSpace);
+			readInt("Compression", compression);
+
+			settings.Wrap = static_cast<WrapMode>(std::clamp(wrap, 0, static_cast<int>(WRAP_MIRROR)));
+			settings.ColorSpace = static_cast<ColorFormat>(std::clamp(colorSpace, 0, static_cast<int>(CS_SRGBO)));
+			settings.Compression = static_cast<TextureCompression>(std::clamp(compression, 0, static_cast<int>(TC_BC7)));
+			settings.MipLevels = std::max(settings.MipLevels, 0);
+			break;
+		}
+
+		return settings;
+	}
+
+	bool LoadImageFile(const std::filesystem::path& path, const Settings& settings, Image& image) {
+		int width{}, height{}, channels{};
+		unsigned char* data = stbi_load(path.string().c_str(), &width, &height, &channels, 4);
+		if (!data) {
+			return false;
+		}
+
+		image.width = width;
+		image.height = height;
+		image.pixels.resize(static_cast<size_t>(width) * height * 4);
+
+		const bool srgb = InputIsSRGB(settings);
+		const auto& table = SRGBTable();
+		for (int y = 0; y < height; ++y) {
+			int sy = settings.VerticalFlip ? height - 1 - y : y;
+			for (int x = 0; x < width; ++x) {
+				int sx = settings.HoriztonalFlip ? width - 1 - x : x;
+				const unsigned char* src = data + (static_cast<size_t>(sy) * width + sx) * 4;
+				float* dst = image.pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+				for (int ch = 0; ch < 3; ++ch) {
+					dst[ch] = srgb ? table[src[ch]] : src[ch] / 255.f;
+				}
+				dst[3] = src[3] / 255.f;
+			}
+		}
+
+		stbi_image_free(data);
+		return true;
+	}
+
+	Image Resample(const Image& source, int width, int height, WrapMode wrap) {
+		if (width == source.width && height == source.height) {
+			return source;
+		}
+
+		//horizontal pass
+		Image horizontal;
+		horizontal.width = width;
+		horizontal.height = source.height;
+		horizontal.pixels.assign(static_cast<size_t>(width) * source.height * 4, 0.f);
+		{
+			auto taps = BuildTaps(source.width, width, wrap);
+			for (int y = 0; y < source.height; ++y) {
+				const float* row = source.pixels.data() + static_cast<size_t>(y) * source.width * 4;
+				float* out = horizontal.pixels.data() + static_cast<size_t>(y) * width * 4;
+				for (int x = 0; x < width; ++x) {
+					for (const Tap& tap : taps[static_cast<size_t>(x)]) {
+						for (int ch = 0; ch < 4; ++ch) {
+							out[x * 4 + ch] += row[tap.index * 4 + ch] * tap.weight;
+						}
+					}
+				}
+			}
+		}
+
+		//vertical pass
+		Image result;
+		result.width = width;
+		result.height = height;
+		result.pixels.assign(static_cast<size_t>(width) * height * 4, 0.f);
+		auto taps = BuildTaps(source.height, height, wrap);
+		for (int y = 0; y < height; ++y) {
+			float* out = result.pixels.data() + static_cast<size_t>(y) * width * 4;
+			for (const Tap& tap : taps[static_cast<size_t>(y)]) {
+				const float* row = horizontal.pixels.data() + static_cast<size_t>(tap.index) * width * 4;
+				for (int i = 0; i < width * 4; ++i) {
+					out[i] += row[i] * tap.weight;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	std::vector<Image> BuildMipChain(Image image, const Settings& settings) {
+		int width = settings.Width > 0.f ? static_cast<int>(settings.Width) : image.width;
+		int height = settings.Height > 0.f ? static_cast<int>(settings.Height) : image.height;
+		image = Resample(image, std::max(width, 1), std::max(height, 1), settings.Wrap);
+
+		int fullChain = 1;
+		for (int size = std::max(image.width, image.height); size > 1; size >>= 1) {
+			++fullChain;
+		}
+		int levels = settings.MipLevels == 0 ? fullChain : std::min(settings.MipLevels, fullChain);
+
+		std::vector<Image> chain;
+		chain.reserve(static_cast<size_t>(levels));
+		chain.push_back(std::move(image));
+		for (int level = 1; level < levels; ++level) {
+			const Image& previous = chain.back();
+			chain.push_back(Resample(previous, std::max(previous.width / 2, 1), std::max(previous.height / 2, 1), settings.Wrap));
+		}
+		return chain;
+	}
+
+	Surface ToRGBA8(const Image& image, bool encodeSRGB) {
+		Surface surface;
+		surface.width = image.width;
+		surface.height = image.height;
+		surface.data.resize(image.pixels.size());
+		for (size_t i = 0; i < image.pixels.size(); ++i) {
+			float value = std::clamp(image.pixels[i], 0.f, 1.f);
+			if (encodeSRGB && (i % 4) != 3) {
+				value = LinearToSRGB(value);
+			}
+			surface.data[i] = static_cast<uint8_t>(std::lround(value * 255.f));
+		}
+		return surface;
+	}
+
+	Surface EncodeSurface(const Surface& rgba8, bc::Format format, unsigned int threadCount) {
+		const int blocksX = (rgba8.width + 3) / 4;
+		const int blocksY = (rgba8.height + 3) / 4;
+		const size_t blockSize = bc::BlockSize(format);
+
+		Surface encoded;
+		encoded.width = rgba8.width;
+		encoded.height = rgba8.height;
+		encoded.data.resize(static_cast<size_t>(blocksX) * blocksY * blockSize);
+
+		ParallelRows(blocksY, threadCount, [&](int begin, int end) {
+			uint8_t pixels[64];
+			for (int by = begin; by < end; ++by) {
+				for (int bx = 0; bx < blocksX; ++bx) {
+					GatherBlock(rgba8, bx, by, pixels);
+					bc::EncodeBlock(format, pixels, encoded.data.data() + (static_cast<size_t>(by) * blocksX + bx) * blockSize);
+				}
+			}
+			});
+
+		return encoded;
+	}
+
+	Surface DecodeSurface(const Surface& encoded, bc::Format format) {
+		const int blocksX = (encoded.width + 3) / 4;
+		const int blocksY = (encoded.height + 3) / 4;
+		const size_t blockSize = bc::BlockSize(format);
+
+		Surface decoded;
+		decoded.width = encoded.width;
+		decoded.height = encoded.height;
+		decoded.data.resize(static_cast<size_t>(encoded.width) * encoded.height * 4);
+
+		uint8_t pixels[64];
+		for (int by = 0; by < blocksY; ++by) {
+			for (int bx = 0; bx < blocksX; ++bx) {
+				bc::DecodeBlock(format, encoded.data.data() + (static_cast<size_t>(by) * blocksX + bx) * blockSize, pixels);
+				for (int y = 0; y < 4 && by * 4 + y < encoded.height; ++y) {
+					for (int x = 0; x < 4 && bx * 4 + x < encoded.width; ++x) {
+						std::memcpy(decoded.data.data() + (static_cast<size_t>(by * 4 + y) * encoded.width + bx * 4 + x) * 4, pixels + (y * 4 + x) * 4, 4);
+					}
+				}
+			}
+		}
+		return decoded;
+	}
+
+	std::vector<uint8_t> BuildDDS(const std::vector<Surface>& mips, bc::Format format) {
+		std::vector<uint8_t> out;
+		if (mips.empty()) return out;
+
+		const bool useDX10 = (format == bc::Format::BC5 || format == bc::Format::BC7);
+		const uint32_t mipCount = static_cast<uint32_t>(mips.size());
+
+		uint32_t fourCC = MakeFourCC('D', 'X', '1', '0');
+		if (format == bc::Format::BC1) fourCC = MakeFourCC('D', 'X', 'T', '1');
+		if (format == bc::Format::BC3) fourCC = MakeFourCC('D', 'X', 'T', '5');
+
+		WriteU32(out, DDS_MAGIC);
+		WriteU32(out, 124);
+		WriteU32(out, DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE);
+		WriteU32(out, static_cast<uint32_t>(mips.front().height));
+		WriteU32(out, static_cast<uint32_t>(mips.front().width));
+		WriteU32(out, static_cast<uint32_t>(mips.front().data.size()));
+		WriteU32(out, 0); //depth
+		WriteU32(out, mipCount);
+		for (int i = 0; i < 11; ++i) WriteU32(out, 0); //reserved
+
+		//pixel format
+		WriteU32(out, 32);
+		WriteU32(out, DDPF_FOURCC);
+		WriteU32(out, fourCC);
+		for (int i = 0; i < 5; ++i) WriteU32(out, 0); //bit count + masks
+
+		WriteU32(out, DDSCAPS_TEXTURE | (mipCount > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0));
+		for (int i = 0; i < 4; ++i) WriteU32(out, 0); //caps2-4 + reserved
+
+		if (useDX10) {
+			WriteU32(out, format == bc::Format::BC5 ? DXGI_FORMAT_BC5_UNORM : DXGI_FORMAT_BC7_UNORM);
+			WriteU32(out, DDS_DIMENSION_TEXTURE2D);
+			WriteU32(out, 0); //misc flags
+			WriteU32(out, 1); //array size
+			WriteU32(out, 0); //alpha mode unknown
+		}
+
+		for (const Surface& mip : mips) {
+			out.insert(out.end(), mip.data.begin(), mip.data.end());
+		}
+		return out;
+	}
+
+	bool WriteDDS(const std::filesystem::path& path, const std::vector<Surface>& mips, bc::Format format) {
+		std::vector<uint8_t> bytes = BuildDDS(mips, format);
+		if (bytes.empty()) return false;
+
+		if (path.has_parent_path() && !std::filesystem::exists(path.parent_path())) {
+			std::filesystem::create_directories(path.parent_path());
+		}
+
+		std::ofstream file(path, std::ios::binary);
+		if (!file) return false;
+		file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		return static_cast<bool>(file);
+	}
+
+	std::vector<Surface> CompileImage(const Image& image, const Settings& settings) {
+		const bc::Format format = ToBlockFormat(settings.Compression);
+		const bool srgb = OutputIsSRGB(settings);
+
+		std::vector<Surface> mips;
+		for (const Image& level : BuildMipChain(image, settings)) {
+			mips.push_back(EncodeSurface(ToRGBA8(level, srgb), format, settings.threadCount));
+		}
+		return mips;
+	}
+
+	bool CompileTexture(const std::filesystem::path& input, const Settings& settings, const std::filesystem::path& output, std::string& error) {
+		Image image;
+		if (!LoadImageFile(input, settings, image)) {
+			error = "Failed to load image: " + input.string() + " (" + stbi_failure_reason() + ")";
+			return false;
+		}
+
+		std::vector<Surface> mips = CompileImage(image, settings);
+
+		if (!WriteDDS(output, mips, ToBlockFormat(settings.Compression))) {
+			error = "Failed to write DDS: " + output.string();
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,98 @@
+/******************************************************************/
+/*!
+\file      TextureCompiler.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Native texture compiler. Replaces the texconv.exe wrapper so
+		   textures can be cooked on every platform.
+		   - ReadSettings: Reads the TextureCompilerData block of a .meta file.
+		   - LoadImageFile: Loads a source image into linear float RGBA.
+		   - BuildMipChain: Flips, resizes and generates gamma correct mips.
+		   - EncodeSurface: Block compresses one mip across worker threads.
+		   - WriteDDS: Writes the encoded chain in a format R_Texture loads.
+		   - CompileTexture: Runs the whole pipeline.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "BlockCompression.h"
+
+namespace texturecompiler {
+
+	//matches WrapMode in the editor's TextureCompilerData.h
+	enum WrapMode {
+		WRAP_CLAMP,
+		WRAP_MIRROR
+	};
+
+	//matches ColorFormat in the editor's TextureCompilerData.h
+	enum ColorFormat {
+		CS_SRGB,  //sRGB in, sRGB out
+		CS_SRGBI, //sRGB in, linear out
+		CS_SRGBO  //linear in, sRGB out
+	};
+
+	//matches TextureCompression in the editor's TextureCompilerData.h
+	enum TextureCompression {
+		TC_BC1,
+		TC_BC3,
+		TC_BC5,
+		TC_BC7
+	};
+
+	struct Settings {
+		bool HoriztonalFlip = false;
+		bool VerticalFlip = false;
+		float Width = 0.0f;
+		float Height = 0.0f;
+		int MipLevels = 1; // 0 generates the full chain
+		WrapMode Wrap = WRAP_CLAMP;
+		ColorFormat ColorSpace = CS_SRGB;
+		TextureCompression Compression = TC_BC3;
+
+		unsigned int threadCount = 0; // 0 uses every hardware thread
+	};
+
+	//linear float RGBA
+	struct Image {
+		int width{};
+		int height{};
+		std::vector<float> pixels;
+	};
+
+	//encoded RGBA8 or block data for one mip
+	struct Surface {
+		int width{};
+		int height{};
+		std::vector<uint8_t> data;
+	};
+
+	bc::Format ToBlockFormat(TextureCompression compression);
+
+	Settings ReadSettings(const std::filesystem::path& metaPath);
+
+	bool LoadImageFile(const std::filesystem::path& path, const Settings& settings, Image& image);
+
+	Image Resample(const Image& source, int width, int height, WrapMode wrap);
+	std::vector<Image> BuildMipChain(Image image, const Settings& settings);
+
+	Surface ToRGBA8(const Image& image, bool encodeSRGB);
+	Surface EncodeSurface(const Surface& rgba8, bc::Format format, unsigned int threadCount);
+	Surface DecodeSurface(const Surface& encoded, bc::Format format);
+
+	std::vector<uint8_t> BuildDDS(const std::vector<Surface>& mips, bc::Format format);
+	bool WriteDDS(const std::filesystem::path& path, const std::vector<Surface>& mips, bc::Format format);
+
+	std::vector<Surface> CompileImage(const Image& image, const Settings& settings);
+	bool CompileTexture(const std::filesystem::path& input, const Settings& settings, const std::filesystem::path& output, std::string& error);
+}
@@ -0,0 +1,194 @@
+/******************************************************************/
+/*!
+\file      test.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the texture compiler. Covers encode quality
+		   (PSNR against the source), byte for byte determinism across
+		   thread counts, the DDS header layout and encode throughput.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+
+#include "TextureCompiler.h"
+
+using namespace texturecompiler;
+
+namespace {
+
+	//smooth gradients with a little structure, deterministic for every run
+	Surface MakeTestSurface(int width, int height) {
+		Surface surface;
+		surface.width = width;
+		surface.height = height;
+		surface.data.resize(static_cast<size_t>(width) * height * 4);
+
+		uint32_t seed = 1234567u;
+		for (int y = 0; y < height; ++y) {
+			for (int x = 0; x < width; ++x) {
+				seed = seed * 1664525u + 1013904223u;
+				const int noise = static_cast<int>((seed >> 24) & 7u) - 4;
+
+				const float u = static_cast<float>(x) / static_cast<float>(width);
+				const float v = static_cast<float>(y) / static_cast<float>(height);
+				const float r = 0.5f + 0.5f * std::sin(u * 6.28318f);
+				const float g = v;
+				const float b = 0.5f + 0.5f * std::cos((u + v) * 3.14159f);
+				const float a = 0.75f + 0.2f * std::sin(v * 6.28318f); //stays above the BC1 punch through cutoff
+
+				uint8_t* pixel = surface.data.data() + (static_cast<size_t>(y) * width + x) * 4;
+				pixel[0] = static_cast<uint8_t>(std::clamp(static_cast<int>(r * 255.f) + noise, 0, 255));
+				pixel[1] = static_cast<uint8_t>(std::clamp(static_cast<int>(g * 255.f) + noise, 0, 255));
+				pixel[2] = static_cast<uint8_t>(std::clamp(static_cast<int>(b * 255.f) + noise, 0, 255));
+				pixel[3] = static_cast<uint8_t>(std::clamp(static_cast<int>(a * 255.f), 0, 255));
+			}
+		}
+		return surface;
+	}
+
+	double PSNR(const Surface& reference, const Surface& decoded, int channels) {
+		double error = 0.0;
+		size_t count = 0;
+		for (size_t i = 0; i < reference.data.size(); i += 4) {
+			for (int c = 0; c < channels; ++c) {
+				const double diff = static_cast<double>(reference.data[i + c]) - static_cast<double>(decoded.data[i + c]);
+				error += diff * diff;
+				++count;
+			}
+		}
+		const double mse = error / static_cast<double>(count);
+		if (mse <= 0.0) return 100.0;
+		return 10.0 * std::log10((255.0 * 255.0) / mse);
+	}
+
+	double EncodePSNR(bc::Format format, int channels) {
+		Surface source = MakeTestSurface(256, 256);
+		Surface decoded = DecodeSurface(EncodeSurface(source, format, 0), format);
+		return PSNR(source, decoded, channels);
+	}
+
+	uint32_t ReadU32(const std::vector<uint8_t>& bytes, size_t offset) {
+		uint32_t value;
+		std::memcpy(&value, bytes.data() + offset, sizeof(value));
+		return value;
+	}
+}
+
+
+TEST(TextureCompiler, BC1Quality) {
+	EXPECT_GT(EncodePSNR(bc::Format::BC1, 3), 32.0);
+}
+
+TEST(TextureCompiler, BC3Quality) {
+	EXPECT_GT(EncodePSNR(bc::Format::BC3, 4), 32.0);
+}
+
+TEST(TextureCompiler, BC5Quality) {
+	EXPECT_GT(EncodePSNR(bc::Format::BC5, 2), 38.0);
+}
+
+TEST(TextureCompiler, BC7Quality) {
+	EXPECT_GT(EncodePSNR(bc::Format::BC7, 4), 38.0);
+}
+
+TEST(TextureCompiler, SolidBlock) {
+	uint8_t pixels[64];
+	for (int i = 0; i < 16; ++i) {
+		pixels[i * 4 + 0] = 255;
+		pixels[i * 4 + 1] = 0;
+		pixels[i * 4 + 2] = 255;
+		pixels[i * 4 + 3] = 255;
+	}
+
+	for (bc::Format format : { bc::Format::BC1, bc::Format::BC3, bc::Format::BC7 }) {
+		uint8_t block[16]{};
+		uint8_t decoded[64]{};
+		bc::EncodeBlock(format, pixels, block);
+		bc::DecodeBlock(format, block, decoded);
+		//BC7 mode 6 shares one p-bit per endpoint, so odd and even channels can be off by one
+		for (int i = 0; i < 64; ++i) {
+			EXPECT_LE(std::abs(pixels[i] - decoded[i]), 1);
+		}
+	}
+}
+
+TEST(TextureCompiler, DeterministicAcrossThreadCounts) {
+	Surface source = MakeTestSurface(130, 66); //not a multiple of the block size
+
+	for (bc::Format format : { bc::Format::BC1, bc::Format::BC3, bc::Format::BC5, bc::Format::BC7 }) {
+		Surface single = EncodeSurface(source, format, 1);
+		Surface multi = EncodeSurface(source, format, 7);
+		Surface again = EncodeSurface(source, format, 0);
+		EXPECT_EQ(single.data, multi.data);
+		EXPECT_EQ(single.data, again.data);
+	}
+}
+
+TEST(TextureCompiler, FullMipChain) {
+	Image image;
+	image.width = 64;
+	image.height = 16;
+	image.pixels.assign(static_cast<size_t>(image.width) * image.height * 4, 0.5f);
+
+	Settings settings;
+	settings.MipLevels = 0;
+	std::vector<Image> chain = BuildMipChain(image, settings);
+
+	ASSERT_EQ(chain.size(), 7u);
+	EXPECT_EQ(chain.back().width, 1);
+	EXPECT_EQ(chain.back().height, 1);
+	//box of a constant color must stay constant
+	EXPECT_NEAR(chain.back().pixels[0], 0.5f, 1e-4f);
+}
+
+TEST(TextureCompiler, DDSHeader) {
+	Image image;
+	image.width = 32;
+	image.height = 32;
+	image.pixels.assign(static_cast<size_t>(image.width) * image.height * 4, 1.0f);
+
+	Settings settings;
+	settings.MipLevels = 0;
+
+	settings.Compression = TC_BC3;
+	std::vector<uint8_t> dxt5 = BuildDDS(CompileImage(image, settings), bc::Format::BC3);
+	EXPECT_EQ(ReadU32(dxt5, 0), 0x20534444u);    // "DDS "
+	EXPECT_EQ(ReadU32(dxt5, 12), 32u);           // height
+	EXPECT_EQ(ReadU32(dxt5, 16), 32u);           // width
+	EXPECT_EQ(ReadU32(dxt5, 28), 6u);            // mip count
+	EXPECT_EQ(ReadU32(dxt5, 84), 0x35545844u);   // "DXT5"
+	//header + 8x8 + 4x4 + 2x2 + 1 + 1 + 1 blocks
+	EXPECT_EQ(dxt5.size(), 128u + (64u + 16u + 4u + 1u + 1u + 1u) * 16u);
+
+	settings.Compression = TC_BC7;
+	std::vector<uint8_t> bc7 = BuildDDS(CompileImage(image, settings), bc::Format::BC7);
+	EXPECT_EQ(ReadU32(bc7, 84), 0x30315844u);    // "DX10"
+	EXPECT_EQ(ReadU32(bc7, 128), 98u);           // DXGI_FORMAT_BC7_UNORM
+	EXPECT_EQ(bc7.size(), 148u + (64u + 16u + 4u + 1u + 1u + 1u) * 16u);
+}
+
+TEST(TextureCompiler, Throughput) {
+	Surface source = MakeTestSurface(1024, 1024);
+	const char* names[] = { "BC1", "BC3", "BC5", "BC7" };
+	const bc::Format formats[] = { bc::Format::BC1, bc::Format::BC3, bc::Format::BC5, bc::Format::BC7 };
+
+	for (int i = 0; i < 4; ++i) {
+		auto start = std::chrono::steady_clock::now();
+		Surface encoded = EncodeSurface(source, formats[i], 0);
+		std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+		EXPECT_EQ(encoded.data.size(), 256u * 256u * bc::BlockSize(formats[i]));
+		std::cout << names[i] << ": " << (1.0 / duration.count()) << " MP/s" << std::endl;
+	}
+}
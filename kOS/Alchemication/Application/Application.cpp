@@ -96,6 +96,10 @@ namespace Application {
         --------------------------------------------------------------*/
         auto resourceManager = ResourceManager::GetInstance();
         resourceManager->Init(configpath::resourceFilePath);
+        //shipped builds read every resource from one pack, see Kos_AssetPacker
+        if (std::filesystem::exists(configpath::resourcePackFilePath)) {
+            resourceManager->MountPack(configpath::resourcePackFilePath);
+        }
 
         /*--------------------------------------------------------------
         INITIALIZE SCIRPT
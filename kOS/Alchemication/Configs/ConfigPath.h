@@ -5,5 +5,6 @@ namespace configpath
 {
     constexpr const char *configFilePath = "Alchemication/Configs/Config.json";
     constexpr const char *resourceFilePath = "Resource";
+    constexpr const char *resourcePackFilePath = "Resource.pak";
     constexpr const char *logFilePath = "LogFile.txt";
 }
\ No newline at end of file
@@ -0,0 +1,116 @@
+/******************************************************************/
+/*!
+\file      main.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Headless asset builder. Compiles every asset with a .meta file
+		   into the resource folder through the same job graph and build
+		   cache the editor uses, then prints per stage timing and the
+		   diagnostics of every failed job.
+
+		   Run from the kOS directory:
+		   Kos_AssetBuilder [--assets dir] [--resources dir] [--config file]
+							[--cache dir] [--no-cache] [--jobs n]
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "AssetPipeline/AssetBuilder.h"
+
+namespace {
+
+	struct Options {
+		std::filesystem::path assets = "Kos Editor/Assets";
+		std::filesystem::path resources = "Resource";
+		std::filesystem::path config = "Kos Editor/Configs/Config.json";
+		std::filesystem::path cache = "Kos Editor/Cache/BuildCache";
+		bool useCache = true;
+		unsigned int jobs = 0;
+	};
+
+	void PrintUsage(const char* program) {
+		std::cout << "Usage: " << program << " [--assets dir] [--resources dir] [--config file] [--cache dir] [--no-cache] [--jobs n]\n";
+	}
+
+	bool ParseOptions(int argc, char* argv[], Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+
+			if (argument == "--assets" && hasValue) options.assets = argv[++i];
+			else if (argument == "--resources" && hasValue) options.resources = argv[++i];
+			else if (argument == "--config" && hasValue) options.config = argv[++i];
+			else if (argument == "--cache" && hasValue) options.cache = argv[++i];
+			else if (argument == "--jobs" && hasValue) options.jobs = static_cast<unsigned int>(std::stoul(argv[++i]));
+			else if (argument == "--no-cache") options.useCache = false;
+			else return false;
+		}
+		return true;
+	}
+
+	const char* ToString(assetpipeline::JobStatus status) {
+		switch (status) {
+		case assetpipeline::JobStatus::Succeeded: return "succeeded";
+		case assetpipeline::JobStatus::Failed: return "FAILED";
+		case assetpipeline::JobStatus::Skipped: return "skipped";
+		default: return "pending";
+		}
+	}
+
+	const char* ToString(assetpipeline::Severity severity) {
+		switch (severity) {
+		case assetpipeline::Severity::Error: return "error";
+		case assetpipeline::Severity::Warning: return "warning";
+		default: return "info";
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options)) {
+		PrintUsage(argv[0]);
+		return 1;
+	}
+
+	LOGGING_INIT_LOGS("AssetBuilder.log");
+
+	std::vector<assetpipeline::CompilerEntry> compilers = assetpipeline::LoadCompilerConfig(options.config);
+	if (compilers.empty()) {
+		std::cerr << "No compilers found in " << options.config << std::endl;
+		return 1;
+	}
+
+	assetpipeline::BuildCache cache;
+	if (options.useCache) {
+		cache.Init(options.cache);
+	}
+
+	assetpipeline::AssetBuilder builder{ compilers, options.useCache ? &cache : nullptr };
+	builder.SetThreadCount(options.jobs);
+
+	assetpipeline::BuildReport report = builder.BuildDirectory(options.assets, options.resources);
+
+	for (const auto& asset : report.assets) {
+		std::cout << asset.source.string() << " [" << asset.compiler << "] " << ToString(asset.status) << '\n';
+		for (const auto& diagnostic : asset.diagnostics) {
+			std::cout << "    " << ToString(diagnostic.severity) << ": " << diagnostic.message << '\n';
+		}
+	}
+
+	std::cout << "\nStage timings\n";
+	for (const auto& [stage, milliseconds] : report.stageMilliseconds) {
+		std::cout << "  " << std::left << std::setw(16) << stage << std::right << std::setw(10) << std::fixed << std::setprecision(1) << milliseconds << " ms\n";
+	}
+
+	std::cout << "\nCompiled " << report.compiled << ", up to date " << report.upToDate << ", restored " << report.restored
+		<< ", failed " << report.failed << ", skipped " << report.skipped << std::endl;
+
+	return report.Succeeded() ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+/******************************************************************/
+/*!
+\file      main.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Packs every cooked resource (GUID + extension) in the resource
+		   folder into one resource pack, then reads it back to verify
+		   it. Shipped builds mount the pack instead of opening one file
+		   per resource.
+
+		   Run from the kOS directory:
+		   Kos_AssetPacker [--resources dir] [--output file]
+						   [--align n] [--no-compress]
+		   Kos_AssetPacker --list file
+		   Kos_AssetPacker --verify file
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "AssetPipeline/PackFile.h"
+
+namespace {
+
+	struct Options {
+		std::filesystem::path resources = "Resource";
+		std::filesystem::path output = "Resource.pak";
+		std::filesystem::path list;
+		std::filesystem::path verify;
+		assetpipeline::PackWriter::Options pack;
+	};
+
+	void PrintUsage(const char* program) {
+		std::cout << "Usage: " << program << " [--resources dir] [--output file] [--align n] [--no-compress]\n"
+			<< "       " << program << " --list file\n"
+			<< "       " << program << " --verify file\n";
+	}
+
+	bool ParseOptions(int argc, char* argv[], Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+
+			if (argument == "--resources" && hasValue) options.resources = argv[++i];
+			else if (argument == "--output" && hasValue) options.output = argv[++i];
+			else if (argument == "--list" && hasValue) options.list = argv[++i];
+			else if (argument == "--verify" && hasValue) options.verify = argv[++i];
+			else if (argument == "--align" && hasValue) options.pack.alignment = static_cast<uint32_t>(std::stoul(argv[++i]));
+			else if (argument == "--no-compress") options.pack.compress = false;
+			else return false;
+		}
+		return true;
+	}
+
+	int List(const std::filesystem::path& packPath) {
+		assetpipeline::PackReader reader;
+		std::string error;
+		if (!reader.Open(packPath, error)) {
+			std::cerr << packPath.string() << ": " << error << std::endl;
+			return 1;
+		}
+
+		for (const auto& entry : reader.GetEntries()) {
+			std::cout << entry.GetGUID() << std::left << std::setw(8) << entry.GetType() << std::right
+				<< std::setw(12) << entry.offset << std::setw(12) << entry.size << std::setw(12) << entry.storedSize
+				<< (entry.compression == assetpipeline::PackCompression::LZ4 ? "  lz4" : "") << '\n';
+		}
+		std::cout << reader.GetEntries().size() << " resources" << std::endl;
+		return 0;
+	}
+
+	int Verify(const std::filesystem::path& packPath) {
+		assetpipeline::PackReader reader;
+		std::string error;
+		if (!reader.Open(packPath, error) || !reader.Verify(error)) {
+			std::cerr << packPath.string() << ": " << error << std::endl;
+			return 1;
+		}
+		std::cout << packPath.string() << ": " << reader.GetEntries().size() << " resources OK" << std::endl;
+		return 0;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options)) {
+		PrintUsage(argv[0]);
+		return 1;
+	}
+
+	if (!options.list.empty()) return List(options.list);
+	if (!options.verify.empty()) return Verify(options.verify);
+
+	LOGGING_INIT_LOGS("AssetPacker.log");
+
+	const auto start = std::chrono::steady_clock::now();
+
+	assetpipeline::PackWriter writer{ options.pack };
+	if (writer.AddDirectory(options.resources) == 0) {
+		std::cerr << "No resources found in " << options.resources.string() << std::endl;
+		return 1;
+	}
+
+	std::string error;
+	if (!writer.Write(options.output, error)) {
+		std::cerr << error << std::endl;
+		return 1;
+	}
+
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "Packed " << writer.GetEntryCount() << " resources, " << writer.GetSourceBytes() << " -> " << writer.GetStoredBytes()
+		<< " bytes in " << std::fixed << std::setprecision(2) << seconds << " s" << std::endl;
+
+	return Verify(options.output);
+}
@@ -0,0 +1,498 @@
+/******************************************************************/
+/*!
+\file      AnimationClip.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the baked skeletal animation clip.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AnimationClip.h"
+
+#include <cstring>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace animation {
+
+	namespace {
+
+		template <typename T>
+		uint32_t Append(std::vector<float>& times, std::vector<T>& values, const std::vector<float>& sourceTimes, const std::vector<T>& sourceValues) {
+			const size_t count = std::min(sourceTimes.size(), sourceValues.size());
+			times.insert(times.end(), sourceTimes.begin(), sourceTimes.begin() + count);
+			values.insert(values.end(), sourceValues.begin(), sourceValues.begin() + count);
+			return static_cast<uint32_t>(count);
+		}
+
+		//key pair around "time", the cursor only moves forward unless time went back
+		float FindKey(const float* times, uint32_t count, float time, uint32_t& cursor) {
+			const uint32_t last = count - 2;
+			if (cursor > last || time < times[cursor]) {
+				const uint32_t upper = static_cast<uint32_t>(std::upper_bound(times, times + count, time) - times);
+				cursor = std::min(upper > 0 ? upper - 1 : 0, last);
+			}
+			while (cursor < last && time >= times[cursor + 1]) {
+				++cursor;
+			}
+
+			const float span = times[cursor + 1] - times[cursor];
+			return span > 0.f ? std::clamp((time - times[cursor]) / span, 0.f, 1.f) : 0.f;
+		}
+
+		//FindKey over the quantized times of packed keys
+		float FindPackedKey(const PackedKey* keys, uint32_t count, float time, uint32_t& cursor) {
+			const uint32_t last = count - 2;
+			if (cursor > last || time < keys[cursor].time) {
+				const PackedKey* upper = std::upper_bound(keys, keys + count, time, [](float value, const PackedKey& key) { return value < key.time; });
+				const uint32_t index = static_cast<uint32_t>(upper - keys);
+				cursor = std::min(index > 0 ? index - 1 : 0, last);
+			}
+			while (cursor < last && time >= keys[cursor + 1].time) {
+				++cursor;
+			}
+
+			const float span = static_cast<float>(keys[cursor + 1].time) - static_cast<float>(keys[cursor].time);
+			return span > 0.f ? std::clamp((time - keys[cursor].time) / span, 0.f, 1.f) : 0.f;
+		}
+
+		template <typename T>
+		bool ReadRecords(std::string_view binary, size_t& offset, uint32_t count, std::vector<T>& records) {
+			const size_t size = size_t{ count } * sizeof(T);
+			if (offset + size > binary.size()) return false;
+
+			records.resize(count);
+			if (size > 0) std::memcpy(records.data(), binary.data() + offset, size);
+			offset += size;
+			return true;
+		}
+
+		//no shear in node transforms, so the columns hold rotation * scale
+		JointPose Decompose(const glm::mat4& transform) {
+			JointPose pose;
+			pose.position = glm::vec3(transform[3]);
+			pose.scale = { glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])) };
+
+			glm::mat3 rotation{ 1.f };
+			for (int i = 0; i < 3; ++i) {
+				if (pose.scale[i] > 0.f) rotation[i] = glm::vec3(transform[i]) / pose.scale[i];
+			}
+			if (glm::determinant(rotation) < 0.f) {
+				pose.scale.x = -pose.scale.x;
+				rotation[0] = -rotation[0];
+			}
+			pose.rotation = glm::normalize(glm::quat_cast(rotation));
+			return pose;
+		}
+	}
+
+	glm::mat4 ToMatrix(const JointPose& pose) {
+		//T * R * S without the two matrix products
+		glm::mat4 local = glm::mat4_cast(pose.rotation);
+		local[0] *= pose.scale.x;
+		local[1] *= pose.scale.y;
+		local[2] *= pose.scale.z;
+		local[3] = glm::vec4(pose.position, 1.f);
+		return local;
+	}
+
+	void AnimationClip::Build(float duration, float ticksPerSecond, const std::vector<JointDesc>& joints,
+		const std::unordered_map<std::string, BoneTrack>& tracks)
+	{
+		Clear();
+		m_duration = duration;
+		m_ticksPerSecond = ticksPerSecond;
+
+		m_joints.reserve(joints.size());
+		m_jointNames.reserve(joints.size());
+
+		for (size_t i = 0; i < joints.size(); ++i) {
+			const JointDesc& desc = joints[i];
+			Joint joint{ desc.parent, -1, desc.bindTransform, Decompose(desc.bindTransform) };
+
+			if (joint.parent >= static_cast<int>(i)) {
+				LOGGING_ERROR("Animation Clip: joint " + desc.name + " is listed before its parent");
+				joint.parent = -1;
+			}
+
+			//only tracks that drive a joint are kept
+			const auto it = tracks.find(desc.name);
+			if (it != tracks.end()) {
+				const BoneTrack& source = it->second;
+				Track track{};
+				track.positionExtent = track.scaleExtent = glm::vec3{ 0.f };
+				track.positionFirst = static_cast<uint32_t>(m_positions.size());
+				track.positionCount = Append(m_positionTimes, m_positions, source.positionTimes, source.positions);
+				track.rotationFirst = static_cast<uint32_t>(m_rotations.size());
+				track.rotationCount = Append(m_rotationTimes, m_rotations, source.rotationTimes, source.rotations);
+				track.scaleFirst = static_cast<uint32_t>(m_scales.size());
+				track.scaleCount = Append(m_scaleTimes, m_scales, source.scaleTimes, source.scales);
+
+				joint.track = static_cast<int>(m_tracks.size());
+				m_tracks.push_back(track);
+			}
+
+			m_joints.push_back(joint);
+			m_jointNames.push_back(desc.name);
+		}
+		SetJointImportance(ComputeJointImportance(joints));
+
+		const auto root = std::find_if(m_joints.begin(), m_joints.end(), [](const Joint& joint) { return joint.track >= 0; });
+		SetRootJoint(root == m_joints.end() ? -1 : static_cast<int>(root - m_joints.begin()));
+	}
+
+	bool AnimationClip::Load(std::string_view binary, std::string& error) {
+		using namespace assetpipeline;
+		Clear();
+
+		AnimationHeader header{};
+		if (binary.size() < sizeof(header)) {
+			error = "Truncated animation header";
+			return false;
+		}
+		std::memcpy(&header, binary.data(), sizeof(header));
+
+		if (std::memcmp(header.magic, ANIMATION_MAGIC, sizeof(ANIMATION_MAGIC)) != 0) {
+			error = "Not a compressed animation";
+			return false;
+		}
+		if (header.version != ANIMATION_VERSION) {
+			error = "Unsupported animation version " + std::to_string(header.version);
+			return false;
+		}
+
+		std::vector<JointRecord> joints;
+		std::vector<TrackRecord> tracks;
+		std::vector<EventRecord> events;
+		size_t offset = sizeof(header);
+		if (!ReadRecords(binary, offset, header.jointCount, joints) ||
+			!ReadRecords(binary, offset, header.trackCount, tracks) ||
+			!ReadRecords(binary, offset, header.positionKeyCount, m_packedPositions) ||
+			!ReadRecords(binary, offset, header.rotationKeyCount, m_packedRotations) ||
+			!ReadRecords(binary, offset, header.scaleKeyCount, m_packedScales) ||
+			!ReadRecords(binary, offset, header.eventCount, events) ||
+			offset + header.stringSize != binary.size()) {
+			Clear();
+			error = "Animation size does not match its header";
+			return false;
+		}
+		const std::string_view strings = binary.substr(offset);
+
+		//every index is checked once here so sampling never has to
+		bool valid = true;
+		m_tracks.reserve(tracks.size());
+		for (const TrackRecord& record : tracks) {
+			valid &= size_t{ record.positionFirst } + record.positionCount <= m_packedPositions.size() &&
+				size_t{ record.rotationFirst } + record.rotationCount <= m_packedRotations.size() &&
+				size_t{ record.scaleFirst } + record.scaleCount <= m_packedScales.size();
+
+			Track track{ record.positionFirst, record.positionCount, record.rotationFirst, record.rotationCount, record.scaleFirst, record.scaleCount,
+				glm::make_vec3(record.positionMin), glm::make_vec3(record.positionExtent), glm::make_vec3(record.scaleMin), glm::make_vec3(record.scaleExtent) };
+			m_tracks.push_back(track);
+		}
+
+		m_joints.reserve(joints.size());
+		m_jointNames.reserve(joints.size());
+		for (size_t i = 0; i < joints.size(); ++i) {
+			const JointRecord& record = joints[i];
+			valid &= record.parent < static_cast<int32_t>(i) && record.parent >= -1 &&
+				record.track < static_cast<int32_t>(m_tracks.size()) && record.track >= -1 &&
+				size_t{ record.nameOffset } + record.nameLength <= strings.size();
+			if (!valid) break;
+
+			const glm::mat4 bindTransform = glm::make_mat4(record.bindTransform);
+			m_joints.push_back({ record.parent, record.track, bindTransform, Decompose(bindTransform),
+				static_cast<uint8_t>(std::min<uint32_t>(record.importance, ALL_JOINTS)) });
+			m_jointNames.emplace_back(strings.substr(record.nameOffset, record.nameLength));
+		}
+
+		std::vector<AnimationEvent> markers;
+		markers.reserve(events.size());
+		for (const EventRecord& record : events) {
+			valid &= size_t{ record.nameOffset } + record.nameLength <= strings.size() &&
+				size_t{ record.soundOffset } + record.soundLength <= strings.size();
+			if (!valid) break;
+
+			markers.push_back({ record.time, std::string{ strings.substr(record.nameOffset, record.nameLength) },
+				std::string{ strings.substr(record.soundOffset, record.soundLength) } });
+		}
+
+		if (!valid) {
+			Clear();
+			error = "Animation refers to a record that does not exist";
+			return false;
+		}
+
+		m_duration = header.duration;
+		m_ticksPerSecond = header.ticksPerSecond;
+		m_timeScale = header.timeScale;
+		m_compressed = true;
+		CountSampledJoints();
+		SetEvents(std::move(markers));
+		SetRootJoint(header.rootJoint >= 0 && header.rootJoint < static_cast<int32_t>(m_joints.size()) ? header.rootJoint : -1);
+		return true;
+	}
+
+	void AnimationClip::SetJointImportance(const std::vector<uint8_t>& importance) {
+		for (size_t i = 0; i < m_joints.size(); ++i) {
+			m_joints[i].importance = i < importance.size() ? std::min(importance[i], ALL_JOINTS) : JOINT_ESSENTIAL;
+		}
+		CountSampledJoints();
+	}
+
+	void AnimationClip::CountSampledJoints() {
+		std::fill(std::begin(m_sampledJoints), std::end(m_sampledJoints), size_t{ 0 });
+		for (const Joint& joint : m_joints) {
+			if (joint.track < 0) continue;
+			for (size_t level = joint.importance; level <= ALL_JOINTS; ++level) ++m_sampledJoints[level];
+		}
+	}
+
+	size_t AnimationClip::GetSampledJointCount(uint8_t maxImportance) const {
+		return m_sampledJoints[std::min(maxImportance, ALL_JOINTS)];
+	}
+
+	void AnimationClip::SetRootJoint(int joint) {
+		m_rootJoint = joint >= 0 && joint < static_cast<int>(m_joints.size()) ? joint : -1;
+		m_rootParent = m_rootParentInverse = glm::mat4(1.f);
+		m_rootReferencePosition = glm::vec3{ 0.f };
+		m_rootReferenceRotation = m_rootParentRotation = glm::quat{ 1.f, 0.f, 0.f, 0.f };
+		if (m_rootJoint < 0) return;
+
+		for (int parent = m_joints[m_rootJoint].parent; parent >= 0; parent = m_joints[parent].parent) {
+			m_rootParent = m_joints[parent].bindTransform * m_rootParent;
+		}
+		m_rootParentInverse = glm::inverse(m_rootParent);
+		m_rootParentRotation = Decompose(m_rootParent).rotation;
+
+		KeyCursor cursor{};
+		const Joint& root = m_joints[m_rootJoint];
+		const JointPose first = root.track < 0 ? root.bindPose : SampleTrack(m_tracks[root.track], 0.f, cursor);
+		m_rootReferencePosition = RootPosition(first);
+		m_rootReferenceRotation = m_rootParentRotation * first.rotation;
+	}
+
+	glm::vec3 AnimationClip::RootPosition(const JointPose& root) const {
+		return glm::vec3(m_rootParent * glm::vec4(root.position, 1.f));
+	}
+
+	float AnimationClip::RootYaw(const JointPose& root) const {
+		//heading of the rotation since the first frame, the root's own axes do not matter
+		const glm::vec3 forward = (m_rootParentRotation * root.rotation * glm::conjugate(m_rootReferenceRotation)) * glm::vec3{ 0.f, 0.f, 1.f };
+		return std::atan2(forward.x, forward.z);
+	}
+
+	JointPose AnimationClip::StripRootMotion(const JointPose& root, const RootMotionSettings& settings) const {
+		JointPose stripped = root;
+
+		glm::vec3 position = RootPosition(root);
+		if (!settings.lockX) position.x = m_rootReferencePosition.x;
+		if (!settings.lockY) position.y = m_rootReferencePosition.y;
+		if (!settings.lockZ) position.z = m_rootReferencePosition.z;
+		stripped.position = glm::vec3(m_rootParentInverse * glm::vec4(position, 1.f));
+
+		if (!settings.lockYaw) {
+			const glm::quat yaw = glm::angleAxis(-RootYaw(root), glm::vec3{ 0.f, 1.f, 0.f });
+			stripped.rotation = glm::conjugate(m_rootParentRotation) * yaw * m_rootParentRotation * root.rotation;
+		}
+		return stripped;
+	}
+
+	void AnimationClip::SetEvents(std::vector<AnimationEvent> events) {
+		for (AnimationEvent& event : events) event.time = std::clamp(event.time, 0.f, std::max(m_duration, 0.f));
+		std::stable_sort(events.begin(), events.end(), [](const AnimationEvent& a, const AnimationEvent& b) { return a.time < b.time; });
+
+		m_events = std::move(events);
+		m_eventTimes.clear();
+		m_eventTimes.reserve(m_events.size());
+		for (const AnimationEvent& event : m_events) m_eventTimes.push_back(event.time);
+	}
+
+	void AnimationClip::Clear() {
+		m_duration = 0.f;
+		m_ticksPerSecond = 0.f;
+		m_joints.clear();
+		m_jointNames.clear();
+		m_tracks.clear();
+		std::fill(std::begin(m_sampledJoints), std::end(m_sampledJoints), size_t{ 0 });
+		m_rootJoint = -1;
+		m_events.clear();
+		m_eventTimes.clear();
+		m_positionTimes.clear();
+		m_positions.clear();
+		m_rotationTimes.clear();
+		m_rotations.clear();
+		m_scaleTimes.clear();
+		m_scales.clear();
+
+		m_compressed = false;
+		m_timeScale = 0.f;
+		m_packedPositions.clear();
+		m_packedRotations.clear();
+		m_packedScales.clear();
+	}
+
+	std::vector<JointBinding> AnimationClip::Bind(const std::unordered_map<std::string, int>& boneMap, const std::vector<glm::mat4>& boneOffsets) const {
+		std::vector<JointBinding> binding(m_joints.size());
+		for (size_t i = 0; i < m_joints.size(); ++i) {
+			const auto it = boneMap.find(m_jointNames[i]);
+			if (it == boneMap.end() || it->second < 0 || it->second >= static_cast<int>(boneOffsets.size())) continue;
+
+			binding[i].bone = it->second;
+			binding[i].offset = boneOffsets[it->second];
+		}
+		return binding;
+	}
+
+	JointPose AnimationClip::SampleTrack(const Track& track, float time, KeyCursor& cursor) const {
+		if (m_compressed) return SamplePackedTrack(track, time, cursor);
+
+		glm::vec3 position{ 0.f };
+		if (track.positionCount == 1) {
+			position = m_positions[track.positionFirst];
+		}
+		else if (track.positionCount > 1) {
+			const float factor = FindKey(&m_positionTimes[track.positionFirst], track.positionCount, time, cursor.position);
+			const glm::vec3* keys = &m_positions[track.positionFirst + cursor.position];
+			position = glm::mix(keys[0], keys[1], factor);
+		}
+
+		glm::quat rotation{ 1.f, 0.f, 0.f, 0.f };
+		if (track.rotationCount == 1) {
+			rotation = m_rotations[track.rotationFirst];
+		}
+		else if (track.rotationCount > 1) {
+			const float factor = FindKey(&m_rotationTimes[track.rotationFirst], track.rotationCount, time, cursor.rotation);
+			const glm::quat* keys = &m_rotations[track.rotationFirst + cursor.rotation];
+			rotation = glm::slerp(keys[0], keys[1], factor);
+		}
+
+		glm::vec3 scale{ 1.f };
+		if (track.scaleCount == 1) {
+			scale = m_scales[track.scaleFirst];
+		}
+		else if (track.scaleCount > 1) {
+			const float factor = FindKey(&m_scaleTimes[track.scaleFirst], track.scaleCount, time, cursor.scale);
+			const glm::vec3* keys = &m_scales[track.scaleFirst + cursor.scale];
+			scale = glm::mix(keys[0], keys[1], factor);
+		}
+
+		return { position, rotation, scale };
+	}
+
+	JointPose AnimationClip::SamplePackedTrack(const Track& track, float time, KeyCursor& cursor) const {
+		const float quantizedTime = time * m_timeScale;
+
+		glm::vec3 position{ 0.f };
+		if (track.positionCount == 1) {
+			position = UnpackRange(m_packedPositions[track.positionFirst].value, track.positionMin, track.positionExtent);
+		}
+		else if (track.positionCount > 1) {
+			const float factor = FindPackedKey(&m_packedPositions[track.positionFirst], track.positionCount, quantizedTime, cursor.position);
+			const PackedKey* keys = &m_packedPositions[track.positionFirst + cursor.position];
+			position = glm::mix(UnpackRange(keys[0].value, track.positionMin, track.positionExtent),
+				UnpackRange(keys[1].value, track.positionMin, track.positionExtent), factor);
+		}
+
+		glm::quat rotation{ 1.f, 0.f, 0.f, 0.f };
+		if (track.rotationCount == 1) {
+			rotation = UnpackRotation(m_packedRotations[track.rotationFirst].value);
+		}
+		else if (track.rotationCount > 1) {
+			const float factor = FindPackedKey(&m_packedRotations[track.rotationFirst], track.rotationCount, quantizedTime, cursor.rotation);
+			const PackedKey* keys = &m_packedRotations[track.rotationFirst + cursor.rotation];
+			rotation = glm::slerp(UnpackRotation(keys[0].value), UnpackRotation(keys[1].value), factor);
+		}
+
+		glm::vec3 scale{ 1.f };
+		if (track.scaleCount == 1) {
+			scale = UnpackRange(m_packedScales[track.scaleFirst].value, track.scaleMin, track.scaleExtent);
+		}
+		else if (track.scaleCount > 1) {
+			const float factor = FindPackedKey(&m_packedScales[track.scaleFirst], track.scaleCount, quantizedTime, cursor.scale);
+			const PackedKey* keys = &m_packedScales[track.scaleFirst + cursor.scale];
+			scale = glm::mix(UnpackRange(keys[0].value, track.scaleMin, track.scaleExtent),
+				UnpackRange(keys[1].value, track.scaleMin, track.scaleExtent), factor);
+		}
+
+		return { position, rotation, scale };
+	}
+
+	JointPose AnimationClip::SampleJoint(size_t joint, float time, std::vector<KeyCursor>& cursors) const {
+		const Joint& data = m_joints[joint];
+		return data.track < 0 ? data.bindPose : SampleTrack(m_tracks[data.track], time, cursors[data.track]);
+	}
+
+	void AnimationClip::SampleLocal(float time, std::vector<KeyCursor>& cursors, std::vector<glm::mat4>& locals) const {
+		cursors.resize(m_tracks.size());
+		locals.resize(m_joints.size());
+
+		for (size_t i = 0; i < m_joints.size(); ++i) {
+			const Joint& joint = m_joints[i];
+			locals[i] = joint.track < 0 ? joint.bindTransform : ToMatrix(SampleTrack(m_tracks[joint.track], time, cursors[joint.track]));
+		}
+	}
+
+	void AnimationClip::SamplePose(float time, std::vector<KeyCursor>& cursors, const std::vector<JointBinding>& binding,
+		const glm::mat4& parentTransform, const glm::mat4& globalInverse,
+		std::vector<glm::mat4>& globals, std::vector<glm::mat4>& finalTransforms,
+		const RootMotionSettings& rootMotion, uint8_t maxImportance) const
+	{
+		cursors.resize(m_tracks.size());
+		globals.resize(m_joints.size());
+
+		const int stripped = rootMotion.enabled ? m_rootJoint : -1;
+		const size_t bound = std::min(binding.size(), m_joints.size());
+		for (size_t i = 0; i < m_joints.size(); ++i) {
+			const Joint& joint = m_joints[i];
+			glm::mat4 local;
+			if (static_cast<int>(i) == stripped) {
+				local = ToMatrix(StripRootMotion(joint.track < 0 ? joint.bindPose : SampleTrack(m_tracks[joint.track], time, cursors[joint.track]), rootMotion));
+			}
+			else {
+				const bool held = joint.track < 0 || joint.importance > maxImportance;
+				local = held ? joint.bindTransform : ToMatrix(SampleTrack(m_tracks[joint.track], time, cursors[joint.track]));
+			}
+
+			//parents are always sampled first
+			globals[i] = (joint.parent < 0 ? parentTransform : globals[joint.parent]) * local;
+
+			if (i < bound && binding[i].bone >= 0 && binding[i].bone < static_cast<int>(finalTransforms.size())) {
+				finalTransforms[binding[i].bone] = globalInverse * globals[i] * binding[i].offset;
+			}
+		}
+	}
+
+	void AnimationClip::ComposePose(const std::vector<JointPose>& locals, const std::vector<JointBinding>& binding,
+		const glm::mat4& parentTransform, const glm::mat4& globalInverse,
+		std::vector<glm::mat4>& globals, std::vector<glm::mat4>& finalTransforms) const
+	{
+		globals.resize(m_joints.size());
+
+		const size_t count = std::min(locals.size(), m_joints.size());
+		const size_t bound = std::min(binding.size(), count);
+		for (size_t i = 0; i < count; ++i) {
+			const Joint& joint = m_joints[i];
+			globals[i] = (joint.parent < 0 ? parentTransform : globals[joint.parent]) * ToMatrix(locals[i]);
+
+			if (i < bound && binding[i].bone >= 0 && binding[i].bone < static_cast<int>(finalTransforms.size())) {
+				finalTransforms[binding[i].bone] = globalInverse * globals[i] * binding[i].offset;
+			}
+		}
+	}
+
+	void AnimationClip::ComposeSkinning(const std::vector<glm::mat4>& globals, const std::vector<JointBinding>& binding,
+		const glm::mat4& globalInverse, std::vector<glm::mat4>& finalTransforms) const
+	{
+		const size_t bound = std::min({ binding.size(), globals.size(), m_joints.size() });
+		for (size_t i = 0; i < bound; ++i) {
+			if (binding[i].bone >= 0 && binding[i].bone < static_cast<int>(finalTransforms.size())) {
+				finalTransforms[binding[i].bone] = globalInverse * globals[i] * binding[i].offset;
+			}
+		}
+	}
+}
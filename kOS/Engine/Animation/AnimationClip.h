@@ -0,0 +1,213 @@
+/******************************************************************/
+/*!
+\file      AnimationClip.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Skeletal animation clip baked for sampling.
+
+		   The node hierarchy is flattened at load time into a joint
+		   array where every parent comes before its children, and each
+		   joint refers to its key track by index. Keys of every track
+		   live in shared contiguous arrays.
+
+		   Sampling keeps one key cursor per track, so playing forward
+		   only steps the cursor by the keys that were passed since the
+		   last sample. The pose is evaluated in a single pass over the
+		   joint array.
+
+		   Clips from the asset pipeline are compressed: redundant keys
+		   are removed, rotations are stored as smallest three
+		   quaternions in 48 bits, and translations, scales and key
+		   times are quantized to 16 bits per component. Compressed keys
+		   are sampled as they are stored.
+
+		   Event markers (footsteps, hit frames, sounds) are kept sorted
+		   by time so playback can find the ones it crossed with a
+		   binary search.
+
+		   Every joint has an importance from the size of the part of
+		   the skeleton it moves in bind pose. LOD sampling evaluates
+		   only the joints up to a given importance and holds the rest
+		   (fingers, twist bones) in bind pose.
+
+		   One joint is marked as the root motion joint. Its movement
+		   in model space (ancestors taken in bind pose) can be taken
+		   out of the pose and handed to the character instead, as a
+		   translation and a yaw about +Y relative to the first frame.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "AssetPipeline/AnimationFormat.h"
+#include <glm/gtc/quaternion.hpp>
+
+namespace animation {
+
+	//local transform of a joint, the form poses are blended in
+	struct JointPose {
+		glm::vec3 position{ 0.f };
+		glm::quat rotation{ 1.f, 0.f, 0.f, 0.f };
+		glm::vec3 scale{ 1.f };
+	};
+
+	struct Joint {
+		int parent;          //index into the joint array, always lower than this joint
+		int track;           //index into the track array, -1 keeps the bind transform
+		glm::mat4 bindTransform;
+		JointPose bindPose;  //bindTransform split into position, rotation and scale
+		uint8_t importance{}; //see JOINT_ESSENTIAL
+	};
+
+	//T * R * S
+	glm::mat4 ToMatrix(const JointPose& pose);
+
+	//last key used per channel of one track
+	struct KeyCursor {
+		uint32_t position{};
+		uint32_t rotation{};
+		uint32_t scale{};
+	};
+
+	//root motion taken out of the pose, locked axes stay in the pose and do not move the character
+	struct RootMotionSettings {
+		bool enabled{};
+		bool lockX{};
+		bool lockY{ true };
+		bool lockZ{};
+		bool lockYaw{};
+	};
+
+	//movement of the root joint over a step, translation in the heading of the step start
+	struct RootMotion {
+		glm::vec3 translation{ 0.f };
+		float yaw{};         //radians about +Y
+	};
+
+	//skinned mesh bone a joint writes to, bone is -1 if the mesh has no such bone
+	struct JointBinding {
+		int bone{ -1 };
+		glm::mat4 offset{ 1.f };
+	};
+
+	class AnimationClip {
+	public:
+
+		//joints must list every parent before its children
+		void Build(float duration, float ticksPerSecond, const std::vector<JointDesc>& joints,
+			const std::unordered_map<std::string, BoneTrack>& tracks);
+
+		//compressed clip written by assetpipeline::CompressAnimation
+		bool Load(std::string_view binary, std::string& error);
+
+		//-1 disables root motion, Build picks the first joint with a track
+		void SetRootJoint(int joint);
+		int GetRootJoint() const { return m_rootJoint; }
+
+		//model space position and yaw (relative to the first frame) of a local pose of the root joint
+		glm::vec3 RootPosition(const JointPose& root) const;
+		float RootYaw(const JointPose& root) const;
+
+		//local pose of the root joint with the extracted axes held at the first frame
+		JointPose StripRootMotion(const JointPose& root, const RootMotionSettings& settings) const;
+
+		//replaces the event markers, times are clamped to the clip and sorted
+		void SetEvents(std::vector<AnimationEvent> events);
+
+		//bone index of every joint, looked up by joint name
+		std::vector<JointBinding> Bind(const std::unordered_map<std::string, int>& boneMap, const std::vector<glm::mat4>& boneOffsets) const;
+
+		std::vector<KeyCursor> CreateCursors() const { return std::vector<KeyCursor>(m_tracks.size()); }
+
+		//replaces the importance of every joint, compiled clips carry their own
+		void SetJointImportance(const std::vector<uint8_t>& importance);
+
+		//joints with a track that a pose sampled at "maxImportance" evaluates
+		size_t GetSampledJointCount(uint8_t maxImportance = ALL_JOINTS) const;
+
+		//local transform of every joint at "time"
+		void SampleLocal(float time, std::vector<KeyCursor>& cursors, std::vector<glm::mat4>& locals) const;
+
+		//local transform of one joint at "time", cursors must come from CreateCursors
+		JointPose SampleJoint(size_t joint, float time, std::vector<KeyCursor>& cursors) const;
+
+		//skinning matrices from a local pose of this clip's joints, unbound bones are left untouched
+		void ComposePose(const std::vector<JointPose>& locals, const std::vector<JointBinding>& binding,
+			const glm::mat4& parentTransform, const glm::mat4& globalInverse,
+			std::vector<glm::mat4>& globals, std::vector<glm::mat4>& finalTransforms) const;
+
+		//skinning matrices of already composed model space transforms, after they were edited
+		void ComposeSkinning(const std::vector<glm::mat4>& globals, const std::vector<JointBinding>& binding,
+			const glm::mat4& globalInverse, std::vector<glm::mat4>& finalTransforms) const;
+
+		//skinning matrix of every bound joint at "time", unbound bones are left untouched.
+		//joints above "maxImportance" hold their bind transform
+		void SamplePose(float time, std::vector<KeyCursor>& cursors, const std::vector<JointBinding>& binding,
+			const glm::mat4& parentTransform, const glm::mat4& globalInverse,
+			std::vector<glm::mat4>& globals, std::vector<glm::mat4>& finalTransforms,
+			const RootMotionSettings& rootMotion = {}, uint8_t maxImportance = ALL_JOINTS) const;
+
+		float GetDuration() const { return m_duration; }
+		float GetTicksPerSecond() const { return m_ticksPerSecond; }
+		const std::vector<Joint>& GetJoints() const { return m_joints; }
+		const std::vector<std::string>& GetJointNames() const { return m_jointNames; }
+		const std::vector<AnimationEvent>& GetEvents() const { return m_events; }
+		const std::vector<float>& GetEventTimes() const { return m_eventTimes; }
+		size_t GetTrackCount() const { return m_tracks.size(); }
+		bool IsCompressed() const { return m_compressed; }
+
+	private:
+
+		struct Track {
+			uint32_t positionFirst, positionCount;
+			uint32_t rotationFirst, rotationCount;
+			uint32_t scaleFirst, scaleCount;
+
+			//quantization ranges of compressed tracks
+			glm::vec3 positionMin, positionExtent;
+			glm::vec3 scaleMin, scaleExtent;
+		};
+
+		void Clear();
+		void CountSampledJoints();
+		JointPose SampleTrack(const Track& track, float time, KeyCursor& cursor) const;
+		JointPose SamplePackedTrack(const Track& track, float time, KeyCursor& cursor) const;
+
+		float m_duration{};
+		float m_ticksPerSecond{};
+
+		std::vector<Joint> m_joints;
+		std::vector<std::string> m_jointNames;
+		std::vector<Track> m_tracks;
+		size_t m_sampledJoints[ALL_JOINTS + 1]{}; //animated joints up to each importance
+
+		int m_rootJoint{ -1 };
+		glm::mat4 m_rootParent{ 1.f };        //bind pose model transform of the root's parent
+		glm::mat4 m_rootParentInverse{ 1.f };
+		glm::quat m_rootParentRotation{ 1.f, 0.f, 0.f, 0.f };
+		glm::vec3 m_rootReferencePosition{ 0.f }; //model space root at the first frame
+		glm::quat m_rootReferenceRotation{ 1.f, 0.f, 0.f, 0.f };
+
+		//sorted by time, the times are also kept apart for searching
+		std::vector<AnimationEvent> m_events;
+		std::vector<float> m_eventTimes;
+
+		std::vector<float> m_positionTimes;
+		std::vector<glm::vec3> m_positions;
+		std::vector<float> m_rotationTimes;
+		std::vector<glm::quat> m_rotations;
+		std::vector<float> m_scaleTimes;
+		std::vector<glm::vec3> m_scales;
+
+		bool m_compressed{};
+		float m_timeScale{}; //quantized key time per tick
+		std::vector<PackedKey> m_packedPositions;
+		std::vector<PackedKey> m_packedRotations;
+		std::vector<PackedKey> m_packedScales;
+	};
+}
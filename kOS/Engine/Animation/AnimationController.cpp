@@ -0,0 +1,565 @@
+/******************************************************************/
+/*!
+\file      AnimationController.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the animation state machine and its per entity
+		   evaluation.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AnimationController.h"
+
+#include <cstring>
+
+namespace animation {
+
+	using namespace assetpipeline;
+
+	namespace {
+
+		//samples below this weight are not sampled at all
+		constexpr float MIN_WEIGHT = 1e-4f;
+
+		template <typename T>
+		bool ReadRecords(std::string_view binary, size_t& offset, uint32_t count, std::vector<T>& records) {
+			const size_t size = size_t{ count } * sizeof(T);
+			if (offset + size > binary.size()) return false;
+
+			records.resize(count);
+			if (size > 0) std::memcpy(records.data(), binary.data() + offset, size);
+			offset += size;
+			return true;
+		}
+
+		bool StringInRange(uint32_t offset, uint32_t length, size_t stringSize) {
+			return size_t{ offset } + length <= stringSize;
+		}
+
+		float ClipSeconds(const AnimationClip& clip) {
+			const float ticksPerSecond = clip.GetTicksPerSecond() > 0.f ? clip.GetTicksPerSecond() : 25.f;
+			return clip.GetDuration() / ticksPerSecond;
+		}
+	}
+
+	bool AnimationController::Load(std::string_view binary, std::string& error) {
+		ControllerHeader header{};
+		if (binary.size() < sizeof(header)) {
+			error = "Truncated controller header";
+			return false;
+		}
+		std::memcpy(&header, binary.data(), sizeof(header));
+
+		if (std::memcmp(header.magic, CONTROLLER_MAGIC, sizeof(CONTROLLER_MAGIC)) != 0) {
+			error = "Not an animation controller";
+			return false;
+		}
+		if (header.version != CONTROLLER_VERSION) {
+			error = "Unsupported controller version " + std::to_string(header.version);
+			return false;
+		}
+
+		size_t offset = sizeof(header);
+		if (!ReadRecords(binary, offset, header.parameterCount, m_parameters) ||
+			!ReadRecords(binary, offset, header.clipCount, m_clips) ||
+			!ReadRecords(binary, offset, header.stateCount, m_states) ||
+			!ReadRecords(binary, offset, header.sampleCount, m_samples) ||
+			!ReadRecords(binary, offset, header.transitionCount, m_transitions) ||
+			!ReadRecords(binary, offset, header.conditionCount, m_conditions) ||
+			offset + header.stringSize != binary.size()) {
+			error = "Controller size does not match its header";
+			return false;
+		}
+		m_strings.assign(binary.substr(offset));
+
+		//every index is checked once here so evaluation never has to
+		const auto parameterValid = [&](int32_t parameter) { return parameter >= 0 && parameter < static_cast<int32_t>(m_parameters.size()); };
+		const auto clipValid = [&](int32_t clip) { return clip >= 0 && clip < static_cast<int32_t>(m_clips.size()); };
+		const auto stateValid = [&](int32_t state) { return state >= 0 && state < static_cast<int32_t>(m_states.size()); };
+
+		if (m_states.empty() || !stateValid(header.defaultState)) {
+			error = "Controller has no valid default state";
+			return false;
+		}
+
+		bool valid = true;
+		for (const auto& parameter : m_parameters) valid &= StringInRange(parameter.nameOffset, parameter.nameLength, m_strings.size());
+		for (const auto& clip : m_clips) valid &= StringInRange(clip.GUIDOffset, clip.GUIDLength, m_strings.size());
+		for (const auto& sample : m_samples) valid &= clipValid(sample.clip);
+
+		m_maxSamples = 1;
+		for (const auto& state : m_states) {
+			valid &= StringInRange(state.nameOffset, state.nameLength, m_strings.size());
+			switch (state.motion) {
+			case MotionType::Clip:
+				valid &= clipValid(state.clip);
+				break;
+			case MotionType::Blend2D:
+				valid &= parameterValid(state.parameterY);
+				[[fallthrough]];
+			case MotionType::Blend1D:
+				valid &= parameterValid(state.parameterX) && state.sampleCount > 0 &&
+					size_t{ state.firstSample } + state.sampleCount <= m_samples.size();
+				m_maxSamples = std::max<size_t>(m_maxSamples, state.sampleCount);
+				break;
+			default:
+				valid = false;
+			}
+		}
+		for (const auto& transition : m_transitions) {
+			valid &= (transition.from == ANY_STATE || stateValid(transition.from)) && stateValid(transition.to) &&
+				size_t{ transition.firstCondition } + transition.conditionCount <= m_conditions.size();
+		}
+		for (const auto& condition : m_conditions) valid &= parameterValid(condition.parameter);
+
+		if (!valid) {
+			error = "Controller refers to a record that does not exist";
+			return false;
+		}
+
+		m_defaultState = header.defaultState;
+		return true;
+	}
+
+	int AnimationController::FindParameter(std::string_view name) const {
+		for (size_t i = 0; i < m_parameters.size(); ++i) {
+			if (GetParameterName(i) == name) return static_cast<int>(i);
+		}
+		return -1;
+	}
+
+	int AnimationController::FindState(std::string_view name) const {
+		for (size_t i = 0; i < m_states.size(); ++i) {
+			if (GetStateName(i) == name) return static_cast<int>(i);
+		}
+		return -1;
+	}
+
+
+	void ControllerInstance::Bind(std::shared_ptr<const AnimationController> controller, std::vector<std::shared_ptr<const AnimationClip>> clips,
+		const void* skeleton, const std::unordered_map<std::string, int>& boneMap, const std::vector<glm::mat4>& boneOffsets)
+	{
+		m_controller = std::move(controller);
+		m_boundSkeleton = skeleton;
+		m_skeleton = nullptr;
+		m_clips.clear();
+		m_pose.clear();
+
+		clips.resize(m_controller->GetClips().size());
+		for (const auto& clip : clips) {
+			if (clip && !clip->GetJoints().empty()) {
+				m_skeleton = clip.get();
+				break;
+			}
+		}
+
+		m_parameters.clear();
+		for (const auto& parameter : m_controller->GetParameters()) {
+			m_parameters.push_back(parameter.defaultValue);
+		}
+
+		if (!m_skeleton) {
+			LOGGING_WARN("Animation Controller: none of the controller's clips are loaded");
+			return;
+		}
+
+		const auto& jointNames = m_skeleton->GetJointNames();
+		for (auto& clip : clips) {
+			ClipSlot slot;
+			if (clip) {
+				slot.cursors = clip->CreateCursors();
+				slot.joints.assign(jointNames.size(), -1);
+
+				std::unordered_map<std::string_view, int> clipJoints;
+				for (size_t i = 0; i < clip->GetJointNames().size(); ++i) clipJoints.emplace(clip->GetJointNames()[i], static_cast<int>(i));
+				for (size_t i = 0; i < jointNames.size(); ++i) {
+					const auto it = clipJoints.find(jointNames[i]);
+					if (it != clipJoints.end()) slot.joints[i] = it->second;
+				}
+			}
+			slot.clip = std::move(clip);
+			m_clips.push_back(std::move(slot));
+		}
+
+		m_binding = m_skeleton->Bind(boneMap, boneOffsets);
+		for (auto& binding : m_binding) {
+			if (binding.bone >= MAX_BONES) binding.bone = -1;
+		}
+
+		m_weights.assign(m_controller->GetMaxSamples(), 0.f);
+		m_clipPose.assign(jointNames.size(), JointPose{});
+		m_blendPose.assign(jointNames.size(), JointPose{});
+		m_previousPose.assign(jointNames.size(), JointPose{});
+		m_globals.assign(jointNames.size(), glm::mat4(1.f));
+		m_pose.assign(std::min(boneOffsets.size(), static_cast<size_t>(MAX_BONES)), glm::mat4(1.f));
+
+		size_t eventCount = 0;
+		for (const ClipSlot& slot : m_clips) {
+			if (slot.clip) eventCount += slot.clip->GetEvents().size();
+		}
+		m_firedEvents.clear();
+		m_firedEvents.reserve(eventCount);
+
+		m_fading = false;
+		m_previous = {};
+		m_current = { m_controller->GetDefaultState(), 0.f };
+		m_eventsStarted = false;
+	}
+
+	void ControllerInstance::SetFloat(int parameter, float value) {
+		if (parameter >= 0 && parameter < static_cast<int>(m_parameters.size())) m_parameters[parameter] = value;
+	}
+
+	float ControllerInstance::GetFloat(int parameter) const {
+		return parameter >= 0 && parameter < static_cast<int>(m_parameters.size()) ? m_parameters[parameter] : 0.f;
+	}
+
+	void ControllerInstance::SetFloat(std::string_view name, float value) {
+		if (m_controller) SetFloat(m_controller->FindParameter(name), value);
+	}
+
+	void ControllerInstance::SetBool(std::string_view name, bool value) {
+		if (m_controller) SetBool(m_controller->FindParameter(name), value);
+	}
+
+	void ControllerInstance::SetTrigger(std::string_view name) {
+		if (m_controller) SetTrigger(m_controller->FindParameter(name));
+	}
+
+	void ControllerInstance::ComputeWeights(int state, float* weights) const {
+		const StateRecord& record = m_controller->GetStates()[state];
+		if (record.motion == MotionType::Clip) {
+			weights[0] = 1.f;
+			return;
+		}
+
+		const BlendSampleRecord* samples = &m_controller->GetSamples()[record.firstSample];
+		const uint32_t count = record.sampleCount;
+		std::fill(weights, weights + count, 0.f);
+
+		if (record.motion == MotionType::Blend1D) {
+			//samples are sorted by threshold, the two around the parameter share the weight
+			const float value = m_parameters[record.parameterX];
+			if (value <= samples[0].x) {
+				weights[0] = 1.f;
+				return;
+			}
+			for (uint32_t i = 0; i + 1 < count; ++i) {
+				if (value < samples[i + 1].x) {
+					const float span = samples[i + 1].x - samples[i].x;
+					const float t = span > 0.f ? (value - samples[i].x) / span : 0.f;
+					weights[i] = 1.f - t;
+					weights[i + 1] = t;
+					return;
+				}
+			}
+			weights[count - 1] = 1.f;
+			return;
+		}
+
+		//gradient band interpolation: each sample fades out towards every other sample
+		const glm::vec2 point{ m_parameters[record.parameterX], m_parameters[record.parameterY] };
+		float total = 0.f;
+		for (uint32_t i = 0; i < count; ++i) {
+			const glm::vec2 origin{ samples[i].x, samples[i].y };
+			float weight = 1.f;
+			for (uint32_t j = 0; j < count; ++j) {
+				const glm::vec2 edge = glm::vec2{ samples[j].x, samples[j].y } - origin;
+				const float lengthSquared = glm::dot(edge, edge);
+				if (j == i || lengthSquared <= 0.f) continue;
+				weight = std::min(weight, std::max(1.f - glm::dot(point - origin, edge) / lengthSquared, 0.f));
+			}
+			weights[i] = weight;
+			total += weight;
+		}
+
+		if (total > 0.f) {
+			for (uint32_t i = 0; i < count; ++i) weights[i] /= total;
+			return;
+		}
+
+		//outside every band, the closest sample plays alone
+		uint32_t closest = 0;
+		float closestDistance = std::numeric_limits<float>::max();
+		for (uint32_t i = 0; i < count; ++i) {
+			const glm::vec2 offset = point - glm::vec2{ samples[i].x, samples[i].y };
+			if (glm::dot(offset, offset) < closestDistance) {
+				closestDistance = glm::dot(offset, offset);
+				closest = i;
+			}
+		}
+		weights[closest] = 1.f;
+	}
+
+	void ControllerInstance::GetBlendWeights(int state, std::vector<float>& weights) const {
+		weights.clear();
+		if (!m_controller || state < 0 || state >= static_cast<int>(m_controller->GetStates().size())) return;
+
+		const StateRecord& record = m_controller->GetStates()[state];
+		weights.resize(record.motion == MotionType::Clip ? 1 : record.sampleCount);
+		ComputeWeights(state, weights.data());
+	}
+
+	float ControllerInstance::StateLength(int state, const float* weights) const {
+		const StateRecord& record = m_controller->GetStates()[state];
+		float seconds = 0.f;
+
+		if (record.motion == MotionType::Clip) {
+			const auto& clip = m_clips[record.clip].clip;
+			seconds = clip ? ClipSeconds(*clip) : 0.f;
+		}
+		else {
+			//blended clips are played in sync, the length is their weighted length
+			const BlendSampleRecord* samples = &m_controller->GetSamples()[record.firstSample];
+			for (uint32_t i = 0; i < record.sampleCount; ++i) {
+				const auto& clip = m_clips[samples[i].clip].clip;
+				if (clip) seconds += weights[i] * ClipSeconds(*clip);
+			}
+		}
+		return seconds > 0.f ? seconds : 1.f;
+	}
+
+	float ControllerInstance::Advance(StatePlayback& playback, float deltaTime) {
+		ComputeWeights(playback.state, m_weights.data());
+		const StateRecord& record = m_controller->GetStates()[playback.state];
+		const float step = deltaTime * record.speed / StateLength(playback.state, m_weights.data());
+		playback.normalizedTime += step;
+		if (playback.normalizedTime < 0.f) {
+			playback.normalizedTime = record.loop ? playback.normalizedTime - std::floor(playback.normalizedTime) : 0.f;
+		}
+		return step;
+	}
+
+	void ControllerInstance::CollectStateEvents(float from, float step) {
+		//m_weights still holds the current state's weights from Advance
+		const StateRecord& record = m_controller->GetStates()[m_current.state];
+		int clip = record.clip;
+		if (record.motion != MotionType::Clip) {
+			const BlendSampleRecord* samples = &m_controller->GetSamples()[record.firstSample];
+			uint32_t dominant = 0;
+			for (uint32_t i = 1; i < record.sampleCount; ++i) {
+				if (m_weights[i] > m_weights[dominant]) dominant = i;
+			}
+			clip = record.sampleCount ? static_cast<int>(samples[dominant].clip) : -1;
+		}
+		if (clip < 0 || !m_clips[clip].clip) return;
+
+		const AnimationClip& source = *m_clips[clip].clip;
+		const float duration = source.GetDuration();
+		const float phase = record.loop ? from - std::floor(from) : std::clamp(from, 0.f, 1.f);
+		CollectEvents(source, phase * duration, step * duration, record.loop ? LoopMode::Loop : LoopMode::Once, 1.f,
+			!m_eventsStarted, m_firedEvents);
+		if (step != 0.f) m_eventsStarted = true;
+	}
+
+	RootMotion ControllerInstance::StateRootMotion(const StatePlayback& playback, float from, float step) {
+		//m_weights still holds the weights of "playback" from Advance
+		RootMotion motion;
+		if (!m_rootMotionSettings.enabled) return motion;
+
+		const StateRecord& record = m_controller->GetStates()[playback.state];
+		const uint32_t count = record.motion == MotionType::Clip ? 1 : record.sampleCount;
+		const BlendSampleRecord* samples = record.motion == MotionType::Clip ? nullptr : &m_controller->GetSamples()[record.firstSample];
+
+		for (uint32_t i = 0; i < count; ++i) {
+			const int clip = samples ? static_cast<int>(samples[i].clip) : record.clip;
+			const float weight = samples ? m_weights[i] : 1.f;
+			if (clip < 0 || weight <= 0.f || !m_clips[clip].clip) continue;
+
+			ClipSlot& slot = m_clips[clip];
+			const float duration = slot.clip->GetDuration();
+			const float phase = record.loop ? from - std::floor(from) : std::clamp(from, 0.f, 1.f);
+			const RootMotion sample = ExtractRootMotion(*slot.clip, phase * duration, step * duration,
+				record.loop ? LoopMode::Loop : LoopMode::Once, 1.f, m_rootMotionSettings, slot.cursors);
+			motion.translation += weight * sample.translation;
+			motion.yaw += weight * sample.yaw;
+		}
+		return motion;
+	}
+
+	bool ControllerInstance::CheckConditions(const TransitionRecord& transition) const {
+		if (transition.exitTime >= 0.f && m_current.normalizedTime < transition.exitTime) return false;
+
+		for (uint32_t i = 0; i < transition.conditionCount; ++i) {
+			const ConditionRecord& condition = m_controller->GetConditions()[transition.firstCondition + i];
+			const float value = m_parameters[condition.parameter];
+
+			bool passed = false;
+			switch (condition.mode) {
+			case ConditionMode::If:        passed = value != 0.f; break;
+			case ConditionMode::IfNot:     passed = value == 0.f; break;
+			case ConditionMode::Greater:   passed = value > condition.threshold; break;
+			case ConditionMode::Less:      passed = value < condition.threshold; break;
+			case ConditionMode::Equals:    passed = value == condition.threshold; break;
+			case ConditionMode::NotEquals: passed = value != condition.threshold; break;
+			}
+			if (!passed) return false;
+		}
+		return true;
+	}
+
+	void ControllerInstance::StartState(int state, float duration) {
+		if (duration > 0.f) {
+			m_previous = m_current;
+			m_fading = true;
+			m_fadeElapsed = 0.f;
+			m_fadeDuration = duration;
+		}
+		else {
+			m_fading = false;
+		}
+		m_current = { state, 0.f };
+		m_eventsStarted = false;
+	}
+
+	void ControllerInstance::FireTransitions() {
+		//a cross fade runs to the end before the next transition is considered
+		if (m_fading) return;
+
+		const auto& transitions = m_controller->GetTransitions();
+		for (int pass = 0; pass < 2; ++pass) {
+			for (const TransitionRecord& transition : transitions) {
+				//transitions from any state are tried first and never restart the playing state
+				const bool fromAny = transition.from == ANY_STATE;
+				if (pass == 0 ? (!fromAny || transition.to == m_current.state) : transition.from != m_current.state) continue;
+				if (!CheckConditions(transition)) continue;
+
+				//triggers are used up by the transition they fire
+				for (uint32_t i = 0; i < transition.conditionCount; ++i) {
+					const ConditionRecord& condition = m_controller->GetConditions()[transition.firstCondition + i];
+					if (m_controller->GetParameters()[condition.parameter].type == ParameterType::Trigger) {
+						m_parameters[condition.parameter] = 0.f;
+					}
+				}
+
+				StartState(transition.to, transition.duration);
+				return;
+			}
+		}
+	}
+
+	void ControllerInstance::SampleClip(ClipSlot& slot, float normalizedTime, bool loop, uint8_t maxImportance, std::vector<JointPose>& pose) {
+		const AnimationClip& clip = *slot.clip;
+		const float phase = loop ? normalizedTime - std::floor(normalizedTime) : std::clamp(normalizedTime, 0.f, 1.f);
+		const float time = phase * clip.GetDuration();
+
+		//importance is the skeleton's, every clip is mapped onto its joints
+		const auto& bindJoints = m_skeleton->GetJoints();
+		for (size_t i = 0; i < pose.size(); ++i) {
+			const int joint = slot.joints[i];
+			const bool held = joint < 0 || bindJoints[i].importance > maxImportance;
+			pose[i] = held ? bindJoints[i].bindPose : clip.SampleJoint(static_cast<size_t>(joint), time, slot.cursors);
+		}
+	}
+
+	void ControllerInstance::SampleState(const StatePlayback& playback, uint8_t maxImportance, std::vector<JointPose>& pose) {
+		const StateRecord& record = m_controller->GetStates()[playback.state];
+		ComputeWeights(playback.state, m_weights.data());
+
+		const uint32_t count = record.motion == MotionType::Clip ? 1 : record.sampleCount;
+		const BlendSampleRecord* samples = record.motion == MotionType::Clip ? nullptr : &m_controller->GetSamples()[record.firstSample];
+
+		for (auto& joint : pose) {
+			joint.position = glm::vec3{ 0.f };
+			joint.rotation = glm::quat{ 0.f, 0.f, 0.f, 0.f };
+			joint.scale = glm::vec3{ 0.f };
+		}
+
+		float total = 0.f;
+		for (uint32_t i = 0; i < count; ++i) {
+			const float weight = m_weights[i];
+			ClipSlot& slot = m_clips[samples ? samples[i].clip : record.clip];
+			if (weight < MIN_WEIGHT || !slot.clip) continue;
+
+			SampleClip(slot, playback.normalizedTime, record.loop, maxImportance, m_clipPose);
+			total += weight;
+
+			for (size_t j = 0; j < pose.size(); ++j) {
+				const JointPose& sample = m_clipPose[j];
+				//keep every rotation in the hemisphere of the running sum
+				const glm::quat rotation = glm::dot(pose[j].rotation, sample.rotation) < 0.f ? -sample.rotation : sample.rotation;
+				pose[j].position += weight * sample.position;
+				pose[j].rotation = pose[j].rotation + weight * rotation;
+				pose[j].scale += weight * sample.scale;
+			}
+		}
+
+		const auto& bindJoints = m_skeleton->GetJoints();
+		for (size_t j = 0; j < pose.size(); ++j) {
+			const float length = glm::length(pose[j].rotation);
+			if (total <= 0.f || length <= 0.f) {
+				pose[j] = bindJoints[j].bindPose;
+				continue;
+			}
+			pose[j].position /= total;
+			pose[j].scale /= total;
+			pose[j].rotation = pose[j].rotation / length;
+		}
+	}
+
+	void ControllerInstance::Update(float deltaTime) {
+		Advance(deltaTime);
+		Sample();
+	}
+
+	void ControllerInstance::Advance(float deltaTime) {
+		if (!m_controller || !m_skeleton) return;
+
+		FireTransitions();
+
+		m_firedEvents.clear();
+		const float from = m_current.normalizedTime;
+		const float step = Advance(m_current, deltaTime);
+		CollectStateEvents(from, step);
+		m_rootMotion = StateRootMotion(m_current, from, step);
+
+		if (m_fading) {
+			const float previousFrom = m_previous.normalizedTime;
+			const float previousStep = Advance(m_previous, deltaTime);
+			const RootMotion previous = StateRootMotion(m_previous, previousFrom, previousStep);
+			m_fadeElapsed += deltaTime;
+
+			const float weight = GetTransitionWeight();
+			m_rootMotion.translation = glm::mix(previous.translation, m_rootMotion.translation, weight);
+			m_rootMotion.yaw = glm::mix(previous.yaw, m_rootMotion.yaw, weight);
+
+			//the finished fade samples as the current state alone, which is what weight 1 blends to
+			if (m_fadeElapsed >= m_fadeDuration) m_fading = false;
+		}
+	}
+
+	void ControllerInstance::Sample(uint8_t maxImportance) {
+		if (!m_controller || !m_skeleton) return;
+
+		SampleState(m_current, maxImportance, m_blendPose);
+		if (m_fading) {
+			SampleState(m_previous, maxImportance, m_previousPose);
+
+			const float weight = GetTransitionWeight();
+			for (size_t j = 0; j < m_blendPose.size(); ++j) {
+				m_blendPose[j].position = glm::mix(m_previousPose[j].position, m_blendPose[j].position, weight);
+				m_blendPose[j].rotation = glm::slerp(m_previousPose[j].rotation, m_blendPose[j].rotation, weight);
+				m_blendPose[j].scale = glm::mix(m_previousPose[j].scale, m_blendPose[j].scale, weight);
+			}
+		}
+
+		const int root = m_skeleton->GetRootJoint();
+		if (m_rootMotionSettings.enabled && root >= 0) {
+			m_blendPose[root] = m_skeleton->StripRootMotion(m_blendPose[root], m_rootMotionSettings);
+		}
+
+		m_skeleton->ComposePose(m_blendPose, m_binding, glm::mat4(1.f), glm::mat4(1.f), m_globals, m_pose);
+	}
+
+	void ControllerInstance::SolveIk(const std::vector<IkConstraint>& constraints) {
+		if (!m_skeleton || constraints.empty() || m_globals.size() != m_skeleton->GetJoints().size()) return;
+
+		animation::SolveIk(m_skeleton->GetJoints(), constraints, m_globals);
+		m_skeleton->ComposeSkinning(m_globals, m_binding, glm::mat4(1.f), m_pose);
+	}
+}
@@ -0,0 +1,195 @@
+/******************************************************************/
+/*!
+\file      AnimationController.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Animation state machine with 1D and 2D blend spaces.
+
+		   AnimationController is the compiled controller: parameters,
+		   states, transitions and blend samples, immutable once
+		   loaded and shared by every entity that uses it.
+
+		   ControllerInstance is the per entity side: parameter values,
+		   the playing state, an optional cross fade from the previous
+		   state, and the pose. Poses are blended per joint in local
+		   space (position, rotation, scale), then composed into
+		   skinning matrices once. Every buffer is sized by Bind, so
+		   Update does not allocate.
+
+		   Event markers fire from the current state only: its clip,
+		   or the sample with the largest weight in a blend space. Root
+		   motion is blended like the pose: by sample weight within a
+		   state and by transition weight across a cross fade.
+
+		   SolveIk runs after Update on the composed pose, the local
+		   pose is left as the state machine blended it.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "AnimationInstance.h"
+#include "AssetPipeline/ControllerCompiler.h"
+
+namespace animation {
+
+	using assetpipeline::ParameterType;
+	using assetpipeline::ConditionMode;
+	using assetpipeline::MotionType;
+
+	class AnimationController {
+	public:
+
+		//binary written by assetpipeline::CompileController
+		bool Load(std::string_view binary, std::string& error);
+
+		//-1 if there is no such parameter or state
+		int FindParameter(std::string_view name) const;
+		int FindState(std::string_view name) const;
+
+		std::string_view GetParameterName(size_t parameter) const { return GetString(m_parameters[parameter].nameOffset, m_parameters[parameter].nameLength); }
+		std::string_view GetStateName(size_t state) const { return GetString(m_states[state].nameOffset, m_states[state].nameLength); }
+		std::string_view GetClipGUID(size_t clip) const { return GetString(m_clips[clip].GUIDOffset, m_clips[clip].GUIDLength); }
+
+		int GetDefaultState() const { return m_defaultState; }
+		const std::vector<assetpipeline::ParameterRecord>& GetParameters() const { return m_parameters; }
+		const std::vector<assetpipeline::ClipRecord>& GetClips() const { return m_clips; }
+		const std::vector<assetpipeline::StateRecord>& GetStates() const { return m_states; }
+		const std::vector<assetpipeline::BlendSampleRecord>& GetSamples() const { return m_samples; }
+		const std::vector<assetpipeline::TransitionRecord>& GetTransitions() const { return m_transitions; }
+		const std::vector<assetpipeline::ConditionRecord>& GetConditions() const { return m_conditions; }
+
+		//largest number of clips one state blends
+		size_t GetMaxSamples() const { return m_maxSamples; }
+
+	private:
+
+		std::string_view GetString(uint32_t offset, uint32_t length) const { return std::string_view{ m_strings }.substr(offset, length); }
+
+		int m_defaultState{};
+		size_t m_maxSamples{ 1 };
+		std::vector<assetpipeline::ParameterRecord> m_parameters;
+		std::vector<assetpipeline::ClipRecord> m_clips;
+		std::vector<assetpipeline::StateRecord> m_states;
+		std::vector<assetpipeline::BlendSampleRecord> m_samples;
+		std::vector<assetpipeline::TransitionRecord> m_transitions;
+		std::vector<assetpipeline::ConditionRecord> m_conditions;
+		std::string m_strings;
+	};
+
+	class ControllerInstance {
+	public:
+
+		//clips[i] plays the controller's clip i, null if it is missing. The joints of
+		//the first clip are the skeleton every other clip is mapped onto by name.
+		void Bind(std::shared_ptr<const AnimationController> controller, std::vector<std::shared_ptr<const AnimationClip>> clips,
+			const void* skeleton, const std::unordered_map<std::string, int>& boneMap, const std::vector<glm::mat4>& boneOffsets);
+
+		bool IsBound(const AnimationController& controller, const void* skeleton) const {
+			return m_controller.get() == &controller && m_boundSkeleton == skeleton;
+		}
+
+		//fires transitions, advances the states and samples the pose
+		void Update(float deltaTime);
+
+		//the two halves of Update. Advance alone keeps transitions, events and root motion
+		//going while the pose is held, Sample evaluates joints up to "maxImportance"
+		void Advance(float deltaTime);
+		void Sample(uint8_t maxImportance = ALL_JOINTS);
+
+		//parameters by index are the allocation free path, names are matched linearly
+		void SetFloat(int parameter, float value);
+		void SetBool(int parameter, bool value) { SetFloat(parameter, value ? 1.f : 0.f); }
+		void SetTrigger(int parameter) { SetFloat(parameter, 1.f); }
+		void ResetTrigger(int parameter) { SetFloat(parameter, 0.f); }
+		float GetFloat(int parameter) const;
+
+		void SetFloat(std::string_view name, float value);
+		void SetBool(std::string_view name, bool value);
+		void SetTrigger(std::string_view name);
+
+		int GetCurrentState() const { return m_current.state; }
+		int GetPreviousState() const { return m_fading ? m_previous.state : -1; }
+		float GetNormalizedTime() const { return m_current.normalizedTime; }
+		bool IsInTransition() const { return m_fading; }
+
+		//0 at the start of a cross fade, 1 once only the current state plays
+		float GetTransitionWeight() const { return m_fading ? std::min(m_fadeElapsed / m_fadeDuration, 1.f) : 1.f; }
+
+		//weight of every sample of "state" at the current parameter values
+		void GetBlendWeights(int state, std::vector<float>& weights) const;
+
+		const std::vector<glm::mat4>& GetPose() const { return m_pose; }
+		const std::vector<JointPose>& GetLocalPose() const { return m_blendPose; }
+		const std::vector<glm::mat4>& GetGlobalTransforms() const { return m_globals; }
+
+		//clip whose joints the pose is laid out in, null until bound
+		const AnimationClip* GetSkeleton() const { return m_skeleton; }
+
+		//moves the pose of the last Update by "constraints" and rebuilds its skinning matrices
+		void SolveIk(const std::vector<IkConstraint>& constraints);
+
+		//events crossed by the last Update
+		const std::vector<const AnimationEvent*>& GetFiredEvents() const { return m_firedEvents; }
+
+		//root motion is measured on every clip's own root joint and left out of the pose
+		void SetRootMotion(const RootMotionSettings& settings) { m_rootMotionSettings = settings; }
+		const RootMotion& GetRootMotion() const { return m_rootMotion; }
+
+	private:
+
+		struct ClipSlot {
+			std::shared_ptr<const AnimationClip> clip;
+			std::vector<KeyCursor> cursors;
+			std::vector<int> joints; //clip joint for every skeleton joint, -1 holds the skeleton bind pose
+		};
+
+		struct StatePlayback {
+			int state{ -1 };
+			float normalizedTime{}; //1 per played length, keeps counting past the end
+		};
+
+		void StartState(int state, float duration);
+		bool CheckConditions(const assetpipeline::TransitionRecord& transition) const;
+		void FireTransitions();
+
+		void ComputeWeights(int state, float* weights) const;
+		float StateLength(int state, const float* weights) const;
+		float Advance(StatePlayback& playback, float deltaTime); //returns the normalized step
+		void CollectStateEvents(float from, float step);
+		RootMotion StateRootMotion(const StatePlayback& playback, float from, float step);
+		void SampleState(const StatePlayback& playback, uint8_t maxImportance, std::vector<JointPose>& pose);
+		void SampleClip(ClipSlot& slot, float normalizedTime, bool loop, uint8_t maxImportance, std::vector<JointPose>& pose);
+
+		std::shared_ptr<const AnimationController> m_controller;
+		const void* m_boundSkeleton{ nullptr };
+		const AnimationClip* m_skeleton{ nullptr };
+
+		std::vector<ClipSlot> m_clips;
+		std::vector<float> m_parameters;
+		std::vector<JointBinding> m_binding;
+
+		StatePlayback m_current;
+		StatePlayback m_previous;
+		bool m_fading{};
+		float m_fadeElapsed{};
+		float m_fadeDuration{};
+		bool m_eventsStarted{}; //events at the start of a state fire on its first update only
+		std::vector<const AnimationEvent*> m_firedEvents;
+		RootMotionSettings m_rootMotionSettings;
+		RootMotion m_rootMotion;
+
+		//scratch, sized once by Bind
+		std::vector<float> m_weights;
+		std::vector<JointPose> m_clipPose;
+		std::vector<JointPose> m_blendPose;
+		std::vector<JointPose> m_previousPose;
+		std::vector<glm::mat4> m_globals;
+		std::vector<glm::mat4> m_pose;
+	};
+}
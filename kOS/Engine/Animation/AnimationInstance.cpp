@@ -0,0 +1,210 @@
+/******************************************************************/
+/*!
+\file      AnimationInstance.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the per entity animation playback state.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AnimationInstance.h"
+
+namespace animation {
+
+	namespace {
+		//assimp leaves ticks per second at 0 when the source file has none
+		constexpr float DEFAULT_TICKS_PER_SECOND = 25.f;
+
+		//events with a time in the segment between "from" and "to", either way round
+		void CollectSegment(const AnimationClip& clip, float from, float to, bool includeFrom,
+			std::vector<const AnimationEvent*>& fired, size_t firstFired)
+		{
+			const std::vector<float>& times = clip.GetEventTimes();
+			const auto push = [&](size_t index) {
+				const AnimationEvent* event = &clip.GetEvents()[index];
+				if (std::find(fired.begin() + firstFired, fired.end(), event) == fired.end()) fired.push_back(event);
+			};
+
+			if (from <= to) {
+				const auto first = includeFrom ? std::lower_bound(times.begin(), times.end(), from) : std::upper_bound(times.begin(), times.end(), from);
+				const auto last = std::upper_bound(times.begin(), times.end(), to);
+				for (auto it = first; it < last; ++it) push(it - times.begin());
+			}
+			else {
+				const auto first = std::lower_bound(times.begin(), times.end(), to);
+				const auto last = includeFrom ? std::upper_bound(times.begin(), times.end(), from) : std::lower_bound(times.begin(), times.end(), from);
+				for (auto it = last; it > first; --it) push(it - 1 - times.begin());
+			}
+		}
+
+		//direction playback moves through the clip
+		float MovingDirection(float ticks, LoopMode loopMode, float direction) {
+			return (loopMode == LoopMode::PingPong ? direction : 1.f) * (ticks > 0.f ? 1.f : -1.f);
+		}
+
+		float WrapAngle(float angle) {
+			angle = std::fmod(angle + glm::pi<float>(), glm::two_pi<float>());
+			return (angle < 0.f ? angle + glm::two_pi<float>() : angle) - glm::pi<float>();
+		}
+
+		/*
+		  Calls segment(from, to, includeFrom) for every stretch of the clip covered moving
+		  "distance" ticks from "time": up to an end of the clip, then on from the other end for
+		  loops or back the other way for ping pong. A loop step ending exactly on the clip end
+		  gets a last empty stretch at the start, which is the same point of the loop.
+		*/
+		template <typename Segment>
+		void WalkSegments(float duration, float time, float distance, float moving, LoopMode loopMode, bool includeStart, Segment&& segment) {
+			float remaining = distance;
+			float position = std::clamp(time, 0.f, duration);
+			bool inclusive = includeStart;
+
+			while (true) {
+				const float end = moving > 0.f ? std::min(duration, position + remaining) : std::max(0.f, position - remaining);
+				segment(position, end, inclusive);
+				remaining -= std::abs(end - position);
+
+				const bool atEnd = moving > 0.f ? end >= duration : end <= 0.f;
+				if (loopMode == LoopMode::Loop && atEnd) {
+					position = moving > 0.f ? 0.f : duration;
+					inclusive = true;
+					if (remaining <= 0.f) {
+						segment(position, position, true);
+						break;
+					}
+					continue;
+				}
+				if (remaining <= 0.f || loopMode != LoopMode::PingPong) break;
+
+				position = end;
+				moving = -moving;
+				inclusive = false;
+			}
+		}
+	}
+
+	void CollectEvents(const AnimationClip& clip, float time, float ticks, LoopMode loopMode, float direction,
+		bool includeStart, std::vector<const AnimationEvent*>& fired)
+	{
+		const float duration = clip.GetDuration();
+		if (clip.GetEvents().empty() || duration <= 0.f || ticks == 0.f) return;
+
+		//one whole cycle crosses every event, the rest would only repeat them
+		const float cycle = loopMode == LoopMode::PingPong ? 2.f * duration : duration;
+		const size_t firstFired = fired.size();
+		WalkSegments(duration, time, std::min(std::abs(ticks), cycle), MovingDirection(ticks, loopMode, direction), loopMode, includeStart,
+			[&](float from, float to, bool includeFrom) { CollectSegment(clip, from, to, includeFrom, fired, firstFired); });
+	}
+
+	RootMotion ExtractRootMotion(const AnimationClip& clip, float time, float ticks, LoopMode loopMode, float direction,
+		const RootMotionSettings& settings, std::vector<KeyCursor>& cursors)
+	{
+		RootMotion motion;
+		const int root = clip.GetRootJoint();
+		if (!settings.enabled || root < 0 || clip.GetDuration() <= 0.f || ticks == 0.f) return motion;
+		cursors.resize(clip.GetTrackCount());
+
+		const glm::vec3 up{ 0.f, 1.f, 0.f };
+		WalkSegments(clip.GetDuration(), time, std::abs(ticks), MovingDirection(ticks, loopMode, direction), loopMode, false,
+			[&](float from, float to, bool) {
+				if (from == to) return;
+
+				//the root at both ends of the stretch, positions telescope over any split of a step
+				const JointPose start = clip.SampleJoint(static_cast<size_t>(root), from, cursors);
+				const JointPose end = clip.SampleJoint(static_cast<size_t>(root), to, cursors);
+				const glm::vec3 delta = clip.RootPosition(end) - clip.RootPosition(start);
+				if (settings.lockYaw) {
+					motion.translation += delta;
+					return;
+				}
+
+				//into the heading the character had at the start of the step
+				const float startYaw = clip.RootYaw(start);
+				motion.translation += glm::angleAxis(motion.yaw - startYaw, up) * delta;
+				motion.yaw += WrapAngle(clip.RootYaw(end) - startYaw);
+			});
+
+		if (settings.lockX) motion.translation.x = 0.f;
+		if (settings.lockY) motion.translation.y = 0.f;
+		if (settings.lockZ) motion.translation.z = 0.f;
+		return motion;
+	}
+
+	void AnimationInstance::Advance(const AnimationClip& clip, float deltaTime, LoopMode loopMode) {
+		m_firedEvents.clear();
+		m_rootMotion = {};
+		const float duration = clip.GetDuration();
+		if (duration <= 0.f) {
+			m_time = 0.f;
+			return;
+		}
+
+		const float ticksPerSecond = clip.GetTicksPerSecond() > 0.f ? clip.GetTicksPerSecond() : DEFAULT_TICKS_PER_SECOND;
+		const float ticks = deltaTime * ticksPerSecond;
+
+		CollectEvents(clip, m_time, ticks, loopMode, m_direction, !m_started, m_firedEvents);
+		m_rootMotion = ExtractRootMotion(clip, m_time, ticks, loopMode, m_direction, m_rootMotionSettings, m_rootCursors);
+		if (ticks != 0.f) m_started = true;
+
+		switch (loopMode) {
+		case LoopMode::Loop:
+			m_time = std::fmod(m_time + ticks, duration);
+			if (m_time < 0.f) m_time += duration;
+			m_finished = false;
+			break;
+
+		case LoopMode::Once:
+			m_time = std::clamp(m_time + ticks, 0.f, duration);
+			m_finished = ticks >= 0.f ? m_time >= duration : m_time <= 0.f;
+			break;
+
+		case LoopMode::PingPong: {
+			//fold the time into one forward and backward cycle
+			const float cycle = 2.f * duration;
+			float position = std::fmod((m_direction > 0.f ? m_time : cycle - m_time) + ticks, cycle);
+			if (position < 0.f) position += cycle;
+
+			m_direction = position < duration ? 1.f : -1.f;
+			m_time = position < duration ? position : cycle - position;
+			m_finished = false;
+			break;
+		}
+		}
+	}
+
+	void AnimationInstance::Bind(const AnimationClip& clip, const void* skeleton,
+		const std::unordered_map<std::string, int>& boneMap, const std::vector<glm::mat4>& boneOffsets)
+	{
+		m_binding = clip.Bind(boneMap, boneOffsets);
+		for (auto& binding : m_binding) {
+			if (binding.bone >= MAX_BONES) binding.bone = -1;
+		}
+
+		m_boundClip = &clip;
+		m_boundSkeleton = skeleton;
+		m_cursors = clip.CreateCursors();
+		m_pose.assign(std::min(boneOffsets.size(), static_cast<size_t>(MAX_BONES)), glm::mat4(1.f));
+	}
+
+	void AnimationInstance::Sample(const AnimationClip& clip, const glm::mat4& globalInverse, uint8_t maxImportance) {
+		if (m_boundClip != &clip) {
+			LOGGING_WARN("Animation Instance: sampled a clip it is not bound to");
+			return;
+		}
+
+		m_globalInverse = globalInverse;
+		clip.SamplePose(m_time, m_cursors, m_binding, glm::mat4(1.f), globalInverse, m_globals, m_pose, m_rootMotionSettings, maxImportance);
+	}
+
+	void AnimationInstance::SolveIk(const AnimationClip& clip, const std::vector<IkConstraint>& constraints) {
+		if (m_boundClip != &clip || constraints.empty() || m_globals.size() != clip.GetJoints().size()) return;
+
+		animation::SolveIk(clip.GetJoints(), constraints, m_globals);
+		clip.ComposeSkinning(m_globals, m_binding, m_globalInverse, m_pose);
+	}
+}
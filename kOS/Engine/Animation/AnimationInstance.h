@@ -0,0 +1,129 @@
+/******************************************************************/
+/*!
+\file      AnimationInstance.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Playback state of one animated entity.
+
+		   Clips are shared, immutable resources. Everything that
+		   changes while a clip plays (time, key cursors, the bone
+		   binding and the pose) lives here, one per entity, so
+		   entities sharing a clip animate independently and can be
+		   sampled on different threads.
+
+		   Advancing also collects the clip's event markers that the
+		   playback crossed, so each one is reported exactly once even
+		   when a frame steps over it, wraps a loop or covers more than
+		   the whole clip.
+
+		   With root motion enabled, Advance also measures how far the
+		   root joint moved over the same stretch of the clip, and
+		   Sample leaves that movement out of the pose.
+
+		   SolveIk runs after Sample, moving the sampled pose by IK
+		   constraints before it is skinned.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "AnimationClip.h"
+#include "InverseKinematics.h"
+
+namespace animation {
+
+	//size of the bone array in the skinning shaders
+	inline constexpr int MAX_BONES = 200;
+
+	enum class LoopMode {
+		Loop,
+		Once,
+		PingPong
+	};
+
+	/*!
+	\brief   Appends to "fired" the events of "clip" crossed moving "ticks" from
+			 "time", in the order playback reaches them and at most once each.
+			 "direction" is the ping pong direction at "time", and
+			 "includeStart" also reports events exactly at "time".
+	*/
+	void CollectEvents(const AnimationClip& clip, float time, float ticks, LoopMode loopMode, float direction,
+		bool includeStart, std::vector<const AnimationEvent*>& fired);
+
+	/*!
+	\brief   Movement of the clip's root joint over the same stretch of the clip
+			 as CollectEvents, with the locked axes zeroed. "cursors" are
+			 resized to the clip and only used for the root joint.
+	*/
+	RootMotion ExtractRootMotion(const AnimationClip& clip, float time, float ticks, LoopMode loopMode, float direction,
+		const RootMotionSettings& settings, std::vector<KeyCursor>& cursors);
+
+	class AnimationInstance {
+	public:
+
+		//moves the playback time by "deltaTime" seconds, negative plays backwards
+		void Advance(const AnimationClip& clip, float deltaTime, LoopMode loopMode);
+
+		void SetRootMotion(const RootMotionSettings& settings) { m_rootMotionSettings = settings; }
+		const RootMotionSettings& GetRootMotionSettings() const { return m_rootMotionSettings; }
+
+		//root motion of the last Advance
+		const RootMotion& GetRootMotion() const { return m_rootMotion; }
+
+		//events crossed by the last Advance, valid while the clip is alive
+		const std::vector<const AnimationEvent*>& GetFiredEvents() const { return m_firedEvents; }
+
+		//clip of the last Bind, whose joints the global transforms are laid out in
+		const AnimationClip* GetBoundClip() const { return m_boundClip; }
+
+		//true if the bone binding was built for this clip and skeleton
+		bool IsBound(const AnimationClip& clip, const void* skeleton) const {
+			return m_boundClip == &clip && m_boundSkeleton == skeleton;
+		}
+
+		//maps the clip joints to the skeleton bones, only needed when either changes
+		void Bind(const AnimationClip& clip, const void* skeleton,
+			const std::unordered_map<std::string, int>& boneMap, const std::vector<glm::mat4>& boneOffsets);
+
+		//skinning matrices at the current time, joints above "maxImportance" hold their bind pose
+		void Sample(const AnimationClip& clip, const glm::mat4& globalInverse = glm::mat4(1.f), uint8_t maxImportance = ALL_JOINTS);
+
+		//moves the last sampled pose by "constraints" and rebuilds its skinning matrices
+		void SolveIk(const AnimationClip& clip, const std::vector<IkConstraint>& constraints);
+
+		float GetTime() const { return m_time; }
+		void SetTime(float time) { m_time = time; m_finished = false; m_started = false; }
+
+		//a clip played once has reached its end
+		bool IsFinished() const { return m_finished; }
+
+		const std::vector<glm::mat4>& GetPose() const { return m_pose; }
+		const std::vector<glm::mat4>& GetGlobalTransforms() const { return m_globals; }
+
+	private:
+
+		float m_time{};         //in clip ticks
+		float m_direction{ 1.f }; //ping pong direction
+		bool m_finished{};
+		bool m_started{};         //events at the start time fire on the first advance only
+		std::vector<const AnimationEvent*> m_firedEvents;
+
+		RootMotionSettings m_rootMotionSettings;
+		RootMotion m_rootMotion;
+		std::vector<KeyCursor> m_rootCursors;
+
+		const AnimationClip* m_boundClip{ nullptr };
+		const void* m_boundSkeleton{ nullptr };
+		std::vector<JointBinding> m_binding;
+
+		std::vector<KeyCursor> m_cursors;
+		glm::mat4 m_globalInverse{ 1.f };
+		std::vector<glm::mat4> m_globals;
+		std::vector<glm::mat4> m_pose;
+	};
+}
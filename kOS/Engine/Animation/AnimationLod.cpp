@@ -0,0 +1,146 @@
+/******************************************************************/
+/*!
+\file      AnimationLod.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the animation level of detail scheduler.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AnimationLod.h"
+
+namespace animation {
+
+	namespace {
+
+		//full rate down to a quarter of the screen height, then fewer frames and joints
+		const std::vector<LodLevel> DEFAULT_LEVELS = {
+			{ 0.25f, 1, ALL_JOINTS },
+			{ 0.1f, 2, JOINT_DETAIL },
+			{ 0.03f, 4, JOINT_ESSENTIAL },
+			{ 0.f, 8, JOINT_ESSENTIAL },
+		};
+
+		glm::vec4 Row(const glm::mat4& m, int row) {
+			return { m[0][row], m[1][row], m[2][row], m[3][row] };
+		}
+	}
+
+	LodCamera MakeLodCamera(const glm::vec3& position, const glm::mat4& view, const glm::mat4& projection, float fov) {
+		LodCamera camera;
+		camera.position = position;
+		camera.viewProjection = projection * view;
+		camera.tanHalfFov = std::tan(glm::radians(glm::clamp(fov, 1.f, 179.f)) * 0.5f);
+		return camera;
+	}
+
+	float ScreenSize(const LodCamera& camera, const glm::vec3& center, float radius) {
+		const float distance = glm::length(center - camera.position);
+		if (distance <= radius) return 1.f;
+		return radius / (distance * camera.tanHalfFov);
+	}
+
+	bool IsVisible(const LodCamera& camera, const glm::vec3& center, float radius) {
+		//planes of the clip volume, -w <= x, y, z <= w, taken from the rows of the matrix
+		const glm::mat4& m = camera.viewProjection;
+		const glm::vec4 w = Row(m, 3);
+		for (int axis = 0; axis < 3; ++axis) {
+			for (const float side : { 1.f, -1.f }) {
+				const glm::vec4 plane = w + side * Row(m, axis);
+				const float length = glm::length(glm::vec3(plane));
+				if (length <= 0.f) continue;
+				if (glm::dot(glm::vec3(plane), center) + plane.w < -radius * length) return false;
+			}
+		}
+		return true;
+	}
+
+	LodView MeasureView(const std::vector<LodCamera>& cameras, const glm::vec3& center, float radius) {
+		LodView view;
+		for (const LodCamera& camera : cameras) {
+			if (!IsVisible(camera, center, radius)) continue;
+			view.visible = true;
+			view.screenSize = std::max(view.screenSize, ScreenSize(camera, center, radius));
+		}
+		return view;
+	}
+
+	LodScheduler::LodScheduler() : m_levels(DEFAULT_LEVELS) {}
+
+	void LodScheduler::SetLevels(std::vector<LodLevel> levels) {
+		for (LodLevel& level : levels) level.interval = std::max(level.interval, 1);
+		std::stable_sort(levels.begin(), levels.end(), [](const LodLevel& a, const LodLevel& b) { return a.minScreenSize > b.minScreenSize; });
+		m_levels = levels.empty() ? DEFAULT_LEVELS : std::move(levels);
+	}
+
+	void LodScheduler::BeginFrame() {
+		++m_frame;
+		m_evaluations = 0;
+		m_jointEvaluations = 0;
+		m_frozen = 0;
+	}
+
+	int LodScheduler::PickLevel(float screenSize) const {
+		for (size_t i = 0; i < m_levels.size(); ++i) {
+			if (screenSize >= m_levels[i].minScreenSize) return static_cast<int>(i);
+		}
+		return static_cast<int>(m_levels.size()) - 1;
+	}
+
+	LodDecision LodScheduler::Schedule(LodState& state, const LodView& view) {
+		LodDecision decision;
+
+		//phases are handed out in turn, so characters of one level land on different frames
+		if (state.level < 0) state.phase = m_nextPhase++;
+
+		if (!view.visible && state.evaluated) {
+			state.frozen = true;
+			decision.frozen = true;
+			++m_frozen;
+			return decision;
+		}
+
+		const int level = PickLevel(view.screenSize);
+		const LodLevel& lod = m_levels[level];
+		const uint32_t interval = static_cast<uint32_t>(lod.interval);
+		const uint32_t waited = m_frame - state.lastEvaluated;
+		decision.maxImportance = lod.maxImportance;
+
+		//a character without a pose, or coming back on screen with a stale one, cannot wait
+		const bool urgent = !state.evaluated || state.frozen;
+		const bool due = (m_frame + state.phase) % interval == 0 || waited >= interval;
+		const bool overBudget = m_budget > 0 && m_evaluations >= m_budget;
+		decision.evaluate = urgent || (due && (!overBudget || waited >= 2 * interval));
+
+		state.level = level;
+		state.frozen = false;
+		if (decision.evaluate) {
+			state.evaluated = true;
+			state.lastEvaluated = m_frame;
+			state.blendFrames = urgent ? 0 : interval;
+			++m_evaluations;
+		}
+
+		const uint32_t since = m_frame - state.lastEvaluated;
+		if (state.blendFrames > 1 && since + 1 < state.blendFrames) {
+			decision.blend = static_cast<float>(since + 1) / static_cast<float>(state.blendFrames);
+		}
+		return decision;
+	}
+
+	void BlendPoses(const std::vector<glm::mat4>& from, const std::vector<glm::mat4>& to, float t, std::vector<glm::mat4>& out) {
+		out.resize(to.size());
+		if (from.size() != to.size() || t >= 1.f) {
+			std::copy(to.begin(), to.end(), out.begin());
+			return;
+		}
+		for (size_t i = 0; i < to.size(); ++i) {
+			out[i] = from[i] + (to[i] - from[i]) * t;
+		}
+	}
+}
@@ -0,0 +1,135 @@
+/******************************************************************/
+/*!
+\file      AnimationLod.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Level of detail for skinned characters, picked from how
+		   much of the screen they cover.
+
+		   Each character's bounding sphere is measured against every
+		   camera: the share of the screen height it covers picks a
+		   level, which sets how many frames pass between pose
+		   evaluations and the least important joint that is still
+		   sampled (see animation::JOINT_ESSENTIAL). A character no
+		   camera sees is not evaluated at all and keeps its last pose.
+
+		   Playback time, events and root motion still advance every
+		   frame, only the pose is throttled. Each evaluation is
+		   blended in over the frames until the next one, starting from
+		   the pose shown when it was taken, so a character updated
+		   every fourth frame moves smoothly, one interval behind.
+
+		   LodScheduler spreads the evaluations: every character gets
+		   its own phase, so a crowd at the same level is split evenly
+		   over the frames of the interval instead of all evaluating on
+		   the same frame. An optional budget caps the evaluations per
+		   frame, characters over it wait for a later frame, but never
+		   longer than another interval.
+
+		   Nothing here touches the renderer, cameras are reduced to
+		   LodCamera by the caller.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "AnimationClip.h"
+
+namespace animation {
+
+	//what LOD needs of a camera, all in world space
+	struct LodCamera {
+		glm::vec3 position{ 0.f };
+		glm::mat4 viewProjection{ 1.f };
+		float tanHalfFov{ 1.f }; //tangent of half the vertical field of view
+	};
+
+	//perspective camera, "fov" is the vertical field of view in degrees
+	LodCamera MakeLodCamera(const glm::vec3& position, const glm::mat4& view, const glm::mat4& projection, float fov);
+
+	//share of the screen height the sphere covers, 1 or more when the camera is inside it
+	float ScreenSize(const LodCamera& camera, const glm::vec3& center, float radius);
+
+	//false only if the sphere is wholly outside the view frustum
+	bool IsVisible(const LodCamera& camera, const glm::vec3& center, float radius);
+
+	struct LodLevel {
+		float minScreenSize{};  //the first level whose size the character reaches is used
+		int interval{ 1 };      //frames between pose evaluations
+		uint8_t maxImportance{ ALL_JOINTS };
+	};
+
+	//largest size and whether any camera sees the sphere
+	struct LodView {
+		float screenSize{};
+		bool visible{};
+	};
+
+	LodView MeasureView(const std::vector<LodCamera>& cameras, const glm::vec3& center, float radius);
+
+	//per character scheduling state, owned by the character
+	struct LodState {
+		int level{ -1 };         //-1 until the first Schedule
+		uint32_t phase{};
+		uint32_t lastEvaluated{};
+		uint32_t blendFrames{};  //frames the last evaluation is blended in over, 0 shows it at once
+		bool evaluated{};        //a pose exists to hold or blend from
+		bool frozen{};           //offscreen, the pose is held
+	};
+
+	//what the caller does with the pose this frame
+	struct LodDecision {
+		bool evaluate{};          //sample the pose
+		bool frozen{};            //keep the last pose
+		uint8_t maxImportance{ ALL_JOINTS };
+		float blend{ 1.f };       //from the pose shown before the last evaluation to it, 1 shows it as sampled
+	};
+
+	class LodScheduler {
+	public:
+
+		LodScheduler();
+
+		//levels sorted from the largest size down, the last one catches everything smaller
+		void SetLevels(std::vector<LodLevel> levels);
+		const std::vector<LodLevel>& GetLevels() const { return m_levels; }
+
+		//most evaluations per frame before characters start to wait, 0 for no limit
+		void SetBudget(size_t evaluations) { m_budget = evaluations; }
+		size_t GetBudget() const { return m_budget; }
+
+		//starts a frame and clears its counters
+		void BeginFrame();
+
+		int PickLevel(float screenSize) const;
+
+		LodDecision Schedule(LodState& state, const LodView& view);
+
+		//counted by the caller after evaluating, Schedule only counts the evaluations
+		void AddJointEvaluations(size_t joints) { m_jointEvaluations += joints; }
+
+		uint32_t GetFrame() const { return m_frame; }
+		size_t GetEvaluations() const { return m_evaluations; }
+		size_t GetJointEvaluations() const { return m_jointEvaluations; }
+		size_t GetFrozen() const { return m_frozen; }
+
+	private:
+
+		std::vector<LodLevel> m_levels;
+		size_t m_budget{};
+		uint32_t m_frame{};
+		uint32_t m_nextPhase{};
+
+		size_t m_evaluations{};
+		size_t m_jointEvaluations{};
+		size_t m_frozen{};
+	};
+
+	//"out" = "from" blended towards "to" by "t", per element of matrices that are near each other
+	void BlendPoses(const std::vector<glm::mat4>& from, const std::vector<glm::mat4>& to, float t, std::vector<glm::mat4>& out);
+}
@@ -0,0 +1,248 @@
+/******************************************************************/
+/*!
+\file      CpuSkinning.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the CPU skinning paths.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "CpuSkinning.h"
+
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define KOS_SKINNING_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace animation {
+
+	namespace {
+
+		struct SkinVertex {
+			glm::vec3 position;
+			glm::vec3 normal;
+			int boneIds[SKINNING_INFLUENCES];
+			float weights[SKINNING_INFLUENCES];
+		};
+
+		//fields are copied out, the source layout does not have to be aligned
+		SkinVertex ReadVertex(const SkinningInput& input, size_t index) {
+			const std::byte* vertex = input.vertices + index * input.stride;
+			SkinVertex out;
+			std::memcpy(&out.position, vertex + input.positionOffset, sizeof(glm::vec3));
+			std::memcpy(&out.normal, vertex + input.normalOffset, sizeof(glm::vec3));
+			std::memcpy(out.boneIds, vertex + input.boneIdOffset, sizeof(out.boneIds));
+			std::memcpy(out.weights, vertex + input.weightOffset, sizeof(out.weights));
+			return out;
+		}
+
+		bool IsInfluence(const SkinVertex& vertex, int i, size_t paletteSize) {
+			return vertex.weights[i] != 0.f && vertex.boneIds[i] >= 0 && static_cast<size_t>(vertex.boneIds[i]) < paletteSize;
+		}
+
+		void LinearBlendScalar(const SkinningInput& input, const std::vector<glm::mat4>& palette, size_t begin, size_t end,
+			glm::vec3* positions, glm::vec3* normals) {
+			for (size_t v = begin; v < end; ++v) {
+				const SkinVertex vertex = ReadVertex(input, v);
+
+				glm::mat4 blend{ 0.f };
+				bool influenced = false;
+				for (int i = 0; i < SKINNING_INFLUENCES; ++i) {
+					if (!IsInfluence(vertex, i, palette.size())) continue;
+					blend += palette[vertex.boneIds[i]] * vertex.weights[i];
+					influenced = true;
+				}
+
+				if (!influenced) {
+					positions[v] = vertex.position;
+					normals[v] = vertex.normal;
+					continue;
+				}
+				positions[v] = glm::vec3(blend * glm::vec4(vertex.position, 1.f));
+				normals[v] = glm::mat3(blend) * vertex.normal;
+			}
+		}
+
+#ifdef KOS_SKINNING_SSE
+		//blends the four palette columns in registers, glm matrices are column major
+		void LinearBlendSse(const SkinningInput& input, const std::vector<glm::mat4>& palette, size_t begin, size_t end,
+			glm::vec3* positions, glm::vec3* normals) {
+			alignas(16) float result[4];
+			for (size_t v = begin; v < end; ++v) {
+				const SkinVertex vertex = ReadVertex(input, v);
+
+				__m128 column0 = _mm_setzero_ps(), column1 = _mm_setzero_ps(), column2 = _mm_setzero_ps(), column3 = _mm_setzero_ps();
+				bool influenced = false;
+				for (int i = 0; i < SKINNING_INFLUENCES; ++i) {
+					if (!IsInfluence(vertex, i, palette.size())) continue;
+					const float* bone = &palette[vertex.boneIds[i]][0][0];
+					const __m128 weight = _mm_set1_ps(vertex.weights[i]);
+					column0 = _mm_add_ps(column0, _mm_mul_ps(_mm_loadu_ps(bone), weight));
+					column1 = _mm_add_ps(column1, _mm_mul_ps(_mm_loadu_ps(bone + 4), weight));
+					column2 = _mm_add_ps(column2, _mm_mul_ps(_mm_loadu_ps(bone + 8), weight));
+					column3 = _mm_add_ps(column3, _mm_mul_ps(_mm_loadu_ps(bone + 12), weight));
+					influenced = true;
+				}
+
+				if (!influenced) {
+					positions[v] = vertex.position;
+					normals[v] = vertex.normal;
+					continue;
+				}
+
+				const __m128 x = _mm_set1_ps(vertex.normal.x), y = _mm_set1_ps(vertex.normal.y), z = _mm_set1_ps(vertex.normal.z);
+				const __m128 normal = _mm_add_ps(_mm_add_ps(_mm_mul_ps(column0, x), _mm_mul_ps(column1, y)), _mm_mul_ps(column2, z));
+				_mm_store_ps(result, normal);
+				normals[v] = glm::vec3{ result[0], result[1], result[2] };
+
+				const __m128 px = _mm_set1_ps(vertex.position.x), py = _mm_set1_ps(vertex.position.y), pz = _mm_set1_ps(vertex.position.z);
+				const __m128 position = _mm_add_ps(_mm_add_ps(_mm_mul_ps(column0, px), _mm_mul_ps(column1, py)),
+					_mm_add_ps(_mm_mul_ps(column2, pz), column3));
+				_mm_store_ps(result, position);
+				positions[v] = glm::vec3{ result[0], result[1], result[2] };
+			}
+		}
+#endif
+
+		//blends the dual quaternions in the hemisphere of the first influence
+		void DualQuaternionRange(const SkinningInput& input, const std::vector<DualQuaternion>& palette, bool simd, size_t begin, size_t end,
+			glm::vec3* positions, glm::vec3* normals) {
+			for (size_t v = begin; v < end; ++v) {
+				const SkinVertex vertex = ReadVertex(input, v);
+
+				DualQuaternion blend{ glm::quat{ 0.f, 0.f, 0.f, 0.f }, glm::quat{ 0.f, 0.f, 0.f, 0.f } };
+				const glm::quat* pivot = nullptr;
+
+#ifdef KOS_SKINNING_SSE
+				__m128 real = _mm_setzero_ps(), dual = _mm_setzero_ps();
+#endif
+				for (int i = 0; i < SKINNING_INFLUENCES; ++i) {
+					if (!IsInfluence(vertex, i, palette.size())) continue;
+
+					const DualQuaternion& bone = palette[vertex.boneIds[i]];
+					if (!pivot) pivot = &bone.real;
+					const float weight = glm::dot(*pivot, bone.real) < 0.f ? -vertex.weights[i] : vertex.weights[i];
+
+#ifdef KOS_SKINNING_SSE
+					if (simd) {
+						const __m128 w = _mm_set1_ps(weight);
+						real = _mm_add_ps(real, _mm_mul_ps(_mm_loadu_ps(&bone.real.x), w));
+						dual = _mm_add_ps(dual, _mm_mul_ps(_mm_loadu_ps(&bone.dual.x), w));
+						continue;
+					}
+#endif
+					blend.real += bone.real * weight;
+					blend.dual += bone.dual * weight;
+				}
+
+				if (!pivot) {
+					positions[v] = vertex.position;
+					normals[v] = vertex.normal;
+					continue;
+				}
+
+#ifdef KOS_SKINNING_SSE
+				if (simd) {
+					_mm_storeu_ps(&blend.real.x, real);
+					_mm_storeu_ps(&blend.dual.x, dual);
+				}
+#endif
+				const float length = glm::length(blend.real);
+				blend.real /= length;
+				blend.dual /= length;
+
+				positions[v] = TransformPoint(blend, vertex.position);
+				normals[v] = blend.real * vertex.normal;
+			}
+		}
+
+		unsigned int WorkerCount(const SkinningSettings& settings, size_t count) {
+			unsigned int threads = settings.threadCount ? settings.threadCount : std::max(1u, std::thread::hardware_concurrency());
+			const size_t ranges = std::max<size_t>(1, count / std::max<size_t>(1, settings.minVerticesPerThread));
+			return static_cast<unsigned int>(std::min<size_t>(threads, ranges));
+		}
+	}
+
+	//glm::quat stores x, y, z, w in that order, the SSE loads above rely on it
+	static_assert(sizeof(glm::quat) == 4 * sizeof(float) && offsetof(DualQuaternion, dual) == sizeof(glm::quat));
+
+	DualQuaternion ToDualQuaternion(const glm::mat4& transform) {
+		const glm::mat3 rotation{ glm::normalize(glm::vec3(transform[0])), glm::normalize(glm::vec3(transform[1])),
+			glm::normalize(glm::vec3(transform[2])) };
+
+		DualQuaternion dq;
+		dq.real = glm::normalize(glm::quat_cast(rotation));
+		const glm::vec3 translation{ transform[3] };
+		dq.dual = glm::quat{ 0.f, translation.x, translation.y, translation.z } * dq.real * 0.5f;
+		return dq;
+	}
+
+	glm::vec3 TransformPoint(const DualQuaternion& dq, const glm::vec3& point) {
+		const glm::quat translation = dq.dual * glm::conjugate(dq.real) * 2.f;
+		return dq.real * point + glm::vec3{ translation.x, translation.y, translation.z };
+	}
+
+	bool HasSimdSkinning() {
+#ifdef KOS_SKINNING_SSE
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	void SkinVertices(const SkinningInput& input, const std::vector<glm::mat4>& palette, const SkinningSettings& settings,
+		std::vector<glm::vec3>& positions, std::vector<glm::vec3>& normals) {
+		positions.resize(input.count);
+		normals.resize(input.count);
+		if (!input.count || !input.vertices) return;
+
+		const bool simd = settings.simd && HasSimdSkinning();
+
+		//converted once per call, every range reads the same palette
+		std::vector<DualQuaternion> dualPalette;
+		if (settings.method == SkinningMethod::DualQuaternion) {
+			dualPalette.reserve(palette.size());
+			for (const glm::mat4& bone : palette) dualPalette.push_back(ToDualQuaternion(bone));
+		}
+
+		auto skinRange = [&](size_t begin, size_t end) {
+			if (settings.method == SkinningMethod::DualQuaternion) {
+				DualQuaternionRange(input, dualPalette, simd, begin, end, positions.data(), normals.data());
+				return;
+			}
+#ifdef KOS_SKINNING_SSE
+			if (simd) {
+				LinearBlendSse(input, palette, begin, end, positions.data(), normals.data());
+				return;
+			}
+#endif
+			LinearBlendScalar(input, palette, begin, end, positions.data(), normals.data());
+		};
+
+		const unsigned int workers = WorkerCount(settings, input.count);
+		if (workers <= 1) {
+			skinRange(0, input.count);
+			return;
+		}
+
+		//ranges write disjoint parts of the output, the calling thread takes the last one
+		const size_t rangeSize = (input.count + workers - 1) / workers;
+		std::vector<std::thread> threads;
+		threads.reserve(workers - 1);
+		for (unsigned int w = 0; w + 1 < workers; ++w) {
+			const size_t begin = w * rangeSize;
+			threads.emplace_back(skinRange, begin, std::min(input.count, begin + rangeSize));
+		}
+		skinRange(std::min(input.count, (workers - 1) * rangeSize), input.count);
+
+		for (std::thread& thread : threads) thread.join();
+	}
+}
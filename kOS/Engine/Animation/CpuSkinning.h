@@ -0,0 +1,83 @@
+/******************************************************************/
+/*!
+\file      CpuSkinning.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Skinning on the CPU, with linear blend and dual quaternion
+		   methods.
+
+		   Works on any interleaved vertex layout with a position, a
+		   normal, four bone ids and four weights, such as the vertices
+		   of R_Model (see R_Model::GetSkinningInput). The bone palette
+		   is the pose of an AnimationInstance or ControllerInstance.
+
+		   Linear blend follows the skinning shaders: the palette
+		   matrices are blended by weight, the position is transformed
+		   by the blend and the normal by its upper 3x3, without
+		   normalizing. It is meant both as a fallback when the skinned
+		   shader is too costly and as the reference output the shader
+		   is tested against.
+
+		   Ids outside the palette are skipped, and a vertex without a
+		   valid influence keeps its rest position and normal (the
+		   shader collapses it instead).
+
+		   Vertices are split in ranges over worker threads, and
+		   blended with SSE where the target has it.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+namespace animation {
+
+	//bone influences per vertex, same as the skinning shaders
+	inline constexpr int SKINNING_INFLUENCES = 4;
+
+	enum class SkinningMethod {
+		LinearBlend,
+		DualQuaternion   //no candy wrapper on twisting joints, ignores scale in the palette
+	};
+
+	//strided view of interleaved vertices, offsets are in bytes from the start of a vertex
+	struct SkinningInput {
+		const std::byte* vertices{ nullptr };
+		size_t stride{};
+		size_t count{};
+		size_t positionOffset{};  //glm::vec3
+		size_t normalOffset{};    //glm::vec3
+		size_t boneIdOffset{};    //int[SKINNING_INFLUENCES]
+		size_t weightOffset{};    //float[SKINNING_INFLUENCES]
+	};
+
+	struct SkinningSettings {
+		SkinningMethod method = SkinningMethod::LinearBlend;
+		unsigned int threadCount = 1;       //0 uses every hardware thread
+		size_t minVerticesPerThread = 4096; //smaller ranges are not worth a thread
+		bool simd = true;                   //false forces the scalar path
+	};
+
+	struct DualQuaternion {
+		glm::quat real{ 1.f, 0.f, 0.f, 0.f };
+		glm::quat dual{ 0.f, 0.f, 0.f, 0.f };
+	};
+
+	//rigid part of "transform", scale and shear are dropped
+	DualQuaternion ToDualQuaternion(const glm::mat4& transform);
+
+	//"point" rotated then translated by a unit dual quaternion
+	glm::vec3 TransformPoint(const DualQuaternion& dq, const glm::vec3& point);
+
+	//fills "positions" and "normals" with one entry per input vertex
+	void SkinVertices(const SkinningInput& input, const std::vector<glm::mat4>& palette, const SkinningSettings& settings,
+		std::vector<glm::vec3>& positions, std::vector<glm::vec3>& normals);
+
+	//true when SkinVertices can use SSE on this target
+	bool HasSimdSkinning();
+}
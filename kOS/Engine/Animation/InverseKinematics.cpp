@@ -0,0 +1,240 @@
+/******************************************************************/
+/*!
+\file      InverseKinematics.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the inverse kinematics solvers.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "InverseKinematics.h"
+
+namespace animation {
+
+	namespace {
+
+		constexpr float EPSILON = 1e-6f;
+
+		glm::vec3 Position(const glm::mat4& global) {
+			return glm::vec3{ global[3] };
+		}
+
+		float Angle(const glm::vec3& from, const glm::vec3& to) {
+			return std::acos(glm::clamp(glm::dot(from, to), -1.f, 1.f));
+		}
+
+		//any unit vector at right angles to the unit vector "v"
+		glm::vec3 Perpendicular(const glm::vec3& v) {
+			const glm::vec3 other = std::abs(v.x) < 0.9f ? glm::vec3{ 1.f, 0.f, 0.f } : glm::vec3{ 0.f, 1.f, 0.f };
+			return glm::normalize(glm::cross(v, other));
+		}
+
+		//shortest rotation taking the unit vector "from" onto the unit vector "to"
+		glm::quat Arc(const glm::vec3& from, const glm::vec3& to) {
+			const float cosine = glm::dot(from, to);
+			if (cosine < -1.f + EPSILON) return glm::angleAxis(glm::pi<float>(), Perpendicular(from));
+			const glm::vec3 axis = glm::cross(from, to);
+			return glm::normalize(glm::quat{ 1.f + cosine, axis.x, axis.y, axis.z });
+		}
+
+		//unit "direction" pulled back into the cone of "halfAngle" around the unit "reference"
+		glm::vec3 LimitCone(const glm::vec3& direction, const glm::vec3& reference, float halfAngle) {
+			if (halfAngle >= glm::pi<float>() || Angle(reference, direction) <= halfAngle) return direction;
+			glm::vec3 axis = glm::cross(reference, direction);
+			axis = glm::length(axis) < EPSILON ? Perpendicular(reference) : glm::normalize(axis);
+			return glm::angleAxis(halfAngle, axis) * reference;
+		}
+
+		bool IsBelow(const std::vector<Joint>& joints, int joint, int ancestor) {
+			//parents always come before their children
+			while (joint > ancestor) joint = joints[joint].parent;
+			return joint == ancestor;
+		}
+
+		bool IsValid(const IkConstraint& constraint, size_t minimum, size_t jointCount) {
+			if (constraint.chain.size() < minimum) return false;
+			for (const int joint : constraint.chain) {
+				if (joint < 0 || static_cast<size_t>(joint) >= jointCount) return false;
+			}
+			return true;
+		}
+	}
+
+	bool BuildChain(const std::vector<Joint>& joints, int root, int end, std::vector<int>& chain) {
+		chain.clear();
+		const int count = static_cast<int>(joints.size());
+		if (root < 0 || end < 0 || root >= count || end >= count) return false;
+
+		for (int joint = end; joint >= root; joint = joints[joint].parent) {
+			chain.push_back(joint);
+			if (joint == root) {
+				std::reverse(chain.begin(), chain.end());
+				return true;
+			}
+		}
+		chain.clear();
+		return false;
+	}
+
+	void RotateJoint(const std::vector<Joint>& joints, std::vector<glm::mat4>& globals, int joint, const glm::quat& rotation) {
+		const glm::vec3 pivot = Position(globals[joint]);
+		const glm::mat4 move = glm::translate(glm::mat4(1.f), pivot) * glm::mat4_cast(rotation) * glm::translate(glm::mat4(1.f), -pivot);
+
+		const size_t count = std::min(globals.size(), joints.size());
+		globals[joint] = move * globals[joint];
+		for (size_t i = static_cast<size_t>(joint) + 1; i < count; ++i) {
+			if (IsBelow(joints, static_cast<int>(i), joint)) globals[i] = move * globals[i];
+		}
+	}
+
+	float SolveTwoBone(const std::vector<Joint>& joints, const IkConstraint& constraint, std::vector<glm::mat4>& globals) {
+		if (!IsValid(constraint, 3, globals.size())) return 0.f;
+
+		const int root = constraint.chain.front();
+		const int middle = constraint.chain[constraint.chain.size() - 2];
+		const int end = constraint.chain.back();
+
+		glm::vec3 a = Position(globals[root]), b = Position(globals[middle]), c = Position(globals[end]);
+		const glm::vec3 target = glm::mix(c, constraint.target, constraint.weight);
+		const float upper = glm::length(b - a), lower = glm::length(c - b);
+		if (upper < EPSILON || lower < EPSILON) return glm::length(c - target);
+
+		//bend of the middle joint that puts the effector at the target distance, 0 is straight
+		const float reach = glm::clamp(glm::length(target - a), std::abs(upper - lower) + EPSILON, upper + lower - EPSILON);
+		const float interior = std::acos(glm::clamp((upper * upper + lower * lower - reach * reach) / (2.f * upper * lower), -1.f, 1.f));
+		const float bend = glm::clamp(glm::pi<float>() - interior, constraint.minAngle, constraint.maxAngle);
+
+		//turn the middle joint in the plane of the limb, a straight limb bends towards the pole
+		glm::vec3 axis = glm::cross(a - b, c - b);
+		if (glm::length(axis) < EPSILON * upper * lower && constraint.usePole) axis = glm::cross(a - b, constraint.pole - b);
+		axis = glm::length(axis) < EPSILON * upper * lower ? Perpendicular(glm::normalize(a - b)) : glm::normalize(axis);
+		const float currentInterior = Angle(glm::normalize(a - b), glm::normalize(c - b));
+		RotateJoint(joints, globals, middle, glm::angleAxis((glm::pi<float>() - bend) - currentInterior, axis));
+
+		//aim the root so the effector lies on the line to the target
+		c = Position(globals[end]);
+		if (glm::length(target - a) > EPSILON && glm::length(c - a) > EPSILON) {
+			RotateJoint(joints, globals, root, Arc(glm::normalize(c - a), glm::normalize(target - a)));
+		}
+
+		//twist the limb about that line until the middle joint faces the pole
+		if (constraint.usePole) {
+			b = Position(globals[middle]);
+			c = Position(globals[end]);
+			if (glm::length(c - a) > EPSILON) {
+				const glm::vec3 line = glm::normalize(c - a);
+				const glm::vec3 current = (b - a) - line * glm::dot(b - a, line);
+				const glm::vec3 wanted = (constraint.pole - a) - line * glm::dot(constraint.pole - a, line);
+				if (glm::length(current) > EPSILON && glm::length(wanted) > EPSILON) {
+					const float twist = std::atan2(glm::dot(glm::cross(current, wanted), line), glm::dot(current, wanted));
+					RotateJoint(joints, globals, root, glm::angleAxis(twist, line));
+				}
+			}
+		}
+
+		return glm::length(Position(globals[end]) - target);
+	}
+
+	float SolveFabrik(const std::vector<Joint>& joints, const IkConstraint& constraint, std::vector<glm::mat4>& globals) {
+		if (!IsValid(constraint, 2, globals.size())) return 0.f;
+
+		const std::vector<int>& chain = constraint.chain;
+		const size_t count = chain.size();
+
+		std::vector<glm::vec3> points(count);
+		std::vector<float> lengths(count - 1);
+		for (size_t i = 0; i < count; ++i) points[i] = Position(globals[chain[i]]);
+		for (size_t i = 0; i + 1 < count; ++i) lengths[i] = glm::length(points[i + 1] - points[i]);
+
+		const glm::vec3 target = glm::mix(points.back(), constraint.target, constraint.weight);
+		const glm::vec3 base = points.front();
+		const glm::vec3 rootDirection = lengths[0] > EPSILON ? (points[1] - base) / lengths[0] : glm::vec3{ 0.f, 1.f, 0.f };
+
+		//root to tip with the root held, each segment kept in the cone of the one before
+		auto backward = [&](bool towardsTarget) {
+			points[0] = base;
+			glm::vec3 reference = rootDirection;
+			for (size_t i = 0; i + 1 < count; ++i) {
+				const glm::vec3 next = towardsTarget ? target : points[i + 1];
+				glm::vec3 direction = next - points[i];
+				direction = glm::length(direction) < EPSILON ? reference : glm::normalize(direction);
+				direction = LimitCone(direction, reference, constraint.maxAngle);
+				points[i + 1] = points[i] + direction * lengths[i];
+				reference = direction;
+			}
+		};
+
+		const float total = std::accumulate(lengths.begin(), lengths.end(), 0.f);
+		if (glm::length(target - base) >= total) {
+			//out of reach, the chain points straight at the target as far as its limits allow
+			backward(true);
+		}
+		else {
+			for (int iteration = 0; iteration < constraint.iterations && glm::length(points.back() - target) > constraint.tolerance; ++iteration) {
+				//tip to root with the tip on the target
+				points.back() = target;
+				for (size_t i = count - 1; i-- > 0;) {
+					glm::vec3 direction = points[i] - points[i + 1];
+					direction = glm::length(direction) < EPSILON ? -rootDirection : glm::normalize(direction);
+					points[i] = points[i + 1] + direction * lengths[i];
+				}
+				backward(false);
+			}
+		}
+
+		//each joint takes the shortest turn onto its solved segment, its children are already carried to their points
+		for (size_t i = 0; i + 1 < count; ++i) {
+			const glm::vec3 current = Position(globals[chain[i + 1]]) - Position(globals[chain[i]]);
+			const glm::vec3 solved = points[i + 1] - points[i];
+			if (glm::length(current) < EPSILON || glm::length(solved) < EPSILON) continue;
+			RotateJoint(joints, globals, chain[i], Arc(glm::normalize(current), glm::normalize(solved)));
+		}
+
+		return glm::length(Position(globals[chain.back()]) - target);
+	}
+
+	float SolveLookAt(const std::vector<Joint>& joints, const IkConstraint& constraint, std::vector<glm::mat4>& globals) {
+		if (!IsValid(constraint, 1, globals.size())) return 0.f;
+
+		const int joint = constraint.chain.back();
+		const glm::vec3 toTarget = constraint.target - Position(globals[joint]);
+		const glm::vec3 axis = glm::mat3(globals[joint]) * constraint.axis;
+		if (glm::length(toTarget) < EPSILON || glm::length(axis) < EPSILON) return 0.f;
+
+		const glm::vec3 current = glm::normalize(axis);
+		const glm::vec3 wanted = glm::normalize(toTarget);
+		const glm::vec3 limited = LimitCone(wanted, current, constraint.maxAngle);
+		RotateJoint(joints, globals, joint, glm::slerp(glm::quat{ 1.f, 0.f, 0.f, 0.f }, Arc(current, limited), constraint.weight));
+
+		return Angle(glm::normalize(glm::mat3(globals[joint]) * constraint.axis), wanted);
+	}
+
+	void SolveIk(const std::vector<Joint>& joints, const std::vector<IkConstraint>& constraints, std::vector<glm::mat4>& globals) {
+		for (const IkConstraint& constraint : constraints) {
+			if (constraint.weight <= 0.f) continue;
+
+			switch (constraint.solver) {
+			case IkSolver::TwoBone: SolveTwoBone(joints, constraint, globals); break;
+			case IkSolver::Fabrik:  SolveFabrik(joints, constraint, globals); break;
+			case IkSolver::LookAt:  SolveLookAt(joints, constraint, globals); break;
+			}
+		}
+	}
+
+	bool PlaceOnGround(const IkRaycast& raycast, const glm::vec3& effector, const glm::vec3& origin, const glm::vec3& up,
+		float reach, glm::vec3& target)
+	{
+		if (!raycast || reach <= 0.f) return false;
+
+		IkHit hit;
+		if (!raycast(effector + up * reach, -up, 2.f * reach, hit)) return false;
+
+		target = effector + up * glm::dot(hit.point - origin, up);
+		return true;
+	}
+}
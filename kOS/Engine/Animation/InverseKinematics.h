@@ -0,0 +1,91 @@
+/******************************************************************/
+/*!
+\file      InverseKinematics.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Inverse kinematics solvers run on a sampled pose.
+
+		   The solvers work on the model space transforms of the
+		   flattened joint array (AnimationInstance::GetGlobalTransforms
+		   and ControllerInstance::GetGlobalTransforms). A joint is
+		   turned about its own origin and every joint below it follows,
+		   so bone lengths are kept and the rest of the pose is
+		   untouched.
+
+		   - TwoBone: analytic solve of a limb (hip, knee, ankle), the
+		     bend is kept in a range and can face a pole.
+		   - Fabrik: iterative solve of a chain of any length (spine,
+		     tail), each segment stays in a cone around the one before.
+		   - LookAt: turns one joint so an axis points at the target,
+		     within a cone around the animated direction.
+
+		   Targets come from the caller. PlaceOnGround adds the ground
+		   under an effector through a raycast callback, the engine
+		   passes PhysicsManager::Raycast and tests pass a stub.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "AnimationClip.h"
+
+namespace animation {
+
+	enum class IkSolver {
+		TwoBone,
+		Fabrik,
+		LookAt
+	};
+
+	struct IkConstraint {
+		IkSolver solver = IkSolver::TwoBone;
+		std::vector<int> chain;          //joints from the chain root to the effector, see BuildChain
+		glm::vec3 target{ 0.f };         //model space
+		glm::vec3 pole{ 0.f };           //model space point the two bone bend faces
+		bool usePole{};
+		glm::vec3 axis{ 0.f, 0.f, 1.f }; //joint space axis LookAt points at the target
+		float weight{ 1.f };             //0 keeps the animated pose
+		float minAngle{ 0.f };           //TwoBone: least bend of the middle joint, 0 is straight
+		float maxAngle{ glm::pi<float>() }; //TwoBone: most bend, Fabrik and LookAt: cone half angle
+		int iterations{ 10 };            //Fabrik only
+		float tolerance{ 1e-3f };        //Fabrik only, distance at which it stops iterating
+	};
+
+	struct IkHit {
+		glm::vec3 point{ 0.f };
+		glm::vec3 normal{ 0.f };
+		float distance{};
+	};
+
+	//casts along a unit "direction", true and fills "hit" on a hit
+	using IkRaycast = std::function<bool(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, IkHit& hit)>;
+
+	//"chain" from "root" down to "end", false if "end" is not below "root"
+	bool BuildChain(const std::vector<Joint>& joints, int root, int end, std::vector<int>& chain);
+
+	//turns "joint" about its origin by a model space rotation, its descendants follow
+	void RotateJoint(const std::vector<Joint>& joints, std::vector<glm::mat4>& globals, int joint, const glm::quat& rotation);
+
+	//each returns the distance left between the effector and the target, LookAt the angle left in radians
+	float SolveTwoBone(const std::vector<Joint>& joints, const IkConstraint& constraint, std::vector<glm::mat4>& globals);
+	float SolveFabrik(const std::vector<Joint>& joints, const IkConstraint& constraint, std::vector<glm::mat4>& globals);
+	float SolveLookAt(const std::vector<Joint>& joints, const IkConstraint& constraint, std::vector<glm::mat4>& globals);
+
+	//runs the constraints in order, later ones see the pose of earlier ones
+	void SolveIk(const std::vector<Joint>& joints, const std::vector<IkConstraint>& constraints, std::vector<glm::mat4>& globals);
+
+	/*!
+	\brief   Moves "effector" along "up" by the height of the ground under it
+			 over the ground at "origin" (the character's feet), so a foot
+			 animated on flat ground lands on a slope or step. Casts from
+			 "reach" above the effector to "reach" below it, all in world
+			 space. False, leaving "target" alone, when nothing is hit.
+	*/
+	bool PlaceOnGround(const IkRaycast& raycast, const glm::vec3& effector, const glm::vec3& origin, const glm::vec3& up,
+		float reach, glm::vec3& target);
+}
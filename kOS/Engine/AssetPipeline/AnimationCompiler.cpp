@@ -0,0 +1,436 @@
+/******************************************************************/
+/*!
+\file      AnimationCompiler.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the animation clip compression pass.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AnimationCompiler.h"
+
+#include <RAPIDJSON/document.h>
+#include <cstring>
+
+namespace assetpipeline {
+
+	namespace {
+
+		//keys one removal test looks back over, bounds the cost of long linear channels
+		constexpr size_t MAX_SEGMENT = 1024;
+
+		//node trees deeper than this are treated as corrupt
+		constexpr int MAX_NODE_DEPTH = 256;
+
+		//reads the mesh compiler layout: plain values, sizes as size_t, strings as a size and chars
+		class RawReader {
+		public:
+			explicit RawReader(std::string_view data) : m_data(data) {}
+
+			template <typename T>
+			bool Read(T& value) {
+				if (m_offset + sizeof(T) > m_data.size()) return false;
+				std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+				m_offset += sizeof(T);
+				return true;
+			}
+
+			bool ReadCount(size_t& count, size_t elementSize) {
+				return Read(count) && count <= (m_data.size() - m_offset) / elementSize;
+			}
+
+			bool ReadString(std::string& value) {
+				size_t length;
+				if (!ReadCount(length, 1)) return false;
+				value.assign(m_data.substr(m_offset, length));
+				m_offset += length;
+				return true;
+			}
+
+			//floats and vec3s, written component by component
+			template <typename T>
+			bool ReadKeys(std::vector<T>& values) {
+				size_t count;
+				if (!ReadCount(count, sizeof(T))) return false;
+
+				values.resize(count);
+				for (T& value : values) {
+					if (!Read(value)) return false;
+				}
+				return true;
+			}
+
+			//written as x, y, z, w
+			bool ReadRotations(std::vector<glm::quat>& rotations) {
+				size_t count;
+				if (!ReadCount(count, sizeof(float) * 4)) return false;
+
+				rotations.resize(count);
+				for (glm::quat& rotation : rotations) {
+					if (!Read(rotation.x) || !Read(rotation.y) || !Read(rotation.z) || !Read(rotation.w)) return false;
+				}
+				return true;
+			}
+
+			bool ReadNode(int parent, int depth, std::vector<animation::JointDesc>& joints) {
+				if (depth > MAX_NODE_DEPTH) return false;
+
+				animation::JointDesc joint;
+				joint.parent = parent;
+				if (!ReadString(joint.name) || !Read(joint.bindTransform)) return false;
+
+				//depth first, so every parent is listed before its children
+				const int index = static_cast<int>(joints.size());
+				joints.push_back(std::move(joint));
+
+				size_t children;
+				if (!Read(children)) return false;
+				for (size_t i = 0; i < children; ++i) {
+					if (!ReadNode(index, depth + 1, joints)) return false;
+				}
+				return true;
+			}
+
+		private:
+			std::string_view m_data;
+			size_t m_offset{};
+		};
+
+		//angle of the rotation between a and b, acos of the dot product loses small angles
+		float RotationError(const glm::quat& a, const glm::quat& b) {
+			const glm::quat difference = glm::conjugate(a) * b;
+			return 2.f * std::atan2(glm::length(glm::vec3{ difference.x, difference.y, difference.z }), std::abs(difference.w));
+		}
+
+		//indices of the keys interpolation cannot rebuild within "tolerance" of every key it replaces
+		template <typename T, typename Interpolate, typename Error>
+		std::vector<uint32_t> ReduceKeys(const std::vector<float>& times, const std::vector<T>& values, float tolerance,
+			Interpolate interpolate, Error error)
+		{
+			const size_t count = std::min(times.size(), values.size());
+			std::vector<uint32_t> kept;
+			if (count == 0) return kept;
+
+			kept.push_back(0);
+
+			//a channel that never leaves its first value needs one key
+			bool constant = true;
+			for (size_t i = 1; i < count && constant; ++i) constant = error(values[0], values[i]) <= tolerance;
+			if (constant) return kept;
+
+			size_t anchor = 0;
+			for (size_t end = anchor + 2; end < count; ++end) {
+				bool fits = end - anchor <= MAX_SEGMENT;
+				const float span = times[end] - times[anchor];
+				for (size_t i = anchor + 1; i < end && fits; ++i) {
+					const float factor = span > 0.f ? (times[i] - times[anchor]) / span : 0.f;
+					fits = error(interpolate(values[anchor], values[end], factor), values[i]) <= tolerance;
+				}
+				if (!fits) {
+					anchor = end - 1;
+					kept.push_back(static_cast<uint32_t>(anchor));
+				}
+			}
+			kept.push_back(static_cast<uint32_t>(count - 1));
+			return kept;
+		}
+
+		class AnimationWriter {
+		public:
+			AnimationWriter(const RawAnimation& animation, const AnimationCompressionSettings& settings, AnimationCompressionStats& stats)
+				: m_animation(animation), m_settings(settings), m_stats(stats)
+			{
+				//times past the clip end still fit in 16 bits
+				float lastTime = animation.duration;
+				for (const auto& [name, track] : animation.tracks) {
+					for (const auto* times : { &track.positionTimes, &track.rotationTimes, &track.scaleTimes }) {
+						if (!times->empty()) lastTime = std::max(lastTime, times->back());
+					}
+				}
+				//whole steps per tick keep keys on whole ticks, as sampled clips are, exact
+				const float steps = lastTime > 0.f ? ANIMATION_TIME_STEPS / lastTime : 0.f;
+				m_timeScale = steps >= 1.f ? std::floor(steps) : steps;
+			}
+
+			void Write(std::string& binary) {
+				std::vector<JointRecord> joints;
+				std::vector<TrackRecord> tracks;
+				std::string strings;
+
+				const std::vector<uint8_t> importance = animation::ComputeJointImportance(m_animation.joints);
+				for (const animation::JointDesc& joint : m_animation.joints) {
+					JointRecord record{};
+					record.importance = importance[joints.size()];
+					record.nameOffset = static_cast<uint32_t>(strings.size());
+					record.nameLength = static_cast<uint32_t>(joint.name.size());
+					record.parent = joint.parent;
+					record.track = -1;
+					std::memcpy(record.bindTransform, &joint.bindTransform[0][0], sizeof(record.bindTransform));
+					strings += joint.name;
+
+					const auto it = m_animation.tracks.find(joint.name);
+					if (it != m_animation.tracks.end()) {
+						record.track = static_cast<int32_t>(tracks.size());
+						tracks.push_back(WriteTrack(it->second));
+					}
+					joints.push_back(record);
+				}
+
+				std::vector<animation::AnimationEvent> markers = m_animation.events;
+				std::stable_sort(markers.begin(), markers.end(),
+					[](const animation::AnimationEvent& a, const animation::AnimationEvent& b) { return a.time < b.time; });
+
+				std::vector<EventRecord> events;
+				for (const animation::AnimationEvent& marker : markers) {
+					EventRecord record{};
+					record.time = std::clamp(marker.time, 0.f, std::max(m_animation.duration, 0.f));
+					record.nameOffset = static_cast<uint32_t>(strings.size());
+					record.nameLength = static_cast<uint32_t>(marker.name.size());
+					strings += marker.name;
+					record.soundOffset = static_cast<uint32_t>(strings.size());
+					record.soundLength = static_cast<uint32_t>(marker.sound.size());
+					strings += marker.sound;
+					events.push_back(record);
+				}
+
+				AnimationHeader header{};
+				std::memcpy(header.magic, ANIMATION_MAGIC, sizeof(ANIMATION_MAGIC));
+				header.version = ANIMATION_VERSION;
+				header.duration = m_animation.duration;
+				header.ticksPerSecond = m_animation.ticksPerSecond;
+				header.timeScale = m_timeScale;
+				header.jointCount = static_cast<uint32_t>(joints.size());
+				header.trackCount = static_cast<uint32_t>(tracks.size());
+				header.positionKeyCount = static_cast<uint32_t>(m_positions.size());
+				header.rotationKeyCount = static_cast<uint32_t>(m_rotations.size());
+				header.scaleKeyCount = static_cast<uint32_t>(m_scales.size());
+				header.eventCount = static_cast<uint32_t>(events.size());
+				header.rootJoint = FindRootJoint(joints);
+				header.stringSize = static_cast<uint32_t>(strings.size());
+
+				binary.clear();
+				Append(binary, &header, sizeof(header));
+				Append(binary, joints.data(), joints.size() * sizeof(JointRecord));
+				Append(binary, tracks.data(), tracks.size() * sizeof(TrackRecord));
+				Append(binary, m_positions.data(), m_positions.size() * sizeof(animation::PackedKey));
+				Append(binary, m_rotations.data(), m_rotations.size() * sizeof(animation::PackedKey));
+				Append(binary, m_scales.data(), m_scales.size() * sizeof(animation::PackedKey));
+				Append(binary, events.data(), events.size() * sizeof(EventRecord));
+				binary += strings;
+
+				m_stats.compressedKeyBytes += (m_positions.size() + m_rotations.size() + m_scales.size()) * sizeof(animation::PackedKey);
+			}
+
+		private:
+
+			static void Append(std::string& binary, const void* data, size_t size) {
+				binary.append(static_cast<const char*>(data), size);
+			}
+
+			int32_t FindRootJoint(const std::vector<JointRecord>& joints) const {
+				for (size_t i = 0; i < joints.size(); ++i) {
+					const bool marked = m_settings.rootMotionJoint.empty() ? joints[i].track >= 0 : m_animation.joints[i].name == m_settings.rootMotionJoint;
+					if (marked) return static_cast<int32_t>(i);
+				}
+				return -1;
+			}
+
+			uint16_t PackTime(float time) const {
+				return static_cast<uint16_t>(std::lround(std::clamp(time * m_timeScale, 0.f, ANIMATION_TIME_STEPS)));
+			}
+
+			void CountSource(size_t keys, size_t valueSize) {
+				m_stats.sourceKeys += keys;
+				m_stats.sourceKeyBytes += keys * (sizeof(float) + valueSize);
+			}
+
+			//vec3 channel packed over the range of its kept keys
+			void WriteRangeChannel(const std::vector<float>& times, const std::vector<glm::vec3>& values, float tolerance,
+				std::vector<animation::PackedKey>& keys, uint32_t& first, uint32_t& count, float (&min)[3], float (&extent)[3])
+			{
+				const std::vector<uint32_t> kept = ReduceKeys(times, values, tolerance,
+					[](const glm::vec3& a, const glm::vec3& b, float factor) { return glm::mix(a, b, factor); },
+					[](const glm::vec3& a, const glm::vec3& b) { return glm::length(a - b); });
+				CountSource(std::min(times.size(), values.size()), sizeof(glm::vec3));
+				m_stats.keptKeys += kept.size();
+
+				glm::vec3 low{ 0.f }, high{ 0.f };
+				if (!kept.empty()) low = high = values[kept[0]];
+				for (uint32_t index : kept) {
+					low = glm::min(low, values[index]);
+					high = glm::max(high, values[index]);
+				}
+
+				first = static_cast<uint32_t>(keys.size());
+				count = static_cast<uint32_t>(kept.size());
+				for (int i = 0; i < 3; ++i) {
+					min[i] = low[i];
+					extent[i] = high[i] - low[i];
+				}
+				for (uint32_t index : kept) {
+					animation::PackedKey key{};
+					key.time = PackTime(times[index]);
+					animation::PackRange(values[index], low, high - low, key.value);
+					keys.push_back(key);
+				}
+			}
+
+			TrackRecord WriteTrack(const animation::BoneTrack& source) {
+				TrackRecord record{};
+				WriteRangeChannel(source.positionTimes, source.positions, m_settings.positionTolerance,
+					m_positions, record.positionFirst, record.positionCount, record.positionMin, record.positionExtent);
+				WriteRangeChannel(source.scaleTimes, source.scales, m_settings.scaleTolerance,
+					m_scales, record.scaleFirst, record.scaleCount, record.scaleMin, record.scaleExtent);
+
+				const std::vector<uint32_t> kept = ReduceKeys(source.rotationTimes, source.rotations, m_settings.rotationTolerance,
+					[](const glm::quat& a, const glm::quat& b, float factor) { return glm::slerp(a, b, factor); },
+					RotationError);
+				CountSource(std::min(source.rotationTimes.size(), source.rotations.size()), sizeof(glm::quat));
+				m_stats.keptKeys += kept.size();
+
+				record.rotationFirst = static_cast<uint32_t>(m_rotations.size());
+				record.rotationCount = static_cast<uint32_t>(kept.size());
+				for (uint32_t index : kept) {
+					animation::PackedKey key{};
+					key.time = PackTime(source.rotationTimes[index]);
+					animation::PackRotation(source.rotations[index], key.value);
+					m_rotations.push_back(key);
+				}
+				return record;
+			}
+
+			const RawAnimation& m_animation;
+			const AnimationCompressionSettings& m_settings;
+			AnimationCompressionStats& m_stats;
+			float m_timeScale{};
+
+			std::vector<animation::PackedKey> m_positions;
+			std::vector<animation::PackedKey> m_rotations;
+			std::vector<animation::PackedKey> m_scales;
+		};
+	}
+
+	namespace {
+		//"AnimationCompilerData" block of the meta file, null if there is none
+		const rapidjson::Value* FindAnimationData(const rapidjson::Document& document) {
+			if (document.HasParseError() || !document.IsArray()) return nullptr;
+			for (const auto& entry : document.GetArray()) {
+				if (entry.IsObject() && entry.HasMember("AnimationCompilerData") && entry["AnimationCompilerData"].IsObject()) {
+					return &entry["AnimationCompilerData"];
+				}
+			}
+			return nullptr;
+		}
+
+		bool ParseMeta(const std::filesystem::path& metaPath, rapidjson::Document& document) {
+			std::ifstream file(metaPath);
+			if (!file) return false;
+			const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			document.Parse(json.c_str());
+			return !document.HasParseError();
+		}
+	}
+
+	AnimationCompressionSettings ReadAnimationSettings(const std::filesystem::path& metaPath) {
+		AnimationCompressionSettings settings;
+
+		rapidjson::Document document;
+		if (!ParseMeta(metaPath, document)) return settings;
+		const rapidjson::Value* data = FindAnimationData(document);
+		if (!data) return settings;
+
+		const auto readTolerance = [&](const char* key, float& value) {
+			if (data->HasMember(key) && (*data)[key].IsNumber()) value = std::max((*data)[key].GetFloat(), 0.f);
+			};
+		readTolerance("positionTolerance", settings.positionTolerance);
+		readTolerance("rotationTolerance", settings.rotationTolerance);
+		readTolerance("scaleTolerance", settings.scaleTolerance);
+		if (data->HasMember("rootMotionJoint") && (*data)["rootMotionJoint"].IsString()) settings.rootMotionJoint = (*data)["rootMotionJoint"].GetString();
+		return settings;
+	}
+
+	std::vector<animation::AnimationEvent> ReadAnimationEvents(const std::filesystem::path& metaPath) {
+		std::vector<animation::AnimationEvent> events;
+
+		rapidjson::Document document;
+		if (!ParseMeta(metaPath, document)) return events;
+		const rapidjson::Value* data = FindAnimationData(document);
+		if (!data || !data->HasMember("events") || !(*data)["events"].IsArray()) return events;
+
+		for (const auto& entry : (*data)["events"].GetArray()) {
+			if (!entry.IsObject() || !entry.HasMember("name") || !entry["name"].IsString() ||
+				!entry.HasMember("time") || !entry["time"].IsNumber()) continue;
+
+			animation::AnimationEvent event;
+			event.name = entry["name"].GetString();
+			event.time = entry["time"].GetFloat();
+			if (entry.HasMember("sound") && entry["sound"].IsString()) event.sound = entry["sound"].GetString();
+			events.push_back(std::move(event));
+		}
+		return events;
+	}
+
+	bool ReadRawAnimation(std::string_view raw, RawAnimation& animation, std::string& error) {
+		animation = {};
+		RawReader reader{ raw };
+
+		size_t trackCount;
+		if (!reader.Read(animation.duration) || !reader.Read(animation.ticksPerSecond) ||
+			!reader.ReadString(animation.name) || !reader.Read(trackCount)) {
+			error = "Truncated animation header";
+			return false;
+		}
+
+		for (size_t i = 0; i < trackCount; ++i) {
+			//the map key is written before the node name, joints are bound by node name
+			std::string key, name;
+			int id;
+			if (!reader.ReadString(key) || !reader.ReadString(name) || !reader.Read(id)) {
+				error = "Truncated animation track " + std::to_string(i);
+				return false;
+			}
+
+			animation::BoneTrack& track = animation.tracks[name];
+			if (!reader.ReadKeys(track.positions) || !reader.ReadKeys(track.positionTimes) ||
+				!reader.ReadRotations(track.rotations) || !reader.ReadKeys(track.rotationTimes) ||
+				!reader.ReadKeys(track.scales) || !reader.ReadKeys(track.scaleTimes)) {
+				error = "Truncated keys of animation track " + name;
+				return false;
+			}
+		}
+
+		if (!reader.ReadNode(-1, 0, animation.joints)) {
+			error = "Truncated animation node tree";
+			return false;
+		}
+		return true;
+	}
+
+	void CompressAnimation(const RawAnimation& animation, const AnimationCompressionSettings& settings,
+		std::string& binary, AnimationCompressionStats& stats)
+	{
+		stats = {};
+		AnimationWriter{ animation, settings, stats }.Write(binary);
+	}
+
+	bool CompileAnimation(std::string_view raw, const AnimationCompressionSettings& settings,
+		std::string& binary, AnimationCompressionStats& stats, std::string& error,
+		const std::vector<animation::AnimationEvent>& events)
+	{
+		RawAnimation animation;
+		if (!ReadRawAnimation(raw, animation, error)) return false;
+		animation.events = events;
+
+		CompressAnimation(animation, settings, binary, stats);
+		return true;
+	}
+
+	bool IsCompressedAnimation(std::string_view data) {
+		return data.size() >= sizeof(ANIMATION_MAGIC) && std::memcmp(data.data(), ANIMATION_MAGIC, sizeof(ANIMATION_MAGIC)) == 0;
+	}
+}
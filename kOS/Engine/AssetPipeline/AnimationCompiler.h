@@ -0,0 +1,87 @@
+/******************************************************************/
+/*!
+\file      AnimationCompiler.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     The pass that compresses the clips written by the mesh
+		   compiler into the layout of AnimationFormat.h.
+
+		   Every channel first drops the keys that linear (or slerp)
+		   interpolation of its neighbours reproduces within the
+		   tolerance. The kept keys are then quantized: rotations to
+		   smallest three quaternions in 48 bits, translations and
+		   scales to 16 bits per component over the range of their
+		   track, and key times to 16 bits over the clip, in whole steps
+		   per tick when the clip is short enough.
+
+		   Each joint also gets its LOD importance from the bind pose
+		   (animation::ComputeJointImportance), so the runtime never
+		   has to walk the skeleton for it.
+
+		   A compressed clip is a header followed by the joint and
+		   track tables, the position, rotation and scale keys, the
+		   event markers and the string table. animation::AnimationClip::Load
+		   copies the tables and samples the keys as stored.
+
+		   Tolerances are read from the asset meta file:
+		   [ { "AnimationCompilerData": { "positionTolerance": 0.001,
+				 "rotationTolerance": 0.002, "scaleTolerance": 0.001 } } ]
+		   Rotation tolerance is in radians. "rootMotionJoint" names the
+		   joint root motion is taken from, the first joint with a track
+		   when it is missing. Event markers are authored
+		   in the same block, at a time in clip ticks, with an optional
+		   audio asset GUID to play:
+			   "events": [ { "name": "Footstep", "time": 12, "sound": "" } ]
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "AnimationFormat.h"
+
+namespace assetpipeline {
+
+	struct AnimationCompressionSettings {
+		float positionTolerance = 0.001f;
+		float rotationTolerance = 0.002f;
+		float scaleTolerance = 0.001f;
+		std::string rootMotionJoint; //empty picks the first joint with a track
+	};
+
+	struct AnimationCompressionStats {
+		size_t sourceKeys{};
+		size_t keptKeys{};
+		size_t sourceKeyBytes{};      //keys and times as floats, as the mesh compiler writes them
+		size_t compressedKeyBytes{};
+	};
+
+	//clip as written by the mesh compiler: name, timing, tracks by node name and the node tree
+	struct RawAnimation {
+		std::string name;
+		float duration{};
+		float ticksPerSecond{};
+		std::vector<animation::JointDesc> joints;
+		std::unordered_map<std::string, animation::BoneTrack> tracks;
+		std::vector<animation::AnimationEvent> events;
+	};
+
+	AnimationCompressionSettings ReadAnimationSettings(const std::filesystem::path& metaPath);
+	std::vector<animation::AnimationEvent> ReadAnimationEvents(const std::filesystem::path& metaPath);
+
+	bool ReadRawAnimation(std::string_view raw, RawAnimation& animation, std::string& error);
+	void CompressAnimation(const RawAnimation& animation, const AnimationCompressionSettings& settings,
+		std::string& binary, AnimationCompressionStats& stats);
+
+	//mesh compiler clip to the binary layout above, with "events" as its markers
+	bool CompileAnimation(std::string_view raw, const AnimationCompressionSettings& settings,
+		std::string& binary, AnimationCompressionStats& stats, std::string& error,
+		const std::vector<animation::AnimationEvent>& events = {});
+
+	//true if "data" starts like a compressed clip
+	bool IsCompressedAnimation(std::string_view data);
+}
@@ -0,0 +1,131 @@
+/******************************************************************/
+/*!
+\file      AnimationFormat.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Key quantization and joint importance shared by the animation
+		   compiler and the runtime clip.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AnimationFormat.h"
+
+namespace animation {
+
+	namespace {
+
+		constexpr float ROTATION_STEPS = 32767.f;
+		constexpr float RANGE_STEPS = 65535.f;
+
+		//smallest three components lie in [-1/sqrt2, 1/sqrt2]
+		constexpr float ROTATION_RANGE = 0.70710678f;
+
+		//share of the skeleton's bind pose extent a joint has to move to be essential or detail
+		constexpr float ESSENTIAL_SHARE = 0.12f;
+		constexpr float DETAIL_SHARE = 0.05f;
+	}
+
+	void PackRotation(const glm::quat& rotation, uint16_t (&packed)[3]) {
+		const glm::quat q = glm::normalize(rotation);
+		float components[4] = { q.x, q.y, q.z, q.w };
+
+		int largest = 0;
+		for (int i = 1; i < 4; ++i) {
+			if (std::abs(components[i]) > std::abs(components[largest])) largest = i;
+		}
+		//q and -q are the same rotation, keep the dropped component positive
+		const float sign = components[largest] < 0.f ? -1.f : 1.f;
+
+		uint64_t bits = 0;
+		int shift = 0;
+		for (int i = 0; i < 4; ++i) {
+			if (i == largest) continue;
+			const float normalized = std::clamp(sign * components[i] / ROTATION_RANGE * 0.5f + 0.5f, 0.f, 1.f);
+			bits |= static_cast<uint64_t>(std::lround(normalized * ROTATION_STEPS)) << shift;
+			shift += 15;
+		}
+		bits |= static_cast<uint64_t>(largest) << 45;
+
+		packed[0] = static_cast<uint16_t>(bits);
+		packed[1] = static_cast<uint16_t>(bits >> 16);
+		packed[2] = static_cast<uint16_t>(bits >> 32);
+	}
+
+	glm::quat UnpackRotation(const uint16_t (&packed)[3]) {
+		const uint64_t bits = uint64_t{ packed[0] } | (uint64_t{ packed[1] } << 16) | (uint64_t{ packed[2] } << 32);
+		const int largest = static_cast<int>((bits >> 45) & 3);
+
+		float components[4];
+		float sum = 0.f;
+		int shift = 0;
+		for (int i = 0; i < 4; ++i) {
+			if (i == largest) continue;
+			const float normalized = static_cast<float>((bits >> shift) & 0x7FFF) / ROTATION_STEPS;
+			components[i] = (normalized * 2.f - 1.f) * ROTATION_RANGE;
+			sum += components[i] * components[i];
+			shift += 15;
+		}
+		components[largest] = std::sqrt(std::max(1.f - sum, 0.f));
+
+		return glm::normalize(glm::quat{ components[3], components[0], components[1], components[2] });
+	}
+
+	void PackRange(const glm::vec3& value, const glm::vec3& min, const glm::vec3& extent, uint16_t (&packed)[3]) {
+		for (int i = 0; i < 3; ++i) {
+			const float normalized = extent[i] > 0.f ? std::clamp((value[i] - min[i]) / extent[i], 0.f, 1.f) : 0.f;
+			packed[i] = static_cast<uint16_t>(std::lround(normalized * RANGE_STEPS));
+		}
+	}
+
+	glm::vec3 UnpackRange(const uint16_t (&packed)[3], const glm::vec3& min, const glm::vec3& extent) {
+		return min + extent * glm::vec3{ packed[0], packed[1], packed[2] } * (1.f / RANGE_STEPS);
+	}
+
+	std::vector<uint8_t> ComputeJointImportance(const std::vector<JointDesc>& joints) {
+		const size_t count = joints.size();
+		std::vector<uint8_t> importance(count, JOINT_ESSENTIAL);
+		if (count == 0) return importance;
+
+		std::vector<glm::vec3> positions(count);
+		glm::vec3 min{ std::numeric_limits<float>::max() }, max{ -std::numeric_limits<float>::max() };
+		std::vector<glm::mat4> globals(count);
+		for (size_t i = 0; i < count; ++i) {
+			const int parent = joints[i].parent;
+			globals[i] = parent >= 0 && parent < static_cast<int>(i) ? globals[parent] * joints[i].bindTransform : joints[i].bindTransform;
+			positions[i] = glm::vec3(globals[i][3]);
+			min = glm::min(min, positions[i]);
+			max = glm::max(max, positions[i]);
+		}
+		const float extent = glm::length(max - min);
+		if (extent <= 0.f) return importance;
+
+		//farthest joint below each joint, children come after their parents
+		std::vector<float> reach(count, 0.f);
+		std::vector<bool> leaf(count, true);
+		for (size_t i = count; i-- > 0;) {
+			const int parent = joints[i].parent;
+			if (parent < 0 || parent >= static_cast<int>(i)) continue;
+			reach[parent] = std::max(reach[parent], reach[i] + glm::length(positions[i] - positions[parent]));
+			leaf[parent] = false;
+		}
+
+		for (size_t i = 0; i < count; ++i) {
+			const int parent = joints[i].parent;
+			if (parent < 0 || parent >= static_cast<int>(i)) continue;
+
+			//a leaf moves nothing below it, its own bone stands in for its size
+			const float size = leaf[i] ? glm::length(positions[i] - positions[parent]) : reach[i];
+			const float share = size / extent;
+			importance[i] = share >= ESSENTIAL_SHARE ? JOINT_ESSENTIAL : share >= DETAIL_SHARE ? JOINT_DETAIL : JOINT_FINE;
+
+			//a joint is never kept while its parent is dropped
+			importance[i] = std::max(importance[i], importance[parent]);
+		}
+		return importance;
+	}
+}
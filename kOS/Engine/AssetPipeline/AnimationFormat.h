@@ -0,0 +1,135 @@
+/******************************************************************/
+/*!
+\file      AnimationFormat.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     What the animation compiler writes and the runtime clip reads:
+		   the source clip types, the key quantization, joint importance
+		   and the record layout of a compressed clip.
+
+		   Part of the asset pipeline library so the headless builder
+		   links without the engine. The runtime includes this, never
+		   AnimationCompiler.h, and the compiler never includes the
+		   runtime clip.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include <glm/gtc/quaternion.hpp>
+
+namespace animation {
+
+	//keys of one animated node as stored in the animation file
+	struct BoneTrack {
+		std::vector<glm::vec3> positions;
+		std::vector<float> positionTimes;
+
+		std::vector<glm::quat> rotations;
+		std::vector<float> rotationTimes;
+
+		std::vector<glm::vec3> scales;
+		std::vector<float> scaleTimes;
+	};
+
+	//node of the hierarchy in depth first order, parent is -1 for the root
+	struct JointDesc {
+		std::string name;
+		int parent{ -1 };
+		glm::mat4 bindTransform{ 1.f };
+	};
+
+	//joint importance, lower is more important. The limit a pose is sampled at keeps every joint up to it
+	inline constexpr uint8_t JOINT_ESSENTIAL = 0; //moves a large part of the body (hips, spine, limbs)
+	inline constexpr uint8_t JOINT_DETAIL = 1;    //hands, feet, head
+	inline constexpr uint8_t JOINT_FINE = 2;      //fingers, toes, facial and twist bones
+	inline constexpr uint8_t ALL_JOINTS = JOINT_FINE;
+
+	/*!
+	\brief   Importance of every joint from the bind pose: the joint's bone and
+			 everything below it, against the size of the whole skeleton. Roots
+			 are always essential.
+	*/
+	std::vector<uint8_t> ComputeJointImportance(const std::vector<JointDesc>& joints);
+
+	//key of a compressed clip, time and value quantized to 16 bits per component
+	struct PackedKey {
+		uint16_t time;
+		uint16_t value[3];
+	};
+
+	//smallest three: the largest component is dropped and rebuilt from the other three, 15 bits each
+	void PackRotation(const glm::quat& rotation, uint16_t (&packed)[3]);
+	glm::quat UnpackRotation(const uint16_t (&packed)[3]);
+
+	//every component mapped from [min, min + extent] to [0, 65535]
+	void PackRange(const glm::vec3& value, const glm::vec3& min, const glm::vec3& extent, uint16_t (&packed)[3]);
+	glm::vec3 UnpackRange(const uint16_t (&packed)[3], const glm::vec3& min, const glm::vec3& extent);
+
+	//named marker on the clip timeline, "sound" is the GUID of an audio asset to play or empty
+	struct AnimationEvent {
+		float time{};        //in clip ticks
+		std::string name;
+		std::string sound;
+	};
+}
+
+namespace assetpipeline {
+
+	inline constexpr char ANIMATION_MAGIC[4] = { 'K', 'A', 'N', 'M' };
+	inline constexpr uint32_t ANIMATION_VERSION = 4;
+
+	//largest quantized key time
+	inline constexpr float ANIMATION_TIME_STEPS = 65535.f;
+
+	struct AnimationHeader {
+		char magic[4];
+		uint32_t version;
+		float duration;
+		float ticksPerSecond;
+		float timeScale;     //quantized key time per tick
+		uint32_t jointCount;
+		uint32_t trackCount;
+		uint32_t positionKeyCount;
+		uint32_t rotationKeyCount;
+		uint32_t scaleKeyCount;
+		uint32_t eventCount;
+		int32_t rootJoint;   //-1 if the clip has no root motion joint
+		uint32_t stringSize;
+	};
+
+	struct JointRecord {
+		uint32_t nameOffset;
+		uint32_t nameLength;
+		int32_t parent;
+		int32_t track;       //-1 keeps the bind transform
+		float bindTransform[16];
+		uint32_t importance; //animation::JOINT_ESSENTIAL to JOINT_FINE, from the bind pose
+	};
+
+	struct TrackRecord {
+		uint32_t positionFirst;
+		uint32_t positionCount;
+		uint32_t rotationFirst;
+		uint32_t rotationCount;
+		uint32_t scaleFirst;
+		uint32_t scaleCount;
+		float positionMin[3];
+		float positionExtent[3];
+		float scaleMin[3];
+		float scaleExtent[3];
+	};
+
+	struct EventRecord {
+		float time;          //in clip ticks, records are sorted by time
+		uint32_t nameOffset;
+		uint32_t nameLength;
+		uint32_t soundOffset;
+		uint32_t soundLength;
+	};
+}
@@ -0,0 +1,316 @@
+/******************************************************************/
+/*!
+\file      AssetBuilder.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the asset builder.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AssetBuilder.h"
+
+#include <RAPIDJSON/document.h>
+
+namespace assetpipeline {
+
+	namespace {
+
+		using Clock = std::chrono::steady_clock;
+
+		double ElapsedMilliseconds(Clock::time_point start) {
+			return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		}
+
+		bool ParseJsonFile(const std::filesystem::path& path, rapidjson::Document& document) {
+			std::ifstream file(path);
+			if (!file) return false;
+			std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			document.Parse(content.c_str());
+			return !document.HasParseError() && document.IsArray();
+		}
+
+		std::string GetString(const rapidjson::Value& object, const char* name) {
+			if (object.HasMember(name) && object[name].IsString()) {
+				return object[name].GetString();
+			}
+			return std::string{};
+		}
+
+		//member name in Config.json -> resource type, matches Kos Editor/Compilers/Compiler.h
+		const std::unordered_map<std::string, std::string> compilerTypes{
+			{ "meshCompiler", "R_Model" },
+			{ "textureCompiler", "R_Texture" },
+			{ "fontCompiler", "R_Font" },
+			{ "sceneCompiler", "R_Scene" },
+			{ "prefabCompiler", "R_Prefab" },
+			{ "audioCompiler", "R_Audio" },
+			{ "materialCompiler", "R_Material" },
+			{ "dmcCompiler", "R_DepthMapCube" },
+			{ "controllerCompiler", "R_AnimationController" },
+			{ "animationCompiler", "R_Animation" }
+		};
+
+		//only text assets refer to other assets by GUID
+		const std::unordered_set<std::string> textAssets{ ".mat", ".prefab", ".json" };
+
+		struct AssetEntry {
+			std::filesystem::path source;
+			std::filesystem::path meta;
+			std::string GUID;
+			std::vector<std::filesystem::path> dependencies;
+			std::vector<JobID> jobs;
+		};
+	}
+
+	std::vector<CompilerEntry> LoadCompilerConfig(const std::filesystem::path& configFile) {
+		std::vector<CompilerEntry> compilers;
+
+		rapidjson::Document document;
+		if (!ParseJsonFile(configFile, document)) {
+			LOGGING_WARN("Asset Builder: failed to read " + configFile.string());
+			return compilers;
+		}
+
+		for (const auto& entry : document.GetArray()) {
+			if (!entry.IsObject() || !entry.HasMember("CompilerData")) continue;
+
+			for (const auto& member : entry["CompilerData"].GetObject()) {
+				const rapidjson::Value& data = member.value;
+				if (!data.IsObject()) continue;
+
+				const std::string name = member.name.GetString();
+				const auto type = compilerTypes.find(name);
+
+				CompilerEntry compiler;
+				compiler.identity.type = type != compilerTypes.end() ? type->second : name;
+				compiler.identity.compilerFilePath = GetString(data, "path");
+				compiler.identity.outputExtension = GetString(data, "outputExtension");
+				compiler.identity.version = GetString(data, "version");
+
+				if (data.HasMember("inputExtensions") && data["inputExtensions"].IsArray()) {
+					for (const auto& extension : data["inputExtensions"].GetArray()) {
+						if (extension.IsString()) {
+							compiler.inputExtensions.push_back(extension.GetString());
+						}
+						else if (extension.IsObject()) {
+							std::string value = GetString(extension, "inputExtensions");
+							if (!value.empty()) compiler.inputExtensions.push_back(value);
+						}
+					}
+				}
+
+				compilers.push_back(std::move(compiler));
+			}
+		}
+		return compilers;
+	}
+
+	std::string ReadAssetGUID(const std::filesystem::path& metaPath) {
+		rapidjson::Document document;
+		if (!ParseJsonFile(metaPath, document)) return std::string{};
+
+		for (const auto& entry : document.GetArray()) {
+			if (entry.IsObject() && entry.HasMember("AssetData") && entry["AssetData"].IsObject()) {
+				return GetString(entry["AssetData"], "GUID");
+			}
+		}
+		return std::string{};
+	}
+
+
+	AssetBuilder::AssetBuilder(std::vector<CompilerEntry> compilers, BuildCache* cache)
+		: m_compilers(std::move(compilers)), m_cache(cache)
+	{
+	}
+
+	void AssetBuilder::RegisterGUID(const std::string& guid, const std::filesystem::path& source) {
+		std::lock_guard lock{ m_mutex };
+		m_GUIDtoFilePath[guid] = source;
+	}
+
+	std::vector<const CompilerEntry*> AssetBuilder::FindCompilers(const std::string& extension) const {
+		std::vector<const CompilerEntry*> compilers;
+		for (const auto& compiler : m_compilers) {
+			if (std::find(compiler.inputExtensions.begin(), compiler.inputExtensions.end(), extension) != compiler.inputExtensions.end()) {
+				compilers.push_back(&compiler);
+			}
+		}
+		return compilers;
+	}
+
+	std::vector<std::filesystem::path> AssetBuilder::CollectDependencies(const std::filesystem::path& source) const {
+		std::vector<std::filesystem::path> dependencies;
+		std::unordered_set<std::string> visited;
+
+		std::function<void(const std::filesystem::path&)> collect;
+		collect = [&](const std::filesystem::path& path) {
+			if (textAssets.find(path.extension().string()) == textAssets.end()) return;
+
+			for (const auto& guid : FindGUIDReferences(path)) {
+				std::filesystem::path dependency;
+				{
+					std::lock_guard lock{ m_mutex };
+					const auto it = m_GUIDtoFilePath.find(guid);
+					if (it == m_GUIDtoFilePath.end()) continue;
+					dependency = it->second;
+				}
+				if (dependency == source || !visited.insert(guid).second) continue;
+
+				dependencies.push_back(dependency);
+				dependencies.push_back(dependency.string() + ".meta");
+				collect(dependency);
+			}
+			};
+
+		collect(source);
+		return dependencies;
+	}
+
+	BuildReport AssetBuilder::Build(const std::vector<std::filesystem::path>& sources, const std::filesystem::path& resourceDirectory) {
+		BuildReport report;
+		const auto buildStart = Clock::now();
+
+		//Scan: read GUIDs and dependencies
+		auto stageStart = Clock::now();
+		std::vector<AssetEntry> assets;
+		for (const auto& source : sources) {
+			if (FindCompilers(source.extension().string()).empty()) continue;
+
+			AssetEntry asset;
+			asset.source = source;
+			asset.meta = source.string() + ".meta";
+			asset.GUID = ReadAssetGUID(asset.meta);
+			if (asset.GUID.empty()) {
+				report.assets.push_back({ source, std::string{}, JobStatus::Failed, { { Severity::Error, "Missing or invalid meta file" } } });
+				++report.failed;
+				continue;
+			}
+			RegisterGUID(asset.GUID, source);
+			assets.push_back(std::move(asset));
+		}
+		for (auto& asset : assets) {
+			asset.dependencies = CollectDependencies(asset.source);
+		}
+		report.stageMilliseconds.push_back({ "Scan", ElapsedMilliseconds(stageStart) });
+
+		//Graph: one job per compiler, waiting on the jobs of every dependency in this build
+		stageStart = Clock::now();
+		JobGraph graph;
+		std::atomic<size_t> compiled{ 0 }, upToDate{ 0 }, restored{ 0 };
+		std::unordered_map<std::string, size_t> assetIndex;
+		std::vector<size_t> jobAsset;
+
+		//a lone job (a single file saved in the editor) gets every thread, otherwise the pool is already full
+		size_t jobCount = 0;
+		for (const auto& asset : assets) {
+			jobCount += FindCompilers(asset.source.extension().string()).size();
+		}
+		const unsigned int compileThreads = jobCount == 1 ? m_threadCount : 1;
+
+		for (size_t i = 0; i < assets.size(); ++i) {
+			AssetEntry& asset = assets[i];
+			assetIndex[asset.source.lexically_normal().string()] = i;
+
+			for (const CompilerEntry* compiler : FindCompilers(asset.source.extension().string())) {
+				CompileRequest request{ asset.source, asset.meta, resourceDirectory / (asset.GUID + compiler->identity.outputExtension), compiler->identity, compileThreads };
+				BuildInput input{ asset.source, asset.meta, compiler->identity, asset.dependencies };
+
+				JobID id = graph.AddJob(asset.source.filename().string(), compiler->identity.type,
+					[this, request, input, &compiled, &upToDate, &restored](std::vector<Diagnostic>& diagnostics) {
+						std::string key;
+						if (m_cache) {
+							key = m_cache->ComputeKey(input);
+							switch (m_cache->Fetch(key, request.output)) {
+							case CacheResult::UPTODATE:
+								++upToDate;
+								return true;
+							case CacheResult::RESTORED:
+								++restored;
+								return true;
+							default:
+								break;
+							}
+						}
+
+						if (!GetCompileFunction(request.compiler)(request, diagnostics)) {
+							return false;
+						}
+						++compiled;
+
+						if (m_cache) {
+							//copies do not need a second copy in the store
+							IsCopyCompiler(request.compiler) ? m_cache->Record(key, request.output) : m_cache->Store(key, request.output);
+						}
+						return true;
+					});
+
+				asset.jobs.push_back(id);
+				jobAsset.push_back(i);
+			}
+		}
+
+		for (const auto& asset : assets) {
+			for (const auto& dependency : asset.dependencies) {
+				const auto it = assetIndex.find(dependency.lexically_normal().string());
+				if (it == assetIndex.end()) continue;
+
+				for (JobID job : asset.jobs) {
+					for (JobID dependencyJob : assets[it->second].jobs) {
+						graph.AddDependency(job, dependencyJob);
+					}
+				}
+			}
+		}
+		report.stageMilliseconds.push_back({ "Graph", ElapsedMilliseconds(stageStart) });
+
+		//Compile
+		stageStart = Clock::now();
+		graph.Execute(m_threadCount);
+		report.stageMilliseconds.push_back({ "Compile", ElapsedMilliseconds(stageStart) });
+
+		for (const auto& [stage, milliseconds] : graph.GetStageTimes()) {
+			report.stageMilliseconds.push_back({ stage, milliseconds });
+		}
+
+		for (JobID id = 0; id < graph.GetJobCount(); ++id) {
+			const Job& job = graph.GetJob(id);
+			if (job.status == JobStatus::Failed) ++report.failed;
+			if (job.status == JobStatus::Skipped) ++report.skipped;
+			if (job.status != JobStatus::Succeeded || !job.diagnostics.empty()) {
+				report.assets.push_back({ assets[jobAsset[id]].source, job.stage, job.status, job.diagnostics });
+			}
+		}
+
+		report.compiled = compiled;
+		report.upToDate = upToDate;
+		report.restored = restored;
+		report.stageMilliseconds.push_back({ "Total", ElapsedMilliseconds(buildStart) });
+		return report;
+	}
+
+	BuildReport AssetBuilder::BuildDirectory(const std::filesystem::path& assetDirectory, const std::filesystem::path& resourceDirectory) {
+		std::vector<std::filesystem::path> sources;
+
+		std::error_code ec;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(assetDirectory, ec)) {
+			if (!entry.is_regular_file()) continue;
+			if (entry.path().extension() == ".meta") continue;
+			if (!std::filesystem::exists(entry.path().string() + ".meta")) continue;
+			sources.push_back(entry.path());
+		}
+		std::sort(sources.begin(), sources.end());
+
+		//every GUID is known before any dependency is resolved
+		for (const auto& source : sources) {
+			std::string guid = ReadAssetGUID(source.string() + ".meta");
+			if (!guid.empty()) RegisterGUID(guid, source);
+		}
+
+		return Build(sources, resourceDirectory);
+	}
+}
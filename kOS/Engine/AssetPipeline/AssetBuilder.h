@@ -0,0 +1,105 @@
+/******************************************************************/
+/*!
+\file      AssetBuilder.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Turns a set of source assets into a job graph and compiles it.
+
+		   One job is created per (asset, compiler). An asset that refers
+		   to another asset by GUID (material -> texture, prefab ->
+		   material) waits for that asset's jobs, so outputs are produced
+		   in dependency order. Every job first asks the build cache, and
+		   only runs its compiler on a miss.
+
+		   Used by the editor's AssetManager and the headless
+		   Kos_AssetBuilder driver.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "AssetCompiler.h"
+#include "BuildCache.h"
+#include "JobGraph.h"
+
+#include <mutex>
+
+namespace assetpipeline {
+
+	struct CompilerEntry {
+		CompilerIdentity identity;
+		std::vector<std::string> inputExtensions;
+	};
+
+	//reads the CompilerData block of Kos Editor/Configs/Config.json
+	std::vector<CompilerEntry> LoadCompilerConfig(const std::filesystem::path& configFile);
+
+	//GUID from the AssetData block of a .meta file, empty if there is none
+	std::string ReadAssetGUID(const std::filesystem::path& metaPath);
+
+	struct AssetReport {
+		std::filesystem::path source;
+		std::string compiler;
+		JobStatus status = JobStatus::Pending;
+		std::vector<Diagnostic> diagnostics;
+	};
+
+	struct BuildReport {
+		size_t compiled{};
+		size_t upToDate{};
+		size_t restored{};
+		size_t failed{};
+		size_t skipped{};
+
+		//"Scan", "Graph", "Compile" wall time, then the summed job time of every compiler type
+		std::vector<std::pair<std::string, double>> stageMilliseconds;
+
+		//jobs that failed, were skipped or left diagnostics
+		std::vector<AssetReport> assets;
+
+		bool Succeeded() const { return failed == 0 && skipped == 0; }
+	};
+
+	class AssetBuilder {
+	public:
+
+		AssetBuilder(std::vector<CompilerEntry> compilers, BuildCache* cache = nullptr);
+
+		//0 uses every hardware thread
+		void SetThreadCount(unsigned int threadCount) { m_threadCount = threadCount; }
+
+		//lets dependencies on "guid" resolve to "source"
+		void RegisterGUID(const std::string& guid, const std::filesystem::path& source);
+
+		std::vector<const CompilerEntry*> FindCompilers(const std::string& extension) const;
+
+		//source and meta files of every asset referenced by GUID, followed recursively
+		std::vector<std::filesystem::path> CollectDependencies(const std::filesystem::path& source) const;
+
+		/******************************************************************/
+		/*!
+		\fn      Build
+		\brief   Compiles "sources" into "resourceDirectory". Every source
+				 needs a .meta file next to it.
+		*/
+		/******************************************************************/
+		BuildReport Build(const std::vector<std::filesystem::path>& sources, const std::filesystem::path& resourceDirectory);
+
+		//registers and builds every asset that has a .meta under "assetDirectory"
+		BuildReport BuildDirectory(const std::filesystem::path& assetDirectory, const std::filesystem::path& resourceDirectory);
+
+	private:
+
+		std::vector<CompilerEntry> m_compilers;
+		BuildCache* m_cache;
+		unsigned int m_threadCount = 0;
+
+		mutable std::mutex m_mutex;
+		std::unordered_map<std::string, std::filesystem::path> m_GUIDtoFilePath;
+	};
+}
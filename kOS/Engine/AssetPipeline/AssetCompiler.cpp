@@ -0,0 +1,272 @@
+/******************************************************************/
+/*!
+\file      AssetCompiler.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the asset compiler entry points.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "AssetCompiler.h"
+
+#include "AnimationCompiler.h"
+#include "ControllerCompiler.h"
+#include "FontCompiler.h"
+#include "TextureCompiler.h"
+#include "DeSerialization/BinarySerializationReflection.h"
+#ifdef KOS_MESH_COMPILER
+#include "MeshCompiler.h"
+#endif
+
+#include <RAPIDJSON/document.h>
+#include <RAPIDJSON/error/en.h>
+
+namespace assetpipeline {
+
+	namespace {
+		//R_Texture::classname(), without pulling the renderer into the pipeline
+		constexpr const char* TEXTURE_TYPE = "R_Texture";
+		constexpr const char* CONTROLLER_TYPE = "R_AnimationController";
+		constexpr const char* ANIMATION_TYPE = "R_Animation";
+		constexpr const char* SCENE_TYPE = "R_Scene";
+		constexpr const char* MODEL_TYPE = "R_Model";
+		constexpr const char* FONT_TYPE = "R_Font";
+		constexpr const char* MATERIAL_TYPE = "R_Material";
+		constexpr const char* PREFAB_TYPE = "R_Prefab";
+
+		bool EnsureOutputDirectory(const std::filesystem::path& output, std::vector<Diagnostic>& diagnostics) {
+			if (!output.has_parent_path()) return true;
+
+			std::error_code ec;
+			std::filesystem::create_directories(output.parent_path(), ec);
+			if (ec) {
+				diagnostics.push_back({ Severity::Error, "Failed to create directory " + output.parent_path().string() + ": " + ec.message() });
+				return false;
+			}
+			return true;
+		}
+
+		bool ReadSource(const std::filesystem::path& source, std::string& data, std::vector<Diagnostic>& diagnostics) {
+			std::ifstream file(source, std::ios::binary);
+			if (!file) {
+				diagnostics.push_back({ Severity::Error, "Cannot read " + source.string() });
+				return false;
+			}
+			data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			return true;
+		}
+
+		bool WriteOutput(const std::filesystem::path& output, const std::string& data, std::vector<Diagnostic>& diagnostics) {
+			std::ofstream file(output, std::ios::binary | std::ios::trunc);
+			file.write(data.data(), static_cast<std::streamsize>(data.size()));
+			if (!file) {
+				diagnostics.push_back({ Severity::Error, "Failed to write " + output.string() });
+				return false;
+			}
+			return true;
+		}
+
+		//material and prefab JSON is shipped as is, so a broken file fails here instead of when the game loads it
+		bool ReadJsonSource(const std::filesystem::path& source, rapidjson::Document& document, std::vector<Diagnostic>& diagnostics) {
+			std::string data;
+			if (!ReadSource(source, data, diagnostics)) return false;
+
+			document.Parse(data.c_str());
+			if (document.HasParseError()) {
+				diagnostics.push_back({ Severity::Error, std::string("JSON parse error at offset ") + std::to_string(document.GetErrorOffset()) + ": " +
+					rapidjson::GetParseError_En(document.GetParseError()) });
+				return false;
+			}
+			if (!document.IsArray()) {
+				diagnostics.push_back({ Severity::Error, "Expected a JSON array in " + source.string() });
+				return false;
+			}
+			return true;
+		}
+	}
+
+	bool CompileTextureAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		if (!EnsureOutputDirectory(request.output, diagnostics)) return false;
+
+		texturecompiler::Settings settings = texturecompiler::ReadSettings(request.meta);
+		settings.threadCount = request.threadCount;
+
+		std::string error;
+		if (!texturecompiler::CompileTexture(request.source, settings, request.output, error)) {
+			diagnostics.push_back({ Severity::Error, error });
+			return false;
+		}
+		return true;
+	}
+
+	bool CompileControllerAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		if (!EnsureOutputDirectory(request.output, diagnostics)) return false;
+
+		std::string source;
+		if (!ReadSource(request.source, source, diagnostics)) return false;
+
+		std::string binary, error;
+		if (!CompileController(source, binary, error)) {
+			diagnostics.push_back({ Severity::Error, error });
+			return false;
+		}
+		return WriteOutput(request.output, binary, diagnostics);
+	}
+
+	bool CompileAnimationAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		if (!EnsureOutputDirectory(request.output, diagnostics)) return false;
+
+		std::string source;
+		if (!ReadSource(request.source, source, diagnostics)) return false;
+
+		std::string binary, error;
+		AnimationCompressionStats stats;
+		if (!CompileAnimation(source, ReadAnimationSettings(request.meta), binary, stats, error, ReadAnimationEvents(request.meta))) {
+			diagnostics.push_back({ Severity::Error, error });
+			return false;
+		}
+
+		//size report, shows up in the build report of the asset
+		diagnostics.push_back({ Severity::Info, "Kept " + std::to_string(stats.keptKeys) + " of " + std::to_string(stats.sourceKeys) +
+			" keys, key data " + std::to_string(stats.sourceKeyBytes) + " -> " + std::to_string(stats.compressedKeyBytes) +
+			" bytes, clip " + std::to_string(source.size()) + " -> " + std::to_string(binary.size()) + " bytes" });
+		return WriteOutput(request.output, binary, diagnostics);
+	}
+
+	bool CopyAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		if (!EnsureOutputDirectory(request.output, diagnostics)) return false;
+
+		std::error_code ec;
+		std::filesystem::copy_file(request.source, request.output, std::filesystem::copy_options::overwrite_existing, ec);
+		if (ec) {
+			diagnostics.push_back({ Severity::Error, "Failed to copy to " + request.output.string() + ": " + ec.message() });
+			return false;
+		}
+		return true;
+	}
+
+	bool CompileSceneAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		if (!CopyAsset(request, diagnostics)) return false;
+
+		//the snapshot the editor cooked on save goes along, as long as it was cooked from this JSON
+		std::filesystem::path cooked = request.source;
+		cooked += ".bin";
+		std::filesystem::path cookedOutput = request.output;
+		cookedOutput += ".bin";
+
+		std::error_code ec;
+		std::filesystem::remove(cookedOutput, ec);
+		if (!std::filesystem::exists(cooked)) return true;
+
+		std::string source, binary;
+		std::vector<Diagnostic> ignored;
+		Serialization::SceneBinaryHeader header;
+		if (!ReadSource(request.source, source, diagnostics) || !ReadSource(cooked, binary, ignored) ||
+			!Serialization::ReadSceneBinaryHeader(binary, header) || header.sourceHash != Serialization::HashSceneSource(source)) {
+			diagnostics.push_back({ Severity::Info, "Cooked scene is out of date, the scene loads from JSON until it is saved again" });
+			return true;
+		}
+		return WriteOutput(cookedOutput, binary, diagnostics);
+	}
+
+	bool CompileMeshAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+#ifdef KOS_MESH_COMPILER
+		if (!EnsureOutputDirectory(request.output, diagnostics)) return false;
+
+		std::string error;
+		if (!meshcompiler::CompileMesh(request.source, request.output, error)) {
+			diagnostics.push_back({ Severity::Error, error });
+			return false;
+		}
+		return true;
+#else
+		diagnostics.push_back({ Severity::Error, "Built without Assimp, " + request.source.filename().string() + " cannot be compiled" });
+		return false;
+#endif
+	}
+
+	bool CompileFontAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		if (!EnsureOutputDirectory(request.output, diagnostics)) return false;
+
+		std::string error;
+		if (!fontcompiler::CompileFont(request.source, request.output, error)) {
+			diagnostics.push_back({ Severity::Error, error });
+			return false;
+		}
+		return true;
+	}
+
+	bool CompileMaterialAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		rapidjson::Document document;
+		if (!ReadJsonSource(request.source, document, diagnostics)) return false;
+
+		const bool hasMaterial = std::any_of(document.Begin(), document.End(), [](const rapidjson::Value& entry) {
+			return entry.IsObject() && entry.HasMember("MaterialData") && entry["MaterialData"].IsObject();
+		});
+		if (!hasMaterial) {
+			diagnostics.push_back({ Severity::Error, "No MaterialData in " + request.source.string() });
+			return false;
+		}
+		return CopyAsset(request, diagnostics);
+	}
+
+	bool CompilePrefabAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+		rapidjson::Document document;
+		if (!ReadJsonSource(request.source, document, diagnostics)) return false;
+
+		//scene data first, then one object per entity
+		for (const auto& entry : document.GetArray()) {
+			if (!entry.IsObject()) {
+				diagnostics.push_back({ Severity::Error, "Prefab entries must be objects in " + request.source.string() });
+				return false;
+			}
+		}
+		return CopyAsset(request, diagnostics);
+	}
+
+	CompileFunction GetCompileFunction(const CompilerIdentity& compiler) {
+		if (compiler.type == TEXTURE_TYPE) {
+			return CompileTextureAsset;
+		}
+		if (compiler.type == CONTROLLER_TYPE) {
+			return CompileControllerAsset;
+		}
+		if (compiler.type == ANIMATION_TYPE) {
+			return CompileAnimationAsset;
+		}
+		if (compiler.type == SCENE_TYPE) {
+			return CompileSceneAsset;
+		}
+		if (compiler.type == MODEL_TYPE) {
+			return CompileMeshAsset;
+		}
+		if (compiler.type == FONT_TYPE) {
+			return CompileFontAsset;
+		}
+		if (compiler.type == MATERIAL_TYPE) {
+			return CompileMaterialAsset;
+		}
+		if (compiler.type == PREFAB_TYPE) {
+			return CompilePrefabAsset;
+		}
+		if (IsCopyCompiler(compiler)) {
+			return CopyAsset;
+		}
+
+		//every compiler runs in process, an unknown one has nothing to run
+		return [](const CompileRequest& request, std::vector<Diagnostic>& diagnostics) {
+			diagnostics.push_back({ Severity::Error, "No compiler for " + request.compiler.type });
+			return false;
+		};
+	}
+
+	bool IsCopyCompiler(const CompilerIdentity& compiler) {
+		//in process compilers are also configured with a "null" path
+		return compiler.compilerFilePath == "null" && compiler.type != CONTROLLER_TYPE && compiler.type != ANIMATION_TYPE;
+	}
+}
@@ -0,0 +1,65 @@
+/******************************************************************/
+/*!
+\file      AssetCompiler.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Library entry points for every asset compiler, all sharing
+		   one signature so the job graph can run them side by side.
+
+		   - Textures are compiled in process by the texture compiler
+			 library.
+		   - Meshes are compiled in process by the mesh compiler library,
+			 when the build found Assimp.
+		   - Fonts are rasterized in process by the font compiler
+			 library.
+		   - Animation controllers are compiled in process from JSON to
+			 their binary layout.
+		   - Animation clips written by the mesh compiler are compressed
+			 in process.
+		   - Scenes are copied in process, with the binary snapshot
+			 cooked next to them when it is still current.
+		   - Materials and prefabs are checked as JSON and copied in
+			 process.
+		   - Audio and cube maps ("null" compilers) are copied in
+			 process.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "BuildCache.h"
+#include "JobGraph.h"
+
+namespace assetpipeline {
+
+	struct CompileRequest {
+		std::filesystem::path source;
+		std::filesystem::path meta;
+		std::filesystem::path output;
+		CompilerIdentity compiler;
+		unsigned int threadCount = 1; //threads a single compile may use, 0 for all
+	};
+
+	using CompileFunction = std::function<bool(const CompileRequest&, std::vector<Diagnostic>&)>;
+
+	bool CompileTextureAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CompileControllerAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CompileAnimationAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CompileSceneAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CompileMeshAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CompileFontAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CompileMaterialAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CompilePrefabAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+	bool CopyAsset(const CompileRequest& request, std::vector<Diagnostic>& diagnostics);
+
+	//picks the entry point for a compiler from Config.json
+	CompileFunction GetCompileFunction(const CompilerIdentity& compiler);
+
+	//true if the output is a plain copy of the source
+	bool IsCopyCompiler(const CompilerIdentity& compiler);
+}
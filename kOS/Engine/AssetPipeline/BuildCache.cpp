@@ -0,0 +1,256 @@
+/******************************************************************/
+/*!
+\file      BuildCache.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the content addressed asset build cache.
+
+		   Layout of the cache directory:
+		   - store/<first two key chars>/<key><output extension>
+		   - records/<output file name>.key
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "BuildCache.h"
+
+namespace assetpipeline {
+
+	namespace {
+		constexpr Hash FNV_PRIME = 1099511628211ull;
+		constexpr const char* INVALID_RECORD = "invalid";
+
+		bool IsHex(char c) {
+			return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+		}
+
+		bool IsGUIDAt(std::string_view text, size_t position) {
+			for (size_t i = 0; i < 36; ++i) {
+				const char c = text[position + i];
+				if (i == 8 || i == 13 || i == 18 || i == 23) {
+					if (c != '-') return false;
+				}
+				else if (!IsHex(c)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		//copy to a temporary file and rename, so readers never see a half written file
+		bool CopyAtomic(const std::filesystem::path& from, const std::filesystem::path& to) {
+			std::error_code ec;
+			if (to.has_parent_path()) {
+				std::filesystem::create_directories(to.parent_path(), ec);
+			}
+
+			std::filesystem::path temp = to;
+			temp += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+			std::filesystem::copy_file(from, temp, std::filesystem::copy_options::overwrite_existing, ec);
+			if (ec) {
+				std::filesystem::remove(temp, ec);
+				return false;
+			}
+
+			std::filesystem::rename(temp, to, ec);
+			if (ec) {
+				std::filesystem::remove(temp, ec);
+				return false;
+			}
+			return true;
+		}
+	}
+
+	Hash HashBytes(const void* data, size_t size, Hash seed) {
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		Hash hash = seed;
+		for (size_t i = 0; i < size; ++i) {
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+
+	Hash HashString(const std::string& string, Hash seed) {
+		//length first, so "ab"+"c" and "a"+"bc" hash differently
+		const uint64_t length = string.size();
+		seed = HashBytes(&length, sizeof(length), seed);
+		return HashBytes(string.data(), string.size(), seed);
+	}
+
+	bool HashFile(const std::filesystem::path& path, Hash& hash) {
+		std::ifstream file(path, std::ios::binary);
+		if (!file) return false;
+
+		hash = HASH_SEED;
+		std::vector<char> buffer(1 << 16);
+		while (file) {
+			file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			hash = HashBytes(buffer.data(), static_cast<size_t>(file.gcount()), hash);
+		}
+		return true;
+	}
+
+	std::string ToHex(Hash hash) {
+		static constexpr char digits[] = "0123456789abcdef";
+		std::string hex(16, '0');
+		for (int i = 15; i >= 0; --i) {
+			hex[static_cast<size_t>(i)] = digits[hash & 0xF];
+			hash >>= 4;
+		}
+		return hex;
+	}
+
+	bool IsGUID(std::string_view text) {
+		return text.size() == 36 && IsGUIDAt(text, 0);
+	}
+
+	std::vector<std::string> FindGUIDReferences(const std::filesystem::path& path) {
+		std::vector<std::string> guids;
+
+		std::ifstream file(path, std::ios::binary);
+		if (!file) return guids;
+		std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		for (size_t i = 0; i + 36 <= text.size(); ++i) {
+			if (IsGUIDAt(text, i)) {
+				guids.push_back(text.substr(i, 36));
+				i += 35;
+			}
+		}
+
+		std::sort(guids.begin(), guids.end());
+		guids.erase(std::unique(guids.begin(), guids.end()), guids.end());
+		return guids;
+	}
+
+
+	void BuildCache::Init(const std::filesystem::path& cacheDirectory) {
+		m_cacheDirectory = cacheDirectory;
+
+		std::error_code ec;
+		std::filesystem::create_directories(m_cacheDirectory / "store", ec);
+		std::filesystem::create_directories(m_cacheDirectory / "records", ec);
+		if (ec) {
+			LOGGING_WARN("Build Cache: failed to create " + m_cacheDirectory.string());
+		}
+	}
+
+	std::string BuildCache::ComputeKey(const BuildInput& input) {
+		Hash sourceHash{}, metaHash{};
+		if (!HashFile(input.source, sourceHash) || !HashFile(input.meta, metaHash)) {
+			return std::string{};
+		}
+
+		Hash key = HASH_SEED;
+		key = HashBytes(&sourceHash, sizeof(sourceHash), key);
+		key = HashBytes(&metaHash, sizeof(metaHash), key);
+
+		key = HashString(input.compiler.type, key);
+		key = HashString(input.compiler.compilerFilePath, key);
+		key = HashString(input.compiler.outputExtension, key);
+		key = HashString(input.compiler.version, key);
+
+		//a rebuilt compiler invalidates its outputs even if nobody bumped the version
+		if (input.compiler.compilerFilePath != "null") {
+			Hash compilerHash{};
+			std::lock_guard lock{ m_mutex };
+			auto it = m_compilerHashes.find(input.compiler.compilerFilePath);
+			if (it != m_compilerHashes.end()) {
+				compilerHash = it->second;
+			}
+			else if (HashFile(input.compiler.compilerFilePath, compilerHash)) {
+				m_compilerHashes[input.compiler.compilerFilePath] = compilerHash;
+			}
+			key = HashBytes(&compilerHash, sizeof(compilerHash), key);
+		}
+
+		std::vector<std::filesystem::path> dependencies = input.dependencies;
+		std::sort(dependencies.begin(), dependencies.end());
+		for (const auto& dependency : dependencies) {
+			Hash dependencyHash{};
+			if (!HashFile(dependency, dependencyHash)) {
+				//missing dependencies still change the key, so restoring them triggers a rebuild
+				dependencyHash = HashString("missing:" + dependency.filename().string());
+			}
+			key = HashBytes(&dependencyHash, sizeof(dependencyHash), key);
+		}
+
+		return ToHex(key);
+	}
+
+	CacheResult BuildCache::Fetch(const std::string& key, const std::filesystem::path& output) {
+		if (key.empty() || !IsInitialized()) {
+			++m_misses;
+			return CacheResult::MISS;
+		}
+
+		const std::string record = ReadRecord(output);
+
+		//an output with no record, left by an older compiler or a deleted cache, is not trusted
+		if (record == key && std::filesystem::exists(output)) {
+			++m_hits;
+			return CacheResult::UPTODATE;
+		}
+
+		const std::filesystem::path stored = GetStorePath(key, output);
+		if (std::filesystem::exists(stored) && CopyAtomic(stored, output)) {
+			Record(key, output);
+			++m_hits;
+			return CacheResult::RESTORED;
+		}
+
+		++m_misses;
+		return CacheResult::MISS;
+	}
+
+	bool BuildCache::Store(const std::string& key, const std::filesystem::path& output) {
+		if (key.empty() || !IsInitialized() || !std::filesystem::exists(output)) {
+			return false;
+		}
+
+		const std::filesystem::path stored = GetStorePath(key, output);
+		if (!std::filesystem::exists(stored) && !CopyAtomic(output, stored)) {
+			LOGGING_WARN("Build Cache: failed to store " + output.string());
+			return false;
+		}
+
+		return Record(key, output);
+	}
+
+	bool BuildCache::Record(const std::string& key, const std::filesystem::path& output) {
+		if (key.empty() || !IsInitialized()) return false;
+
+		std::ofstream file(GetRecordPath(output), std::ios::trunc);
+		if (!file) return false;
+		file << key;
+		return static_cast<bool>(file);
+	}
+
+	void BuildCache::Invalidate(const std::filesystem::path& output) {
+		if (!IsInitialized()) return;
+		Record(INVALID_RECORD, output);
+	}
+
+	std::filesystem::path BuildCache::GetStorePath(const std::string& key, const std::filesystem::path& output) const {
+		return m_cacheDirectory / "store" / key.substr(0, 2) / (key + output.extension().string());
+	}
+
+	std::filesystem::path BuildCache::GetRecordPath(const std::filesystem::path& output) const {
+		return m_cacheDirectory / "records" / (output.filename().string() + ".key");
+	}
+
+	std::string BuildCache::ReadRecord(const std::filesystem::path& output) const {
+		std::ifstream file(GetRecordPath(output));
+		std::string key;
+		if (file) {
+			std::getline(file, key);
+		}
+		return key;
+	}
+}
@@ -0,0 +1,131 @@
+/******************************************************************/
+/*!
+\file      BuildCache.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Content addressed cache for compiled assets.
+
+		   A build key is the hash of everything that can change a
+		   compiler's output:
+		   - the source bytes
+		   - the .meta bytes (GUID and compiler settings)
+		   - the compiler identity (type, executable, output extension,
+			 version and executable hash)
+		   - the source and meta bytes of every dependency
+
+		   Compiled outputs are stored under their key, so any asset that
+		   hashes to a key seen before is restored instead of recompiled.
+		   A record per output remembers which key produced the file that
+		   currently sits in the resource folder.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include <atomic>
+#include <mutex>
+
+namespace assetpipeline {
+
+	using Hash = uint64_t;
+
+	constexpr Hash HASH_SEED = 14695981039346656037ull; //FNV-1a offset basis
+
+	Hash HashBytes(const void* data, size_t size, Hash seed = HASH_SEED);
+	Hash HashString(const std::string& string, Hash seed = HASH_SEED);
+
+	//returns false if the file cannot be read
+	bool HashFile(const std::filesystem::path& path, Hash& hash);
+
+	std::string ToHex(Hash hash);
+
+	//true if "text" is exactly one GUID (8-4-4-4-12 hex)
+	bool IsGUID(std::string_view text);
+
+	//returns every GUID (8-4-4-4-12 hex) that appears in a text asset
+	std::vector<std::string> FindGUIDReferences(const std::filesystem::path& path);
+
+	struct CompilerIdentity {
+		std::string type;
+		std::string compilerFilePath;
+		std::string outputExtension;
+		std::string version;
+	};
+
+	struct BuildInput {
+		std::filesystem::path source;
+		std::filesystem::path meta;
+		CompilerIdentity compiler;
+		std::vector<std::filesystem::path> dependencies; //files whose bytes feed into the output
+	};
+
+	enum class CacheResult {
+		UPTODATE, //output already matches the key
+		RESTORED, //output copied from the store
+		MISS      //needs compiling
+	};
+
+	class BuildCache {
+	public:
+
+		void Init(const std::filesystem::path& cacheDirectory);
+
+		bool IsInitialized() const { return !m_cacheDirectory.empty(); }
+
+		/******************************************************************/
+		/*!
+		\fn      ComputeKey
+		\brief   Hashes every input of a compile.
+		\return  hex key, empty if the source or meta cannot be read
+		*/
+		/******************************************************************/
+		std::string ComputeKey(const BuildInput& input);
+
+		/******************************************************************/
+		/*!
+		\fn      Fetch
+		\brief   Brings "output" up to date with "key" without compiling if
+				 possible. Only an output recorded under "key" is taken as
+				 up to date, one with no record is compiled again.
+		*/
+		/******************************************************************/
+		CacheResult Fetch(const std::string& key, const std::filesystem::path& output);
+
+		//copies a freshly compiled output into the store and records it
+		bool Store(const std::string& key, const std::filesystem::path& output);
+
+		//records "key" as the producer of "output" without storing a copy,
+		//for outputs that are plain copies of their source
+		bool Record(const std::string& key, const std::filesystem::path& output);
+
+		//forgets which key produced the output, so the next Fetch rewrites it
+		void Invalidate(const std::filesystem::path& output);
+
+		size_t GetHitCount() const { return m_hits; }
+		size_t GetMissCount() const { return m_misses; }
+
+	private:
+
+		std::filesystem::path GetStorePath(const std::string& key, const std::filesystem::path& output) const;
+		std::filesystem::path GetRecordPath(const std::filesystem::path& output) const;
+
+		std::string ReadRecord(const std::filesystem::path& output) const;
+
+	private:
+
+		std::filesystem::path m_cacheDirectory;
+
+		std::mutex m_mutex;
+
+		//compiler executables are hashed once per session
+		std::unordered_map<std::string, Hash> m_compilerHashes;
+
+		std::atomic<size_t> m_hits{ 0 };
+		std::atomic<size_t> m_misses{ 0 };
+	};
+}
@@ -0,0 +1,318 @@
+/******************************************************************/
+/*!
+\file      ControllerCompiler.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the animation controller compiler.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "ControllerCompiler.h"
+
+#include <RAPIDJSON/document.h>
+#include <RAPIDJSON/error/en.h>
+#include <cstring>
+
+namespace assetpipeline {
+
+	namespace {
+
+		class ControllerBuilder {
+		public:
+
+			bool Build(const rapidjson::Value& root, std::string& error) {
+				if (!root.IsObject()) return Fail(error, "Controller must be a JSON object");
+
+				if (root.HasMember("parameters") && !ReadParameters(root["parameters"], error)) return false;
+
+				if (!root.HasMember("states") || !root["states"].IsArray() || root["states"].Empty()) {
+					return Fail(error, "Controller has no states");
+				}
+				//names first, so transitions may point at states declared later
+				for (const auto& state : root["states"].GetArray()) {
+					const std::string name = GetString(state, "name");
+					if (name.empty()) return Fail(error, "State without a name");
+					if (!m_stateIndex.emplace(name, static_cast<int32_t>(m_stateIndex.size())).second) return Fail(error, "Duplicate state " + name);
+				}
+				for (const auto& state : root["states"].GetArray()) {
+					if (!ReadState(state, error)) return false;
+				}
+
+				m_header.defaultState = 0;
+				const std::string defaultState = GetString(root, "defaultState");
+				if (!defaultState.empty()) {
+					const auto it = m_stateIndex.find(defaultState);
+					if (it == m_stateIndex.end()) return Fail(error, "Unknown default state " + defaultState);
+					m_header.defaultState = it->second;
+				}
+
+				if (root.HasMember("transitions")) {
+					if (!root["transitions"].IsArray()) return Fail(error, "\"transitions\" must be an array");
+					for (const auto& transition : root["transitions"].GetArray()) {
+						if (!ReadTransition(transition, error)) return false;
+					}
+				}
+				return true;
+			}
+
+			std::string Write() {
+				std::memcpy(m_header.magic, CONTROLLER_MAGIC, sizeof(CONTROLLER_MAGIC));
+				m_header.version = CONTROLLER_VERSION;
+				m_header.parameterCount = static_cast<uint32_t>(m_parameters.size());
+				m_header.clipCount = static_cast<uint32_t>(m_clips.size());
+				m_header.stateCount = static_cast<uint32_t>(m_states.size());
+				m_header.sampleCount = static_cast<uint32_t>(m_samples.size());
+				m_header.transitionCount = static_cast<uint32_t>(m_transitions.size());
+				m_header.conditionCount = static_cast<uint32_t>(m_conditions.size());
+				m_header.stringSize = static_cast<uint32_t>(m_strings.size());
+
+				std::string binary;
+				Append(binary, &m_header, 1);
+				Append(binary, m_parameters.data(), m_parameters.size());
+				Append(binary, m_clips.data(), m_clips.size());
+				Append(binary, m_states.data(), m_states.size());
+				Append(binary, m_samples.data(), m_samples.size());
+				Append(binary, m_transitions.data(), m_transitions.size());
+				Append(binary, m_conditions.data(), m_conditions.size());
+				binary += m_strings;
+				return binary;
+			}
+
+		private:
+
+			template <typename T>
+			static void Append(std::string& binary, const T* records, size_t count) {
+				binary.append(reinterpret_cast<const char*>(records), count * sizeof(T));
+			}
+
+			static bool Fail(std::string& error, const std::string& message) {
+				error = message;
+				return false;
+			}
+
+			static std::string GetString(const rapidjson::Value& object, const char* name) {
+				if (object.IsObject() && object.HasMember(name) && object[name].IsString()) {
+					return object[name].GetString();
+				}
+				return std::string{};
+			}
+
+			static float GetFloat(const rapidjson::Value& object, const char* name, float fallback) {
+				if (object.IsObject() && object.HasMember(name)) {
+					if (object[name].IsNumber()) return object[name].GetFloat();
+					if (object[name].IsBool()) return object[name].GetBool() ? 1.f : 0.f;
+				}
+				return fallback;
+			}
+
+			std::pair<uint32_t, uint32_t> AddString(const std::string& text) {
+				const auto offset = static_cast<uint32_t>(m_strings.size());
+				m_strings += text;
+				return { offset, static_cast<uint32_t>(text.size()) };
+			}
+
+			bool FindParameter(const rapidjson::Value& object, const char* member, int32_t& index, std::string& error) const {
+				const std::string name = GetString(object, member);
+				const auto it = m_parameterIndex.find(name);
+				if (it == m_parameterIndex.end()) return Fail(error, "Unknown parameter \"" + name + "\" in \"" + member + "\"");
+				index = it->second;
+				return true;
+			}
+
+			//every clip GUID is stored once
+			int32_t AddClip(const std::string& GUID) {
+				const auto it = m_clipIndex.find(GUID);
+				if (it != m_clipIndex.end()) return it->second;
+
+				const auto [offset, length] = AddString(GUID);
+				m_clips.push_back({ offset, length });
+				const auto index = static_cast<int32_t>(m_clips.size() - 1);
+				m_clipIndex.emplace(GUID, index);
+				return index;
+			}
+
+			bool ReadParameters(const rapidjson::Value& parameters, std::string& error) {
+				if (!parameters.IsArray()) return Fail(error, "\"parameters\" must be an array");
+
+				for (const auto& parameter : parameters.GetArray()) {
+					const std::string name = GetString(parameter, "name");
+					const std::string type = GetString(parameter, "type");
+					if (name.empty()) return Fail(error, "Parameter without a name");
+
+					ParameterRecord record{};
+					if (type == "float") record.type = ParameterType::Float;
+					else if (type == "bool") record.type = ParameterType::Bool;
+					else if (type == "trigger") record.type = ParameterType::Trigger;
+					else return Fail(error, "Parameter " + name + " has unknown type \"" + type + "\"");
+
+					std::tie(record.nameOffset, record.nameLength) = AddString(name);
+					record.defaultValue = record.type == ParameterType::Trigger ? 0.f : GetFloat(parameter, "default", 0.f);
+
+					if (!m_parameterIndex.emplace(name, static_cast<int32_t>(m_parameters.size())).second) return Fail(error, "Duplicate parameter " + name);
+					m_parameters.push_back(record);
+				}
+				return true;
+			}
+
+			bool ReadSamples(const rapidjson::Value& space, bool twoDimensional, StateRecord& state, std::string& error) {
+				if (!space.IsObject() || !space.HasMember("samples") || !space["samples"].IsArray() || space["samples"].Empty()) {
+					return Fail(error, "Blend space has no samples");
+				}
+
+				std::vector<BlendSampleRecord> samples;
+				for (const auto& sample : space["samples"].GetArray()) {
+					const std::string GUID = GetString(sample, "clip");
+					if (GUID.empty()) return Fail(error, "Blend sample without a clip");
+
+					BlendSampleRecord record{ AddClip(GUID), 0.f, 0.f };
+					if (twoDimensional) {
+						if (!sample.HasMember("position") || !sample["position"].IsArray() || sample["position"].Size() != 2 ||
+							!sample["position"][0].IsNumber() || !sample["position"][1].IsNumber()) {
+							return Fail(error, "Blend2D sample needs \"position\": [x, y]");
+						}
+						record.x = sample["position"][0].GetFloat();
+						record.y = sample["position"][1].GetFloat();
+					}
+					else {
+						if (!sample.HasMember("threshold") || !sample["threshold"].IsNumber()) return Fail(error, "Blend1D sample needs a \"threshold\"");
+						record.x = sample["threshold"].GetFloat();
+					}
+					samples.push_back(record);
+				}
+
+				if (!twoDimensional) {
+					std::stable_sort(samples.begin(), samples.end(), [](const BlendSampleRecord& a, const BlendSampleRecord& b) { return a.x < b.x; });
+				}
+
+				state.firstSample = static_cast<uint32_t>(m_samples.size());
+				state.sampleCount = static_cast<uint32_t>(samples.size());
+				m_samples.insert(m_samples.end(), samples.begin(), samples.end());
+				return true;
+			}
+
+			bool ReadState(const rapidjson::Value& state, std::string& error) {
+				const std::string name = GetString(state, "name");
+
+				StateRecord record{};
+				std::tie(record.nameOffset, record.nameLength) = AddString(name);
+				record.speed = GetFloat(state, "speed", 1.f);
+				record.loop = state.HasMember("loop") && state["loop"].IsBool() ? state["loop"].GetBool() : true;
+				record.clip = record.parameterX = record.parameterY = -1;
+
+				if (state.HasMember("blend1D")) {
+					record.motion = MotionType::Blend1D;
+					if (!FindParameter(state["blend1D"], "parameter", record.parameterX, error) ||
+						!ReadSamples(state["blend1D"], false, record, error)) {
+						error = "State " + name + ": " + error;
+						return false;
+					}
+				}
+				else if (state.HasMember("blend2D")) {
+					record.motion = MotionType::Blend2D;
+					if (!FindParameter(state["blend2D"], "parameterX", record.parameterX, error) ||
+						!FindParameter(state["blend2D"], "parameterY", record.parameterY, error) ||
+						!ReadSamples(state["blend2D"], true, record, error)) {
+						error = "State " + name + ": " + error;
+						return false;
+					}
+				}
+				else {
+					const std::string GUID = GetString(state, "clip");
+					if (GUID.empty()) return Fail(error, "State " + name + " has no clip or blend space");
+					record.motion = MotionType::Clip;
+					record.clip = AddClip(GUID);
+				}
+
+				m_states.push_back(record);
+				return true;
+			}
+
+			bool ReadTransition(const rapidjson::Value& transition, std::string& error) {
+				const std::string from = GetString(transition, "from");
+				const std::string to = GetString(transition, "to");
+
+				TransitionRecord record{};
+				if (from == "Any") {
+					record.from = ANY_STATE;
+				}
+				else {
+					const auto it = m_stateIndex.find(from);
+					if (it == m_stateIndex.end()) return Fail(error, "Transition from unknown state \"" + from + "\"");
+					record.from = it->second;
+				}
+
+				const auto it = m_stateIndex.find(to);
+				if (it == m_stateIndex.end()) return Fail(error, "Transition to unknown state \"" + to + "\"");
+				record.to = it->second;
+
+				record.duration = std::max(GetFloat(transition, "duration", 0.f), 0.f);
+				record.exitTime = GetFloat(transition, "exitTime", -1.f);
+
+				record.firstCondition = static_cast<uint32_t>(m_conditions.size());
+				if (transition.HasMember("conditions")) {
+					if (!transition["conditions"].IsArray()) return Fail(error, "\"conditions\" must be an array");
+
+					for (const auto& condition : transition["conditions"].GetArray()) {
+						ConditionRecord conditionRecord{};
+						if (!FindParameter(condition, "parameter", conditionRecord.parameter, error)) return false;
+
+						const std::string mode = GetString(condition, "mode");
+						if (mode == "if") conditionRecord.mode = ConditionMode::If;
+						else if (mode == "ifNot") conditionRecord.mode = ConditionMode::IfNot;
+						else if (mode == "greater") conditionRecord.mode = ConditionMode::Greater;
+						else if (mode == "less") conditionRecord.mode = ConditionMode::Less;
+						else if (mode == "equals") conditionRecord.mode = ConditionMode::Equals;
+						else if (mode == "notEquals") conditionRecord.mode = ConditionMode::NotEquals;
+						else return Fail(error, "Unknown condition mode \"" + mode + "\"");
+
+						conditionRecord.threshold = GetFloat(condition, "threshold", 0.f);
+						m_conditions.push_back(conditionRecord);
+					}
+				}
+				record.conditionCount = static_cast<uint32_t>(m_conditions.size()) - record.firstCondition;
+
+				//a transition with nothing to wait for would fire every frame
+				if (record.conditionCount == 0 && record.exitTime < 0.f) {
+					return Fail(error, "Transition " + from + " -> " + to + " has no condition and no exit time");
+				}
+
+				m_transitions.push_back(record);
+				return true;
+			}
+
+			ControllerHeader m_header{};
+			std::vector<ParameterRecord> m_parameters;
+			std::vector<ClipRecord> m_clips;
+			std::vector<StateRecord> m_states;
+			std::vector<BlendSampleRecord> m_samples;
+			std::vector<TransitionRecord> m_transitions;
+			std::vector<ConditionRecord> m_conditions;
+			std::string m_strings;
+
+			std::unordered_map<std::string, int32_t> m_parameterIndex;
+			std::unordered_map<std::string, int32_t> m_stateIndex;
+			std::unordered_map<std::string, int32_t> m_clipIndex;
+		};
+	}
+
+	bool CompileController(std::string_view source, std::string& binary, std::string& error) {
+		rapidjson::Document document;
+		document.Parse(source.data(), source.size());
+		if (document.HasParseError()) {
+			error = std::string("JSON parse error at offset ") + std::to_string(document.GetErrorOffset()) + ": " +
+				rapidjson::GetParseError_En(document.GetParseError());
+			return false;
+		}
+
+		ControllerBuilder builder;
+		if (!builder.Build(document, error)) return false;
+
+		binary = builder.Write();
+		return true;
+	}
+}
@@ -0,0 +1,139 @@
+/******************************************************************/
+/*!
+\file      ControllerCompiler.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Binary layout of compiled animation controllers, and the
+		   compiler from the JSON controller source.
+
+		   A compiled controller is a header followed by fixed size
+		   record tables (parameters, clips, states, blend samples,
+		   transitions, conditions) and one string table. Records refer
+		   to each other by index, so the runtime copies the tables and
+		   never parses text.
+
+		   Source format:
+		   {
+			 "parameters": [ { "name": "speed", "type": "float", "default": 0 },
+							 { "name": "jump", "type": "trigger" } ],
+			 "defaultState": "Locomotion",
+			 "states": [
+			   { "name": "Idle", "clip": "GUID", "speed": 1, "loop": true },
+			   { "name": "Locomotion", "blend1D": { "parameter": "speed",
+				 "samples": [ { "clip": "GUID", "threshold": 0 }, ... ] } },
+			   { "name": "Strafe", "blend2D": { "parameterX": "x", "parameterY": "y",
+				 "samples": [ { "clip": "GUID", "position": [ 0, 1 ] }, ... ] } } ],
+			 "transitions": [
+			   { "from": "Any", "to": "Jump", "duration": 0.1, "exitTime": 0.9,
+				 "conditions": [ { "parameter": "jump", "mode": "if" },
+								 { "parameter": "speed", "mode": "greater", "threshold": 0.5 } ] } ]
+		   }
+
+		   Condition modes are if, ifNot, greater, less, equals and
+		   notEquals. Transitions are tried in file order.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+namespace assetpipeline {
+
+	inline constexpr char CONTROLLER_MAGIC[4] = { 'K', 'A', 'C', 'T' };
+	inline constexpr uint32_t CONTROLLER_VERSION = 1;
+
+	//"from" of transitions that can leave any state
+	inline constexpr int32_t ANY_STATE = -1;
+
+	enum class ParameterType : uint8_t {
+		Float,
+		Bool,
+		Trigger  //bool that is cleared by the transition it fires
+	};
+
+	enum class ConditionMode : uint8_t {
+		If,
+		IfNot,
+		Greater,
+		Less,
+		Equals,
+		NotEquals
+	};
+
+	enum class MotionType : uint8_t {
+		Clip,
+		Blend1D,
+		Blend2D
+	};
+
+	struct ControllerHeader {
+		char magic[4];
+		uint32_t version;
+		uint32_t parameterCount;
+		uint32_t clipCount;
+		uint32_t stateCount;
+		uint32_t sampleCount;
+		uint32_t transitionCount;
+		uint32_t conditionCount;
+		uint32_t stringSize;
+		int32_t defaultState;
+	};
+
+	struct ParameterRecord {
+		uint32_t nameOffset;
+		uint32_t nameLength;
+		ParameterType type;
+		uint8_t padding[3];
+		float defaultValue;
+	};
+
+	struct ClipRecord {
+		uint32_t GUIDOffset;
+		uint32_t GUIDLength;
+	};
+
+	struct StateRecord {
+		uint32_t nameOffset;
+		uint32_t nameLength;
+		MotionType motion;
+		uint8_t loop;
+		uint8_t padding[2];
+		int32_t clip;        //MotionType::Clip
+		int32_t parameterX;  //blend spaces
+		int32_t parameterY;  //Blend2D
+		uint32_t firstSample;
+		uint32_t sampleCount;
+		float speed;
+	};
+
+	//clip placed in a blend space, 1D spaces only use x and are sorted by it
+	struct BlendSampleRecord {
+		int32_t clip;
+		float x;
+		float y;
+	};
+
+	struct TransitionRecord {
+		int32_t from;        //ANY_STATE or a state index
+		int32_t to;
+		float duration;      //cross fade in seconds
+		float exitTime;      //normalized time of "from" the transition waits for, negative for none
+		uint32_t firstCondition;
+		uint32_t conditionCount;
+	};
+
+	struct ConditionRecord {
+		int32_t parameter;
+		ConditionMode mode;
+		uint8_t padding[3];
+		float threshold;
+	};
+
+	//JSON controller source to the binary layout above
+	bool CompileController(std::string_view source, std::string& binary, std::string& error);
+}
@@ -0,0 +1,505 @@
+/******************************************************************/
+/*!
+\file      FileWatcher.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the file watcher and its inotify and polling
+		   backends.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "FileWatcher.h"
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace assetpipeline {
+
+	namespace {
+
+		using Clock = std::chrono::steady_clock;
+
+		//how long Wait blocks when nothing is pending, bounds how long Stop takes
+		constexpr std::chrono::milliseconds IDLE_WAIT{ 100 };
+
+		bool IsUnder(const std::string& path, const std::string& directory) {
+			return path.size() > directory.size() && path.compare(0, directory.size(), directory) == 0 &&
+				(path[directory.size()] == '/' || path[directory.size()] == '\\');
+		}
+
+		class PollingBackend : public WatcherBackend {
+		public:
+			explicit PollingBackend(std::chrono::milliseconds interval) : m_interval(interval) {}
+
+			bool Start(const std::filesystem::path& root) override {
+				m_root = root;
+				Scan(m_snapshot);
+				m_nextScan = Clock::now() + m_interval;
+				return true;
+			}
+
+			void Wait(std::chrono::milliseconds timeout, std::vector<FileEvent>& events) override {
+				const auto now = Clock::now();
+				if (now < m_nextScan) {
+					std::this_thread::sleep_for(std::min<Clock::duration>(timeout, m_nextScan - now));
+					if (Clock::now() < m_nextScan) return;
+				}
+				m_nextScan = Clock::now() + m_interval;
+
+				std::unordered_map<std::string, std::pair<std::filesystem::file_time_type, uintmax_t>> current;
+				Scan(current);
+
+				for (const auto& [path, state] : current) {
+					const auto it = m_snapshot.find(path);
+					if (it == m_snapshot.end() || it->second != state) {
+						events.push_back({ FileEventType::Changed, path });
+					}
+				}
+				for (const auto& [path, state] : m_snapshot) {
+					if (!current.contains(path)) {
+						events.push_back({ FileEventType::Changed, path });
+					}
+				}
+				m_snapshot = std::move(current);
+			}
+
+			const char* GetName() const override { return "polling"; }
+
+		private:
+
+			void Scan(std::unordered_map<std::string, std::pair<std::filesystem::file_time_type, uintmax_t>>& snapshot) const {
+				std::error_code ec;
+				for (auto it = std::filesystem::recursive_directory_iterator(m_root, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+					std::error_code stateError;
+					const auto time = std::filesystem::last_write_time(it->path(), stateError);
+					const auto size = it->is_regular_file(stateError) ? it->file_size(stateError) : 0;
+					snapshot[it->path().string()] = { time, size };
+				}
+			}
+
+			std::filesystem::path m_root;
+			std::chrono::milliseconds m_interval;
+			Clock::time_point m_nextScan;
+			std::unordered_map<std::string, std::pair<std::filesystem::file_time_type, uintmax_t>> m_snapshot;
+		};
+
+#ifdef __linux__
+		class InotifyBackend : public WatcherBackend {
+		public:
+			~InotifyBackend() override {
+				if (m_fd >= 0) close(m_fd);
+			}
+
+			bool Start(const std::filesystem::path& root) override {
+				m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+				if (m_fd < 0) {
+					LOGGING_WARN("File Watcher: inotify_init1 failed, errno " + std::to_string(errno));
+					return false;
+				}
+
+				std::vector<FileEvent> ignored;
+				return WatchTree(root, ignored);
+			}
+
+			void Wait(std::chrono::milliseconds timeout, std::vector<FileEvent>& events) override {
+				pollfd descriptor{ m_fd, POLLIN, 0 };
+				if (poll(&descriptor, 1, static_cast<int>(timeout.count())) <= 0) return;
+
+				//rename halves arrive as a pair with the same cookie
+				std::unordered_map<uint32_t, std::pair<std::filesystem::path, bool>> movedFrom;
+
+				alignas(inotify_event) char buffer[16 * 1024];
+				while (true) {
+					const ssize_t length = read(m_fd, buffer, sizeof(buffer));
+					if (length <= 0) break;
+
+					for (ssize_t offset = 0; offset < length;) {
+						const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+						offset += sizeof(inotify_event) + event->len;
+						Handle(*event, movedFrom, events);
+					}
+				}
+
+				//the other half was outside the watched tree
+				for (const auto& [cookie, moved] : movedFrom) {
+					if (moved.second) Unwatch(moved.first);
+					events.push_back({ FileEventType::Changed, moved.first });
+				}
+			}
+
+			const char* GetName() const override { return "inotify"; }
+
+		private:
+
+			static constexpr uint32_t WATCH_MASK = IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE |
+				IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+
+			void Handle(const inotify_event& event, std::unordered_map<uint32_t, std::pair<std::filesystem::path, bool>>& movedFrom, std::vector<FileEvent>& events) {
+				if (event.mask & IN_Q_OVERFLOW) {
+					events.push_back({ FileEventType::Rescan });
+					return;
+				}
+
+				const auto watch = m_watches.find(event.wd);
+				if (watch == m_watches.end()) return;
+
+				if (event.mask & IN_IGNORED) {
+					m_watches.erase(watch);
+					return;
+				}
+				if (event.len == 0) return;
+
+				const std::filesystem::path path = watch->second / event.name;
+				const bool directory = event.mask & IN_ISDIR;
+
+				if (event.mask & IN_MOVED_FROM) {
+					movedFrom[event.cookie] = { path, directory };
+					return;
+				}
+
+				if (event.mask & IN_MOVED_TO) {
+					const auto from = movedFrom.find(event.cookie);
+					if (from != movedFrom.end()) {
+						if (directory) Rewatch(from->second.first, path);
+						events.push_back({ FileEventType::Renamed, from->second.first, path });
+						movedFrom.erase(from);
+						return;
+					}
+				}
+
+				if (directory && (event.mask & (IN_CREATE | IN_MOVED_TO))) {
+					//files can land before the watch is added, report everything inside
+					WatchTree(path, events);
+				}
+				events.push_back({ FileEventType::Changed, path });
+			}
+
+			bool WatchTree(const std::filesystem::path& root, std::vector<FileEvent>& events) {
+				if (!AddWatch(root)) return false;
+
+				std::error_code ec;
+				for (auto it = std::filesystem::recursive_directory_iterator(root, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+					std::error_code typeError;
+					if (it->is_directory(typeError) && !AddWatch(it->path())) return false;
+					events.push_back({ FileEventType::Changed, it->path() });
+				}
+				return true;
+			}
+
+			bool AddWatch(const std::filesystem::path& directory) {
+				const int wd = inotify_add_watch(m_fd, directory.c_str(), WATCH_MASK);
+				if (wd < 0) {
+					//ENOSPC: fs.inotify.max_user_watches is too low for this tree
+					LOGGING_WARN("File Watcher: cannot watch " + directory.string() + ", errno " + std::to_string(errno));
+					return false;
+				}
+				m_watches[wd] = directory;
+				return true;
+			}
+
+			void Unwatch(const std::filesystem::path& directory) {
+				const std::string root = directory.string();
+				for (auto it = m_watches.begin(); it != m_watches.end();) {
+					const std::string path = it->second.string();
+					if (path == root || IsUnder(path, root)) {
+						inotify_rm_watch(m_fd, it->first);
+						it = m_watches.erase(it);
+					}
+					else {
+						++it;
+					}
+				}
+			}
+
+			//watch descriptors follow a moved directory, only their paths change
+			void Rewatch(const std::filesystem::path& from, const std::filesystem::path& to) {
+				const std::string root = from.string();
+				for (auto& [wd, path] : m_watches) {
+					const std::string current = path.string();
+					if (current == root) {
+						path = to;
+					}
+					else if (IsUnder(current, root)) {
+						path = to.string() + current.substr(root.size());
+					}
+				}
+			}
+
+			int m_fd = -1;
+			std::unordered_map<int, std::filesystem::path> m_watches;
+		};
+#endif
+	}
+
+	std::unique_ptr<WatcherBackend> CreateInotifyBackend() {
+#ifdef __linux__
+		return std::make_unique<InotifyBackend>();
+#else
+		return nullptr;
+#endif
+	}
+
+	std::unique_ptr<WatcherBackend> CreatePollingBackend(std::chrono::milliseconds interval) {
+		return std::make_unique<PollingBackend>(interval);
+	}
+
+
+	FileWatcher::FileWatcher(const std::string& path, std::chrono::milliseconds delay)
+		: m_path(path), m_delay(delay)
+	{
+	}
+
+	FileWatcher::~FileWatcher() {
+		Stop();
+	}
+
+	void FileWatcher::Start() {
+		// initialize initial files
+		std::error_code ec;
+		for (auto it = std::filesystem::recursive_directory_iterator(m_path, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+			const auto state = ReadState(it->path());
+			if (state && !IsIgnored(it->path(), state->directory)) {
+				m_files[it->path().string()] = *state;
+			}
+		}
+
+		if (m_backendType != Backend::Polling) {
+			m_backend = CreateInotifyBackend();
+			if (m_backend && !m_backend->Start(m_path)) {
+				m_backend.reset();
+			}
+			if (!m_backend && m_backendType == Backend::Inotify) {
+				LOGGING_WARN("File Watcher: inotify is not available, falling back to polling");
+			}
+		}
+		if (!m_backend) {
+			m_backend = CreatePollingBackend(m_delay);
+			m_backend->Start(m_path);
+		}
+
+		m_running = true;
+		m_thread = std::thread([this]() { Run(); });
+	}
+
+	void FileWatcher::Stop() {
+		m_running = false;
+		if (m_thread.joinable()) {
+			m_thread.join();
+		}
+	}
+
+	void FileWatcher::Run() {
+		std::vector<FileEvent> events;
+		while (m_running) {
+			const bool pending = m_rescan || !m_dirty.empty() || !m_renames.empty();
+			std::chrono::milliseconds timeout = IDLE_WAIT;
+			if (pending && !m_paused) {
+				const auto quiet = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - m_lastEvent);
+				timeout = std::clamp(m_debounce - quiet, std::chrono::milliseconds{ 0 }, IDLE_WAIT);
+			}
+
+			events.clear();
+			m_backend->Wait(timeout, events);
+			Collect(events);
+
+			if (m_paused || !(m_rescan || !m_dirty.empty() || !m_renames.empty())) continue;
+
+			//a file written without pause still gets reported
+			const auto now = Clock::now();
+			if (now - m_lastEvent >= m_debounce || now - m_firstEvent >= m_debounce * 10) {
+				Flush();
+			}
+		}
+	}
+
+	void FileWatcher::Collect(const std::vector<FileEvent>& events) {
+		if (events.empty()) return;
+
+		const auto now = Clock::now();
+		if (!m_rescan && m_dirty.empty() && m_renames.empty()) {
+			m_firstEvent = now;
+		}
+		m_lastEvent = now;
+
+		for (const auto& event : events) {
+			switch (event.type) {
+			case FileEventType::Changed:
+				m_dirty.insert(event.path.string());
+				break;
+			case FileEventType::Renamed:
+				m_renames.push_back({ event.path, event.newPath });
+				break;
+			case FileEventType::Rescan:
+				m_rescan = true;
+				break;
+			}
+		}
+	}
+
+	void FileWatcher::MarkTree(const std::filesystem::path& path) {
+		const std::string root = path.string();
+		for (const auto& [known, state] : m_files) {
+			if (IsUnder(known, root)) m_dirty.insert(known);
+		}
+
+		std::error_code ec;
+		if (!std::filesystem::is_directory(path, ec)) return;
+		for (auto it = std::filesystem::recursive_directory_iterator(path, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+			m_dirty.insert(it->path().string());
+		}
+	}
+
+	void FileWatcher::Flush() {
+		if (m_rescan) {
+			MarkTree(m_path);
+			m_rescan = false;
+		}
+
+		//exact renames, a moved directory renames everything under it
+		for (const auto& [from, to] : m_renames) {
+			std::vector<std::pair<std::string, std::filesystem::path>> moved{ { from.string(), to } };
+			const std::string root = from.string();
+			for (const auto& [known, state] : m_files) {
+				if (IsUnder(known, root)) {
+					moved.push_back({ known, to.string() + known.substr(root.size()) });
+				}
+			}
+
+			for (const auto& [source, target] : moved) {
+				const auto known = m_files.find(source);
+				const auto state = ReadState(target);
+				std::error_code ec;
+
+				if (known != m_files.end() && !std::filesystem::exists(source, ec) && state &&
+					!IsIgnored(target, state->directory) && !m_files.contains(target.string()) && !m_dirty.contains(target.string())) {
+					m_files.erase(known);
+					m_files[target.string()] = *state;
+					m_dirty.erase(source);
+					NotifyRename(source, target);
+				}
+				else {
+					//renamed from a temporary file, or over an existing one
+					m_dirty.insert(source);
+					m_dirty.insert(target.string());
+				}
+			}
+		}
+		m_renames.clear();
+
+		//paths inside a removed or created directory
+		std::vector<std::string> directories;
+		for (const auto& path : m_dirty) {
+			std::error_code ec;
+			if (!std::filesystem::exists(path, ec) || std::filesystem::is_directory(path, ec)) directories.push_back(path);
+		}
+		for (const auto& directory : directories) {
+			MarkTree(directory);
+		}
+
+		std::vector<std::pair<std::string, FileState>> added;
+		std::vector<std::pair<std::string, FileState>> removed;
+		for (const auto& path : m_dirty) {
+			const auto state = ReadState(path);
+			const auto known = m_files.find(path);
+
+			if (state && IsIgnored(path, state->directory)) continue;
+
+			if (state && known == m_files.end()) {
+				added.push_back({ path, *state });
+			}
+			else if (state && !(known->second == *state)) {
+				known->second = *state;
+				Notify(MODIFIED, path);
+			}
+			else if (!state && known != m_files.end()) {
+				removed.push_back(*known);
+			}
+		}
+		m_dirty.clear();
+
+		//backends without rename events: a removed and an added file with the same time and size
+		for (auto removedIt = removed.begin(); removedIt != removed.end();) {
+			auto match = added.end();
+			size_t matches = 0;
+			for (auto addedIt = added.begin(); addedIt != added.end(); ++addedIt) {
+				if (addedIt->second == removedIt->second) {
+					match = addedIt;
+					++matches;
+				}
+			}
+
+			if (matches == 1 && !removedIt->second.directory) {
+				m_files.erase(removedIt->first);
+				m_files[match->first] = match->second;
+				NotifyRename(removedIt->first, match->first);
+				added.erase(match);
+				removedIt = removed.erase(removedIt);
+			}
+			else {
+				++removedIt;
+			}
+		}
+
+		for (const auto& [path, state] : added) {
+			m_files[path] = state;
+			Notify(ADDED, path);
+		}
+		for (const auto& [path, state] : removed) {
+			m_files.erase(path);
+			Notify(REMOVED, path);
+		}
+	}
+
+	bool FileWatcher::IsIgnored(const std::filesystem::path& path, bool directory) const {
+		if (m_IgnoreDirectory && directory) {
+			return true;
+		}
+
+		std::string ext = path.extension().string(); // includes the dot, e.g. ".txt"
+
+		return std::find(m_ignoredExtensions.begin(),
+			m_ignoredExtensions.end(),
+			ext) != m_ignoredExtensions.end();
+	}
+
+	std::optional<FileWatcher::FileState> FileWatcher::ReadState(const std::filesystem::path& path) const {
+		std::error_code ec;
+		const auto status = std::filesystem::status(path, ec);
+		if (ec || !std::filesystem::exists(status)) return std::nullopt;
+
+		FileState state;
+		state.directory = std::filesystem::is_directory(status);
+		state.time = std::filesystem::last_write_time(path, ec);
+		if (!state.directory) state.size = std::filesystem::file_size(path, ec);
+		if (ec) return std::nullopt;
+		return state;
+	}
+
+	void FileWatcher::Notify(ACTION action, const std::filesystem::path& filepath) {
+		if (m_Callback) {
+			m_Callback(action, filepath);
+		}
+		else {
+			std::cout << "File " << action << ": " << filepath << "\n";
+		}
+	}
+
+	void FileWatcher::NotifyRename(const std::filesystem::path& from, const std::filesystem::path& to) {
+		if (m_RenameCallback) {
+			m_RenameCallback(from, to);
+		}
+		else {
+			Notify(REMOVED, from);
+			Notify(ADDED, to);
+		}
+	}
+}
@@ -0,0 +1,168 @@
+/******************************************************************/
+/*!
+\file      FileWatcher.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Watches a directory tree and reports added, modified, removed
+		   and renamed files.
+
+		   Changes come from a backend:
+		   - inotify on Linux, event driven.
+		   - polling, a directory walk every "delay", used on other
+			 platforms or when inotify cannot watch the tree.
+
+		   Raw changes are only marked dirty. Once the tree has been quiet
+		   for the debounce window, every dirty path is compared against
+		   the last known state, so a burst of writes is one MODIFIED, a
+		   temporary file that comes and goes reports nothing, and a save
+		   through "write temp file, rename over" is a MODIFIED.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+#include <atomic>
+
+namespace assetpipeline {
+
+	enum ACTION
+	{
+		ADDED,
+		MODIFIED,
+		REMOVED
+	};
+
+	enum class FileEventType {
+		Changed,
+		Renamed,
+		Rescan
+	};
+
+	//raw change from a backend
+	struct FileEvent {
+		FileEventType type = FileEventType::Changed;
+		std::filesystem::path path{};
+		std::filesystem::path newPath{}; //Renamed only
+	};
+
+	class WatcherBackend {
+	public:
+		virtual ~WatcherBackend() = default;
+
+		//false if "root" cannot be watched, the watcher then falls back to polling
+		virtual bool Start(const std::filesystem::path& root) = 0;
+
+		//blocks for at most "timeout", appending whatever changed
+		virtual void Wait(std::chrono::milliseconds timeout, std::vector<FileEvent>& events) = 0;
+
+		virtual const char* GetName() const = 0;
+	};
+
+	//nullptr where inotify is not available
+	std::unique_ptr<WatcherBackend> CreateInotifyBackend();
+	std::unique_ptr<WatcherBackend> CreatePollingBackend(std::chrono::milliseconds interval);
+
+	class FileWatcher {
+	public:
+		using Callback = std::function<void(ACTION, const std::filesystem::path&)>;
+		using RenameCallback = std::function<void(const std::filesystem::path&, const std::filesystem::path&)>;
+
+		enum class Backend {
+			Auto,
+			Inotify,
+			Polling
+		};
+
+		//"delay" is the polling interval when the polling backend is used
+		FileWatcher(const std::string& path, std::chrono::milliseconds delay);
+
+		~FileWatcher();
+
+		void Start();
+		void Stop();
+
+		//events keep collecting while paused and are reported on resume
+		void Pause() { m_paused = true; }
+		void Resume() { m_paused = false; }
+		bool IsPaused() const { return m_paused; }
+
+		template <typename... T>
+		void SetIgnoreExtension(T&&... extensions) {
+			(m_ignoredExtensions.push_back(std::forward<T>(extensions)), ...);
+		}
+
+		void SetIgnoreDirectory(bool boolean) {
+			m_IgnoreDirectory = boolean;
+		}
+
+		void SetCallback(Callback cb) {
+			m_Callback = cb;
+		}
+
+		//without a rename callback, a rename is reported as REMOVED then ADDED
+		void SetRenameCallback(RenameCallback cb) {
+			m_RenameCallback = cb;
+		}
+
+		//quiet time before a burst of changes is reported
+		void SetDebounce(std::chrono::milliseconds debounce) { m_debounce = debounce; }
+
+		//call before Start
+		void SetBackend(Backend backend) { m_backendType = backend; }
+
+		const char* GetBackendName() const { return m_backend ? m_backend->GetName() : "none"; }
+
+	private:
+
+		struct FileState {
+			std::filesystem::file_time_type time{};
+			uintmax_t size{};
+			bool directory{};
+
+			bool operator==(const FileState& other) const {
+				return time == other.time && size == other.size && directory == other.directory;
+			}
+		};
+
+		void Run();
+		void Collect(const std::vector<FileEvent>& events);
+		void Flush();
+		void MarkTree(const std::filesystem::path& path);
+
+		bool IsIgnored(const std::filesystem::path& path, bool directory) const;
+		std::optional<FileState> ReadState(const std::filesystem::path& path) const;
+
+		void Notify(ACTION action, const std::filesystem::path& filepath);
+		void NotifyRename(const std::filesystem::path& from, const std::filesystem::path& to);
+
+		bool m_IgnoreDirectory = true;
+		std::atomic<bool> m_paused{ false };
+		std::string m_path;
+		std::chrono::milliseconds m_delay;
+		std::chrono::milliseconds m_debounce{ 100 };
+		Backend m_backendType = Backend::Auto;
+		std::unique_ptr<WatcherBackend> m_backend;
+
+		//last reported state, only touched by the watcher thread after Start
+		std::unordered_map<std::string, FileState> m_files;
+
+		std::set<std::string> m_dirty;
+		std::vector<std::pair<std::filesystem::path, std::filesystem::path>> m_renames;
+		bool m_rescan = false;
+		std::chrono::steady_clock::time_point m_firstEvent;
+		std::chrono::steady_clock::time_point m_lastEvent;
+
+		std::thread m_thread;
+		std::atomic<bool> m_running{ false };
+		std::vector<std::string> m_ignoredExtensions;
+
+		Callback m_Callback;
+		RenameCallback m_RenameCallback;
+	};
+}
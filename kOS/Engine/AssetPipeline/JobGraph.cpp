@@ -0,0 +1,168 @@
+/******************************************************************/
+/*!
+\file      JobGraph.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the dependency ordered job graph.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "JobGraph.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace assetpipeline {
+
+	JobID JobGraph::AddJob(const std::string& name, const std::string& stage, JobFunction function) {
+		Job job;
+		job.name = name;
+		job.stage = stage;
+		job.function = std::move(function);
+		m_jobs.push_back(std::move(job));
+		return m_jobs.size() - 1;
+	}
+
+	void JobGraph::AddDependency(JobID job, JobID dependency) {
+		m_jobs.at(dependency).dependents.push_back(job);
+		++m_jobs.at(job).dependencyCount;
+	}
+
+	bool JobGraph::Execute(unsigned int threadCount) {
+		if (threadCount == 0) {
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		std::vector<size_t> remaining(m_jobs.size());
+		std::deque<JobID> ready;
+		for (JobID id = 0; id < m_jobs.size(); ++id) {
+			Job& job = m_jobs[id];
+			job.status = JobStatus::Pending;
+			job.diagnostics.clear();
+			job.milliseconds = 0.0;
+			remaining[id] = job.dependencyCount;
+			if (remaining[id] == 0) {
+				ready.push_back(id);
+			}
+		}
+
+		//anything a topological walk cannot reach sits in or behind a cycle
+		size_t outstanding = m_jobs.size();
+		{
+			std::vector<size_t> counts = remaining;
+			std::deque<JobID> walk = ready;
+			std::vector<bool> reached(m_jobs.size(), false);
+			while (!walk.empty()) {
+				JobID id = walk.front();
+				walk.pop_front();
+				reached[id] = true;
+				for (JobID dependent : m_jobs[id].dependents) {
+					if (--counts[dependent] == 0) {
+						walk.push_back(dependent);
+					}
+				}
+			}
+
+			for (JobID id = 0; id < m_jobs.size(); ++id) {
+				if (!reached[id]) {
+					m_jobs[id].status = JobStatus::Failed;
+					m_jobs[id].diagnostics.push_back({ Severity::Error, "Dependency cycle detected" });
+					--outstanding;
+				}
+			}
+		}
+
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		auto worker = [&]() {
+			while (true) {
+				JobID id;
+				{
+					std::unique_lock lock{ mutex };
+					condition.wait(lock, [&]() { return !ready.empty() || outstanding == 0; });
+					if (ready.empty()) return;
+					id = ready.front();
+					ready.pop_front();
+				}
+
+				//each worker only touches its own job while running
+				Job& job = m_jobs[id];
+				bool success = false;
+				auto start = std::chrono::steady_clock::now();
+				try {
+					success = job.function ? job.function(job.diagnostics) : true;
+				}
+				catch (const std::exception& e) {
+					job.diagnostics.push_back({ Severity::Error, std::string("Exception: ") + e.what() });
+				}
+				job.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+				{
+					std::lock_guard lock{ mutex };
+					job.status = success ? JobStatus::Succeeded : JobStatus::Failed;
+					--outstanding;
+
+					if (success) {
+						for (JobID dependent : job.dependents) {
+							if (m_jobs[dependent].status == JobStatus::Pending && --remaining[dependent] == 0) {
+								ready.push_back(dependent);
+							}
+						}
+					}
+					else {
+						outstanding -= SkipDependents(id);
+					}
+				}
+				condition.notify_all();
+			}
+			};
+
+		const size_t workerCount = std::min<size_t>(threadCount, std::max<size_t>(m_jobs.size(), 1));
+		std::vector<std::thread> workers;
+		workers.reserve(workerCount);
+		for (size_t i = 0; i < workerCount; ++i) {
+			workers.emplace_back(worker);
+		}
+		for (auto& thread : workers) {
+			thread.join();
+		}
+
+		return CountStatus(JobStatus::Succeeded) == m_jobs.size();
+	}
+
+	size_t JobGraph::SkipDependents(JobID id) {
+		size_t skipped = 0;
+		std::vector<JobID> stack = m_jobs[id].dependents;
+		while (!stack.empty()) {
+			JobID dependent = stack.back();
+			stack.pop_back();
+
+			Job& job = m_jobs[dependent];
+			if (job.status != JobStatus::Pending) continue;
+
+			job.status = JobStatus::Skipped;
+			job.diagnostics.push_back({ Severity::Warning, "Skipped, " + m_jobs[id].name + " failed" });
+			++skipped;
+			stack.insert(stack.end(), job.dependents.begin(), job.dependents.end());
+		}
+		return skipped;
+	}
+
+	size_t JobGraph::CountStatus(JobStatus status) const {
+		return static_cast<size_t>(std::count_if(m_jobs.begin(), m_jobs.end(), [status](const Job& job) { return job.status == status; }));
+	}
+
+	std::map<std::string, double> JobGraph::GetStageTimes() const {
+		std::map<std::string, double> times;
+		for (const Job& job : m_jobs) {
+			times[job.stage] += job.milliseconds;
+		}
+		return times;
+	}
+}
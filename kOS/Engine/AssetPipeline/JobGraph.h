@@ -0,0 +1,96 @@
+/******************************************************************/
+/*!
+\file      JobGraph.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Dependency ordered job graph executed on a bounded pool of
+		   worker threads.
+
+		   - A job only starts once every job it depends on succeeded.
+		   - A failed job skips everything that depends on it.
+		   - Jobs caught in a dependency cycle fail with a diagnostic
+			 instead of deadlocking the build.
+		   - Every job keeps its own diagnostics and wall clock time.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+namespace assetpipeline {
+
+	enum class Severity {
+		Info,
+		Warning,
+		Error
+	};
+
+	struct Diagnostic {
+		Severity severity = Severity::Info;
+		std::string message;
+	};
+
+	enum class JobStatus {
+		Pending,
+		Succeeded,
+		Failed,
+		Skipped
+	};
+
+	//returns false if the job failed, details go into the diagnostics
+	using JobFunction = std::function<bool(std::vector<Diagnostic>&)>;
+
+	using JobID = size_t;
+
+	struct Job {
+		std::string name;
+		std::string stage;
+		JobFunction function;
+
+		std::vector<JobID> dependents;
+		size_t dependencyCount{};
+
+		JobStatus status = JobStatus::Pending;
+		std::vector<Diagnostic> diagnostics;
+		double milliseconds{};
+	};
+
+	class JobGraph {
+	public:
+
+		JobID AddJob(const std::string& name, const std::string& stage, JobFunction function);
+
+		//"job" waits for "dependency"
+		void AddDependency(JobID job, JobID dependency);
+
+		/******************************************************************/
+		/*!
+		\fn      Execute
+		\brief   Runs every job on at most "threadCount" workers (0 uses
+				 every hardware thread).
+		\return  true if every job succeeded
+		*/
+		/******************************************************************/
+		bool Execute(unsigned int threadCount = 0);
+
+		const Job& GetJob(JobID id) const { return m_jobs.at(id); }
+		size_t GetJobCount() const { return m_jobs.size(); }
+
+		size_t CountStatus(JobStatus status) const;
+
+		//sum of job times per stage
+		std::map<std::string, double> GetStageTimes() const;
+
+	private:
+
+		//marks everything downstream of a failed job, returns how many were marked
+		size_t SkipDependents(JobID id);
+
+		std::vector<Job> m_jobs;
+	};
+}
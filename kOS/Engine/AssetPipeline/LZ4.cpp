@@ -0,0 +1,180 @@
+/******************************************************************/
+/*!
+\file      LZ4.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the LZ4 block encoder and decoder.
+
+		   Block layout, repeated until the input ends:
+		   token (literal length << 4 | match length - 4), extra literal
+		   length bytes, literals, 2 byte match offset, extra match length
+		   bytes. The last sequence has literals only, and the last 5
+		   bytes are always literals.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "LZ4.h"
+
+#include <cstring>
+
+namespace assetpipeline {
+
+	namespace {
+		constexpr size_t MIN_MATCH = 4;
+		constexpr size_t LAST_LITERALS = 5;
+		constexpr size_t MF_LIMIT = 12;
+		constexpr size_t MAX_OFFSET = 65535;
+		constexpr int HASH_LOG = 14;
+
+		uint32_t Read32(const unsigned char* data) {
+			uint32_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		uint32_t Hash(uint32_t sequence) {
+			return (sequence * 2654435761u) >> (32 - HASH_LOG);
+		}
+
+		void WriteLength(std::string& output, size_t length) {
+			for (; length >= 255; length -= 255) {
+				output.push_back(static_cast<char>(255));
+			}
+			output.push_back(static_cast<char>(length));
+		}
+
+		void WriteSequence(std::string& output, const unsigned char* literals, size_t literalLength, size_t offset, size_t matchLength) {
+			const size_t matchCode = matchLength - MIN_MATCH;
+			output.push_back(static_cast<char>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15)));
+			if (literalLength >= 15) WriteLength(output, literalLength - 15);
+
+			output.append(reinterpret_cast<const char*>(literals), literalLength);
+
+			output.push_back(static_cast<char>(offset & 0xFF));
+			output.push_back(static_cast<char>(offset >> 8));
+			if (matchCode >= 15) WriteLength(output, matchCode - 15);
+		}
+
+		void WriteLastLiterals(std::string& output, const unsigned char* literals, size_t literalLength) {
+			output.push_back(static_cast<char>(std::min<size_t>(literalLength, 15) << 4));
+			if (literalLength >= 15) WriteLength(output, literalLength - 15);
+			output.append(reinterpret_cast<const char*>(literals), literalLength);
+		}
+
+		bool ReadLength(std::string_view input, size_t& position, size_t& length) {
+			unsigned char byte;
+			do {
+				if (position >= input.size()) return false;
+				byte = static_cast<unsigned char>(input[position++]);
+				length += byte;
+			} while (byte == 255);
+			return true;
+		}
+	}
+
+	size_t LZ4CompressBound(size_t size) {
+		return size + size / 255 + 16;
+	}
+
+	std::string LZ4Compress(std::string_view input) {
+		const unsigned char* source = reinterpret_cast<const unsigned char*>(input.data());
+		const size_t size = input.size();
+
+		std::string output;
+		output.reserve(LZ4CompressBound(size));
+
+		size_t anchor = 0;
+		if (size > MF_LIMIT) {
+			//position + 1 of the last sequence with this hash, 0 for none
+			std::vector<uint32_t> table(size_t{ 1 } << HASH_LOG, 0);
+
+			const size_t matchLimit = size - LAST_LITERALS;
+			const size_t inputLimit = size - MF_LIMIT;
+
+			size_t position = 0;
+			while (position < inputLimit) {
+				const uint32_t sequence = Read32(source + position);
+				uint32_t& slot = table[Hash(sequence)];
+				size_t reference = slot;
+				slot = static_cast<uint32_t>(position + 1);
+
+				if (reference == 0 || position - (reference - 1) > MAX_OFFSET || Read32(source + reference - 1) != sequence) {
+					//skip faster through data that does not compress
+					position += 1 + ((position - anchor) >> 6);
+					continue;
+				}
+				--reference;
+
+				while (position > anchor && reference > 0 && source[position - 1] == source[reference - 1]) {
+					--position;
+					--reference;
+				}
+
+				size_t length = MIN_MATCH;
+				while (position + length < matchLimit && source[position + length] == source[reference + length]) {
+					++length;
+				}
+
+				WriteSequence(output, source + anchor, position - anchor, position - reference, length);
+				position += length;
+				anchor = position;
+
+				if (position - 2 < inputLimit) {
+					table[Hash(Read32(source + position - 2))] = static_cast<uint32_t>(position - 1);
+				}
+			}
+		}
+
+		WriteLastLiterals(output, source + anchor, size - anchor);
+		return output;
+	}
+
+	bool LZ4Decompress(std::string_view input, char* output, size_t outputSize) {
+		size_t in = 0;
+		size_t out = 0;
+
+		while (true) {
+			if (in >= input.size()) return false;
+			const unsigned char token = static_cast<unsigned char>(input[in++]);
+
+			size_t literalLength = token >> 4;
+			if (literalLength == 15 && !ReadLength(input, in, literalLength)) return false;
+			if (literalLength > input.size() - in || literalLength > outputSize - out) return false;
+
+			std::memcpy(output + out, input.data() + in, literalLength);
+			in += literalLength;
+			out += literalLength;
+
+			if (in == input.size()) {
+				return out == outputSize;
+			}
+
+			if (input.size() - in < 2) return false;
+			const size_t offset = static_cast<unsigned char>(input[in]) | (static_cast<size_t>(static_cast<unsigned char>(input[in + 1])) << 8);
+			in += 2;
+			if (offset == 0 || offset > out) return false;
+
+			size_t matchLength = token & 15;
+			if (matchLength == 15 && !ReadLength(input, in, matchLength)) return false;
+			matchLength += MIN_MATCH;
+			if (matchLength > outputSize - out) return false;
+
+			const char* match = output + out - offset;
+			if (offset >= matchLength) {
+				std::memcpy(output + out, match, matchLength);
+			}
+			else {
+				//overlapping copy repeats the last "offset" bytes
+				for (size_t i = 0; i < matchLength; ++i) {
+					output[out + i] = match[i];
+				}
+			}
+			out += matchLength;
+		}
+	}
+}
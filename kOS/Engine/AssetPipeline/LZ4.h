@@ -0,0 +1,36 @@
+/******************************************************************/
+/*!
+\file      LZ4.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     LZ4 block format encoder and bounds checked decoder, used to
+		   compress entries of resource packs. The output is a plain LZ4
+		   block (no frame), readable by the reference lz4 library.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+namespace assetpipeline {
+
+	//worst case compressed size of "size" bytes
+	size_t LZ4CompressBound(size_t size);
+
+	std::string LZ4Compress(std::string_view input);
+
+	/******************************************************************/
+	/*!
+	\fn      LZ4Decompress
+	\brief   Decodes a block into exactly "outputSize" bytes.
+	\return  false if the block is malformed or does not decode to
+			 exactly "outputSize" bytes
+	*/
+	/******************************************************************/
+	bool LZ4Decompress(std::string_view input, char* output, size_t outputSize);
+}
@@ -0,0 +1,306 @@
+/******************************************************************/
+/*!
+\file      PackFile.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the resource pack reader and writer.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "PackFile.h"
+#include "LZ4.h"
+
+namespace assetpipeline {
+
+	namespace {
+
+		Hash HeaderChecksum(const PackHeader& header) {
+			return HashBytes(&header, offsetof(PackHeader, headerChecksum));
+		}
+
+		bool EntryLess(const PackEntry& entry, std::string_view GUID, std::string_view type) {
+			const int compare = entry.GetGUID().compare(GUID);
+			return compare < 0 || (compare == 0 && entry.GetType() < type);
+		}
+
+		uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+			return (value + alignment - 1) / alignment * alignment;
+		}
+
+		bool ReadWholeFile(const std::filesystem::path& path, std::string& data) {
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			if (!file) return false;
+			data.resize(static_cast<size_t>(file.tellg()));
+			file.seekg(0);
+			file.read(data.data(), static_cast<std::streamsize>(data.size()));
+			return static_cast<bool>(file);
+		}
+	}
+
+	bool PackReader::Open(const std::filesystem::path& packPath, std::string& error) {
+		Close();
+
+		std::error_code ec;
+		m_fileSize = std::filesystem::file_size(packPath, ec);
+		m_file.open(packPath, std::ios::binary);
+		if (ec || !m_file) {
+			error = "Cannot open " + packPath.string();
+			Close();
+			return false;
+		}
+
+		PackHeader header{};
+		if (m_fileSize < sizeof(header) || !m_file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+			error = "Truncated pack header";
+			Close();
+			return false;
+		}
+		if (std::memcmp(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) {
+			error = "Not a resource pack";
+			Close();
+			return false;
+		}
+		if (header.version != PACK_VERSION) {
+			error = "Unsupported pack version " + std::to_string(header.version);
+			Close();
+			return false;
+		}
+		if (header.headerChecksum != HeaderChecksum(header)) {
+			error = "Pack header checksum mismatch";
+			Close();
+			return false;
+		}
+
+		const uint64_t indexSize = uint64_t{ header.entryCount } * sizeof(PackEntry);
+		if (header.indexOffset < sizeof(header) || header.indexOffset + indexSize > m_fileSize) {
+			error = "Pack index out of range";
+			Close();
+			return false;
+		}
+
+		m_entries.resize(header.entryCount);
+		m_file.seekg(static_cast<std::streamoff>(header.indexOffset));
+		if (!m_file.read(reinterpret_cast<char*>(m_entries.data()), static_cast<std::streamsize>(indexSize)) ||
+			HashBytes(m_entries.data(), indexSize) != header.indexChecksum) {
+			error = "Pack index checksum mismatch";
+			Close();
+			return false;
+		}
+
+		for (size_t i = 0; i < m_entries.size(); ++i) {
+			const PackEntry& entry = m_entries[i];
+			if (entry.offset < header.dataOffset || entry.storedSize > m_fileSize || entry.offset > m_fileSize - entry.storedSize) {
+				error = "Pack entry " + std::string(entry.GetGUID()) + std::string(entry.GetType()) + " out of range";
+				Close();
+				return false;
+			}
+			if (i > 0 && !EntryLess(m_entries[i - 1], entry.GetGUID(), entry.GetType())) {
+				error = "Pack index is not sorted";
+				Close();
+				return false;
+			}
+		}
+
+		m_path = packPath;
+		return true;
+	}
+
+	void PackReader::Close() {
+		if (m_file.is_open()) m_file.close();
+		m_file.clear();
+		m_entries.clear();
+		m_path.clear();
+		m_fileSize = 0;
+	}
+
+	const PackEntry* PackReader::Find(std::string_view GUID, std::string_view type) const {
+		const auto it = std::lower_bound(m_entries.begin(), m_entries.end(), std::pair{ GUID, type },
+			[](const PackEntry& entry, const std::pair<std::string_view, std::string_view>& key) {
+				return EntryLess(entry, key.first, key.second);
+			});
+
+		if (it == m_entries.end() || it->GetGUID() != GUID || it->GetType() != type) {
+			return nullptr;
+		}
+		return &*it;
+	}
+
+	bool PackReader::Read(const PackEntry& entry, std::string& data, std::string& error) {
+		std::string stored(static_cast<size_t>(entry.storedSize), '\0');
+		{
+			std::lock_guard lock{ m_mutex };
+			m_file.clear();
+			m_file.seekg(static_cast<std::streamoff>(entry.offset));
+			if (!m_file.read(stored.data(), static_cast<std::streamsize>(stored.size()))) {
+				error = "Failed to read " + std::string(entry.GetGUID()) + std::string(entry.GetType());
+				return false;
+			}
+		}
+
+		if (HashBytes(stored.data(), stored.size()) != entry.checksum) {
+			error = "Checksum mismatch in " + std::string(entry.GetGUID()) + std::string(entry.GetType());
+			return false;
+		}
+
+		switch (entry.compression) {
+		case PackCompression::None:
+			data = std::move(stored);
+			return true;
+		case PackCompression::LZ4:
+			data.assign(static_cast<size_t>(entry.size), '\0');
+			if (!LZ4Decompress(stored, data.data(), data.size())) {
+				error = "Corrupt LZ4 block in " + std::string(entry.GetGUID()) + std::string(entry.GetType());
+				return false;
+			}
+			return true;
+		default:
+			error = "Unknown compression in " + std::string(entry.GetGUID()) + std::string(entry.GetType());
+			return false;
+		}
+	}
+
+	bool PackReader::Verify(std::string& error) {
+		std::string data;
+		for (const auto& entry : m_entries) {
+			if (!Read(entry, data, error)) return false;
+		}
+		return true;
+	}
+
+
+	void PackWriter::Add(const std::string& GUID, const std::string& type, const std::filesystem::path& source) {
+		m_sources.push_back({ GUID, type, source });
+	}
+
+	size_t PackWriter::AddDirectory(const std::filesystem::path& resourceDirectory) {
+		size_t added = 0;
+		std::error_code ec;
+		for (const auto& file : std::filesystem::directory_iterator(resourceDirectory, ec)) {
+			if (!file.is_regular_file()) continue;
+
+			//resources are GUID + extension, skip logs, packs and anything else in the folder
+			const std::string GUID = file.path().stem().string();
+			const std::string type = file.path().extension().string();
+			if (!IsGUID(GUID) || type.empty()) continue;
+
+			Add(GUID, type, file.path());
+			++added;
+		}
+		return added;
+	}
+
+	bool PackWriter::Write(const std::filesystem::path& packPath, std::string& error) {
+		std::sort(m_sources.begin(), m_sources.end(), [](const Source& a, const Source& b) {
+			return std::tie(a.GUID, a.type) < std::tie(b.GUID, b.type);
+			});
+
+		std::vector<PackEntry> entries(m_sources.size());
+		for (size_t i = 0; i < m_sources.size(); ++i) {
+			const Source& source = m_sources[i];
+			if (source.GUID.size() >= sizeof(PackEntry::GUID) || source.type.size() >= sizeof(PackEntry::type)) {
+				error = "Name too long for the pack index: " + source.GUID + source.type;
+				return false;
+			}
+			if (i > 0 && m_sources[i - 1].GUID == source.GUID && m_sources[i - 1].type == source.type) {
+				error = "Duplicate resource " + source.GUID + source.type;
+				return false;
+			}
+			std::memcpy(entries[i].GUID, source.GUID.data(), source.GUID.size());
+			std::memcpy(entries[i].type, source.type.data(), source.type.size());
+		}
+
+		const uint64_t alignment = std::max<uint32_t>(m_options.alignment, 1);
+
+		PackHeader header{};
+		std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+		header.version = PACK_VERSION;
+		header.entryCount = static_cast<uint32_t>(entries.size());
+		header.alignment = static_cast<uint32_t>(alignment);
+		header.indexOffset = sizeof(PackHeader);
+		header.dataOffset = AlignUp(header.indexOffset + entries.size() * sizeof(PackEntry), alignment);
+
+		if (packPath.has_parent_path()) {
+			std::error_code ec;
+			std::filesystem::create_directories(packPath.parent_path(), ec);
+		}
+
+		std::filesystem::path temporary = packPath;
+		temporary += ".tmp";
+		std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			error = "Cannot write " + temporary.string();
+			return false;
+		}
+
+		//index is written last, once every offset is known
+		std::vector<char> zeros(static_cast<size_t>(header.dataOffset), '\0');
+		file.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+
+		m_sourceBytes = 0;
+		m_storedBytes = 0;
+		uint64_t position = header.dataOffset;
+		std::string data;
+		for (size_t i = 0; i < m_sources.size(); ++i) {
+			if (!ReadWholeFile(m_sources[i].path, data)) {
+				error = "Cannot read " + m_sources[i].path.string();
+				file.close();
+				std::filesystem::remove(temporary);
+				return false;
+			}
+
+			PackEntry& entry = entries[i];
+			entry.size = data.size();
+			entry.compression = PackCompression::None;
+
+			if (m_options.compress && !data.empty()) {
+				std::string compressed = LZ4Compress(data);
+				if (static_cast<double>(compressed.size()) <= static_cast<double>(data.size()) * m_options.maximumRatio) {
+					data = std::move(compressed);
+					entry.compression = PackCompression::LZ4;
+				}
+			}
+
+			const uint64_t aligned = AlignUp(position, alignment);
+			zeros.assign(static_cast<size_t>(aligned - position), '\0');
+			file.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+
+			entry.offset = aligned;
+			entry.storedSize = data.size();
+			entry.checksum = HashBytes(data.data(), data.size());
+			file.write(data.data(), static_cast<std::streamsize>(data.size()));
+			position = aligned + data.size();
+
+			m_sourceBytes += entry.size;
+			m_storedBytes += entry.storedSize;
+		}
+
+		header.indexChecksum = HashBytes(entries.data(), entries.size() * sizeof(PackEntry));
+		header.headerChecksum = HeaderChecksum(header);
+
+		file.seekp(0);
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.seekp(static_cast<std::streamoff>(header.indexOffset));
+		file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PackEntry)));
+		file.close();
+
+		if (!file) {
+			error = "Failed while writing " + temporary.string();
+			std::filesystem::remove(temporary);
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temporary, packPath, ec);
+		if (ec) {
+			error = "Cannot replace " + packPath.string() + ": " + ec.message();
+			std::filesystem::remove(temporary);
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,151 @@
+/******************************************************************/
+/*!
+\file      PackFile.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Resource pack, every cooked resource in one file.
+
+		   Layout:
+		   - PackHeader
+		   - PackEntry index, sorted by (GUID, type) for binary search
+		   - entry data, each entry aligned to PackHeader::alignment
+
+		   An entry is stored raw or as an LZ4 block. The header, the
+		   index and every stored entry carry a checksum, so a truncated
+		   or damaged pack is rejected instead of handing garbage to a
+		   resource loader.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "BuildCache.h"
+
+#include <cstring>
+#include <mutex>
+
+namespace assetpipeline {
+
+	constexpr char PACK_MAGIC[4] = { 'K', 'P', 'A', 'K' };
+	constexpr uint32_t PACK_VERSION = 1;
+
+	enum class PackCompression : uint8_t {
+		None,
+		LZ4
+	};
+
+	struct PackHeader {
+		char magic[4];
+		uint32_t version;
+		uint32_t entryCount;
+		uint32_t alignment;
+		uint64_t indexOffset;
+		uint64_t dataOffset;
+		Hash indexChecksum;
+		Hash headerChecksum; //of every header byte before this field
+	};
+	static_assert(sizeof(PackHeader) == 48, "PackHeader layout is part of the file format");
+
+	struct PackEntry {
+		char GUID[40];       //zero padded
+		char type[16];       //resource extension, ".dds"
+		uint64_t offset;     //from the start of the pack
+		uint64_t storedSize;
+		uint64_t size;       //after decompression
+		Hash checksum;       //of the stored bytes
+		PackCompression compression;
+		uint8_t padding[7];
+
+		std::string_view GetGUID() const { return { GUID, strnlen(GUID, sizeof(GUID)) }; }
+		std::string_view GetType() const { return { type, strnlen(type, sizeof(type)) }; }
+	};
+	static_assert(sizeof(PackEntry) == 96, "PackEntry layout is part of the file format");
+
+	class PackReader {
+	public:
+
+		/******************************************************************/
+		/*!
+		\fn      Open
+		\brief   Reads and validates the header and the index. Entry data is
+				 read on demand.
+		\return  false with "error" set if the pack is missing or damaged
+		*/
+		/******************************************************************/
+		bool Open(const std::filesystem::path& packPath, std::string& error);
+		void Close();
+		bool IsOpen() const { return m_file.is_open(); }
+
+		//binary search of the index, nullptr if the pack has no such resource
+		const PackEntry* Find(std::string_view GUID, std::string_view type) const;
+
+		//reads, checks and decompresses one entry
+		bool Read(const PackEntry& entry, std::string& data, std::string& error);
+
+		//checks every entry, used by the packer after writing
+		bool Verify(std::string& error);
+
+		const std::vector<PackEntry>& GetEntries() const { return m_entries; }
+		const std::filesystem::path& GetPath() const { return m_path; }
+
+	private:
+
+		std::filesystem::path m_path;
+		std::ifstream m_file;
+		uint64_t m_fileSize{};
+		std::vector<PackEntry> m_entries;
+
+		//one file handle is shared by every loading thread
+		std::mutex m_mutex;
+	};
+
+	class PackWriter {
+	public:
+
+		struct Options {
+			uint32_t alignment = 16;
+			bool compress = true;
+			//compressed data is only kept if it is at most this fraction of the original
+			double maximumRatio = 0.9;
+		};
+
+		explicit PackWriter(Options options) : m_options(options) {}
+		PackWriter() : PackWriter(Options{}) {}
+
+		void Add(const std::string& GUID, const std::string& type, const std::filesystem::path& source);
+
+		//every resource named GUID + extension in "resourceDirectory", returns how many were added
+		size_t AddDirectory(const std::filesystem::path& resourceDirectory);
+
+		/******************************************************************/
+		/*!
+		\fn      Write
+		\brief   Writes the pack to a temporary file and renames it over
+				 "packPath" once complete.
+		*/
+		/******************************************************************/
+		bool Write(const std::filesystem::path& packPath, std::string& error);
+
+		size_t GetEntryCount() const { return m_sources.size(); }
+		uint64_t GetSourceBytes() const { return m_sourceBytes; }
+		uint64_t GetStoredBytes() const { return m_storedBytes; }
+
+	private:
+
+		struct Source {
+			std::string GUID;
+			std::string type;
+			std::filesystem::path path;
+		};
+
+		Options m_options;
+		std::vector<Source> m_sources;
+		uint64_t m_sourceBytes{};
+		uint64_t m_storedBytes{};
+	};
+}
@@ -0,0 +1,106 @@
+/******************************************************************/
+/*!
+\file      VirtualFileSystem.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Definition of the virtual file system.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "VirtualFileSystem.h"
+
+namespace assetpipeline {
+
+	std::shared_ptr<VirtualFileSystem> VirtualFileSystem::m_instancePtr = nullptr;
+
+	namespace {
+		std::string NormalDirectory(const std::filesystem::path& directory) {
+			std::string normal = directory.lexically_normal().generic_string();
+			while (normal.size() > 1 && normal.back() == '/') normal.pop_back();
+			return normal.empty() ? "." : normal;
+		}
+	}
+
+	bool VirtualFileSystem::Mount(const std::filesystem::path& packPath, const std::filesystem::path& mountDirectory) {
+		auto pack = std::make_unique<PackReader>();
+		std::string error;
+		if (!pack->Open(packPath, error)) {
+			LOGGING_ERROR("Virtual File System: cannot mount " + packPath.string() + ", " + error);
+			return false;
+		}
+
+		LOGGING_INFO("Virtual File System: mounted " + packPath.string() + " (" + std::to_string(pack->GetEntries().size()) + " resources)");
+
+		std::unique_lock lock{ m_mutex };
+		m_mounts.push_back({ NormalDirectory(mountDirectory), std::move(pack) });
+		return true;
+	}
+
+	void VirtualFileSystem::UnmountAll() {
+		std::unique_lock lock{ m_mutex };
+		m_mounts.clear();
+	}
+
+	size_t VirtualFileSystem::GetMountCount() const {
+		std::shared_lock lock{ m_mutex };
+		return m_mounts.size();
+	}
+
+	std::pair<PackReader*, const PackEntry*> VirtualFileSystem::Find(const std::filesystem::path& path) const {
+		if (m_mounts.empty()) return { nullptr, nullptr };
+
+		const std::string directory = NormalDirectory(path.has_parent_path() ? path.parent_path() : std::filesystem::path{ "." });
+		const std::string GUID = path.stem().string();
+		const std::string type = path.extension().string();
+
+		for (auto it = m_mounts.rbegin(); it != m_mounts.rend(); ++it) {
+			if (it->directory != directory) continue;
+
+			if (const PackEntry* entry = it->pack->Find(GUID, type)) {
+				return { it->pack.get(), entry };
+			}
+		}
+		return { nullptr, nullptr };
+	}
+
+	bool VirtualFileSystem::ReadFile(const std::filesystem::path& path, std::string& data) {
+		{
+			std::shared_lock lock{ m_mutex };
+			const auto [pack, entry] = Find(path);
+			if (entry) {
+				std::string error;
+				if (pack->Read(*entry, data, error)) return true;
+
+				LOGGING_ERROR("Virtual File System: " + pack->GetPath().string() + ", " + error);
+				return false;
+			}
+		}
+
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file) return false;
+		data.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(data.data(), static_cast<std::streamsize>(data.size()));
+		return static_cast<bool>(file);
+	}
+
+	bool VirtualFileSystem::Exists(const std::filesystem::path& path) const {
+		{
+			std::shared_lock lock{ m_mutex };
+			if (Find(path).second) return true;
+		}
+
+		std::error_code ec;
+		return std::filesystem::exists(path, ec);
+	}
+
+	bool VirtualFileSystem::IsPacked(const std::filesystem::path& path) const {
+		std::shared_lock lock{ m_mutex };
+		return Find(path).second != nullptr;
+	}
+}
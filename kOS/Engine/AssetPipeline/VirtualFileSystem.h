@@ -0,0 +1,68 @@
+/******************************************************************/
+/*!
+\file      VirtualFileSystem.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Lets resource loaders read a file without knowing whether it
+		   is a loose file or an entry of a mounted resource pack.
+
+		   A pack is mounted over a directory. Reading
+		   "directory/GUID.ext" looks for (GUID, ext) in the packs,
+		   newest mount first, and falls back to the loose file. Paths
+		   outside every mounted directory always read the loose file.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "PackFile.h"
+
+#include <shared_mutex>
+
+namespace assetpipeline {
+
+	class VirtualFileSystem {
+	public:
+
+		static VirtualFileSystem* GetInstance() {
+			if (!m_instancePtr)
+			{
+				m_instancePtr = std::make_shared<VirtualFileSystem>();
+			}
+			return m_instancePtr.get();
+		}
+
+		//false if the pack cannot be opened or is damaged
+		bool Mount(const std::filesystem::path& packPath, const std::filesystem::path& mountDirectory);
+		void UnmountAll();
+		size_t GetMountCount() const;
+
+		//whole file, from a pack or from disk
+		bool ReadFile(const std::filesystem::path& path, std::string& data);
+
+		bool Exists(const std::filesystem::path& path) const;
+
+		//true if "path" is read from a mounted pack
+		bool IsPacked(const std::filesystem::path& path) const;
+
+	private:
+
+		struct MountPoint {
+			std::string directory; //lexically normal
+			std::unique_ptr<PackReader> pack;
+		};
+
+		//pack entry for "path", nullptr if no mounted pack has it
+		std::pair<PackReader*, const PackEntry*> Find(const std::filesystem::path& path) const;
+
+		static std::shared_ptr<VirtualFileSystem> m_instancePtr;
+
+		std::vector<MountPoint> m_mounts;
+		mutable std::shared_mutex m_mutex;
+	};
+}
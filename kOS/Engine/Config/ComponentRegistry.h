@@ -4,7 +4,8 @@
 \author    Jaz Winn Ng
 \par       jazwinn.ng@digipen.edu
 \date      Sept 28, 2025
-\brief     Stores singleton instances of ECS and FieldSingleton for global access.
+\brief     Stores singleton instances of ECS and FieldSingleton for global access,
+           and the list of components ECS::Load registers.
 
 Copyright (C) 2025 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -48,4 +49,30 @@ public:
 
 	static void SetResourceManagerInstance(ResourceManager* resourceManager) { s_resourceManager = resourceManager; }
 	static ResourceManager* GetResourceManagerInstance() { return s_resourceManager; }
-};
\ No newline at end of file
+};
+
+namespace ecs {
+
+    //the components ECS::Load registers, a component's key is its place in the list plus one. ScriptComponent is not
+    //registered, scripts are components of their own
+    using RegisteredComponents = std::tuple<NameComponent, TransformComponent, SpriteComponent, CameraComponent,
+        AudioComponent, TextComponent, MeshFilterComponent, CanvasRendererComponent, MeshRendererComponent,
+        MaterialComponent, SkinnedMeshRendererComponent, AnimatorComponent, AttachmentComponent, LightComponent,
+        RigidbodyComponent, BoxColliderComponent, CapsuleColliderComponent, SphereColliderComponent,
+        CharacterControllerComponent, OctreeGeneratorComponent, CubeRendererComponent, ParticleComponent>;
+
+    //components added along with T
+    template <typename T>
+    struct ComponentDependencies { using type = std::tuple<>; };
+
+    template <>
+    struct ComponentDependencies<SkinnedMeshRendererComponent> { using type = std::tuple<AnimatorComponent>; };
+
+    inline void RegisterComponents(ECS& ecs) {
+        [&ecs] <typename... T>(std::tuple<T...>*) {
+            ([&ecs] <typename... Dependent>(std::tuple<Dependent...>*) {
+                ecs.RegisterComponent<T, Dependent...>();
+            }(static_cast<typename ComponentDependencies<T>::type*>(nullptr)), ...);
+        }(static_cast<RegisteredComponents*>(nullptr));
+    }
+}
\ No newline at end of file
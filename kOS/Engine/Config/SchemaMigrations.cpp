@@ -0,0 +1,62 @@
+/******************************************************************/
+/*!
+\file      SchemaMigrations.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     The schema version of every type saved in scenes and prefabs
+		   and the migration steps between versions. Shared by the
+		   engine and the SchemaMigrator tool, which has no ECS to learn
+		   the types from.
+
+		   When a component changes in a way old files cannot load as
+		   they are, raise its REFLECT_SCHEMA_VERSION and add the step
+		   from the version before here, e.g. for LightComponent going
+		   to version 2 with "colour" renamed and "range" added:
+
+		   migrations.Add<ecs::LightComponent>(1, [](rapidjson::Value& object, JsonAllocator& allocator, bool partial) {
+			   migrate::Rename("colour", "color")(object, allocator, partial);
+			   migrate::Default("range", 10.f)(object, allocator, partial);
+		   });
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "DeSerialization/schema_migration.h"
+#include "ECS/Component/ComponentHeader.h"
+#include "Scene/SceneData.h"
+
+namespace Serialization {
+
+	void RegisterSchemaMigrations(SchemaMigrations& migrations) {
+		//keep in step with the components ECS::Load registers, it warns about any left out
+		migrations.SetVersion<SceneData>();
+		migrations.SetVersion<ecs::NameComponent>();
+		migrations.SetVersion<ecs::TransformComponent>();
+		migrations.SetVersion<ecs::SpriteComponent>();
+		migrations.SetVersion<ecs::CameraComponent>();
+		migrations.SetVersion<ecs::AudioComponent>();
+		migrations.SetVersion<ecs::TextComponent>();
+		migrations.SetVersion<ecs::MeshFilterComponent>();
+		migrations.SetVersion<ecs::CanvasRendererComponent>();
+		migrations.SetVersion<ecs::MeshRendererComponent>();
+		migrations.SetVersion<ecs::MaterialComponent>();
+		migrations.SetVersion<ecs::SkinnedMeshRendererComponent>();
+		migrations.SetVersion<ecs::AnimatorComponent>();
+		migrations.SetVersion<ecs::AttachmentComponent>();
+		migrations.SetVersion<ecs::LightComponent>();
+		migrations.SetVersion<ecs::RigidbodyComponent>();
+		migrations.SetVersion<ecs::BoxColliderComponent>();
+		migrations.SetVersion<ecs::CapsuleColliderComponent>();
+		migrations.SetVersion<ecs::SphereColliderComponent>();
+		migrations.SetVersion<ecs::CharacterControllerComponent>();
+		migrations.SetVersion<ecs::OctreeGeneratorComponent>();
+		migrations.SetVersion<ecs::CubeRendererComponent>();
+		migrations.SetVersion<ecs::ParticleComponent>();
+
+		//migration steps, by the version each starts from
+	}
+}
@@ -0,0 +1,394 @@
+/******************************************************************/
+/*!
+\file      BinarySerializationReflection.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Reflection for the cooked binary scene format.
+
+		   Components are written a type at a time, one column per
+		   reflected member: every row's value of the first member, then
+		   every row's value of the second and so on. Columns of plain
+		   values are stored back to back and read in one copy.
+		   - float, int and glm vectors are stored as is, bool as one
+			 byte and enums as int.
+		   - Strings are indices into the string table of the file, so a
+			 name repeated over thousands of entities is stored once.
+		   - std::vector members store a count per row, then the elements
+			 of all rows as a column of their own.
+		   - Nested reflectable classes are split into a column per
+			 member, the same way.
+		   Types the JSON serializer skips are skipped here too.
+
+		   Every type has a schema hash taken from its member names and
+		   types. A cooked file whose hashes differ from the running
+		   build is out of date, the loader then falls back to JSON.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+#include <cstring>
+
+namespace Serialization {
+
+	constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+	constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+	inline uint64_t HashBytes(std::string_view data, uint64_t hash = FNV_OFFSET) {
+		for (const char c : data) {
+			hash = (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+		}
+		return hash;
+	}
+
+	//hash of the JSON a scene was cooked from, carriage returns are skipped so text mode line endings do not matter
+	inline uint64_t HashSceneSource(std::string_view json, uint64_t hash = FNV_OFFSET) {
+		for (const char c : json) {
+			if (c == '\r') continue;
+			hash = (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+		}
+		return hash;
+	}
+
+	constexpr char SCENE_BINARY_MAGIC[4] = { 'K', 'O', 'S', 'B' };
+	constexpr uint32_t SCENE_BINARY_VERSION = 1;
+
+	struct SceneBinaryHeader {
+		char magic[4]{};
+		uint32_t version{};
+		uint64_t sourceHash{};  //HashSceneSource of the JSON it was cooked from
+		uint32_t entityCount{};
+		uint32_t blockCount{};  //component types, the scene data block not included
+		uint32_t stringCount{};
+		uint32_t reserved{};
+	};
+
+	//false if the data is not a cooked scene of this version
+	inline bool ReadSceneBinaryHeader(std::string_view data, SceneBinaryHeader& header) {
+		if (data.size() < sizeof(SceneBinaryHeader)) return false;
+		std::memcpy(&header, data.data(), sizeof(SceneBinaryHeader));
+		return std::memcmp(header.magic, SCENE_BINARY_MAGIC, sizeof(SCENE_BINARY_MAGIC)) == 0 && header.version == SCENE_BINARY_VERSION;
+	}
+
+	//strings of a cooked file, each stored once
+	class StringTable {
+	public:
+
+		uint32_t Intern(const std::string& value) {
+			auto [it, inserted] = m_index.try_emplace(value, static_cast<uint32_t>(m_strings.size()));
+			if (inserted) m_strings.push_back(value);
+			return it->second;
+		}
+
+		const std::vector<std::string>& GetStrings() const { return m_strings; }
+
+	private:
+
+		std::vector<std::string> m_strings;
+		std::unordered_map<std::string, uint32_t> m_index;
+	};
+
+	class BinaryWriter {
+	public:
+
+		explicit BinaryWriter(StringTable& strings) : m_strings(strings) {}
+
+		template <typename V>
+		void Write(const V& value) {
+			static_assert(std::is_trivially_copyable_v<V>);
+			WriteBytes(&value, sizeof(V));
+		}
+
+		template <typename V>
+		void WriteArray(const std::vector<V>& values) {
+			static_assert(std::is_trivially_copyable_v<V>);
+			if (!values.empty()) WriteBytes(values.data(), values.size() * sizeof(V));
+		}
+
+		void WriteString(const std::string& value) {
+			Write(m_strings.Intern(value));
+		}
+
+		void WriteBytes(const void* data, size_t size) {
+			m_data.append(static_cast<const char*>(data), size);
+		}
+
+		StringTable& GetStrings() { return m_strings; }
+		std::string& GetData() { return m_data; }
+
+	private:
+
+		StringTable& m_strings;
+		std::string m_data;
+	};
+
+	//reads what BinaryWriter wrote, throws std::runtime_error when the data runs out
+	class BinaryReader {
+	public:
+
+		BinaryReader(const char* data, size_t size, const std::vector<std::string>* strings = nullptr)
+			: m_data(data), m_size(size), m_strings(strings) {}
+
+		template <typename V>
+		V Read() {
+			static_assert(std::is_trivially_copyable_v<V>);
+			V value;
+			ReadBytes(&value, sizeof(V));
+			return value;
+		}
+
+		template <typename V>
+		void ReadArray(std::vector<V>& values, size_t count) {
+			static_assert(std::is_trivially_copyable_v<V>);
+			if (count > Remaining() / sizeof(V)) throw std::runtime_error("Unexpected end of binary data");
+			values.resize(count);
+			if (count) ReadBytes(values.data(), count * sizeof(V));
+		}
+
+		const std::string& ReadString() {
+			const uint32_t index = Read<uint32_t>();
+			if (!m_strings || index >= m_strings->size()) throw std::runtime_error("String index out of range");
+			return (*m_strings)[index];
+		}
+
+		void ReadBytes(void* out, size_t size) {
+			if (size > Remaining()) throw std::runtime_error("Unexpected end of binary data");
+			std::memcpy(out, m_data + m_offset, size);
+			m_offset += size;
+		}
+
+		//the next "size" bytes as a reader of their own
+		BinaryReader Slice(size_t size) {
+			if (size > Remaining()) throw std::runtime_error("Unexpected end of binary data");
+			BinaryReader slice(m_data + m_offset, size, m_strings);
+			m_offset += size;
+			return slice;
+		}
+
+		void SetStrings(const std::vector<std::string>* strings) { m_strings = strings; }
+
+		size_t Remaining() const { return m_size - m_offset; }
+		size_t GetOffset() const { return m_offset; }
+
+	private:
+
+		const char* m_data;
+		size_t m_size;
+		size_t m_offset{};
+		const std::vector<std::string>* m_strings;
+	};
+
+	//member traits shared by the serializers that walk a type instead of an instance
+	template <typename M>
+	struct IsVector : std::false_type {};
+	template <typename U, typename A>
+	struct IsVector<std::vector<U, A>> : std::true_type {};
+
+	template <typename M>
+	concept Reflectable = std::is_class_v<M> && requires { M::Names(); };
+
+	template <typename M>
+	using MemberTuple = decltype(std::declval<M&>().member());
+
+	template <typename M, size_t I>
+	using MemberType = std::remove_reference_t<std::tuple_element_t<I, MemberTuple<M>>>;
+
+	namespace binary {
+
+		//stored exactly as they are in memory
+		template <typename M>
+		constexpr bool IsPlain = std::is_same_v<M, float> || std::is_same_v<M, int> ||
+			std::is_same_v<M, glm::vec2> || std::is_same_v<M, glm::vec3> || std::is_same_v<M, glm::vec4>;
+
+		template <typename M>
+		void AppendSchema(std::string& signature) {
+			if constexpr (std::is_same_v<M, float>) signature += "f";
+			else if constexpr (std::is_same_v<M, int>) signature += "i";
+			else if constexpr (std::is_same_v<M, bool>) signature += "b";
+			else if constexpr (std::is_same_v<M, std::string>) signature += "s";
+			else if constexpr (std::is_same_v<M, glm::vec2>) signature += "v2";
+			else if constexpr (std::is_same_v<M, glm::vec3>) signature += "v3";
+			else if constexpr (std::is_same_v<M, glm::vec4>) signature += "v4";
+			else if constexpr (std::is_enum_v<M>) signature += "e";
+			else if constexpr (IsVector<M>::value) {
+				signature += "[";
+				AppendSchema<typename M::value_type>(signature);
+				signature += "]";
+			}
+			else if constexpr (Reflectable<M>) {
+				const auto names = M::Names();
+				signature += "{";
+				[&] <size_t... I>(std::index_sequence<I...>) {
+					((signature += names[I] + ":", AppendSchema<MemberType<M, I>>(signature), signature += ","), ...);
+				}(std::make_index_sequence<std::tuple_size_v<MemberTuple<M>>>{});
+				signature += "}";
+			}
+			//every chain below handles the same types, a new member type has to be added to all of them
+			else static_assert(sizeof(M) == 0, "unsupported member type");
+		}
+
+		template <typename M>
+		void WriteColumn(const std::vector<M*>& rows, BinaryWriter& writer);
+		template <typename M>
+		void ReadColumn(const std::vector<M*>& rows, BinaryReader& reader);
+
+		template <typename M, size_t I>
+		std::vector<MemberType<M, I>*> MemberColumn(const std::vector<M*>& rows) {
+			std::vector<MemberType<M, I>*> column;
+			column.reserve(rows.size());
+			for (M* row : rows) column.push_back(&std::get<I>(row->member()));
+			return column;
+		}
+
+		template <typename M>
+		void WriteColumn(const std::vector<M*>& rows, BinaryWriter& writer) {
+			if constexpr (IsPlain<M>) {
+				std::vector<M> values;
+				values.reserve(rows.size());
+				for (M* row : rows) values.push_back(*row);
+				writer.WriteArray(values);
+			}
+			else if constexpr (std::is_same_v<M, bool>) {
+				std::vector<uint8_t> values;
+				values.reserve(rows.size());
+				for (M* row : rows) values.push_back(*row ? 1 : 0);
+				writer.WriteArray(values);
+			}
+			else if constexpr (std::is_enum_v<M>) {
+				std::vector<int32_t> values;
+				values.reserve(rows.size());
+				for (M* row : rows) values.push_back(static_cast<int32_t>(*row));
+				writer.WriteArray(values);
+			}
+			else if constexpr (std::is_same_v<M, std::string>) {
+				std::vector<uint32_t> values;
+				values.reserve(rows.size());
+				for (M* row : rows) values.push_back(writer.GetStrings().Intern(*row));
+				writer.WriteArray(values);
+			}
+			else if constexpr (IsVector<M>::value) {
+				std::vector<uint32_t> counts;
+				std::vector<typename M::value_type*> elements;
+				counts.reserve(rows.size());
+				for (M* row : rows) {
+					counts.push_back(static_cast<uint32_t>(row->size()));
+					for (auto& element : *row) elements.push_back(&element);
+				}
+				writer.WriteArray(counts);
+				WriteColumn(elements, writer);
+			}
+			else if constexpr (Reflectable<M>) {
+				[&] <size_t... I>(std::index_sequence<I...>) {
+					(WriteColumn(MemberColumn<M, I>(rows), writer), ...);
+				}(std::make_index_sequence<std::tuple_size_v<MemberTuple<M>>>{});
+			}
+			else static_assert(sizeof(M) == 0, "unsupported member type");
+		}
+
+		//hashes what WriteColumn writes of one value, strings by their text instead of their index
+		template <typename M>
+		uint64_t HashValue(const M& value, uint64_t hash) {
+			auto hashBits = [&hash](const auto& bits) {
+				hash = HashBytes({ reinterpret_cast<const char*>(&bits), sizeof(bits) }, hash);
+			};
+			if constexpr (IsPlain<M>) hashBits(value);
+			else if constexpr (std::is_same_v<M, bool>) hashBits(static_cast<uint8_t>(value ? 1 : 0));
+			else if constexpr (std::is_enum_v<M>) hashBits(static_cast<int32_t>(value));
+			else if constexpr (std::is_same_v<M, std::string>) {
+				hashBits(static_cast<uint32_t>(value.size()));
+				hash = HashBytes(value, hash);
+			}
+			else if constexpr (IsVector<M>::value) {
+				hashBits(static_cast<uint32_t>(value.size()));
+				for (const auto& element : value) hash = HashValue(element, hash);
+			}
+			else if constexpr (Reflectable<M>) {
+				const auto members = value.member();
+				[&] <size_t... I>(std::index_sequence<I...>) {
+					((hash = HashValue(std::get<I>(members), hash)), ...);
+				}(std::make_index_sequence<std::tuple_size_v<MemberTuple<M>>>{});
+			}
+			else static_assert(sizeof(M) == 0, "unsupported member type");
+			return hash;
+		}
+
+		template <typename M>
+		void ReadColumn(const std::vector<M*>& rows, BinaryReader& reader) {
+			if constexpr (IsPlain<M>) {
+				std::vector<M> values;
+				reader.ReadArray(values, rows.size());
+				for (size_t i = 0; i < rows.size(); ++i) *rows[i] = values[i];
+			}
+			else if constexpr (std::is_same_v<M, bool>) {
+				std::vector<uint8_t> values;
+				reader.ReadArray(values, rows.size());
+				for (size_t i = 0; i < rows.size(); ++i) *rows[i] = values[i] != 0;
+			}
+			else if constexpr (std::is_enum_v<M>) {
+				std::vector<int32_t> values;
+				reader.ReadArray(values, rows.size());
+				for (size_t i = 0; i < rows.size(); ++i) *rows[i] = static_cast<M>(values[i]);
+			}
+			else if constexpr (std::is_same_v<M, std::string>) {
+				for (M* row : rows) *row = reader.ReadString();
+			}
+			else if constexpr (IsVector<M>::value) {
+				std::vector<uint32_t> counts;
+				reader.ReadArray(counts, rows.size());
+				std::vector<typename M::value_type*> elements;
+				for (size_t i = 0; i < rows.size(); ++i) {
+					//a count past the data left cannot be real, checked before resizing
+					if (counts[i] > reader.Remaining()) throw std::runtime_error("Vector count out of range");
+					rows[i]->clear();
+					rows[i]->resize(counts[i]);
+					for (auto& element : *rows[i]) elements.push_back(&element);
+				}
+				ReadColumn(elements, reader);
+			}
+			else if constexpr (Reflectable<M>) {
+				[&] <size_t... I>(std::index_sequence<I...>) {
+					(ReadColumn(MemberColumn<M, I>(rows), reader), ...);
+				}(std::make_index_sequence<std::tuple_size_v<MemberTuple<M>>>{});
+			}
+			else static_assert(sizeof(M) == 0, "unsupported member type");
+		}
+	}
+
+	//changes whenever a member of T, or of anything T holds, is added, removed, renamed or retyped, or T's schema
+	//version is raised
+	template <typename T>
+	uint64_t SchemaHash() {
+		static const uint64_t hash = [] {
+			std::string signature = T::classname();
+			binary::AppendSchema<T>(signature);
+			//version 1 adds nothing, so snapshots cooked before versions existed stay valid
+			if constexpr (reflect::SchemaVersion<T>() != 1) {
+				signature += '@' + std::to_string(reflect::SchemaVersion<T>());
+			}
+			return HashBytes(signature);
+		}();
+		return hash;
+	}
+
+	template <typename T>
+	void WriteComponentColumns(const std::vector<T*>& rows, BinaryWriter& writer) {
+		binary::WriteColumn(rows, writer);
+	}
+
+	//equal for two components that WriteComponentColumns writes the same
+	template <typename T>
+	uint64_t HashComponent(const T& component, uint64_t hash = FNV_OFFSET) {
+		return binary::HashValue(component, hash);
+	}
+
+	template <typename T>
+	void ReadComponentColumns(const std::vector<T*>& rows, BinaryReader& reader) {
+		binary::ReadColumn(rows, reader);
+	}
+}
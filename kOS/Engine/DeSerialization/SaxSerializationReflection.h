@@ -0,0 +1,436 @@
+/******************************************************************/
+/*!
+\file      SaxSerializationReflection.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Reflection for reading JSON as a stream of RapidJSON SAX
+		   events, without building a document first.
+
+		   GetSaxType<T>() describes once how T is filled: for a
+		   reflectable class, a table from the name hash of each of its
+		   Fields() to the member's accessor and type. SaxFiller follows
+		   the events of one object through those tables and writes the
+		   values straight into the component.
+
+		   Values are accepted exactly where LoadComponent accepts them,
+		   so both loaders leave the same state behind: floats only from
+		   numbers with a fraction, ints and enums from numbers that fit
+		   an int, a vector read replaces what it held, and the first of
+		   two equal keys wins. Anything else is skipped with its contents.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "BinarySerializationReflection.h"
+
+#include <RAPIDJSON/reader.h>
+
+namespace Serialization {
+
+	enum class SaxKind { Skip, Float, Int, Bool, String, Enum, Vec2, Vec3, Vec4, Vector, Object };
+
+	struct SaxType;
+
+	struct SaxMember {
+		std::string_view name;  //from T::Fields(), lives as long as the program
+		const SaxType* type{};
+		void* (*access)(void* object){};  //the member inside an object of the owning type
+	};
+
+	struct SaxType {
+		SaxKind kind{ SaxKind::Skip };
+
+		//Object
+		std::vector<SaxMember> members;
+		std::unordered_map<uint64_t, uint32_t> lookup;  //hash of a member name to its index
+
+		//Vector
+		const SaxType* element{};
+		void* (*append)(void* vector){};  //adds a default element and returns it
+		void (*clear)(void* vector){};
+
+		//Enum
+		void (*setEnum)(void* target, int value){};
+
+		//index of the member named "name", -1 if there is none
+		int Find(std::string_view name) const {
+			const auto it = lookup.find(HashBytes(name));
+			if (it == lookup.end() || members[it->second].name != name) return -1;
+			return static_cast<int>(it->second);
+		}
+	};
+
+	template <typename M>
+	const SaxType& GetSaxType();
+
+	namespace sax {
+
+		template <typename M, size_t I>
+		void* AccessMember(void* object) {
+			return &std::get<I>(static_cast<M*>(object)->member());
+		}
+
+		template <typename M>
+		SaxType MakeType() {
+			SaxType type;
+			if constexpr (std::is_same_v<M, float>) type.kind = SaxKind::Float;
+			else if constexpr (std::is_same_v<M, int>) type.kind = SaxKind::Int;
+			else if constexpr (std::is_same_v<M, bool>) type.kind = SaxKind::Bool;
+			else if constexpr (std::is_same_v<M, std::string>) type.kind = SaxKind::String;
+			else if constexpr (std::is_same_v<M, glm::vec2>) type.kind = SaxKind::Vec2;
+			else if constexpr (std::is_same_v<M, glm::vec3>) type.kind = SaxKind::Vec3;
+			else if constexpr (std::is_same_v<M, glm::vec4>) type.kind = SaxKind::Vec4;
+			else if constexpr (std::is_enum_v<M>) {
+				type.kind = SaxKind::Enum;
+				type.setEnum = [](void* target, int value) { *static_cast<M*>(target) = static_cast<M>(value); };
+			}
+			else if constexpr (IsVector<M>::value) {
+				type.kind = SaxKind::Vector;
+				type.element = &GetSaxType<typename M::value_type>();
+				type.append = [](void* vector) -> void* { return &static_cast<M*>(vector)->emplace_back(); };
+				type.clear = [](void* vector) { static_cast<M*>(vector)->clear(); };
+			}
+			else if constexpr (Reflectable<M>) {
+				type.kind = SaxKind::Object;
+				constexpr auto fields = M::Fields();
+				[&] <size_t... I>(std::index_sequence<I...>) {
+					(type.members.push_back({ fields[I].name, &GetSaxType<MemberType<M, I>>(), &AccessMember<M, I> }), ...);
+				}(std::make_index_sequence<std::tuple_size_v<MemberTuple<M>>>{});
+				for (uint32_t i = 0; i < type.members.size(); ++i) {
+					type.lookup.emplace(fields[i].nameHash, i);
+				}
+			}
+			return type;
+		}
+	}
+
+	//built on first use, then shared
+	template <typename M>
+	const SaxType& GetSaxType() {
+		static const SaxType type = sax::MakeType<M>();
+		return type;
+	}
+
+	//fills one object from SAX events, the caller hands events over while IsActive()
+	class SaxFiller {
+	public:
+
+		//the StartObject of "target" was just read
+		void BeginObject(const SaxType& type, void* target) {
+			m_frames.push_back({ Frame::OBJECT, &type, target });
+		}
+
+		//the StartObject or StartArray of something to ignore was just read
+		void BeginSkip() {
+			m_frames.push_back({ Frame::SKIP });
+		}
+
+		bool IsActive() const { return !m_frames.empty(); }
+
+		bool Null() { return Scalar(); }
+		bool Bool(bool value) {
+			Slot slot = TakeValueSlot();
+			if (slot.type && slot.type->kind == SaxKind::Bool) *static_cast<bool*>(slot.target) = value;
+			return true;
+		}
+		bool Int(int value) { return Integer(value, true); }
+		bool Uint(unsigned value) { return Integer(static_cast<int>(value), value <= static_cast<unsigned>(std::numeric_limits<int>::max())); }
+		bool Int64(int64_t) { return Scalar(); }
+		bool Uint64(uint64_t) { return Scalar(); }
+		bool Double(double value) {
+			Slot slot = TakeValueSlot();
+			//rapidjson::Value::IsFloat
+			if (!slot.type || value < -3.4028234e38 || value > 3.4028234e38) return true;
+			if (slot.type->kind == SaxKind::Float) *static_cast<float*>(slot.target) = static_cast<float>(value);
+			return true;
+		}
+		bool RawNumber(const char*, rapidjson::SizeType, bool) { return Scalar(); }
+		bool String(const char* value, rapidjson::SizeType length, bool) {
+			Slot slot = TakeValueSlot();
+			if (slot.type && slot.type->kind == SaxKind::String) static_cast<std::string*>(slot.target)->assign(value, length);
+			return true;
+		}
+
+		bool StartObject() {
+			Slot slot = TakeSlot();
+			if (!slot.type) {
+				m_frames.push_back({ Frame::SKIP });
+			}
+			else if (slot.wrapped) {
+				//{ "member": value }, how an element of a vector of values is written
+				m_frames.push_back({ Frame::WRAPPED, slot.type, slot.target, slot.wrapped });
+			}
+			else if (slot.type->kind == SaxKind::Object) {
+				m_frames.push_back({ Frame::OBJECT, slot.type, slot.target });
+			}
+			else if (slot.type->kind == SaxKind::Vec2 || slot.type->kind == SaxKind::Vec3 || slot.type->kind == SaxKind::Vec4) {
+				m_frames.push_back({ Frame::VEC, slot.type, slot.target });
+			}
+			else {
+				m_frames.push_back({ Frame::SKIP });
+			}
+			return true;
+		}
+
+		bool Key(const char* name, rapidjson::SizeType length, bool) {
+			Frame& frame = m_frames.back();
+			frame.pending = {};
+			const std::string_view key(name, length);
+
+			int index = -1;
+			if (frame.type == Frame::OBJECT) {
+				index = frame.saxType->Find(key);
+			}
+			else if (frame.type == Frame::VEC) {
+				if (key.size() == 1 && key[0] >= 'w' && key[0] <= 'z') {
+					index = key[0] == 'w' ? 3 : key[0] - 'x';
+					if (index >= static_cast<int>(frame.saxType->kind) - static_cast<int>(SaxKind::Vec2) + 2) index = -1;
+				}
+			}
+			else if (frame.type == Frame::WRAPPED) {
+				if (key == *frame.wrapped) index = 0;
+			}
+			if (index < 0 || (frame.seen >> index & 1u)) return true;
+			frame.seen |= 1u << index;
+
+			if (frame.type == Frame::OBJECT) {
+				const SaxMember& member = frame.saxType->members[index];
+				frame.pending = { member.type, member.access(frame.target), nullptr, &member.name };
+			}
+			else if (frame.type == Frame::VEC) {
+				frame.pending = { &GetSaxType<float>(), static_cast<float*>(frame.target) + index };
+			}
+			else {
+				frame.pending = { frame.saxType, frame.target, nullptr, frame.wrapped };
+			}
+			return true;
+		}
+
+		bool EndObject(rapidjson::SizeType) {
+			m_frames.pop_back();
+			return true;
+		}
+
+		bool StartArray() {
+			Slot slot = TakeSlot();
+			if (slot.type && slot.type->kind == SaxKind::Vector && !slot.wrapped) {
+				//a prefab instance's override replaces the prefab's elements
+				slot.type->clear(slot.target);
+				m_frames.push_back({ Frame::ARRAY, slot.type, slot.target });
+				m_frames.back().wrapped = slot.name;
+			}
+			else {
+				m_frames.push_back({ Frame::SKIP });
+			}
+			return true;
+		}
+
+		bool EndArray(rapidjson::SizeType) {
+			m_frames.pop_back();
+			return true;
+		}
+
+	private:
+
+		//where the next value goes, no type to ignore it
+		struct Slot {
+			const SaxType* type{};
+			void* target{};
+			const std::string_view* wrapped{};  //the value is wrapped in an object under this key
+			const std::string_view* name{};     //member the value belongs to
+		};
+
+		struct Frame {
+			enum Type { SKIP, OBJECT, VEC, WRAPPED, ARRAY } type{ SKIP };
+			const SaxType* saxType{};
+			void* target{};
+			const std::string_view* wrapped{};  //WRAPPED: the key of the value, ARRAY: the member name
+			uint32_t seen{};                    //keys already read, only the first counts
+			Slot pending{};
+		};
+
+		Slot TakeSlot() {
+			if (m_frames.empty()) return {};
+			Frame& frame = m_frames.back();
+			if (frame.type == Frame::ARRAY) {
+				//every element appends, as LoadComponent does after clearing
+				const SaxType* element = frame.saxType->element;
+				void* target = frame.saxType->append(frame.target);
+				return { element, target, element->kind == SaxKind::Object ? nullptr : frame.wrapped };
+			}
+			Slot slot = frame.pending;
+			frame.pending = {};
+			return slot;
+		}
+
+		//a wrapped value has to come inside its object
+		Slot TakeValueSlot() {
+			Slot slot = TakeSlot();
+			return slot.wrapped ? Slot{} : slot;
+		}
+
+		bool Integer(int value, bool fits) {
+			Slot slot = TakeValueSlot();
+			if (!slot.type || !fits) return true;
+			if (slot.type->kind == SaxKind::Int) *static_cast<int*>(slot.target) = value;
+			else if (slot.type->kind == SaxKind::Enum) slot.type->setEnum(slot.target, value);
+			return true;
+		}
+
+		bool Scalar() {
+			TakeSlot();
+			return true;
+		}
+
+		std::vector<Frame> m_frames;
+	};
+
+	//RapidJSON handler that hands events to its SaxFiller while an object is being filled, the rest go to Derived
+	template <typename Derived>
+	class SaxHandler {
+	public:
+
+		bool Null() { return m_filler.IsActive() ? m_filler.Null() : Self().OnValue(); }
+		bool Bool(bool value) { return m_filler.IsActive() ? m_filler.Bool(value) : Self().OnValue(); }
+		bool Int(int value) { return m_filler.IsActive() ? m_filler.Int(value) : Self().OnValue(); }
+		bool Uint(unsigned value) { return m_filler.IsActive() ? m_filler.Uint(value) : Self().OnUint(value); }
+		bool Int64(int64_t value) { return m_filler.IsActive() ? m_filler.Int64(value) : Self().OnValue(); }
+		bool Uint64(uint64_t value) { return m_filler.IsActive() ? m_filler.Uint64(value) : Self().OnValue(); }
+		bool Double(double value) { return m_filler.IsActive() ? m_filler.Double(value) : Self().OnValue(); }
+		bool RawNumber(const char* value, rapidjson::SizeType length, bool copy) { return m_filler.IsActive() ? m_filler.RawNumber(value, length, copy) : Self().OnValue(); }
+		bool String(const char* value, rapidjson::SizeType length, bool copy) { return m_filler.IsActive() ? m_filler.String(value, length, copy) : Self().OnString(std::string_view(value, length)); }
+
+		bool StartObject() { return m_filler.IsActive() ? m_filler.StartObject() : Self().OnStartObject(); }
+		bool Key(const char* name, rapidjson::SizeType length, bool copy) { return m_filler.IsActive() ? m_filler.Key(name, length, copy) : Self().OnKey(std::string_view(name, length)); }
+		bool EndObject(rapidjson::SizeType count) { return m_filler.IsActive() ? m_filler.EndObject(count) : Self().OnEndObject(); }
+		bool StartArray() { return m_filler.IsActive() ? m_filler.StartArray() : Self().OnStartArray(); }
+		bool EndArray(rapidjson::SizeType count) { return m_filler.IsActive() ? m_filler.EndArray(count) : Self().OnEndArray(); }
+
+		//strings and unsigned numbers outside the object being filled are values like any other, unless Derived reads them
+		bool OnString(std::string_view) { return Self().OnValue(); }
+		bool OnUint(unsigned) { return Self().OnValue(); }
+
+	protected:
+
+		SaxFiller m_filler;
+
+	private:
+
+		Derived& Self() { return static_cast<Derived&>(*this); }
+	};
+
+	//byte range of each object in a top level array, and whether it has "key" as a key of its own
+	template <typename Stream>
+	class EntryRangeHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, EntryRangeHandler<Stream>> {
+	public:
+
+		struct Entry {
+			size_t begin{};
+			size_t end{};
+			bool hasKey{};
+		};
+
+		EntryRangeHandler(const Stream& stream, std::string_view key) : m_stream(stream), m_key(key) {}
+
+		const std::vector<Entry>& GetEntries() const { return m_entries; }
+
+		bool Default() { return true; }
+
+		bool StartObject() {
+			//the reader has taken the '{'
+			if (++m_depth == 2) m_entries.push_back({ m_stream.Tell() - 1 });
+			return true;
+		}
+		bool Key(const char* name, rapidjson::SizeType length, bool) {
+			if (m_depth == 2 && std::string_view(name, length) == m_key) m_entries.back().hasKey = true;
+			return true;
+		}
+		bool EndObject(rapidjson::SizeType) {
+			if (m_depth-- == 2) m_entries.back().end = m_stream.Tell();
+			return true;
+		}
+		bool StartArray() {
+			++m_depth;
+			return true;
+		}
+		bool EndArray(rapidjson::SizeType) {
+			--m_depth;
+			return true;
+		}
+
+	private:
+
+		const Stream& m_stream;
+		std::string_view m_key;
+		std::vector<Entry> m_entries;
+		int m_depth{};  //1 in the top level array, 2 in one of its entries
+	};
+
+	//ReadJsonFile: the T of every entry of the top level array, a later entry over an earlier one
+	template <typename T>
+	class ComponentSaxHandler : public SaxHandler<ComponentSaxHandler<T>> {
+	public:
+
+		T& GetData() { return m_data; }
+
+		bool OnValue() {
+			m_match = false;
+			return true;
+		}
+
+		bool OnStartObject() {
+			if (m_depth == 1) {
+				m_depth = 2;
+				m_seen = false;
+			}
+			else if (m_match) {
+				this->m_filler.BeginObject(GetSaxType<T>(), &m_data);
+			}
+			else {
+				this->m_filler.BeginSkip();
+			}
+			m_match = false;
+			return true;
+		}
+
+		bool OnKey(std::string_view name) {
+			m_match = !m_seen && name == T::classname();
+			m_seen = m_seen || m_match;
+			return true;
+		}
+
+		bool OnEndObject() {
+			m_depth = 1;
+			return true;
+		}
+
+		bool OnStartArray() {
+			if (m_depth == 0) {
+				m_depth = 1;
+			}
+			else {
+				this->m_filler.BeginSkip();
+			}
+			m_match = false;
+			return true;
+		}
+
+		bool OnEndArray() {
+			m_depth = 0;
+			return true;
+		}
+
+	private:
+
+		T m_data{};
+		int m_depth{};     //0 outside the top level array, 1 in it, 2 in an entry
+		bool m_match{};    //the value about to be read is the T of the entry
+		bool m_seen{};     //the entry already had a T
+	};
+}
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <RAPIDJSON/document.h>
 #include <RAPIDJSON/writer.h>
 #include <RAPIDJSON/stringbuffer.h>
+#include "Reflection/Reflection.h"
 
 template <typename T>
 struct SaveComponent {
@@ -272,6 +273,7 @@ struct LoadComponent {
 	template <typename U>
 	void operator()(std::vector<U>& _args, const rapidjson::Value& value) {
 		if (value.HasMember(m_Array[count].c_str()) && value[m_Array[count].c_str()].IsArray()) {
+			_args.clear();
 
 			if constexpr (std::is_class_v<U> && requires { U::Names(); }) {
 
@@ -458,6 +460,36 @@ inline void saveComponentreflect(T* component, rapidjson::Value& entityData, rap
 	entityData.AddMember(key, name, allocator);
 }
 
+//the members of "component" that differ from "source", under the component's name, nothing is written when all match
+template<typename T>
+inline bool saveOverridesreflect(T* component, T* source, rapidjson::Value& entityData, rapidjson::Document::AllocatorType& allocator)
+{
+	if (component == nullptr || source == nullptr) return false;
+
+	[[maybe_unused]] constexpr auto fields = T::Fields();
+	rapidjson::Value name(rapidjson::kObjectType);
+	SaveComponent<decltype(T::Names())> saver{ T::Names() };
+	CompareComponent<decltype(T::Names())> compare{ T::Names() };
+
+	auto members = component->member();
+	auto sourceMembers = source->member();
+
+	[&] <std::size_t... Is>(std::index_sequence<Is...>) {
+		([&] {
+			if (fields[Is].Has(reflect::TRANSIENT)) return;
+			compare.result = true;
+			compare(std::get<Is>(members), std::get<Is>(sourceMembers));
+			if (compare.result) return;
+			saver.count = static_cast<int>(Is);
+			saver(std::get<Is>(members), name, allocator);
+		}(), ...);
+	}(std::make_index_sequence<std::tuple_size_v<decltype(members)>>{});
+
+	if (name.ObjectEmpty()) return false;
+	entityData.AddMember(rapidjson::Value(T::classname(), allocator), name, allocator);
+	return true;
+}
+
 template<typename T>
 inline void LoadComponentreflect(T* component, const rapidjson::Value& entityData)
 {
@@ -0,0 +1,253 @@
+/******************************************************************/
+/*!
+\file      binary_handler.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Saving and loading of cooked binary scene snapshots.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "binary_handler.h"
+
+#include "ECS/ECS.h"
+#include "Debugging/Logging.h"
+#include "ECS/Hierachy.h"
+
+namespace Serialization {
+
+	namespace {
+
+		struct BlockHeader {
+			uint64_t schemaHash{};
+			uint64_t size{};    //bytes of the block after this header
+			uint32_t name{};    //string table index
+			uint32_t rows{};
+		};
+
+		struct Block {
+			BlockHeader header;
+			std::string name;
+			BinaryReader data;
+		};
+
+		//depth first, the order SaveEntity writes the JSON in
+		void CollectEntity(ecs::EntityID id, int32_t parent, std::vector<ecs::EntityID>& entities, std::vector<int32_t>& parents, std::unordered_set<ecs::EntityID>& visited) {
+			if (!visited.insert(id).second) return;
+
+			const int32_t index = static_cast<int32_t>(entities.size());
+			entities.push_back(id);
+			parents.push_back(parent);
+
+			std::optional<std::vector<ecs::EntityID>> children = hierachy::m_GetChild(id);
+			if (children.has_value()) {
+				for (ecs::EntityID child : children.value()) {
+					CollectEntity(child, index, entities, parents, visited);
+				}
+			}
+		}
+
+		void WriteBlock(BinaryWriter& writer, const std::string& name, uint64_t schemaHash, uint32_t rows, const std::string& data) {
+			writer.Write(BlockHeader{ schemaHash, data.size(), writer.GetStrings().Intern(name), rows });
+			writer.WriteBytes(data.data(), data.size());
+		}
+
+		Block ReadBlock(BinaryReader& reader, const std::vector<std::string>& strings) {
+			const BlockHeader header = reader.Read<BlockHeader>();
+			if (header.name >= strings.size()) throw std::runtime_error("Block name out of range");
+			return { header, strings[header.name], reader.Slice(static_cast<size_t>(header.size)) };
+		}
+	}
+
+	bool HasEntities(const std::string& sceneName) {
+		const auto& sceneMap = ecs::ECS::GetInstance()->sceneMap;
+		const auto it = sceneMap.find(sceneName);
+		return it != sceneMap.end() && !it->second.sceneIDs.empty();
+	}
+
+	std::filesystem::path GetCookedScenePath(const std::filesystem::path& scenePath) {
+		std::filesystem::path cooked = scenePath;
+		cooked += ".bin";
+		return cooked;
+	}
+
+	void WriteStringTable(const StringTable& strings, BinaryWriter& writer) {
+		for (const std::string& value : strings.GetStrings()) {
+			writer.Write(static_cast<uint32_t>(value.size()));
+			writer.WriteBytes(value.data(), value.size());
+		}
+	}
+
+	void ReadStringTable(BinaryReader& reader, uint32_t count, std::vector<std::string>& strings) {
+		strings.clear();
+		strings.reserve(std::min<size_t>(count, reader.Remaining() / sizeof(uint32_t)));
+		for (uint32_t i = 0; i < count; ++i) {
+			const uint32_t length = reader.Read<uint32_t>();
+			std::string& value = strings.emplace_back();
+			if (length > reader.Remaining()) throw std::runtime_error("Unexpected end of binary data");
+			value.resize(length);
+			reader.ReadBytes(value.data(), length);
+		}
+	}
+
+	bool SaveSceneBinary(const std::filesystem::path& scene, const std::filesystem::path& targetFilePath, uint64_t sourceHash)
+	{
+		auto* ecs = ecs::ECS::GetInstance();
+		const std::string sceneName = scene.filename().string();
+
+		std::vector<ecs::EntityID> entities;
+		std::vector<int32_t> parents;
+		SceneData sceneData;
+		const auto sceneIt = ecs->sceneMap.find(sceneName);
+		if (sceneIt != ecs->sceneMap.end()) {
+			sceneData = sceneIt->second;
+			std::unordered_set<ecs::EntityID> visited;
+			for (ecs::EntityID id : sceneIt->second.sceneIDs) {
+				if (!hierachy::GetParent(id).has_value()) {
+					CollectEntity(id, -1, entities, parents, visited);
+				}
+			}
+		}
+
+		StringTable strings;
+		BinaryWriter body(strings);
+		body.WriteArray(parents);
+
+		{
+			BinaryWriter columns(strings);
+			WriteComponentColumns(std::vector<SceneData*>{ &sceneData }, columns);
+			WriteBlock(body, SceneData::classname(), SchemaHash<SceneData>(), 1, columns.GetData());
+		}
+
+		//a block per component type, rows in entity order
+		uint32_t blockCount = 0;
+		for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+			std::vector<uint32_t> rows;
+			std::vector<ecs::EntityID> rowEntities;
+			for (size_t i = 0; i < entities.size(); ++i) {
+				if (ecs->GetEntitySignature(entities[i]).test(key)) {
+					rows.push_back(static_cast<uint32_t>(i));
+					rowEntities.push_back(entities[i]);
+				}
+			}
+			if (rows.empty()) continue;
+
+			auto& actionInvoker = ecs->componentAction.at(componentName);
+			BinaryWriter columns(strings);
+			columns.WriteArray(rows);
+			actionInvoker->SaveBinary(rowEntities, columns);
+			WriteBlock(body, componentName, actionInvoker->SchemaHash(), static_cast<uint32_t>(rows.size()), columns.GetData());
+			++blockCount;
+		}
+
+		SceneBinaryHeader header;
+		std::memcpy(header.magic, SCENE_BINARY_MAGIC, sizeof(SCENE_BINARY_MAGIC));
+		header.version = SCENE_BINARY_VERSION;
+		header.sourceHash = sourceHash;
+		header.entityCount = static_cast<uint32_t>(entities.size());
+		header.blockCount = blockCount;
+		header.stringCount = static_cast<uint32_t>(strings.GetStrings().size());
+
+		BinaryWriter file(strings);
+		file.Write(header);
+		WriteStringTable(strings, file);
+		file.WriteBytes(body.GetData().data(), body.GetData().size());
+
+		if (!WriteFileAtomic(targetFilePath, file.GetData())) {
+			LOGGING_ERROR("Failed to write cooked scene: {}", targetFilePath.string().c_str());
+			return false;
+		}
+		return true;
+	}
+
+	bool LoadSceneBinary(const std::string& data, uint64_t sourceHash, const std::string& sceneName)
+	{
+		SceneBinaryHeader header;
+		if (!ReadSceneBinaryHeader(data, header) || header.sourceHash != sourceHash) {
+			return false;
+		}
+
+		auto* ecs = ecs::ECS::GetInstance();
+		std::vector<std::string> strings;
+		std::vector<int32_t> parents;
+		SceneData sceneData;
+		std::vector<Block> blocks;
+
+		//everything is checked before the first entity is made, so a stale file leaves nothing behind
+		try {
+			BinaryReader reader(data.data(), data.size());
+			reader.Slice(sizeof(SceneBinaryHeader));
+			ReadStringTable(reader, header.stringCount, strings);
+			reader.SetStrings(&strings);
+			reader.ReadArray(parents, header.entityCount);
+
+			Block scene = ReadBlock(reader, strings);
+			if (scene.name != SceneData::classname() || scene.header.schemaHash != SchemaHash<SceneData>()) {
+				LOGGING_INFO("Cooked scene data is out of date, loading JSON");
+				return false;
+			}
+			ReadComponentColumns(std::vector<SceneData*>{ &sceneData }, scene.data);
+
+			for (uint32_t i = 0; i < header.blockCount; ++i) {
+				Block block = ReadBlock(reader, strings);
+				const auto action = ecs->componentAction.find(block.name);
+				if (action == ecs->componentAction.end() || action->second->SchemaHash() != block.header.schemaHash) {
+					LOGGING_INFO("Cooked {} is out of date, loading JSON", block.name.c_str());
+					return false;
+				}
+				blocks.push_back(std::move(block));
+			}
+
+			for (size_t i = 0; i < parents.size(); ++i) {
+				if (parents[i] >= static_cast<int32_t>(i)) throw std::runtime_error("Parent listed after its child");
+			}
+		}
+		catch (const std::exception& e) {
+			LOGGING_WARN("Cooked scene is damaged, loading JSON: {}", e.what());
+			return false;
+		}
+
+		if (!HasEntities(sceneName)) ecs->AddScene(sceneName, sceneData);
+
+		std::vector<ecs::EntityID> entities;
+		entities.reserve(parents.size());
+		for (size_t i = 0; i < parents.size(); ++i) {
+			entities.push_back(ecs->CreateEntity(sceneName));
+		}
+
+		try {
+			for (Block& block : blocks) {
+				std::vector<uint32_t> rows;
+				block.data.ReadArray(rows, block.header.rows);
+
+				std::vector<ecs::EntityID> rowEntities;
+				rowEntities.reserve(rows.size());
+				for (uint32_t row : rows) {
+					if (row >= entities.size()) throw std::runtime_error("Entity index out of range");
+					rowEntities.push_back(entities[row]);
+				}
+				ecs->componentAction.at(block.name)->LoadBinary(rowEntities, block.data);
+			}
+		}
+		catch (const std::exception& e) {
+			LOGGING_WARN("Cooked scene is damaged, loading JSON: {}", e.what());
+			for (ecs::EntityID id : entities) {
+				ecs->DeleteEntity(id);
+			}
+			return false;
+		}
+
+		//parents come before their children, so children keep the order they were saved in
+		for (size_t i = 0; i < parents.size(); ++i) {
+			if (parents[i] >= 0) {
+				hierachy::m_SetParent(entities[parents[i]], entities[i]);
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,94 @@
+/******************************************************************/
+/*!
+\file      binary_handler.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Cooked binary snapshots of scenes, saved next to the JSON
+		   they were cooked from.
+
+		   JSON stays the format scenes are authored and merged in.
+		   Saving a scene also writes "<scene>.bin", which LoadScene
+		   prefers while it is current: it must be cooked from the same
+		   JSON text and every component type in it must have the schema
+		   hash of the running build. Anything else loads the JSON.
+
+		   Layout, all values little endian:
+		   - SceneBinaryHeader
+		   - string table, a length and the bytes of each string
+		   - parent of each entity, an index into the entity list or -1,
+			 entities listed depth first as SaveEntity writes them
+		   - the SceneData block, then one block per component type:
+			 type name, schema hash, row count and byte size, followed by
+			 the entity index of each row and the columns of the type
+			 (see BinarySerializationReflection.h)
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "BinarySerializationReflection.h"
+#include "json_writer.h"
+#include "AssetPipeline/VirtualFileSystem.h"
+
+namespace Serialization {
+
+		//a file loaded into a scene that already has entities, such as a prefab, leaves the scene's own data alone
+		bool HasEntities(const std::string& sceneName);
+
+		//"level.json" is cooked to "level.json.bin"
+		std::filesystem::path GetCookedScenePath(const std::filesystem::path& scenePath);
+
+		//writes the scene loaded as "scene" to "targetFilePath", "sourceHash" is HashSceneSource of the JSON saved with it
+		bool SaveSceneBinary(const std::filesystem::path& scene, const std::filesystem::path& targetFilePath, uint64_t sourceHash);
+
+		//false, with nothing loaded, if the data is not a current cooked scene of "sourceHash"
+		bool LoadSceneBinary(const std::string& data, uint64_t sourceHash, const std::string& sceneName);
+
+		void WriteStringTable(const StringTable& strings, BinaryWriter& writer);
+		void ReadStringTable(BinaryReader& reader, uint32_t count, std::vector<std::string>& strings);
+
+
+		//single component files, the binary counterpart of WriteJsonFile and ReadJsonFile
+		template <typename T>
+		bool WriteBinaryFile(const std::string& filepath, T* object) {
+			StringTable strings;
+			BinaryWriter columns(strings);
+			WriteComponentColumns(std::vector<T*>{ object }, columns);
+
+			BinaryWriter file(strings);
+			file.Write(SchemaHash<T>());
+			file.Write(static_cast<uint32_t>(strings.GetStrings().size()));
+			WriteStringTable(strings, file);
+			file.WriteBytes(columns.GetData().data(), columns.GetData().size());
+
+			return WriteFileAtomic(filepath, file.GetData());
+		}
+
+		template <typename T>
+		T ReadBinaryFile(const std::string& filepath)
+		{
+			std::string fileContent;
+			if (!assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(filepath, fileContent)) {
+				LOGGING_WARN("Failed to open binary file for reading: {}", filepath.c_str());
+				throw std::runtime_error("Failed to open binary file: " + filepath);
+			}
+
+			BinaryReader reader(fileContent.data(), fileContent.size());
+			if (reader.Read<uint64_t>() != SchemaHash<T>()) {
+				throw std::runtime_error(std::string("Schema of ") + T::classname() + " changed since " + filepath + " was written");
+			}
+
+			std::vector<std::string> strings;
+			ReadStringTable(reader, reader.Read<uint32_t>(), strings);
+			reader.SetStrings(&strings);
+
+			T data;
+			ReadComponentColumns(std::vector<T*>{ &data }, reader);
+			return data;
+		}
+}
@@ -36,10 +36,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 /********************************************************************/
 #include "Config/pch.h"
 #include "json_handler.h"
+#include "binary_handler.h"
 
 #include <RAPIDJSON/filewritestream.h>
 #include <RAPIDJSON/istreamwrapper.h>
-#include <RAPIDJSON/prettywriter.h>
 #include <RAPIDJSON/filereadstream.h>
 
 
@@ -69,28 +69,820 @@ namespace Serialization {
 		checkFile.close();
 	}
 
+	std::filesystem::path GetSceneIndexPath(const std::filesystem::path& scenePath) {
+		std::filesystem::path index = scenePath;
+		index += ".idx";
+		return index;
+	}
+
+	namespace {
+
+		//HashSceneSource of a scene file, loose files are hashed a chunk at a time
+		uint64_t HashJsonFile(const std::filesystem::path& jsonFilePath) {
+			auto* vfs = assetpipeline::VirtualFileSystem::GetInstance();
+			if (vfs->IsPacked(jsonFilePath)) {
+				std::string fileContent;
+				vfs->ReadFile(jsonFilePath, fileContent);
+				return HashSceneSource(fileContent);
+			}
+
+			std::ifstream file(jsonFilePath, std::ios::binary);
+			std::array<char, 65536> buffer;
+			uint64_t hash = FNV_OFFSET;
+			while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+				hash = HashSceneSource({ buffer.data(), static_cast<size_t>(file.gcount()) }, hash);
+			}
+			return hash;
+		}
+
+		//where a top level record of a saved scene sits in its file
+		struct SceneRecord {
+			uint64_t offset{};
+			uint64_t size{};
+			uint64_t liveHash{};  //HashLiveSubtree of its root when it was written
+		};
+
+		//the layout of the file a scene was last saved to or loaded from, record 0 is the scene data
+		struct SceneRecords {
+			std::filesystem::path path;
+			uint64_t sourceHash{};
+			uint64_t fileSize{};
+			std::string content;                          //the file as last saved or checked, empty until a save needs it
+			std::filesystem::file_time_type writeTime{};  //of the file when "content" was taken
+			std::vector<ecs::EntityID> roots;  //root entity of each record after the scene data
+			std::vector<SceneRecord> records;
+			JsonStyle style{};
+		};
+
+		constexpr char SCENE_INDEX_MAGIC[4] = { 'K', 'O', 'S', 'I' };
+		constexpr uint32_t SCENE_INDEX_VERSION = 2;
+
+		struct SceneIndexHeader {
+			char magic[4]{};
+			uint32_t version{};
+			uint64_t sourceHash{};   //HashSceneSource of the JSON the records are in
+			uint64_t fileSize{};
+			uint64_t schemaHash{};   //RegistrySchemaHash when the records were written
+			uint32_t recordCount{};
+			JsonStyle style{};       //of the records, a record is only reused in a file of its own style
+		};
+
+		//scene name to its records
+		std::unordered_map<std::string, SceneRecords> s_sceneRecords;
+
+		//changes whenever a component type is added, removed or changes its members, old records are then written again
+		uint64_t RegistrySchemaHash() {
+			auto* ecs = ecs::ECS::GetInstance();
+			auto combine = [](uint64_t hash, uint64_t schema) {
+				return HashBytes({ reinterpret_cast<const char*>(&schema), sizeof(schema) }, hash);
+			};
+			uint64_t hash = combine(HashBytes(SceneData::classname()), SchemaHash<SceneData>());
+			for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+				hash = combine(HashBytes(componentName, hash), ecs->componentAction.at(componentName)->SchemaHash());
+			}
+			return hash;
+		}
+
+		bool SamePath(const std::filesystem::path& a, const std::filesystem::path& b) {
+			std::error_code ec;
+			return std::filesystem::absolute(a, ec).lexically_normal() == std::filesystem::absolute(b, ec).lexically_normal();
+		}
+
+		std::vector<ecs::EntityID> GetRootEntities(const std::string& sceneName) {
+			std::vector<ecs::EntityID> roots;
+			const auto sceneIt = ecs::ECS::GetInstance()->sceneMap.find(sceneName);
+			if (sceneIt == ecs::ECS::GetInstance()->sceneMap.end()) return roots;
+			for (ecs::EntityID id : sceneIt->second.sceneIDs) {
+				if (!hierachy::GetParent(id).has_value()) roots.push_back(id);
+			}
+			return roots;
+		}
+
+		//hash of the live components of "root" and everything under it, as the cooked snapshot writes them, which is far
+		//quicker than building the JSON record. Equal only if the subtree still saves as the record it was last saved as
+		uint64_t HashLiveSubtree(ecs::EntityID root, uint64_t hash = FNV_OFFSET) {
+			auto* ecs = ecs::ECS::GetInstance();
+			auto hashBits = [&hash](const auto& bits) {
+				hash = HashBytes({ reinterpret_cast<const char*>(&bits), sizeof(bits) }, hash);
+			};
+
+			const ecs::ComponentSignature signature = ecs->GetEntitySignature(root);
+			hashBits(static_cast<uint64_t>(signature.to_ullong()));
+			for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+				if (signature.test(key)) hash = ecs->componentAction.at(componentName)->HashBinary(root, hash);
+			}
+
+			// how many children, so moving an entity changes the hash
+			const std::optional<std::vector<ecs::EntityID>> children = hierachy::m_GetChild(root);
+			hashBits(static_cast<uint32_t>(children.has_value() ? children->size() : 0));
+			if (children.has_value()) {
+				for (ecs::EntityID child : children.value()) {
+					hash = HashLiveSubtree(child, hash);
+				}
+			}
+			return hash;
+		}
+
+		//roots with a dirty entity under them, found from the dirty entities up so a save walks the edits, not the scene
+		std::unordered_set<ecs::EntityID> GetDirtyRoots() {
+			std::unordered_set<ecs::EntityID> roots;
+			for (ecs::EntityID id : ecs::ECS::GetInstance()->GetDirtyEntities()) {
+				for (std::optional<ecs::EntityID> parent = hierachy::GetParent(id); parent.has_value(); parent = hierachy::GetParent(id)) {
+					id = parent.value();
+				}
+				roots.insert(id);
+			}
+			return roots;
+		}
+
+		void WriteSceneIndex(const SceneRecords& saved) {
+			SceneIndexHeader header;
+			std::memcpy(header.magic, SCENE_INDEX_MAGIC, sizeof(SCENE_INDEX_MAGIC));
+			header.version = SCENE_INDEX_VERSION;
+			header.sourceHash = saved.sourceHash;
+			header.fileSize = saved.fileSize;
+			header.schemaHash = RegistrySchemaHash();
+			header.recordCount = static_cast<uint32_t>(saved.records.size());
+			header.style = saved.style;
+
+			StringTable strings;
+			BinaryWriter writer(strings);
+			writer.Write(header);
+			writer.WriteArray(saved.records);
+			if (!WriteFileAtomic(GetSceneIndexPath(saved.path), writer.GetData())) {
+				LOGGING_WARN("Failed to write scene index, the next save rewrites the whole scene");
+			}
+		}
+
+		//pairs the records in the index next to a freshly loaded scene file with the roots it made
+		void ReadSceneIndex(const std::filesystem::path& jsonFilePath, const std::string& sceneName) {
+			s_sceneRecords.erase(sceneName);
+
+			std::ifstream file(GetSceneIndexPath(jsonFilePath), std::ios::binary);
+			if (!file) return;
+			const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+			SceneRecords loaded;
+			try {
+				BinaryReader reader(data.data(), data.size());
+				const SceneIndexHeader header = reader.Read<SceneIndexHeader>();
+				if (std::memcmp(header.magic, SCENE_INDEX_MAGIC, sizeof(SCENE_INDEX_MAGIC)) != 0 || header.version != SCENE_INDEX_VERSION ||
+					header.schemaHash != RegistrySchemaHash()) {
+					return;
+				}
+				reader.ReadArray(loaded.records, header.recordCount);
+				loaded.sourceHash = header.sourceHash;
+				loaded.fileSize = header.fileSize;
+				loaded.style = header.style;
+			}
+			catch (const std::exception&) {
+				return;
+			}
+
+			loaded.path = jsonFilePath;
+			loaded.roots = GetRootEntities(sceneName);
+			if (loaded.records.size() != loaded.roots.size() + 1) return;
+			for (const SceneRecord& record : loaded.records) {
+				if (record.offset > loaded.fileSize || record.size > loaded.fileSize - record.offset) return;
+			}
+			s_sceneRecords[sceneName] = std::move(loaded);
+		}
+
+		//a scene just loaded whole from its file matches what is on disk, nothing in it needs saving yet
+		void TrackLoadedScene(const std::filesystem::path& jsonFilePath, const std::string& sceneName) {
+			auto* ecs = ecs::ECS::GetInstance();
+			for (ecs::EntityID id : ecs->sceneMap.at(sceneName).sceneIDs) {
+				ecs->ClearDirty(id);
+			}
+
+			if (assetpipeline::VirtualFileSystem::GetInstance()->IsPacked(jsonFilePath)) {
+				s_sceneRecords.erase(sceneName);
+			}
+			else {
+				ReadSceneIndex(jsonFilePath, sceneName);
+			}
+		}
+
+		//the records of the last save or load of "sceneName" to "jsonFilePath" in "style", while the file still holds them. The file is
+		//read and hashed once, after that only while its size or write time moved
+		const SceneRecords* FindReusableRecords(const std::string& sceneName, const std::filesystem::path& jsonFilePath, JsonStyle style) {
+			const auto it = s_sceneRecords.find(sceneName);
+			if (it == s_sceneRecords.end() || !SamePath(it->second.path, jsonFilePath) || it->second.style != style) return nullptr;
+			SceneRecords& records = it->second;
+
+			std::error_code ec;
+			const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(jsonFilePath, ec);
+			const uintmax_t fileSize = ec ? 0 : std::filesystem::file_size(jsonFilePath, ec);
+			if (ec) return nullptr;
+			if (!records.content.empty() && writeTime == records.writeTime && fileSize == records.fileSize) return &records;
+
+			records.content.clear();
+			std::ifstream file(jsonFilePath, std::ios::binary);
+			if (!file) return nullptr;
+			std::string content(static_cast<size_t>(fileSize), '\0');
+			file.read(content.data(), static_cast<std::streamsize>(content.size()));
+			if (!file || content.size() != records.fileSize || HashSceneSource(content) != records.sourceHash) {
+				LOGGING_INFO("{} changed on disk, saving the whole scene", jsonFilePath.string().c_str());
+				return nullptr;
+			}
+			records.content = std::move(content);
+			records.writeTime = writeTime;
+			return &records;
+		}
+
+		std::function<bool(const std::string&)> s_prefabResolver;
+		//each prefab as its instances were last brought up to date with, what PropagatePrefab compares the prefab against
+		std::unordered_map<std::string, ecs::EntityTemplate> s_prefabBaselines;
+		//prefabs being loaded by FindPrefabSource, a prefab holding an instance of itself is not loaded again
+		std::unordered_set<std::string> s_prefabsLoading;
+
+		std::optional<ecs::EntityID> FindLoadedPrefab(const std::string& prefabName) {
+			const auto& sceneMap = ecs::ECS::GetInstance()->sceneMap;
+			const auto it = sceneMap.find(prefabName);
+			if (it == sceneMap.end() || it->second.sceneIDs.empty()) return std::nullopt;
+
+			const auto& ids = it->second.sceneIDs;
+			if (it->second.isPrefab && std::find(ids.begin(), ids.end(), it->second.prefabID) != ids.end()) return it->second.prefabID;
+			for (ecs::EntityID id : ids) {
+				if (!hierachy::GetParent(id).has_value()) return id;
+			}
+			return std::nullopt;
+		}
+
+		//"Assets/Scene/level.json" finds "Crate.prefab" next to it or in "Assets/Prefabs", loaded inactive as prefab::LoadPrefab would
+		bool LoadPrefabNear(const std::string& prefabName, const std::filesystem::path& scenePath) {
+			if (scenePath.empty()) return false;
+
+			auto* ecs = ecs::ECS::GetInstance();
+			auto* vfs = assetpipeline::VirtualFileSystem::GetInstance();
+			for (const auto& path : { scenePath.parent_path() / prefabName, scenePath.parent_path().parent_path() / "Prefabs" / prefabName }) {
+				if (!vfs->Exists(path)) continue;
+
+				ecs->sceneMap[prefabName];
+				LoadScene(path, prefabName);
+				SceneData& prefabData = ecs->sceneMap.at(prefabName);
+				prefabData.isPrefab = true;
+				prefabData.isActive = false;
+				for (ecs::EntityID id : prefabData.sceneIDs) {
+					if (!hierachy::GetParent(id).has_value()) {
+						prefabData.prefabID = id;
+						ecs->GetComponent<ecs::NameComponent>(id)->prefabName = prefabName;
+						return true;
+					}
+				}
+				return false;
+			}
+			return false;
+		}
+
+		const ecs::NameComponent* GetPrefabName(ecs::EntityID id) {
+			auto* ecs = ecs::ECS::GetInstance();
+			if (!ecs->HasComponent<ecs::NameComponent>(id)) return nullptr;
+			const ecs::NameComponent* nc = ecs->GetComponent<ecs::NameComponent>(id);
+			return nc->isPrefab && !nc->prefabName.empty() ? nc : nullptr;
+		}
+
+		//instances name every one of their entities after the prefab, see prefab::m_CreatePrefab
+		bool IsInstanceRoot(ecs::EntityID id) {
+			const ecs::NameComponent* nc = GetPrefabName(id);
+			if (nc == nullptr) return false;
+			const std::optional<ecs::EntityID> parent = hierachy::GetParent(id);
+			const ecs::NameComponent* parentName = parent.has_value() ? GetPrefabName(parent.value()) : nullptr;
+			return parentName == nullptr || parentName->prefabName != nc->prefabName;
+		}
+
+		//the component of entity "index" of a template, null when it has none
+		void* FindTemplateRow(const ecs::EntityTemplate& entityTemplate, const std::string& componentName, uint32_t index) {
+			for (const auto& column : entityTemplate.columns) {
+				if (column.component != componentName) continue;
+				const auto row = std::lower_bound(column.rows.begin(), column.rows.end(), index);
+				if (row == column.rows.end() || *row != index) return nullptr;
+				return ecs::ECS::GetInstance()->componentAction.at(componentName)->GetRow(column.data.get(), row - column.rows.begin());
+			}
+			return nullptr;
+		}
+
+		//writes "root", an instance of "source", as what it overrides, false when its entities no longer line up with the prefab's
+		bool SavePrefabInstance(ecs::EntityID root, ecs::EntityID source, const std::string& prefabName, rapidjson::Value& parentArray,
+			rapidjson::Document::AllocatorType& allocator, std::unordered_set<ecs::EntityID>& savedEntities) {
+			auto* ecs = ecs::ECS::GetInstance();
+			std::vector<int32_t> parents, sourceParents;
+			const std::vector<ecs::EntityID> entities = ecs->GetSubtree(root, &parents);
+			const std::vector<ecs::EntityID> sourceEntities = ecs->GetSubtree(source, &sourceParents);
+			if (parents != sourceParents) return false;
+
+			rapidjson::Value overrides(rapidjson::kArrayType);
+			rapidjson::SizeType used = 0;
+			for (size_t i = 0; i < entities.size(); ++i) {
+				const auto signature = ecs->GetEntitySignature(entities[i]);
+				const auto sourceSignature = ecs->GetEntitySignature(sourceEntities[i]);
+				rapidjson::Value entityData(rapidjson::kObjectType);
+				rapidjson::Value removed(rapidjson::kArrayType);
+
+				for (const auto& [ComponentName, key] : ecs->GetComponentKeyData()) {
+					auto& actionInvoker = ecs->componentAction[ComponentName];
+					if (!signature.test(key)) {
+						if (sourceSignature.test(key)) removed.PushBack(rapidjson::Value(ComponentName.c_str(), allocator), allocator);
+						continue;
+					}
+
+					auto* component = ecs->GetIComponent<ecs::Component*>(ComponentName, entities[i]);
+					if (!sourceSignature.test(key)) {
+						actionInvoker->Save(component, entityData, allocator);
+						continue;
+					}
+
+					void* sourceComponent = ecs->GetIComponent<ecs::Component*>(ComponentName, sourceEntities[i]);
+					ecs::NameComponent sourceName;
+					if (ComponentName == ecs::NameComponent::classname()) {
+						sourceName = *static_cast<ecs::NameComponent*>(sourceComponent);
+						sourceName.isPrefab = true;
+						sourceName.prefabName = prefabName;
+						sourceComponent = &sourceName;
+					}
+					actionInvoker->SaveOverrides(component, sourceComponent, entityData, allocator);
+				}
+
+				if (!removed.Empty()) entityData.AddMember("removed", removed, allocator);
+				if (!entityData.ObjectEmpty()) used = static_cast<rapidjson::SizeType>(i + 1);
+				overrides.PushBack(entityData, allocator);
+			}
+
+			//entities after the last one with overrides are left out
+			while (overrides.Size() > used) overrides.PopBack();
+
+			rapidjson::Value instanceData(rapidjson::kObjectType);
+			instanceData.AddMember("prefab", rapidjson::Value(prefabName.c_str(), allocator), allocator);
+			if (!overrides.Empty()) instanceData.AddMember("overrides", overrides, allocator);
+			parentArray.PushBack(instanceData, allocator);
+			savedEntities.insert(entities.begin(), entities.end());
+			return true;
+		}
+
+		//scenes holding instances are not cooked, an instance is the prefab as it is when the scene is loaded
+		bool HasPrefabInstances(const std::string& sceneName) {
+			const auto& sceneMap = ecs::ECS::GetInstance()->sceneMap;
+			const auto sceneIt = sceneMap.find(sceneName);
+			if (sceneIt == sceneMap.end()) return false;
+			for (ecs::EntityID id : sceneIt->second.sceneIDs) {
+				if (!IsInstanceRoot(id)) continue;
+				const std::optional<ecs::EntityID> source = FindLoadedPrefab(GetPrefabName(id)->prefabName);
+				if (source.has_value() && source.value() != id) return true;
+			}
+			return false;
+		}
+
+		//the prefabs one file clones, each is captured once however many instances of it there are
+		class PrefabTemplates {
+		public:
+
+			explicit PrefabTemplates(const std::filesystem::path& scenePath) : m_scenePath(scenePath) {}
+
+			const ecs::EntityTemplate* Find(const std::string& prefabName) {
+				auto it = m_templates.find(prefabName);
+				if (it == m_templates.end()) {
+					const std::optional<ecs::EntityID> source = FindPrefabSource(prefabName, m_scenePath);
+					it = m_templates.emplace(prefabName, source.has_value() ? ecs::ECS::GetInstance()->CaptureTemplate(source.value()) : ecs::EntityTemplate{}).first;
+				}
+				return it->second.Empty() ? nullptr : &it->second;
+			}
+
+		private:
+
+			std::filesystem::path m_scenePath;
+			std::unordered_map<std::string, ecs::EntityTemplate> m_templates;
+		};
+
+		//the entities of a new instance of "prefabName" depth first, just the root when the prefab cannot be found
+		std::vector<ecs::EntityID> InstantiatePrefab(const std::string& prefabName, std::optional<ecs::EntityID> parentID, const std::string& sceneName, PrefabTemplates& prefabs) {
+			auto* ecs = ecs::ECS::GetInstance();
+			std::vector<ecs::EntityID> entities;
+			if (const ecs::EntityTemplate* entityTemplate = prefabs.Find(prefabName)) {
+				entities = ecs->GetSubtree(ecs->InstantiateTemplate(*entityTemplate, sceneName));
+			}
+			else {
+				LOGGING_WARN("Prefab {} not found, its instance is loaded from its overrides alone", prefabName.c_str());
+				entities.push_back(ecs->CreateEntity(sceneName));
+			}
+
+			for (ecs::EntityID id : entities) {
+				ecs::NameComponent* nc = ecs->GetComponent<ecs::NameComponent>(id);
+				nc->isPrefab = true;
+				nc->prefabName = prefabName;
+			}
+
+			if (parentID.has_value()) {
+				hierachy::m_SetParent(parentID.value(), entities.front());
+			}
+			return entities;
+		}
+
+		void ApplyOverrides(const rapidjson::Value& entityData, ecs::EntityID id) {
+			if (!entityData.IsObject()) return;
+
+			auto* ecs = ecs::ECS::GetInstance();
+			for (const auto& [ComponentName, key] : ecs->GetComponentKeyData()) {
+				if (entityData.HasMember(ComponentName.c_str()) && entityData[ComponentName.c_str()].IsObject()) {
+					ecs->componentAction[ComponentName]->Load(id, entityData);
+				}
+			}
+
+			if (entityData.HasMember("removed") && entityData["removed"].IsArray()) {
+				for (const auto& removed : entityData["removed"].GetArray()) {
+					if (!removed.IsString()) continue;
+					const auto action = ecs->componentAction.find(removed.GetString());
+					if (action != ecs->componentAction.end() && action->second->HasComponent(id)) {
+						action->second->RemoveComponent(id);
+					}
+				}
+			}
+		}
+
+		void LoadEntityRecord(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName, PrefabTemplates& prefabs)
+		{
+			ecs::ECS* ecs = ecs::ECS::GetInstance();
+
+			if (entityData.HasMember("prefab") && entityData["prefab"].IsString()) {
+				const std::vector<ecs::EntityID> entities = InstantiatePrefab(entityData["prefab"].GetString(), parentID, sceneName, prefabs);
+				if (entityData.HasMember("overrides") && entityData["overrides"].IsArray()) {
+					const rapidjson::Value& overrides = entityData["overrides"];
+					for (rapidjson::SizeType i = 0; i < overrides.Size() && i < entities.size(); i++) {
+						ApplyOverrides(overrides[i], entities[i]);
+					}
+				}
+				return;
+			}
+
+			ecs::EntityID newEntityId = ecs->CreateEntity(sceneName);
+
+			const auto& componentKey = ecs->GetComponentKeyData();
+			for (const auto& [ComponentName, key] : componentKey) {
+				if (entityData.HasMember(ComponentName.c_str()) && entityData[ComponentName.c_str()].IsObject()) {
+					auto& actionInvoker = ecs->componentAction[ComponentName];
+					actionInvoker->Load(newEntityId, entityData);
+				}
+
+			}
+
+
+			//Attach entity to parent
+			if (parentID.has_value()) {
+				hierachy::m_SetParent(parentID.value(), newEntityId);
+			}
+
+			// Load children
+			if (entityData.HasMember("children") && entityData["children"].IsArray()) {
+				const rapidjson::Value& childrenArray = entityData["children"];
+				for (rapidjson::SizeType i = 0; i < childrenArray.Size(); i++) {
+					LoadEntityRecord(childrenArray[i], newEntityId, sceneName, prefabs);
+				}
+			}
+		}
+
+		//builds the scene while it is parsed, in the order LoadEntity would: an entity is made at its
+		//first key, before its components and children, and a child is attached as soon as it exists.
+		//A prefab instance is cloned at its "prefab" key, which SaveEntity writes first
+		class SceneSaxHandler : public SaxHandler<SceneSaxHandler> {
+		public:
+
+			SceneSaxHandler(const std::string& sceneName, const std::filesystem::path& scenePath)
+				: m_ecs(ecs::ECS::GetInstance()), m_migrations(SchemaMigrations::GetInstance()), m_sceneName(sceneName), m_prefabs(scenePath) {
+				for (const auto& [componentName, key] : m_ecs->GetComponentKeyData()) {
+					m_components.emplace(HashBytes(componentName), ComponentEntry{ componentName, m_ecs->componentAction[componentName].get(), key });
+				}
+			}
+
+			bool OnValue() {
+				if (m_levels.empty()) return true;
+				Level& level = m_levels.back();
+				level.pending = Pending::NONE;
+				//anything but an object still stands for an entity of the instance
+				if (level.type == Level::OVERRIDES) ++level.next;
+				return true;
+			}
+
+			//nothing was made from the file when it stopped here
+			bool IsOutdated() const { return m_outdated; }
+
+			bool OnUint(unsigned value) {
+				if (!m_levels.empty() && m_levels.back().type == Level::VERSIONS) {
+					m_versions.Set(m_versionName, value);
+				}
+				return OnValue();
+			}
+
+			bool OnString(std::string_view value) {
+				if (m_levels.empty()) return true;
+				Level& level = m_levels.back();
+
+				if (level.pending == Pending::PREFAB) {
+					level.instance = InstantiatePrefab(std::string(value), level.parent, m_sceneName, m_prefabs);
+					level.entity = level.instance.front();
+					level.created = true;
+					level.prefab = true;
+				}
+				else if (level.type == Level::REMOVED) {
+					const ComponentEntry* entry = FindComponent(value);
+					if (entry && entry->invoker->HasComponent(level.entity)) entry->invoker->RemoveComponent(level.entity);
+				}
+				return OnValue();
+			}
+
+			bool OnStartObject() {
+				if (m_levels.empty()) {
+					m_filler.BeginSkip();
+					return true;
+				}
+
+				Level& level = m_levels.back();
+				if (level.type == Level::ROOT) {
+					//made at its first key, unless that key says the entry is the scene data or a prefab instance
+					m_levels.push_back({ Level::ENTITY });
+				}
+				else if (level.type == Level::CHILDREN) {
+					Level child{ Level::ENTITY };
+					child.parent = level.entity;
+					m_levels.push_back(child);
+				}
+				else if (level.type == Level::OVERRIDES) {
+					//one object per entity of the instance, depth first
+					if (level.next < level.instance.size()) {
+						Level overrides{ Level::ENTITY, level.instance[level.next++], true };
+						overrides.overrides = true;
+						m_levels.push_back(overrides);
+					}
+					else {
+						m_filler.BeginSkip();
+					}
+				}
+				else {
+					if (level.pending == Pending::COMPONENT) {
+						//a prefab instance already has most of its components, the overrides are filled over them
+						void* component = level.component->invoker->HasComponent(level.entity)
+							? m_ecs->GetIComponent<ecs::Component*>(level.component->name, level.entity)
+							: level.component->invoker->AddComponent(level.entity);
+						component ? m_filler.BeginObject(level.component->invoker->GetSaxType(), component) : m_filler.BeginSkip();
+					}
+					else if (level.pending == Pending::SCENEDATA) {
+						m_filler.BeginObject(GetSaxType<SceneData>(), &m_sceneData);
+					}
+					else if (level.pending == Pending::SCHEMA_VERSIONS) {
+						level.pending = Pending::NONE;
+						m_levels.push_back({ Level::VERSIONS });
+						return true;
+					}
+					else {
+						m_filler.BeginSkip();
+					}
+					level.pending = Pending::NONE;
+				}
+				return true;
+			}
+
+			bool OnKey(std::string_view name) {
+				Level& level = m_levels.back();
+				level.pending = Pending::NONE;
+				if (level.type == Level::VERSIONS) {
+					m_versionName = name;
+					return true;
+				}
+
+				if (!level.created && !level.sceneData) {
+					if (name == SceneData::classname() && !level.parent.has_value()) {
+						level.sceneData = true;
+						level.pending = Pending::SCENEDATA;
+						return true;
+					}
+					//the versions are beside the scene data, a file without them is checked before its first entity
+					if (!CheckVersions()) return false;
+					if (name == "prefab") {
+						level.pending = Pending::PREFAB;
+						return true;
+					}
+					level.entity = MakeEntity(level);
+					level.created = true;
+				}
+				if (level.sceneData) {
+					if (name == SchemaVersions::KEY) level.pending = Pending::SCHEMA_VERSIONS;
+					return true;
+				}
+
+				if (level.prefab) {
+					if (name == "overrides" && !level.instance.empty()) level.pending = Pending::OVERRIDES;
+					return true;
+				}
+				if (level.overrides) {
+					if (name == "removed") level.pending = Pending::REMOVED;
+				}
+				//only the first of two equal keys is read, as HasMember finds the first
+				else if (name == "children") {
+					if (!level.seenChildren) level.pending = Pending::CHILDREN;
+					level.seenChildren = true;
+					return true;
+				}
+
+				const ComponentEntry* entry = FindComponent(name);
+				if (entry == nullptr) return true;
+				if (!level.seen.test(entry->key)) {
+					level.pending = Pending::COMPONENT;
+					level.component = entry;
+				}
+				level.seen.set(entry->key);
+				return true;
+			}
+
+			bool OnEndObject() {
+				Level& level = m_levels.back();
+				if (level.sceneData) {
+					if (!CheckVersions()) return false;
+					if (!HasEntities(m_sceneName)) m_ecs->AddScene(m_sceneName, m_sceneData);
+					m_sceneData = SceneData{};
+				}
+				else if (!level.created && level.type == Level::ENTITY) {
+					//an empty entry is still an entity
+					MakeEntity(level);
+				}
+				m_levels.pop_back();
+				return true;
+			}
+
+			bool OnStartArray() {
+				if (m_levels.empty()) {
+					m_levels.push_back({ Level::ROOT });
+					return true;
+				}
+
+				Level& level = m_levels.back();
+				if (level.type == Level::ENTITY && level.pending == Pending::CHILDREN) {
+					const ecs::EntityID parent = level.entity;
+					level.pending = Pending::NONE;
+					m_levels.push_back({ Level::CHILDREN, parent, true });
+				}
+				else if (level.type == Level::ENTITY && level.pending == Pending::OVERRIDES) {
+					Level overrides{ Level::OVERRIDES, level.entity, true };
+					overrides.instance = std::move(level.instance);
+					level.pending = Pending::NONE;
+					m_levels.push_back(std::move(overrides));
+				}
+				else if (level.type == Level::ENTITY && level.pending == Pending::REMOVED) {
+					const ecs::EntityID entity = level.entity;
+					level.pending = Pending::NONE;
+					m_levels.push_back({ Level::REMOVED, entity, true });
+				}
+				else {
+					OnValue();
+					m_filler.BeginSkip();
+				}
+				return true;
+			}
+
+			bool OnEndArray() {
+				m_levels.pop_back();
+				return true;
+			}
+
+		private:
+
+			enum class Pending { NONE, COMPONENT, CHILDREN, SCENEDATA, SCHEMA_VERSIONS, PREFAB, OVERRIDES, REMOVED };
+
+			struct ComponentEntry {
+				std::string name;
+				IActionInvoker* invoker{};
+				size_t key{};
+			};
+
+			struct Level {
+				//OVERRIDES: the override objects of an instance, REMOVED: names of components an override removes,
+				//VERSIONS: the schema versions the file was saved at
+				enum Type { ROOT, ENTITY, CHILDREN, OVERRIDES, REMOVED, VERSIONS } type{ ROOT };
+				ecs::EntityID entity{};    //ENTITY, REMOVED: the entity, CHILDREN: their parent
+				bool created{};
+				bool sceneData{};
+				bool seenChildren{};
+				ecs::ComponentSignature seen{};
+				Pending pending{ Pending::NONE };
+				const ComponentEntry* component{};
+				std::optional<ecs::EntityID> parent{};    //of an ENTITY not made yet
+				bool prefab{};                            //ENTITY: a prefab instance
+				bool overrides{};                         //ENTITY: an override object of an instance
+				std::vector<ecs::EntityID> instance{};    //ENTITY of a prefab instance, then its OVERRIDES: the instance's entities
+				size_t next{};                            //OVERRIDES: the entity the next object is for
+			};
+
+			const ComponentEntry* FindComponent(std::string_view name) const {
+				const auto it = m_components.find(HashBytes(name));
+				return it == m_components.end() || it->second.name != name ? nullptr : &it->second;
+			}
+
+			//once, before anything is made: false when a component of the file needs migrating, which streaming cannot do
+			bool CheckVersions() {
+				if (m_versionsChecked) return true;
+				m_versionsChecked = true;
+				m_outdated = !m_versions.IsCurrent(m_migrations);
+				return !m_outdated;
+			}
+
+			ecs::EntityID MakeEntity(const Level& level) {
+				const ecs::EntityID id = m_ecs->CreateEntity(m_sceneName);
+				if (level.parent.has_value()) hierachy::m_SetParent(level.parent.value(), id);
+				return id;
+			}
+
+			ecs::ECS* m_ecs;
+			const SchemaMigrations& m_migrations;
+			SchemaVersions m_versions;
+			std::string m_versionName;    //the key of the version being read
+			bool m_versionsChecked{};
+			bool m_outdated{};
+			std::string m_sceneName;
+			std::unordered_map<uint64_t, ComponentEntry> m_components;  //hash of a component name
+			std::vector<Level> m_levels;
+			SceneData m_sceneData;
+			PrefabTemplates m_prefabs;
+		};
+	}
+
 	void LoadScene(const std::filesystem::path& jsonFilePath, const std::string sceneName)
 	{
-		// Open the JSON file for reading
-		std::ifstream inputFile(jsonFilePath.string());
+		// Scenes may be packed
+		auto* vfs = assetpipeline::VirtualFileSystem::GetInstance();
+		if (!vfs->Exists(jsonFilePath)) {
+			LOGGING_ERROR("Failed to open JSON file for reading: {}", jsonFilePath.string().c_str());
+			return;
+		}
 
-		if (!inputFile) {
+		std::string scenename = sceneName.empty() ? jsonFilePath.filename().string() : sceneName;
+
+		// Only a file loaded into an empty scene describes all of it, see SaveScene
+		auto* ecs = ecs::ECS::GetInstance();
+		const auto sceneIt = ecs->sceneMap.find(scenename);
+		const bool wholeScene = sceneIt == ecs->sceneMap.end() || sceneIt->second.sceneIDs.empty();
+
+		// Prefer the cooked snapshot while it matches this JSON and the running build
+		const std::filesystem::path cookedFilePath = GetCookedScenePath(jsonFilePath);
+		std::string cookedContent;
+		if (vfs->Exists(cookedFilePath) && vfs->ReadFile(cookedFilePath, cookedContent) &&
+			LoadSceneBinary(cookedContent, HashJsonFile(jsonFilePath), scenename)) {
+			LOGGING_INFO("Load Binary Scene Successful");
+		}
+		else if (LoadSceneParallel(jsonFilePath, scenename, GetSceneLoadSettings())) {
+			LOGGING_INFO("Load Json Successful");
+		}
+		else {
+			// Entities are made while the file is read, no document is held
+			SceneSaxHandler handler(scenename, jsonFilePath);
+			if (ParseJsonFile(jsonFilePath, handler)) {
+				LOGGING_INFO("Load Json Successful");
+			}
+			else if (handler.IsOutdated()) {
+				// Saved at older component versions, migrated in a document before it is loaded
+				LOGGING_INFO("Migrating {} to the current component versions", jsonFilePath.string().c_str());
+				LoadSceneDocument(jsonFilePath, scenename);
+			}
+			else {
+				LOGGING_ERROR("Failed to load JSON file: {}", jsonFilePath.string().c_str());
+				return;
+			}
+		}
+
+		if (wholeScene) {
+			TrackLoadedScene(jsonFilePath, scenename);
+		}
+	}
+
+	void LoadSceneDocument(const std::filesystem::path& jsonFilePath, const std::string sceneName)
+	{
+		// Open the JSON file for reading, scenes may be packed
+		std::string fileContent;
+		if (!assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(jsonFilePath, fileContent)) {
 			LOGGING_ERROR("Failed to open JSON file for reading: {}", jsonFilePath.string().c_str());
 			return;
 		}
 
-		std::string fileContent((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
-		inputFile.close();
+		if (IsCompressedJson(fileContent)) {
+			std::string json;
+			if (!DecompressJson(fileContent, json)) {
+				LOGGING_ERROR("Corrupt compressed JSON in {}", jsonFilePath.string().c_str());
+				return;
+			}
+			fileContent = std::move(json);
+		}
 
 		// Parse the JSON content
 		rapidjson::Document doc;
 		doc.Parse(fileContent.c_str());
 
 		std::string scenename = sceneName.empty() ? jsonFilePath.filename().string() : sceneName;
+		if (!doc.IsArray()) {
+			LOGGING_ERROR("Failed to load JSON file: {}", jsonFilePath.string().c_str());
+			return;
+		}
 
-		/*******************INSERT INTO FUNCTION*****************************/
+		// Components saved at older schema versions are brought up to the current ones
+		MigrateSceneDocument(doc, SchemaMigrations::GetInstance());
 
 		// Iterate through each component entry in the JSON array
+		PrefabTemplates prefabs(jsonFilePath);
 		for (rapidjson::SizeType i = 0; i < doc.Size(); i++) {
 			const rapidjson::Value& entityData = doc[i];
 
@@ -98,85 +890,161 @@ namespace Serialization {
 				//load scene data
 				SceneData sceneData;
 				LoadComponentreflect(&sceneData, entityData);
-				ecs::ECS::GetInstance()->AddScene(scenename, sceneData);
+				if (!HasEntities(scenename)) ecs::ECS::GetInstance()->AddScene(scenename, sceneData);
 
 			}
 			else {
-				LoadEntity(entityData, std::nullopt, scenename);
+				LoadEntityRecord(entityData, std::nullopt, scenename, prefabs);
 			}
 		}
 
 		LOGGING_INFO("Load Json Successful");
 	}
 
-	void SaveScene(const std::filesystem::path& scene, const std::filesystem::path& targetFilePath)
+	void SaveScene(const std::filesystem::path& scene, const std::filesystem::path& targetFilePath, const JsonSaveOptions& options)
 	{
 		auto* ecs = ecs::ECS::GetInstance();
-		std::string jsonFilePath = targetFilePath.empty() ? scene.string() : targetFilePath.string();
-		JsonFileValidation(jsonFilePath);
-
-		// Create JSON object to hold the updated values
-		rapidjson::Document doc;
+		const std::filesystem::path jsonFilePath = targetFilePath.empty() ? scene : targetFilePath;
+		const auto sceneName = scene.filename().string();
+		const auto sceneIt = ecs->sceneMap.find(sceneName);
 
-		if (!doc.IsArray()) {
-			doc.SetArray();  // Initialize as an empty array
+		// Roots nothing has been marked dirty under since the last save to this file keep the bytes they were saved as,
+		// without being hashed unless options.verifyCleanRoots asks for it
+		const SceneRecords* previous = options.compress ? nullptr : FindReusableRecords(sceneName, jsonFilePath, options.style);
+		std::unordered_map<ecs::EntityID, SceneRecord> previousRecords;
+		if (previous) {
+			for (size_t i = 0; i < previous->roots.size(); ++i) {
+				previousRecords.emplace(previous->roots[i], previous->records[i + 1]);
+			}
 		}
 
-		rapidjson::Document::AllocatorType& allocator = doc.GetAllocator();
+		// One record per root, in scene order
+		SceneRecords saved;
+		saved.path = jsonFilePath;
+		saved.style = options.style;
+		const std::string_view newline = options.style == JsonStyle::PRETTY ? "\n" : "";
+		std::string content = "[";
+		content += newline;
+		auto append = [&](std::string_view record, uint64_t liveHash) {
+			if (!saved.records.empty()) {
+				content += ',';
+				content += newline;
+			}
+			saved.records.push_back({ content.size(), record.size(), liveHash });
+			content += record;
+		};
+
+		// Values are built in the thread's save arena, emptied after each record is written
+		JsonSaveArena arena;
 
 		//save scene data
-		auto sceneName = scene.filename().string();
 		{
-			
 			SceneData data;
-			if (ecs->sceneMap.find(sceneName) != ecs->sceneMap.end())
+			if (sceneIt != ecs->sceneMap.end())
 			{
-				data = ecs->sceneMap.at(sceneName);
+				data = sceneIt->second;
 			}
 
 			rapidjson::Value sceneData(rapidjson::kObjectType);
-			saveComponentreflect(&data, sceneData, allocator);
-			doc.PushBack(sceneData, allocator);
+			SaveSceneDataRecord(data, data.sceneIDs, sceneData, arena.GetAllocator());
+			append(WriteJson(sceneData, options.style), 0);
+			arena.Reset();
 		}
 
-
-
+		if (sceneIt != ecs->sceneMap.end())
 		{
-			if (ecs->sceneMap.find(sceneName) != ecs->sceneMap.end())
-			{
-				std::unordered_set<ecs::EntityID> savedEntities;  //track saved entities
-				//Start saving the entities
-				std::vector<ecs::EntityID> entities = ecs->sceneMap.find(sceneName)->second.sceneIDs;
-				for (const auto& entityId : entities) {
-					if (!hierachy::GetParent(entityId).has_value()) {
-						SaveEntity(entityId, doc, allocator, savedEntities);
+			std::unordered_set<ecs::EntityID> savedEntities;  //track saved entities
+			const std::unordered_set<ecs::EntityID> dirtyRoots = previous ? GetDirtyRoots() : std::unordered_set<ecs::EntityID>{};
+			//Start saving the entities
+			for (const auto& entityId : GetRootEntities(sceneName)) {
+				const auto record = previousRecords.find(entityId);
+				std::optional<uint64_t> liveHash;
+				if (record != previousRecords.end() && !dirtyRoots.contains(entityId)) {
+					liveHash = options.verifyCleanRoots ? HashLiveSubtree(entityId) : record->second.liveHash;
+					if (liveHash.value() == record->second.liveHash) {
+						append(std::string_view(previous->content).substr(record->second.offset, record->second.size), liveHash.value());
+						saved.roots.push_back(entityId);
+						continue;
 					}
+					LOGGING_WARN("Entity {} changed without being marked dirty, writing it again", entityId);
 				}
+
+				// the hash goes in the record, so a later save that verifies can check it
+				rapidjson::Value records(rapidjson::kArrayType);
+				SaveEntity(entityId, records, arena.GetAllocator(), savedEntities);
+				if (records.Empty()) continue;
+				append(WriteJson(records[0], options.style), liveHash.has_value() ? liveHash.value() : HashLiveSubtree(entityId));
+				arena.Reset();
+				saved.roots.push_back(entityId);
 			}
 		}
+		content += newline;
+		content += "]\n";
+		if (options.compress) {
+			content = CompressJson(content);
+		}
 
+		// Write the JSON back to file, the previous file stays whole until the new one is complete
+		if (!WriteFileAtomic(jsonFilePath, content)) {
+			LOGGING_ERROR("Failed to save scene: {}", jsonFilePath.string().c_str());
+			return;
+		}
 
+		saved.sourceHash = HashSceneSource(content);
+		saved.fileSize = content.size();
+		std::error_code writeTimeError;
+		saved.writeTime = std::filesystem::last_write_time(jsonFilePath, writeTimeError);
+		if (options.compress) {
+			// Record offsets are into the JSON, not the compressed file
+			std::error_code ec;
+			std::filesystem::remove(GetSceneIndexPath(jsonFilePath), ec);
+		}
+		else {
+			WriteSceneIndex(saved);
+		}
 
-		// Write the JSON back to file
-		rapidjson::StringBuffer writeBuffer;
-		rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(writeBuffer);
-		doc.Accept(writer);
+		if (sceneIt != ecs->sceneMap.end()) {
+			for (ecs::EntityID id : sceneIt->second.sceneIDs) {
+				ecs->ClearDirty(id);
+			}
+		}
 
-		std::ofstream outputFile(jsonFilePath);
-		//if file exist
-		if (outputFile) {
-			outputFile << writeBuffer.GetString();
-			outputFile.close();
+		// Cook the snapshot loads prefer, tied to the JSON just written. Prefab instances are cloned from their prefab
+		// as it is when the scene is loaded, so a scene holding any always loads its JSON
+		if (HasPrefabInstances(sceneName)) {
+			std::error_code ec;
+			std::filesystem::remove(GetCookedScenePath(jsonFilePath), ec);
 		}
-		else { //craete new file
-			std::ofstream createFile(jsonFilePath);
-			createFile << writeBuffer.GetString();
-			createFile.close();
+		else {
+			SaveSceneBinary(scene, GetCookedScenePath(jsonFilePath), saved.sourceHash);
+		}
+		if (options.compress) {
+			s_sceneRecords.erase(sceneName);
+		}
+		else {
+			if (!writeTimeError) saved.content = std::move(content);
+			s_sceneRecords[sceneName] = std::move(saved);
 		}
 
 		LOGGING_INFO("Save Json Successful");
 	}
 
+	void SaveSceneDataRecord(SceneData sceneData, const std::vector<ecs::EntityID>& entities, rapidjson::Value& record, rapidjson::Document::AllocatorType& allocator)
+	{
+		auto* ecs = ecs::ECS::GetInstance();
+		saveComponentreflect(&sceneData, record, allocator);
+
+		ecs::ComponentSignature held;
+		for (ecs::EntityID id : entities) {
+			held |= ecs->GetEntitySignature(id);
+		}
+		std::vector<std::string> names{ SceneData::classname() };
+		for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+			if (held.test(key)) names.push_back(componentName);
+		}
+		SchemaVersions::Current(SchemaMigrations::GetInstance(), names).Write(record, allocator);
+	}
+
 	void SaveEntity(ecs::EntityID entityId, rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator, std::unordered_set<ecs::EntityID>& savedEntities) {
 		auto* ecs = ecs::ECS::GetInstance();
 		auto signature = ecs->GetEntitySignature(entityId);
@@ -185,6 +1053,15 @@ namespace Serialization {
 			return;
 		}
 
+		// An instance of a loaded prefab keeps only what it overrides
+		if (IsInstanceRoot(entityId)) {
+			const std::string& prefabName = GetPrefabName(entityId)->prefabName;
+			const std::optional<ecs::EntityID> source = FindLoadedPrefab(prefabName);
+			if (source.has_value() && source.value() != entityId && SavePrefabInstance(entityId, source.value(), prefabName, parentArray, allocator, savedEntities)) {
+				return;
+			}
+		}
+
 		rapidjson::Value entityData(rapidjson::kObjectType);
 
 		
@@ -219,31 +1096,78 @@ namespace Serialization {
 
 	void LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName)
 	{
-		ecs::ECS* ecs = ecs::ECS::GetInstance();
-		ecs::EntityID newEntityId = ecs->CreateEntity(sceneName);
+		PrefabTemplates prefabs("");
+		LoadEntityRecord(entityData, parentID, sceneName, prefabs);
+	}
 
-		const auto& componentKey = ecs->GetComponentKeyData();
-		for (const auto& [ComponentName, key] : componentKey) {
-			if (entityData.HasMember(ComponentName.c_str()) && entityData[ComponentName.c_str()].IsObject()) {
-				auto& actionInvoker = ecs->componentAction[ComponentName];
-				actionInvoker->Load(newEntityId, entityData);
+	void SetPrefabResolver(std::function<bool(const std::string& prefabName)> resolver) {
+		s_prefabResolver = std::move(resolver);
+	}
+
+	std::optional<ecs::EntityID> FindPrefabSource(const std::string& prefabName, const std::filesystem::path& scenePath) {
+		std::optional<ecs::EntityID> source = FindLoadedPrefab(prefabName);
+		if (!source.has_value() && s_prefabsLoading.insert(prefabName).second) {
+			if ((s_prefabResolver && s_prefabResolver(prefabName)) || LoadPrefabNear(prefabName, scenePath)) {
+				source = FindLoadedPrefab(prefabName);
 			}
+			s_prefabsLoading.erase(prefabName);
+		}
 
+		if (source.has_value() && s_prefabBaselines.find(prefabName) == s_prefabBaselines.end()) {
+			s_prefabBaselines[prefabName] = ecs::ECS::GetInstance()->CaptureTemplate(source.value());
 		}
+		return source;
+	}
+
+	bool PropagatePrefab(const std::string& prefabName) {
+		auto* ecs = ecs::ECS::GetInstance();
+		const std::optional<ecs::EntityID> source = FindLoadedPrefab(prefabName);
+		if (!source.has_value()) return false;
 
+		ecs::EntityTemplate current = ecs->CaptureTemplate(source.value());
+		const auto baseline = s_prefabBaselines.find(prefabName);
+		if (baseline == s_prefabBaselines.end() || baseline->second.parents != current.parents) {
+			s_prefabBaselines[prefabName] = std::move(current);
+			return false;
+		}
+		const ecs::EntityTemplate& before = baseline->second;
 
-		//Attach entity to parent
-		if (parentID.has_value()) {
-			hierachy::m_SetParent(parentID.value(), newEntityId);
+		std::vector<ecs::EntityID> roots;
+		for (const auto& [id, signature] : ecs->GetEntitySignatureData()) {
+			if (id != source.value() && IsInstanceRoot(id) && GetPrefabName(id)->prefabName == prefabName) roots.push_back(id);
 		}
 
-		// Load children 
-		if (entityData.HasMember("children") && entityData["children"].IsArray()) {
-			const rapidjson::Value& childrenArray = entityData["children"];
-			for (rapidjson::SizeType i = 0; i < childrenArray.Size(); i++) {
-				LoadEntity(childrenArray[i], newEntityId, sceneName);
+		std::vector<int32_t> parents;
+		for (ecs::EntityID root : roots) {
+			parents.clear();
+			const std::vector<ecs::EntityID> entities = ecs->GetSubtree(root, &parents);
+			//saved whole, see SaveEntity
+			if (parents != current.parents) continue;
+
+			for (uint32_t i = 0; i < entities.size(); ++i) {
+				for (const auto& [ComponentName, key] : ecs->GetComponentKeyData()) {
+					auto& actionInvoker = ecs->componentAction[ComponentName];
+					void* beforeRow = FindTemplateRow(before, ComponentName, i);
+					void* afterRow = FindTemplateRow(current, ComponentName, i);
+					const bool has = actionInvoker->HasComponent(entities[i]);
+
+					if (beforeRow && afterRow && has) {
+						actionInvoker->Rebase(ecs->GetIComponent<ecs::Component*>(ComponentName, entities[i]), beforeRow, afterRow);
+					}
+					else if (!beforeRow && afterRow && !has) {
+						//every member of a component the prefab gained is at its value before, the default
+						void* component = actionInvoker->AddComponent(entities[i]);
+						actionInvoker->Rebase(component, component, afterRow);
+					}
+					else if (beforeRow && !afterRow && has) {
+						actionInvoker->RemoveComponent(entities[i]);
+					}
+				}
 			}
 		}
+
+		s_prefabBaselines[prefabName] = std::move(current);
+		return true;
 	}
 
 }
@@ -18,106 +18,152 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <RAPIDJSON/document.h>
 #include <RAPIDJSON/writer.h>
 #include <RAPIDJSON/stringbuffer.h>
+#include <RAPIDJSON/reader.h>
+#include <RAPIDJSON/filereadstream.h>
+#include <RAPIDJSON/error/en.h>
 
 #include "ECS/ECSList.h"
+#include "Scene/SceneData.h"
 #include "SerializationReflection.h"
+#include "SaxSerializationReflection.h"
+#include "binary_handler.h"
+#include "json_writer.h"
+#include "schema_migration.h"
+#include "parallel_loader.h"
+#include "AssetPipeline/VirtualFileSystem.h"
 
 namespace Serialization {
+		//loads the scene through LoadSceneParallel as GetSceneLoadSettings says, or streams it, entities and components
+		//made as the JSON is parsed. A scene saved at older component schema versions is loaded through
+		//LoadSceneDocument, which migrates it first
 		void LoadScene(const std::filesystem::path& jsonFilePath, const std::string sceneName = "");
-		void SaveScene(const std::filesystem::path& filePath, const std::filesystem::path& targetFilePath = "");
-
+		//the same through a whole RapidJSON document, the reference LoadScene is tested against. The document is
+		//migrated to the current schema versions before it is loaded
+		void LoadSceneDocument(const std::filesystem::path& jsonFilePath, const std::string sceneName = "");
+		//one record per root entity, written to a temporary file and renamed over the old one. When the file still holds
+		//what the scene was last loaded from or saved as, in the same style, roots with no dirty entity under them whose
+		//components still build the record they were saved as keep their bytes. Compressed saves are always written whole
+		void SaveScene(const std::filesystem::path& filePath, const std::filesystem::path& targetFilePath = "", const JsonSaveOptions& options = {});
+		//the first record of a scene or prefab file: its SceneData and the schema version of every component "entities" hold
+		void SaveSceneDataRecord(SceneData sceneData, const std::vector<ecs::EntityID>& entities, rapidjson::Value& record, rapidjson::Document::AllocatorType& allocator);
+		//"level.json" keeps where each of its records starts in "level.json.idx"
+		std::filesystem::path GetSceneIndexPath(const std::filesystem::path& scenePath);
+
+		//the root of an instance of a loaded prefab is saved as {"prefab": name, "overrides": [...]}, one object per entity of the
+		//prefab, depth first, holding the members that differ from the prefab and the "removed" components. Instances whose
+		//children no longer line up with the prefab's are saved whole
 		void SaveEntity(ecs::EntityID entityId, rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator, std::unordered_set<ecs::EntityID>& savedEntities);
+		//a prefab instance clones the prefab as it is now and loads its overrides over it
 		void LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName);
 
+		//loads a prefab that is not loaded yet as a scene of its own, true when it did. Without one, prefabs are
+		//looked for next to the scene being loaded and in the "Prefabs" folder beside it
+		void SetPrefabResolver(std::function<bool(const std::string& prefabName)> resolver);
+		//the root of the loaded prefab "prefabName", loading it if needed. The first time a prefab is found it is
+		//remembered as what its instances were made from, for PropagatePrefab
+		std::optional<ecs::EntityID> FindPrefabSource(const std::string& prefabName, const std::filesystem::path& scenePath = "");
+		//every member an instance still has at the prefab's previous value takes the prefab's value now, false with
+		//nothing changed when the prefab gained or lost entities since, or was never found before
+		bool PropagatePrefab(const std::string& prefabName);
+
 		void JsonFileValidation(const std::string& filePath);
 
 
+		//runs the file through a SAX handler, loose files are read through a fixed buffer and packed or compressed ones from memory
+		template <typename Handler>
+		bool ParseJsonFile(const std::filesystem::path& filepath, Handler& handler)
+		{
+			auto* vfs = assetpipeline::VirtualFileSystem::GetInstance();
+			rapidjson::Reader reader;
+			rapidjson::ParseResult result;
+
+			std::FILE* file = nullptr;
+			if (!vfs->IsPacked(filepath)) {
+				file = std::fopen(filepath.string().c_str(), "rb");
+				if (file == nullptr) return false;
+				char magic[sizeof(JSON_LZ4_MAGIC)];
+				const size_t read = std::fread(magic, 1, sizeof(magic), file);
+				std::rewind(file);
+				if (IsCompressedJson({ magic, read })) {
+					std::fclose(file);
+					file = nullptr;
+				}
+			}
+
+			if (file != nullptr) {
+				char buffer[65536];
+				rapidjson::FileReadStream stream(file, buffer, sizeof(buffer));
+				result = reader.Parse(stream, handler);
+				std::fclose(file);
+			}
+			else {
+				std::string fileContent;
+				if (!vfs->ReadFile(filepath, fileContent)) return false;
+				if (IsCompressedJson(fileContent)) {
+					std::string json;
+					if (!DecompressJson(fileContent, json)) {
+						LOGGING_ERROR("Corrupt compressed JSON in {}", filepath.string().c_str());
+						return false;
+					}
+					fileContent = std::move(json);
+				}
+				rapidjson::StringStream stream(fileContent.c_str());
+				result = reader.Parse(stream, handler);
+			}
+
+			if (result.IsError()) {
+				//a handler stopping the parse says why itself
+				if (result.Code() != rapidjson::kParseErrorTermination) LOGGING_ERROR("JSON parse error in {} at offset {}: {}", filepath.string().c_str(), result.Offset(), rapidjson::GetParseError_En(result.Code()));
+				return false;
+			}
+			return true;
+		}
+
 		template <typename T>
 		T ReadJsonFile(const std::string& filepath)
 		{
-			std::ifstream inputFile(filepath);
-
-			if (!inputFile) {
+			if (!assetpipeline::VirtualFileSystem::GetInstance()->Exists(filepath)) {
 				LOGGING_WARN("Failed to open JSON file for reading: {}", filepath.c_str());
 				throw std::runtime_error("Failed to open JSON file: " + filepath);
 			}
 
-			std::string fileContent((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
-			inputFile.close();
-
-			// Parse the JSON content
-			rapidjson::Document doc;
-			doc.Parse(fileContent.c_str());
-
-			T data;
-
-			for (rapidjson::SizeType i = 0; i < doc.Size(); i++) {
-				const rapidjson::Value& entry = doc[i];
-
-				if (entry.HasMember(T::classname())) {
-					LoadComponentreflect(&data, entry);
-				}
-				
-
-			}
+			// a damaged file keeps what was read before the error
+			ComponentSaxHandler<T> handler;
+			ParseJsonFile(filepath, handler);
 
-			return data;
+			return handler.GetData();
 		}
 
 		template <typename T>
 		bool WriteJsonFile(const std::string& filepath, T* object, bool update = false) {
-			Serialization::JsonFileValidation(filepath);
-
-			rapidjson::Document doc;
-
+			JsonSaveArena arena;
+			rapidjson::Value entityData(rapidjson::kObjectType);
+			saveComponentreflect(object, entityData, arena.GetAllocator());
 
+			std::string content = "[";
 			if (update) {
-				std::ifstream inputFile(filepath);
-
-				if (!inputFile) {
-					LOGGING_ERROR("Failed to open JSON file for reading: {}", filepath.c_str());
-					return false;
-				}
-
-				std::string fileContent((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
-				inputFile.close();
-
-				doc.Parse(fileContent.c_str());
-
-				// Remove existing entries with the same component name
-				for (rapidjson::SizeType i = doc.Size(); i > 0; --i) {
-					auto& obj = doc[i - 1];
-					if (obj.HasMember(T::classname())) {
-						doc.Erase(doc.Begin() + (i - 1));
+				std::ifstream inputFile(filepath, std::ios::binary);
+				if (inputFile) {
+					std::string fileContent((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+
+					// Other entries are copied as they are, only the entries with the same component name are replaced
+					rapidjson::StringStream stream(fileContent.c_str());
+					EntryRangeHandler<rapidjson::StringStream> handler(stream, T::classname());
+					rapidjson::Reader reader;
+					if (!reader.Parse(stream, handler).IsError()) {
+						for (const auto& entry : handler.GetEntries()) {
+							if (entry.hasKey) continue;
+							content.append(fileContent, entry.begin, entry.end - entry.begin);
+							content += ',';
+						}
 					}
 				}
 			}
-
-
-			if (!doc.IsArray()) {
-				doc.SetArray();  // Initialize as an empty array
-			}
-
-
-
-			rapidjson::Document::AllocatorType& allocator = doc.GetAllocator();
-			rapidjson::Value entityData(rapidjson::kObjectType);
-
-
-
-			saveComponentreflect(object, entityData, allocator);
-
-			doc.PushBack(entityData, allocator);
+			content += WriteJson(entityData, JsonStyle::COMPACT);
+			content += ']';
 
 			// Write to file
-			rapidjson::StringBuffer buffer;
-			rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-			doc.Accept(writer);
-
-			std::ofstream ofs(filepath);
-			ofs << buffer.GetString();
-
-			return true;
+			return WriteFileAtomic(filepath, content);
 		}
 }
 
@@ -0,0 +1,219 @@
+/******************************************************************/
+/*!
+\file      json_writer.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Compact and pretty JSON output, the per thread save buffers
+		   and LZ4 compressed JSON files.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "json_writer.h"
+
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <RAPIDJSON/prettywriter.h>
+
+#include "AssetPipeline/LZ4.h"
+
+namespace Serialization {
+
+	namespace {
+
+		constexpr size_t FIRST_CHUNK_SIZE = 64 * 1024;
+
+		struct JsonPool {
+			std::unique_ptr<char[]> chunk;   //first chunk of the allocator, never freed by it
+			size_t chunkSize{};
+			size_t chunkCapacity{};          //what the allocator can hand out before it mallocs
+			std::optional<rapidjson::Document::AllocatorType> allocator;
+			rapidjson::StringBuffer buffer;
+			int arenas{};
+		};
+
+		thread_local JsonPool t_pool;
+
+		//empties the allocator, growing its first chunk to everything the last save took
+		void Recycle(JsonPool& pool) {
+			const size_t used = pool.allocator ? pool.allocator->Capacity() : 0;
+			if (pool.allocator && used <= pool.chunkCapacity) {
+				pool.allocator->Clear();
+				return;
+			}
+
+			pool.allocator.reset();
+			pool.chunkSize = std::max(FIRST_CHUNK_SIZE, used + used / 4);
+			pool.chunk = std::make_unique<char[]>(pool.chunkSize);
+			pool.allocator.emplace(pool.chunk.get(), pool.chunkSize);
+			pool.chunkCapacity = pool.allocator->Capacity();
+		}
+	}
+
+	size_t WriteShortestFloat(float value, char* text, size_t size) {
+		if (size < 3) return 0;
+		const auto [end, error] = std::to_chars(text, text + size - 2, value);
+		if (error != std::errc{}) return 0;
+
+		size_t length = static_cast<size_t>(end - text);
+		if (std::none_of(text, end, [](char c) { return c == '.' || c == 'e'; })) {
+			text[length++] = '.';
+			text[length++] = '0';
+		}
+
+		//loaders read the digits as a double and narrow it, which must land on the same float
+		double readBack{};
+		if (std::from_chars(text, text + length, readBack).ec != std::errc{} || static_cast<float>(readBack) != value) {
+			return 0;
+		}
+		return length;
+	}
+
+	JsonSaveArena::JsonSaveArena() : m_outermost(t_pool.arenas++ == 0) {
+		if (!t_pool.allocator) Recycle(t_pool);
+	}
+
+	JsonSaveArena::~JsonSaveArena() {
+		--t_pool.arenas;
+		Reset();
+	}
+
+	rapidjson::Document::AllocatorType& JsonSaveArena::GetAllocator() {
+		return *t_pool.allocator;
+	}
+
+	void JsonSaveArena::Reset() {
+		if (m_outermost) Recycle(t_pool);
+	}
+
+	std::string_view WriteJson(const rapidjson::Value& value, JsonStyle style) {
+		rapidjson::StringBuffer& buffer = t_pool.buffer;
+		buffer.Clear();
+		if (style == JsonStyle::COMPACT) {
+			CompactWriter<rapidjson::StringBuffer> writer(buffer);
+			value.Accept(writer);
+		}
+		else {
+			rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+			value.Accept(writer);
+		}
+		return { buffer.GetString(), buffer.GetSize() };
+	}
+
+	namespace {
+
+		std::atomic<size_t> s_writeCut{ SIZE_MAX };
+
+		//writes "data" to a new file and flushes it to the disk, so the rename never publishes a file the OS still holds
+		bool WriteFileDurable(const std::filesystem::path& path, std::string_view data) {
+#ifdef _WIN32
+			const int file = _wopen(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+			const int file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+			if (file < 0) return false;
+
+			const size_t cut = s_writeCut.load(std::memory_order_relaxed);
+			const std::string_view written = data.substr(0, std::min(cut, data.size()));
+			bool ok = true;
+			for (size_t offset = 0; ok && offset < written.size();) {
+				constexpr size_t MAX_WRITE = 1u << 30;
+				const size_t size = std::min(written.size() - offset, MAX_WRITE);
+#ifdef _WIN32
+				const int result = _write(file, written.data() + offset, static_cast<unsigned int>(size));
+#else
+				const ssize_t result = ::write(file, written.data() + offset, size);
+				if (result < 0 && errno == EINTR) continue;
+#endif
+				ok = result > 0;
+				if (ok) offset += static_cast<size_t>(result);
+			}
+#ifdef _WIN32
+			ok = ok && _commit(file) == 0;   //FlushFileBuffers on the file's handle
+			ok = _close(file) == 0 && ok;
+#else
+			ok = ok && ::fsync(file) == 0;
+			ok = ::close(file) == 0 && ok;
+#endif
+			//a cut write stops here, as a save killed before the rename would
+			return ok && cut == SIZE_MAX;
+		}
+
+		//the new name lives in the directory, which POSIX flushes apart from the file
+		void FlushDirectory([[maybe_unused]] const std::filesystem::path& path) {
+#ifndef _WIN32
+			std::filesystem::path directory = path.parent_path();
+			if (directory.empty()) directory = ".";
+			const int file = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+			if (file < 0) return;
+			::fsync(file);
+			::close(file);
+#endif
+		}
+	}
+
+	bool WriteFileAtomic(const std::filesystem::path& path, std::string_view data) {
+		std::filesystem::path temporary = path;
+		temporary += ".tmp";
+
+		if (!WriteFileDurable(temporary, data)) {
+			if (s_writeCut.load(std::memory_order_relaxed) == SIZE_MAX) {
+				std::error_code ec;
+				std::filesystem::remove(temporary, ec);
+			}
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temporary, path, ec);
+		if (ec) {
+			LOGGING_ERROR("Cannot replace {}: {}", path.string().c_str(), ec.message().c_str());
+			std::filesystem::remove(temporary, ec);
+			return false;
+		}
+		FlushDirectory(path);
+		return true;
+	}
+
+	void SetWriteFileCut(std::optional<size_t> bytes) {
+		s_writeCut.store(bytes.value_or(SIZE_MAX), std::memory_order_relaxed);
+	}
+
+	bool IsCompressedJson(std::string_view data) {
+		return data.size() >= sizeof(JSON_LZ4_MAGIC) && std::memcmp(data.data(), JSON_LZ4_MAGIC, sizeof(JSON_LZ4_MAGIC)) == 0;
+	}
+
+	std::string CompressJson(std::string_view json) {
+		const uint64_t size = json.size();
+		std::string data(JSON_LZ4_MAGIC, sizeof(JSON_LZ4_MAGIC));
+		data.append(reinterpret_cast<const char*>(&size), sizeof(size));
+		data += assetpipeline::LZ4Compress(json);
+		return data;
+	}
+
+	bool DecompressJson(std::string_view data, std::string& json) {
+		constexpr size_t HEADER_SIZE = sizeof(JSON_LZ4_MAGIC) + sizeof(uint64_t);
+		if (!IsCompressedJson(data) || data.size() < HEADER_SIZE) return false;
+
+		uint64_t size{};
+		std::memcpy(&size, data.data() + sizeof(JSON_LZ4_MAGIC), sizeof(size));
+		//LZ4 expands a byte to at most 255
+		if (size > (data.size() - HEADER_SIZE) * 255 + 16) return false;
+
+		json.assign(static_cast<size_t>(size), '\0');
+		return assetpipeline::LZ4Decompress(data.substr(HEADER_SIZE), json.data(), json.size());
+	}
+}
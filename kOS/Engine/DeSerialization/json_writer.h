@@ -0,0 +1,119 @@
+/******************************************************************/
+/*!
+\file      json_writer.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     How JSON is written out, for files people open and for files
+		   only the game reads back.
+
+		   PRETTY is indented, the format scenes are authored and merged
+		   in. COMPACT has no whitespace and writes every number that is
+		   exactly a float, which all reflected reals are, in the fewest
+		   digits that read back as the same float, instead of the
+		   seventeen a double needs. Either may be LZ4 compressed,
+		   ParseJsonFile tells the two apart by JSON_LZ4_MAGIC.
+
+		   Values built for a save take their memory from a JsonSaveArena
+		   and are written into a buffer kept by each thread, so saves
+		   after the first do not allocate.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+#include <RAPIDJSON/document.h>
+#include <RAPIDJSON/writer.h>
+#include <RAPIDJSON/stringbuffer.h>
+
+namespace Serialization {
+
+	enum class JsonStyle : uint32_t {
+		PRETTY,
+		COMPACT
+	};
+
+	struct JsonSaveOptions {
+		JsonStyle style = JsonStyle::PRETTY;
+		bool compress = false;   //LZ4, whole files only
+		//hash the roots nothing marked dirty and write them again if they changed anyway, finds an edit that missed
+		//MarkDirty at the cost of hashing the whole scene
+		bool verifyCleanRoots = false;
+	};
+
+	//saves the game makes of itself while running, never edited by hand
+	constexpr JsonSaveOptions RUNTIME_SAVE{ JsonStyle::COMPACT, true };
+
+	//a compressed file is the magic, the size of the JSON as a little endian uint64 and an LZ4 block of the JSON
+	constexpr char JSON_LZ4_MAGIC[4] = { 'K', 'O', 'S', 'Z' };
+
+	//writes "value" as a float in the fewest digits that read back as it, always with a "." or an exponent so it
+	//does not read back as an integer. 0 when it cannot be written that way
+	size_t WriteShortestFloat(float value, char* text, size_t size);
+
+	//RapidJSON Writer that writes numbers which are exactly a float with WriteShortestFloat
+	template <typename OutputStream>
+	class CompactWriter : public rapidjson::Writer<OutputStream> {
+		using Base = rapidjson::Writer<OutputStream>;
+	public:
+		using Base::Base;
+
+		bool Double(double value) {
+			const float single = static_cast<float>(value);
+			//beyond the largest float the loaders accept the shortest digits may round past it
+			if (!std::isfinite(value) || static_cast<double>(single) != value || std::abs(value) >= 3.4028234e38) {
+				return Base::Double(value);
+			}
+
+			char text[32];
+			const size_t length = WriteShortestFloat(single, text, sizeof(text));
+			return length ? Base::RawValue(text, length, rapidjson::kNumberType) : Base::Double(value);
+		}
+	};
+
+	/******************************************************************/
+	/*!
+	\class   JsonSaveArena
+	\brief   The allocator values of one save are built with. It belongs
+			 to the thread, when the outermost arena ends or resets its
+			 memory is kept for the next save, grown to what this one
+			 needed. Values built with it must not outlive it or a Reset.
+	*/
+	/******************************************************************/
+	class JsonSaveArena {
+	public:
+		JsonSaveArena();
+		~JsonSaveArena();
+		JsonSaveArena(const JsonSaveArena&) = delete;
+		JsonSaveArena& operator=(const JsonSaveArena&) = delete;
+
+		rapidjson::Document::AllocatorType& GetAllocator();
+
+		//frees every value built so far, only the outermost arena of a thread does
+		void Reset();
+
+	private:
+		bool m_outermost;
+	};
+
+	//writes "value" into the thread's buffer, the text is valid until the next WriteJson on the thread
+	std::string_view WriteJson(const rapidjson::Value& value, JsonStyle style);
+
+	//writes "data" to "<path>.tmp", flushes it to the disk and renames it over "path", so a save cut short, or a power
+	//loss after it, leaves the previous file whole
+	bool WriteFileAtomic(const std::filesystem::path& path, std::string_view data);
+
+	//for tests: until reset, WriteFileAtomic stops after "bytes" of the temporary file and fails before the rename, as
+	//a save killed mid write would
+	void SetWriteFileCut(std::optional<size_t> bytes);
+
+	bool IsCompressedJson(std::string_view data);
+	std::string CompressJson(std::string_view json);
+	//false if "data" is not a whole compressed file
+	bool DecompressJson(std::string_view data, std::string& json);
+}
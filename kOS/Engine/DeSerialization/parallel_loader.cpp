@@ -0,0 +1,446 @@
+/******************************************************************/
+/*!
+\file      parallel_loader.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Two phase JSON scene loading: records are staged on worker
+		   threads, then committed to the ECS on the calling thread.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "parallel_loader.h"
+#include "json_handler.h"
+
+#include "ECS/ECS.h"
+#include "ECS/Hierachy.h"
+
+namespace Serialization {
+
+	namespace {
+
+		SceneLoadSettings s_settings;
+
+		//where a top level record sits in the file
+		struct RecordRange {
+			size_t begin{};
+			size_t end{};
+		};
+
+		bool IsJsonSpace(char c) {
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+		}
+
+		//the byte range of every record of a file that is one array of objects, false for anything else. Only the
+		//brackets are followed, the workers' parse finds anything else wrong with a record
+		bool SplitRecords(std::string_view json, std::vector<RecordRange>& records) {
+			const size_t size = json.size();
+			size_t i = 0;
+			auto skipSpace = [&]() { while (i < size && IsJsonSpace(json[i])) ++i; };
+
+			skipSpace();
+			if (i == size || json[i] != '[') return false;
+			++i;
+
+			bool expectRecord = false;  //after a comma
+			for (;;) {
+				skipSpace();
+				if (i == size) return false;
+				if (json[i] == ']' && !expectRecord) {
+					++i;
+					break;
+				}
+				if (!records.empty() && !expectRecord) {
+					if (json[i] != ',') return false;
+					++i;
+					expectRecord = true;
+					continue;
+				}
+				if (json[i] != '{') return false;
+
+				const size_t begin = i;
+				size_t depth = 0;
+				for (; i < size; ++i) {
+					const char c = json[i];
+					if (c == '"') {
+						for (++i; i < size && json[i] != '"'; ++i) {
+							if (json[i] == '\\') ++i;
+						}
+						if (i >= size) return false;
+					}
+					else if (c == '{' || c == '[') {
+						++depth;
+					}
+					else if ((c == '}' || c == ']') && --depth == 0) {
+						break;
+					}
+				}
+				if (i == size) return false;
+				records.push_back({ begin, ++i });
+				expectRecord = false;
+			}
+
+			//the reader does not accept anything after the array either
+			skipSpace();
+			return i == size;
+		}
+
+		unsigned int WorkerCount(const SceneLoadSettings& settings, size_t bytes, size_t records) {
+			const unsigned int threads = settings.threadCount ? settings.threadCount : std::max(1u, std::thread::hardware_concurrency());
+			const size_t ranges = std::max<size_t>(1, bytes / std::max<size_t>(1, settings.minBytesPerThread));
+			return static_cast<unsigned int>(std::min({ static_cast<size_t>(threads), ranges, records }));
+		}
+
+		struct ComponentEntry {
+			std::string name;
+			IActionInvoker* invoker{};
+			size_t key{};
+		};
+
+		//one step of the load as the streaming loader takes it, replayed in order by the commit
+		struct StagedOp {
+			static constexpr uint32_t CREATE = std::numeric_limits<uint32_t>::max();
+			static constexpr uint32_t SCENE_DATA = CREATE - 1;
+
+			uint32_t column{ CREATE };  //the key of the component filled, or CREATE or SCENE_DATA
+			uint32_t entity{};          //index of the entity among those of the range
+			uint32_t row{};             //of the column, or of the range's scene data
+			int32_t parent{ -1 };       //CREATE: index of the parent in the range, -1 for a root
+		};
+
+		struct StagedSceneData {
+			SceneData data;
+			SchemaVersions versions;
+		};
+
+		//what a worker made of its range of records
+		struct StagedRange {
+			std::vector<StagedOp> ops;
+			std::vector<std::shared_ptr<void>> columns;  //rows of each component, by key
+			std::vector<uint32_t> rowCounts;
+			std::vector<StagedSceneData> sceneData;
+			uint32_t entityCount{};
+			bool staged{};
+		};
+
+		//fills a StagedRange as SceneSaxHandler would fill the ECS, one record parsed at a time. Prefab instances
+		//stop it, they clone entities only the calling thread may read
+		class StagingSaxHandler : public SaxHandler<StagingSaxHandler> {
+		public:
+
+			StagingSaxHandler(const std::unordered_map<uint64_t, ComponentEntry>& components, StagedRange& range)
+				: m_components(components), m_range(range) {
+				m_levels.push_back({ Level::ROOT });
+			}
+
+			bool OnValue() {
+				m_levels.back().pending = Pending::NONE;
+				return true;
+			}
+
+			bool OnUint(unsigned value) {
+				if (m_levels.back().type == Level::VERSIONS) m_versions.Set(m_versionName, value);
+				return OnValue();
+			}
+
+			bool OnStartObject() {
+				Level& level = m_levels.back();
+				if (level.type == Level::ROOT) {
+					m_levels.push_back({ Level::ENTITY });
+				}
+				else if (level.type == Level::CHILDREN) {
+					Level child{ Level::ENTITY };
+					child.parent = static_cast<int32_t>(level.entity);
+					m_levels.push_back(child);
+				}
+				else {
+					if (level.pending == Pending::COMPONENT) {
+						const size_t key = level.component->key;
+						std::shared_ptr<void>& rows = m_range.columns[key];
+						if (!rows) rows = level.component->invoker->CreateRows();
+						m_range.ops.push_back({ static_cast<uint32_t>(key), level.entity, m_range.rowCounts[key]++ });
+						m_filler.BeginObject(level.component->invoker->GetSaxType(), level.component->invoker->AddRow(rows.get()));
+					}
+					else if (level.pending == Pending::SCENEDATA) {
+						m_filler.BeginObject(GetSaxType<SceneData>(), &m_sceneData);
+					}
+					else if (level.pending == Pending::SCHEMA_VERSIONS) {
+						level.pending = Pending::NONE;
+						m_levels.push_back({ Level::VERSIONS });
+						return true;
+					}
+					else {
+						m_filler.BeginSkip();
+					}
+					level.pending = Pending::NONE;
+				}
+				return true;
+			}
+
+			bool OnKey(std::string_view name) {
+				Level& level = m_levels.back();
+				level.pending = Pending::NONE;
+				if (level.type == Level::VERSIONS) {
+					m_versionName = name;
+					return true;
+				}
+
+				if (!level.created && !level.sceneData) {
+					if (name == SceneData::classname() && level.parent < 0) {
+						level.sceneData = true;
+						level.pending = Pending::SCENEDATA;
+						return true;
+					}
+					if (name == "prefab") return false;
+					MakeEntity(level);
+				}
+				if (level.sceneData) {
+					if (name == SchemaVersions::KEY) level.pending = Pending::SCHEMA_VERSIONS;
+					return true;
+				}
+
+				if (name == "children") {
+					if (!level.seenChildren) level.pending = Pending::CHILDREN;
+					level.seenChildren = true;
+					return true;
+				}
+
+				const auto it = m_components.find(HashBytes(name));
+				if (it == m_components.end() || it->second.name != name) return true;
+				const ComponentEntry* entry = &it->second;
+				if (!level.seen.test(entry->key)) {
+					level.pending = Pending::COMPONENT;
+					level.component = entry;
+				}
+				level.seen.set(entry->key);
+				return true;
+			}
+
+			bool OnEndObject() {
+				Level& level = m_levels.back();
+				if (level.sceneData) {
+					m_range.ops.push_back({ StagedOp::SCENE_DATA, 0, static_cast<uint32_t>(m_range.sceneData.size()) });
+					m_range.sceneData.push_back({ std::move(m_sceneData), std::move(m_versions) });
+					m_sceneData = SceneData{};
+					m_versions = SchemaVersions{};
+				}
+				else if (!level.created && level.type == Level::ENTITY) {
+					MakeEntity(level);
+				}
+				m_levels.pop_back();
+				return true;
+			}
+
+			bool OnStartArray() {
+				Level& level = m_levels.back();
+				if (level.type == Level::ENTITY && level.pending == Pending::CHILDREN) {
+					Level children{ Level::CHILDREN };
+					children.entity = level.entity;
+					level.pending = Pending::NONE;
+					m_levels.push_back(children);
+				}
+				else {
+					OnValue();
+					m_filler.BeginSkip();
+				}
+				return true;
+			}
+
+			bool OnEndArray() {
+				m_levels.pop_back();
+				return true;
+			}
+
+		private:
+
+			enum class Pending { NONE, COMPONENT, CHILDREN, SCENEDATA, SCHEMA_VERSIONS };
+
+			struct Level {
+				enum Type { ROOT, ENTITY, CHILDREN, VERSIONS } type{ ROOT };
+				uint32_t entity{};    //ENTITY: the entity, CHILDREN: their parent
+				bool created{};
+				bool sceneData{};
+				bool seenChildren{};
+				ecs::ComponentSignature seen{};
+				Pending pending{ Pending::NONE };
+				const ComponentEntry* component{};
+				int32_t parent{ -1 };  //of an ENTITY
+			};
+
+			void MakeEntity(Level& level) {
+				level.entity = m_range.entityCount++;
+				level.created = true;
+				StagedOp op;
+				op.entity = level.entity;
+				op.parent = level.parent;
+				m_range.ops.push_back(op);
+			}
+
+			const std::unordered_map<uint64_t, ComponentEntry>& m_components;
+			StagedRange& m_range;
+			std::vector<Level> m_levels;
+			SceneData m_sceneData;
+			SchemaVersions m_versions;
+			std::string m_versionName;
+		};
+
+		//phase one: the records of one range into "range", on a worker thread
+		void StageRecords(std::string_view json, const RecordRange* begin, const RecordRange* end,
+			const std::unordered_map<uint64_t, ComponentEntry>& components, size_t keyCount, StagedRange& range) {
+			range.columns.resize(keyCount);
+			range.rowCounts.resize(keyCount);
+
+			StagingSaxHandler handler(components, range);
+			rapidjson::Reader reader;
+			for (const RecordRange* record = begin; record != end; ++record) {
+				//SplitRecords found the '}' the record ends at, the reader stops there
+				rapidjson::StringStream stream(json.data() + record->begin);
+				if (reader.Parse<rapidjson::kParseDefaultFlags | rapidjson::kParseStopWhenDoneFlag>(stream, handler).IsError()) return;
+			}
+			range.staged = true;
+		}
+
+		//the whole file, decompressed
+		bool ReadSceneJson(const std::filesystem::path& jsonFilePath, std::string& json) {
+			if (!assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(jsonFilePath, json)) return false;
+			if (IsCompressedJson(json)) {
+				std::string decompressed;
+				if (!DecompressJson(json, decompressed)) return false;
+				json = std::move(decompressed);
+			}
+			return true;
+		}
+	}
+
+	//the ranges of a file in order and how far the commit has got through them
+	struct StagedScene {
+		std::vector<StagedRange> ranges;
+		std::vector<IActionInvoker*> invokers;  //by component key
+		size_t range{};
+		size_t op{};
+		std::vector<ecs::EntityID> entities;    //made so far of the range being committed
+	};
+
+	namespace {
+
+		//phase one for a whole file, its records split among "workers" threads
+		std::shared_ptr<StagedScene> StageFile(std::string_view json, const std::vector<RecordRange>& records, unsigned int workers) {
+			auto* ecs = ecs::ECS::GetInstance();
+			auto scene = std::make_shared<StagedScene>();
+			std::unordered_map<uint64_t, ComponentEntry> components;
+			for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+				IActionInvoker* invoker = ecs->componentAction.at(componentName).get();
+				components.emplace(HashBytes(componentName), ComponentEntry{ componentName, invoker, key });
+				if (scene->invokers.size() <= key) scene->invokers.resize(key + 1);
+				scene->invokers[key] = invoker;
+			}
+
+			//contiguous ranges of records holding about as many bytes each, the calling thread takes the last one
+			std::vector<size_t> splits{ 0 };
+			for (unsigned int w = 1; w < workers; ++w) {
+				const size_t target = json.size() * w / workers;
+				size_t split = splits.back();
+				while (split < records.size() && records[split].end <= target) ++split;
+				splits.push_back(split);
+			}
+			splits.push_back(records.size());
+
+			std::vector<StagedRange>& ranges = scene->ranges;
+			ranges.resize(workers);
+			auto stage = [&](unsigned int w) {
+				StageRecords(json, records.data() + splits[w], records.data() + splits[w + 1], components, scene->invokers.size(), ranges[w]);
+			};
+			std::vector<std::thread> threads;
+			threads.reserve(workers - 1);
+			for (unsigned int w = 0; w + 1 < workers; ++w) {
+				threads.emplace_back(stage, w);
+			}
+			stage(workers - 1);
+			for (std::thread& thread : threads) thread.join();
+
+			if (!std::all_of(ranges.begin(), ranges.end(), [](const StagedRange& range) { return range.staged; })) return nullptr;
+
+			//the streaming loader checks the versions beside the scene data when the file starts with it, and before its
+			//first entity otherwise
+			const auto first = std::find_if(ranges.begin(), ranges.end(), [](const StagedRange& range) { return !range.ops.empty(); });
+			const bool leadingSceneData = first != ranges.end() && first->ops.front().column == StagedOp::SCENE_DATA;
+			const SchemaVersions versions = leadingSceneData ? first->sceneData.front().versions : SchemaVersions{};
+			if (!versions.IsCurrent(SchemaMigrations::GetInstance())) return nullptr;
+
+			return scene;
+		}
+	}
+
+	void SetSceneLoadSettings(const SceneLoadSettings& settings) {
+		s_settings = settings;
+	}
+
+	const SceneLoadSettings& GetSceneLoadSettings() {
+		return s_settings;
+	}
+
+	bool LoadSceneParallel(const std::filesystem::path& jsonFilePath, const std::string& sceneName, const SceneLoadSettings& settings) {
+		if (settings.threadCount == 1) return false;
+
+		std::string json;
+		if (!ReadSceneJson(jsonFilePath, json)) return false;
+		std::vector<RecordRange> records;
+		if (!SplitRecords(json, records)) return false;
+		const unsigned int workers = WorkerCount(settings, json.size(), records.size());
+		if (workers <= 1) return false;
+
+		const std::shared_ptr<StagedScene> scene = StageFile(json, records, workers);
+		if (!scene) return false;
+		CommitStagedScene(*scene, sceneName);
+		return true;
+	}
+
+	std::shared_ptr<StagedScene> StageScene(const std::filesystem::path& jsonFilePath, const SceneLoadSettings& settings) {
+		std::string json;
+		if (!ReadSceneJson(jsonFilePath, json)) return nullptr;
+		std::vector<RecordRange> records;
+		if (!SplitRecords(json, records)) return nullptr;
+		return StageFile(json, records, std::max(1u, WorkerCount(settings, json.size(), records.size())));
+	}
+
+	//phase two: the staged ranges into the ECS, in file order, from where the last call stopped
+	size_t CommitStagedScene(StagedScene& scene, const std::string& sceneName, size_t maxSteps) {
+		auto* ecs = ecs::ECS::GetInstance();
+		size_t steps = 0;
+		for (; scene.range < scene.ranges.size(); ++scene.range, scene.op = 0) {
+			StagedRange& range = scene.ranges[scene.range];
+			if (scene.op == 0) {
+				scene.entities.clear();
+				scene.entities.reserve(range.entityCount);
+			}
+			for (; scene.op < range.ops.size(); ++scene.op) {
+				if (steps == maxSteps) return steps;
+				++steps;
+
+				const StagedOp& op = range.ops[scene.op];
+				if (op.column == StagedOp::CREATE) {
+					const ecs::EntityID id = ecs->CreateEntity(sceneName);
+					scene.entities.push_back(id);
+					if (op.parent >= 0) hierachy::m_SetParent(scene.entities[op.parent], id);
+				}
+				else if (op.column == StagedOp::SCENE_DATA) {
+					if (!HasEntities(sceneName)) ecs->AddScene(sceneName, range.sceneData[op.row].data);
+				}
+				else {
+					scene.invokers[op.column]->InstantiateRow(range.columns[op.column].get(), op.row, scene.entities[op.entity]);
+				}
+			}
+			//a committed range's rows are not needed again
+			range = StagedRange{};
+		}
+		return steps;
+	}
+
+	bool IsCommitted(const StagedScene& scene) {
+		return scene.range == scene.ranges.size();
+	}
+}
@@ -0,0 +1,61 @@
+/******************************************************************/
+/*!
+\file      parallel_loader.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Loads a JSON scene in two phases. Worker threads each take a
+		   range of the top level records, parse them and fill their
+		   components into rows of their own, without touching the ECS.
+		   The calling thread then makes the entities, parents them and
+		   copies the rows into the component pools in one pass, in the
+		   order the streaming loader would, so both leave the same IDs,
+		   components, pool order and hierarchy behind.
+
+		   The whole file is held in memory while it loads, which the
+		   streaming loader avoids. Files it cannot stage are left to the
+		   streaming loader: prefab instances, which clone entities that
+		   are already loaded, files saved at older component versions,
+		   damaged files and files too small to split.
+
+		   The phases can also be run apart: StageScene on a background
+		   thread, then CommitStagedScene a few steps at a time on the
+		   thread the ECS runs on, as world partition streaming does.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+namespace Serialization {
+
+	struct SceneLoadSettings {
+		unsigned int threadCount = 0;          //0 uses every hardware thread, 1 streams the file on the calling thread
+		size_t minBytesPerThread = 64 * 1024;  //smaller ranges of the file are not worth a thread
+	};
+
+	//how LoadScene reads JSON scenes from now on
+	void SetSceneLoadSettings(const SceneLoadSettings& settings);
+	const SceneLoadSettings& GetSceneLoadSettings();
+
+	//loads the JSON scene at "jsonFilePath" into "sceneName" with worker threads, false with nothing loaded when the
+	//file is one for the streaming loader
+	bool LoadSceneParallel(const std::filesystem::path& jsonFilePath, const std::string& sceneName, const SceneLoadSettings& settings);
+
+	//a scene file parsed into rows, waiting to be committed to the ECS
+	struct StagedScene;
+
+	//stages the JSON scene at "jsonFilePath" on the calling thread and "settings.threadCount" - 1 more, one thread
+	//being enough. Null when the file is one for the streaming loader. Only reads the ECS's component table, so it
+	//may run on any thread while no component is being registered
+	std::shared_ptr<StagedScene> StageScene(const std::filesystem::path& jsonFilePath, const SceneLoadSettings& settings);
+
+	//makes up to "maxSteps" more entities and components of "scene" in "sceneName" and returns how many it made.
+	//The ECS may run between calls, it sees the entities made so far
+	size_t CommitStagedScene(StagedScene& scene, const std::string& sceneName, size_t maxSteps = std::numeric_limits<size_t>::max());
+	bool IsCommitted(const StagedScene& scene);
+}
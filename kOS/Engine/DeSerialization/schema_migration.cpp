@@ -0,0 +1,248 @@
+/******************************************************************/
+/*!
+\file      schema_migration.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Component schema versions, migration steps and the walk that
+		   brings a scene or prefab document up to date.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "schema_migration.h"
+
+#include "Scene/SceneData.h"
+
+namespace Serialization {
+
+	namespace migrate {
+
+		Migration Rename(std::string from, std::string to) {
+			return [from = std::move(from), to = std::move(to)](rapidjson::Value& object, JsonAllocator& allocator, bool) {
+				const auto member = object.FindMember(from.c_str());
+				if (member == object.MemberEnd()) return;
+				if (!object.HasMember(to.c_str())) {
+					rapidjson::Value key(to.c_str(), allocator);
+					object.AddMember(key, member->value, allocator);
+				}
+				//AddMember may have moved the members, members keep their order for the loaders that read them in it
+				object.EraseMember(object.FindMember(from.c_str()));
+			};
+		}
+
+		Migration Remove(std::string name) {
+			return [name = std::move(name)](rapidjson::Value& object, JsonAllocator&, bool) {
+				const auto member = object.FindMember(name.c_str());
+				if (member != object.MemberEnd()) object.EraseMember(member);
+			};
+		}
+
+		Migration Transform(std::string name, std::function<void(rapidjson::Value& member, JsonAllocator& allocator)> transform) {
+			return [name = std::move(name), transform = std::move(transform)](rapidjson::Value& object, JsonAllocator& allocator, bool) {
+				const auto member = object.FindMember(name.c_str());
+				if (member != object.MemberEnd()) transform(member->value, allocator);
+			};
+		}
+	}
+
+	SchemaMigrations& SchemaMigrations::GetInstance() {
+		static SchemaMigrations instance;
+		return instance;
+	}
+
+	void SchemaMigrations::SetVersion(const std::string& name, uint32_t version) {
+		m_schemas[name].version = version;
+	}
+
+	bool SchemaMigrations::IsKnown(std::string_view name) const {
+		return m_schemas.find(name) != m_schemas.end();
+	}
+
+	uint32_t SchemaMigrations::GetVersion(std::string_view name) const {
+		const auto it = m_schemas.find(name);
+		return it == m_schemas.end() ? 1 : it->second.version;
+	}
+
+	bool SchemaMigrations::HasRaisedVersions() const {
+		return std::any_of(m_schemas.begin(), m_schemas.end(), [](const auto& schema) { return schema.second.version != 1; });
+	}
+
+	void SchemaMigrations::Add(const std::string& name, uint32_t fromVersion, Migration step) {
+		m_schemas[name].steps[fromVersion] = std::move(step);
+	}
+
+	bool SchemaMigrations::Migrate(std::string_view name, uint32_t version, rapidjson::Value& object, JsonAllocator& allocator, bool partial) const {
+		const auto it = m_schemas.find(name);
+		if (it == m_schemas.end() || version == it->second.version || !object.IsObject()) return false;
+
+		const Schema& schema = it->second;
+		if (version > schema.version) {
+			LOGGING_WARN("{} was saved at schema version {}, newer than this build's {}", std::string(name).c_str(), version, schema.version);
+			return false;
+		}
+		//the whole chain is checked first, so a component is never left between versions
+		for (uint32_t from = version; from < schema.version; ++from) {
+			if (schema.steps.find(from) == schema.steps.end()) {
+				LOGGING_ERROR("No migration of {} from schema version {}", std::string(name).c_str(), from);
+				return false;
+			}
+		}
+
+		for (uint32_t from = version; from < schema.version; ++from) {
+			schema.steps.at(from)(object, allocator, partial);
+		}
+		return true;
+	}
+
+	void SchemaVersions::Read(const rapidjson::Value& record) {
+		m_versions.clear();
+		m_hasTable = false;
+		if (!record.IsObject()) return;
+
+		const auto table = record.FindMember(KEY);
+		if (table == record.MemberEnd() || !table->value.IsObject()) return;
+
+		m_hasTable = true;
+		for (const auto& entry : table->value.GetObject()) {
+			if (entry.value.IsUint()) m_versions[entry.name.GetString()] = entry.value.GetUint();
+		}
+	}
+
+	void SchemaVersions::Write(rapidjson::Value& record, JsonAllocator& allocator) const {
+		rapidjson::Value table(rapidjson::kObjectType);
+		for (const auto& [name, version] : m_versions) {
+			rapidjson::Value key(name.c_str(), allocator);
+			table.AddMember(key, version, allocator);
+		}
+		const auto member = record.FindMember(KEY);
+		if (member != record.MemberEnd()) member->value = table;
+		else record.AddMember(rapidjson::StringRef(KEY), table, allocator);
+	}
+
+	void SchemaVersions::Set(std::string_view name, uint32_t version) {
+		m_hasTable = true;
+		const auto it = m_versions.find(name);
+		if (it != m_versions.end()) it->second = version;
+		else m_versions.emplace(name, version);
+	}
+
+	uint32_t SchemaVersions::Get(std::string_view name, uint32_t current) const {
+		if (!m_hasTable) return 1;
+		const auto it = m_versions.find(name);
+		return it == m_versions.end() ? current : it->second;
+	}
+
+	bool SchemaVersions::IsCurrent(const SchemaMigrations& migrations) const {
+		if (!m_hasTable) return !migrations.HasRaisedVersions();
+		return std::all_of(m_versions.begin(), m_versions.end(), [&migrations](const auto& entry) {
+			//a class this build does not know is ignored when loaded
+			return !migrations.IsKnown(entry.first) || migrations.GetVersion(entry.first) == entry.second;
+		});
+	}
+
+	SchemaVersions SchemaVersions::Current(const SchemaMigrations& migrations, const std::vector<std::string>& names) {
+		SchemaVersions versions;
+		versions.m_hasTable = true;
+		for (const std::string& name : names) {
+			versions.m_versions[name] = migrations.GetVersion(name);
+		}
+		return versions;
+	}
+
+	namespace {
+
+		class DocumentMigration {
+		public:
+			DocumentMigration(const SchemaMigrations& migrations, const SchemaVersions& versions, JsonAllocator& allocator)
+				: m_migrations(migrations), m_versions(versions), m_allocator(allocator) {}
+
+			//"partial": an override object of a prefab instance
+			void Entity(rapidjson::Value& entity, bool partial) {
+				if (!entity.IsObject()) return;
+
+				if (!partial && entity.HasMember("prefab")) {
+					const auto overrides = entity.FindMember("overrides");
+					if (overrides == entity.MemberEnd() || !overrides->value.IsArray()) return;
+					for (auto& object : overrides->value.GetArray()) {
+						Entity(object, true);
+					}
+					return;
+				}
+
+				for (auto& member : entity.GetObject()) {
+					const std::string_view name(member.name.GetString(), member.name.GetStringLength());
+					if (!partial && name == "children" && member.value.IsArray()) {
+						for (auto& child : member.value.GetArray()) {
+							Entity(child, false);
+						}
+					}
+					else {
+						Component(name, member.value, partial);
+					}
+				}
+			}
+
+			void Component(std::string_view name, rapidjson::Value& object, bool partial) {
+				if (!m_migrations.IsKnown(name) || !object.IsObject()) return;
+				m_names.emplace(name);
+				const uint32_t current = m_migrations.GetVersion(name);
+				if (m_migrations.Migrate(name, m_versions.Get(name, current), object, m_allocator, partial)) ++m_migrated;
+			}
+
+			std::vector<std::string> GetNames() const { return { m_names.begin(), m_names.end() }; }
+			size_t GetMigrated() const { return m_migrated; }
+
+		private:
+			const SchemaMigrations& m_migrations;
+			const SchemaVersions& m_versions;
+			JsonAllocator& m_allocator;
+			std::set<std::string> m_names;   //the known classes the document holds
+			size_t m_migrated{};
+		};
+	}
+
+	size_t MigrateSceneDocument(rapidjson::Document& document, const SchemaMigrations& migrations) {
+		if (!document.IsArray()) return 0;
+
+		rapidjson::Value* sceneData = nullptr;
+		for (auto& record : document.GetArray()) {
+			if (record.IsObject() && record.HasMember(SceneData::classname())) {
+				sceneData = &record;
+				break;
+			}
+		}
+
+		SchemaVersions versions;
+		if (sceneData) versions.Read(*sceneData);
+		if (versions.IsCurrent(migrations)) return 0;
+
+		JsonAllocator& allocator = document.GetAllocator();
+		DocumentMigration migration(migrations, versions, allocator);
+		for (auto& record : document.GetArray()) {
+			if (&record == sceneData) {
+				migration.Component(SceneData::classname(), record[SceneData::classname()], false);
+			}
+			else {
+				migration.Entity(record, false);
+			}
+		}
+
+		//files are saved with their scene data first, a file without it gains it for the table
+		if (!sceneData) {
+			SceneData data;
+			rapidjson::Value record(rapidjson::kObjectType);
+			saveComponentreflect(&data, record, allocator);
+			document.PushBack(record, allocator);
+			for (rapidjson::SizeType i = document.Size() - 1; i > 0; --i) {
+				document[i].Swap(document[i - 1]);
+			}
+			sceneData = &document[0];
+		}
+		SchemaVersions::Current(migrations, migration.GetNames()).Write(*sceneData, allocator);
+		return migration.GetMigrated();
+	}
+}
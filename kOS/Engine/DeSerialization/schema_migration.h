@@ -0,0 +1,144 @@
+/******************************************************************/
+/*!
+\file      schema_migration.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Versions of the saved form of components and the steps that
+		   bring JSON saved at an older version up to the current one.
+
+		   A class's version is 1 until it raises it with
+		   REFLECT_SCHEMA_VERSION, and each raise comes with a step from
+		   the version before, registered in RegisterSchemaMigrations.
+		   Scenes and prefabs keep the versions they were saved at in
+		   "schemaVersions" beside their SceneData, files saved before
+		   it existed are at 1 throughout. Loading an older file runs its
+		   components through the steps in memory, the SchemaMigrator
+		   tool rewrites the files.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+#include <RAPIDJSON/document.h>
+#include "SerializationReflection.h"
+
+namespace Serialization {
+
+	using JsonAllocator = rapidjson::Document::AllocatorType;
+
+	//turns "object", a component saved at the version the step is registered from, into the next version. A partial
+	//object is a prefab override, holding only the members an instance changed
+	using Migration = std::function<void(rapidjson::Value& object, JsonAllocator& allocator, bool partial)>;
+
+	namespace migrate {
+
+		//the member "from" is now "to", a member already called "to" wins
+		Migration Rename(std::string from, std::string to);
+
+		//the member "name" is no longer saved
+		Migration Remove(std::string name);
+
+		//"transform" rewrites the member "name" wherever it was saved
+		Migration Transform(std::string name, std::function<void(rapidjson::Value& member, JsonAllocator& allocator)> transform);
+
+		//a member added since, "value" where it is missing. Overrides are left without it, the instance takes the
+		//prefab's. "value" is of a type a reflected member can be
+		template <typename V>
+		Migration Default(std::string name, V value) {
+			return [name = std::move(name), value = std::move(value)](rapidjson::Value& object, JsonAllocator& allocator, bool partial) {
+				if (partial || object.HasMember(name.c_str())) return;
+				SaveComponent<std::array<std::string, 1>> saver{ { name } };
+				V copy = value;
+				saver(copy, object, allocator);
+			};
+		}
+	}
+
+	/******************************************************************/
+	/*!
+	\class   SchemaMigrations
+	\brief   The current version of every class saved in scenes and the
+			 steps between versions, by class name.
+	*/
+	/******************************************************************/
+	class SchemaMigrations {
+	public:
+		static SchemaMigrations& GetInstance();
+
+		template <typename T>
+		void SetVersion() {
+			SetVersion(T::classname(), reflect::SchemaVersion<T>());
+		}
+		void SetVersion(const std::string& name, uint32_t version);
+
+		bool IsKnown(std::string_view name) const;
+		//1 for a class that is not known
+		uint32_t GetVersion(std::string_view name) const;
+		//false while every class is at version 1, as every file saved before versions is
+		bool HasRaisedVersions() const;
+
+		//"step" turns T saved at "fromVersion" into fromVersion + 1
+		template <typename T>
+		void Add(uint32_t fromVersion, Migration step) {
+			Add(T::classname(), fromVersion, std::move(step));
+		}
+		void Add(const std::string& name, uint32_t fromVersion, Migration step);
+
+		//runs "object", saved at "version", through every step to the current version. False, with the object as it
+		//was, when it is already current, saved by a newer build or a step is missing
+		bool Migrate(std::string_view name, uint32_t version, rapidjson::Value& object, JsonAllocator& allocator, bool partial = false) const;
+
+	private:
+		struct Schema {
+			uint32_t version{ 1 };
+			std::map<uint32_t, Migration> steps;   //by the version each starts from
+		};
+
+		std::map<std::string, Schema, std::less<>> m_schemas;
+	};
+
+	/******************************************************************/
+	/*!
+	\class   SchemaVersions
+	\brief   The versions a file was saved at. A file with the table
+			 lists every class it holds, one without was saved before
+			 versions and is at 1 throughout.
+	*/
+	/******************************************************************/
+	class SchemaVersions {
+	public:
+		static constexpr const char* KEY = "schemaVersions";
+
+		//the table in "record", the scene data record of a file
+		void Read(const rapidjson::Value& record);
+		//the table into "record", replacing the one it had
+		void Write(rapidjson::Value& record, JsonAllocator& allocator) const;
+
+		void Set(std::string_view name, uint32_t version);
+		bool HasTable() const { return m_hasTable; }
+		//the version "name" was saved at, a class the table leaves out is taken as saved at "current"
+		uint32_t Get(std::string_view name, uint32_t current) const;
+		//true when nothing the file holds needs a step of "migrations"
+		bool IsCurrent(const SchemaMigrations& migrations) const;
+
+		//the current version of each of "names"
+		static SchemaVersions Current(const SchemaMigrations& migrations, const std::vector<std::string>& names);
+
+	private:
+		std::map<std::string, uint32_t, std::less<>> m_versions;
+		bool m_hasTable{};
+	};
+
+	//every type saved in scenes and prefabs at its current version, and the steps between versions
+	void RegisterSchemaMigrations(SchemaMigrations& migrations);
+
+	//brings a parsed scene or prefab up to the current versions: the components of every entity, child and prefab
+	//override, then the table. The number of components that were migrated
+	size_t MigrateSceneDocument(rapidjson::Document& document, const SchemaMigrations& migrations);
+}
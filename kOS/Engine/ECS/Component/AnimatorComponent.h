@@ -2,9 +2,38 @@
 #define ANIMATOR_H
 
 #include "Component.h"
+#include "TransformComponent.h"
+#include "Animation/AnimationInstance.h"
+#include "Animation/AnimationController.h"
+#include "Animation/InverseKinematics.h"
+#include "Animation/AnimationLod.h"
+#include "Events/Delegate.h"
 
 namespace ecs {
 
+    // One IK constraint applied after the pose is sampled, joints are found by name in the skeleton
+    struct IkTarget {
+        bool enabled{ true };
+        animation::IkSolver solver{ animation::IkSolver::TwoBone };
+        std::string rootJoint{};     // chain root, unused by LookAt
+        std::string endJoint{};      // effector, or the joint LookAt turns
+        glm::vec3 target{ 0.0f };    // world space
+        glm::vec3 pole{ 0.0f };      // world space point a TwoBone knee or elbow bends towards
+        bool usePole{ false };
+        glm::vec3 aimAxis{ 0.0f, 0.0f, 1.0f }; // joint space axis LookAt points at the target
+        float weight{ 1.0f };
+        float minAngle{ 0.0f };      // degrees, TwoBone least bend
+        float maxAngle{ 180.0f };    // degrees, TwoBone most bend, Fabrik and LookAt cone
+        int iterations{ 10 };        // Fabrik only
+
+        // Ignores target and moves the animated effector onto the ground under it instead
+        bool placeOnGround{ false };
+        float groundReach{ 0.5f };   // how far above and below the effector the ground is looked for
+
+        REFLECTABLE(IkTarget, enabled, solver, rootJoint, endJoint, target, pole, usePole, aimAxis, weight,
+            minAngle, maxAngle, iterations, placeOnGround, groundReach)
+    };
+
     class AnimatorComponent : public Component {
 
     public:
@@ -12,10 +41,84 @@ namespace ecs {
         std::string avatarGUID{};      // Skeleton avatar/rig definition
 
         float playbackSpeed{ 1.0f };
+        animation::LoopMode loopMode{ animation::LoopMode::Loop };
+
+        // Moves the entity by the clip's root joint instead of the rendered pose, locked axes stay in the pose
+        bool applyRootMotion{ false };
+        bool lockRootX{ false };
+        bool lockRootY{ true };
+        bool lockRootZ{ false };
+        bool lockRootYaw{ false };
+
+        // Solved in order after sampling, each one sees the pose left by the ones before
+        std::vector<IkTarget> ikTargets;
+
+        // Samples the pose less often and with fewer joints the less of the screen the character covers
+        bool useLod{ true };
+
+        REFLECTABLE(AnimatorComponent, controllerGUID, avatarGUID, playbackSpeed, loopMode,
+            applyRootMotion, lockRootX, lockRootY, lockRootZ, lockRootYaw, ikTargets, useLod);
+
+        // Runtime playback state of the skeleton clip, sampled by AnimatorSystem
+        animation::AnimationInstance instance{};
+
+        // Runtime state machine, drives the pose instead of the skeleton clip when controllerGUID is set
+        animation::ControllerInstance controller{};
 
-        REFLECTABLE(AnimatorComponent, controllerGUID, avatarGUID, playbackSpeed);
+        // Invoked by AnimatorSystem once for every event marker the playback crosses
+        Delegate<const animation::AnimationEvent&> onEvent;
+
+        // Root motion of this frame, moved through the character controller when the entity has one
+        animation::RootMotion rootMotion{};
+
+        animation::RootMotionSettings GetRootMotionSettings() const {
+            return { applyRootMotion, lockRootX, lockRootY, lockRootZ, lockRootYaw };
+        }
+
+        // Runtime level of detail, scheduled by AnimatorSystem
+        animation::LodState lod{};
+        bool lodBlending{ false };           // the shown pose is blended between two evaluations
+        std::vector<glm::mat4> lodFromPose{}; // shown pose when the last evaluation started
+        std::vector<glm::mat4> lodFromJoints{};
+        std::vector<glm::mat4> lodPose{};     // shown pose while blending
+        std::vector<glm::mat4> lodJoints{};
+        glm::vec3 lodCenter{ 0.0f };          // model space bounds of the last evaluated pose
+        float lodRadius{ 0.0f };
+
+        // Skeleton of the playing pose, null until AnimatorSystem has bound one
+        const animation::AnimationClip* GetSkeleton() const {
+            return controllerGUID.empty() ? instance.GetBoundClip() : controller.GetSkeleton();
+        }
+
+        // Skinning matrices to render this frame
+        const std::vector<glm::mat4>& GetPose() const {
+            if (lodBlending) return lodPose;
+            return controllerGUID.empty() ? instance.GetPose() : controller.GetPose();
+        }
+
+        // Model space transform of every skeleton joint in the pose shown this frame
+        const std::vector<glm::mat4>& GetJointTransforms() const {
+            if (lodBlending) return lodJoints;
+            return controllerGUID.empty() ? instance.GetGlobalTransforms() : controller.GetGlobalTransforms();
+        }
     };
 
+    // World displacement of root motion for an entity with this local transformation
+    inline glm::vec3 RootMotionDisplacement(const Transformation& transformation, const animation::RootMotion& motion) {
+        return glm::quat(glm::radians(transformation.rotation)) * (transformation.scale * motion.translation);
+    }
+
+    // Moves a transformation by root motion only while the game runs, in the editor the animation plays in place
+    // so the entity does not drift and get saved where it drifted to. False if it was left where it is
+    inline bool MoveByRootMotion(GAMESTATE state, Transformation& transformation, const animation::RootMotion& motion) {
+        if (state != RUNNING)
+            return false;
+
+        transformation.position += RootMotionDisplacement(transformation, motion);
+        transformation.rotation.y += glm::degrees(motion.yaw);
+        return true;
+    }
+
 }
 
 #endif // ANIMATOR_H
@@ -0,0 +1,47 @@
+/********************************************************************/
+/*!
+\file      AttachmentComponent.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Declares the AttachmentComponent class, which makes an
+           entity follow a bone of its parent's animated skeleton,
+           such as a weapon held in a hand.
+
+           The entity stays an ordinary child in the hierarchy. Its
+           parent must have an AnimatorComponent. TransformSystem
+           places the entity at parent world * bone * socket * local,
+           using the pose AnimatorSystem sampled earlier in the frame.
+           The bone name is looked up once per skeleton.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#ifndef ATTACHMENTCOMPONENT_H
+#define ATTACHMENTCOMPONENT_H
+
+#include "Component.h"
+#include "TransformComponent.h"
+
+namespace ecs {
+
+    class AttachmentComponent : public Component {
+
+    public:
+        std::string boneName{};   // Joint of the parent's skeleton to follow
+        Transformation socket{};  // Offset from the bone, rotation in degrees
+
+        REFLECTABLE(AttachmentComponent, boneName, socket)
+
+        // Joint index resolved from boneName against this skeleton, redone when either changes
+        int joint{ -1 };
+        const void* resolvedSkeleton{ nullptr };
+        std::string resolvedBoneName{};
+    };
+
+}
+
+#endif // ATTACHMENTCOMPONENT_H
@@ -11,6 +11,7 @@
 #include "MeshRendererComponent.h"
 #include "SkinnedMeshRendererComponent.h"
 #include "AnimatorComponent.h"
+#include "AttachmentComponent.h"
 #include "LightComponent.h"
 #include "ScriptComponent.h"
 #include "CubeRenderComponent.h"
@@ -7,6 +7,8 @@
 #include "Debugging/Performance.h"
 #include "Reflection/Field.h"
 #include "Scene/SceneManager.h"
+#include "DeSerialization/schema_migration.h"
+#include "Config/ComponentRegistry.h"
 
 
 //ECS Varaible
@@ -19,29 +21,17 @@ namespace ecs{
 
 	void ECS::Load() {
 
-		//Allocate memory to each component pool
-		RegisterComponent<NameComponent>();
-		RegisterComponent<TransformComponent>();
-		RegisterComponent<SpriteComponent>();
-		RegisterComponent<CameraComponent>();
-		RegisterComponent<AudioComponent>();
-		RegisterComponent<TextComponent>();
-		RegisterComponent<MeshFilterComponent>();
-		RegisterComponent<CanvasRendererComponent>();
-		RegisterComponent<MeshRendererComponent>();
-		RegisterComponent<MaterialComponent>();
-		RegisterComponent<SkinnedMeshRendererComponent>();
-		RegisterComponent<AnimatorComponent>();
-		RegisterComponent<LightComponent>();
-		RegisterComponent<RigidbodyComponent>();
-		RegisterComponent<BoxColliderComponent>();
-		RegisterComponent<CapsuleColliderComponent>();
-		RegisterComponent<SphereColliderComponent>();
-		RegisterComponent<CharacterControllerComponent>();
-		//RegisterComponent<ScriptComponent>();
-		RegisterComponent<OctreeGeneratorComponent>();
-		RegisterComponent<CubeRendererComponent>();
-		RegisterComponent<ParticleComponent>();
+		//Allocate memory to each component pool, the list is in Config/ComponentRegistry.h
+		RegisterComponents(*this);
+
+		//Versions of the saved components, older scenes are migrated as they load
+		auto& migrations = Serialization::SchemaMigrations::GetInstance();
+		Serialization::RegisterSchemaMigrations(migrations);
+		for (const auto& [componentName, key] : m_componentKey) {
+			if (!migrations.IsKnown(componentName)) {
+				LOGGING_WARN("{} has no schema version, add it to RegisterSchemaMigrations", componentName.c_str());
+			}
+		}
 
 		//Allocate memory to each system
 		RegisterSystem<ScriptingSystem>(RUNNING);
@@ -185,6 +175,8 @@ namespace ecs{
 
 		sceneMap.find(scene)->second.sceneIDs.push_back(ID);
 
+		MarkDirty(ID);
+
 		//add transform component and name component as default
 		AddComponent<NameComponent>(ID);
 		AddComponent<TransformComponent>(ID);
@@ -249,6 +241,88 @@ namespace ecs{
 
 	}
 
+	std::vector<EntityID> ECS::GetSubtree(EntityID root, std::vector<int32_t>* parents) {
+
+		std::vector<EntityID> entities;
+
+		//children pushed last to first so they are popped, and later parented, in their order
+		std::vector<std::pair<EntityID, int32_t>> stack{ { root, -1 } };
+		while (!stack.empty()) {
+			const auto [id, parent] = stack.back();
+			stack.pop_back();
+
+			const int32_t index = static_cast<int32_t>(entities.size());
+			entities.push_back(id);
+			if (parents) parents->push_back(parent);
+
+			const auto children = hierachy::m_GetChild(id);
+			if (children.has_value()) {
+				for (auto it = children->rbegin(); it != children->rend(); ++it) {
+					stack.push_back({ *it, index });
+				}
+			}
+		}
+
+		return entities;
+	}
+
+	EntityTemplate ECS::CaptureTemplate(EntityID root) {
+
+		EntityTemplate entityTemplate;
+		const std::vector<EntityID> entities = GetSubtree(root, &entityTemplate.parents);
+
+		std::vector<EntityID> rowEntities;
+		for (const auto& [ComponentName, key] : m_componentKey) {
+			EntityTemplate::Column column;
+			rowEntities.clear();
+			for (uint32_t i = 0; i < entities.size(); ++i) {
+				if (m_entityMap.at(entities[i]).test(key)) {
+					column.rows.push_back(i);
+					rowEntities.push_back(entities[i]);
+				}
+			}
+			if (rowEntities.empty()) continue;
+
+			column.component = ComponentName;
+			column.data = componentAction.at(ComponentName)->CaptureRows(rowEntities);
+			entityTemplate.columns.push_back(std::move(column));
+		}
+
+		return entityTemplate;
+	}
+
+	EntityID ECS::InstantiateTemplate(const EntityTemplate& entityTemplate, const std::string& scene) {
+
+		if (entityTemplate.Empty()) {
+			LOGGING_WARN("Entity template is empty");
+			throw std::runtime_error("Entity template is empty");
+		}
+
+		std::vector<EntityID> entities;
+		entities.reserve(entityTemplate.EntityCount());
+		for (size_t i = 0; i < entityTemplate.EntityCount(); ++i) {
+			entities.push_back(CreateEntity(scene));
+		}
+
+		std::vector<EntityID> rowEntities;
+		for (const auto& column : entityTemplate.columns) {
+			rowEntities.clear();
+			for (uint32_t row : column.rows) {
+				rowEntities.push_back(entities[row]);
+			}
+			componentAction.at(column.component)->InstantiateRows(column.data.get(), rowEntities);
+		}
+
+		//parents come before their children
+		for (size_t i = 0; i < entities.size(); ++i) {
+			if (entityTemplate.parents[i] >= 0) {
+				hierachy::m_SetParent(entities[entityTemplate.parents[i]], entities[i]);
+			}
+		}
+
+		return entities.front();
+	}
+
 	bool ECS::DeleteEntity(EntityID ID) {
 
 		
@@ -263,6 +337,7 @@ namespace ecs{
 			EntityID parent = hierachy::GetParent(ID).value();
 			// if parent id is deleted, no need to remove its child
 			if (m_entityMap.find(parent) != m_entityMap.end()) {
+				MarkDirty(parent);
 				TransformComponent* parentTransform = GetComponent<TransformComponent>(parent);
 				size_t pos{};
 				for (EntityID& id : parentTransform->m_childID) {
@@ -307,6 +382,7 @@ namespace ecs{
 
 		//store delete entity
 		m_entityMap.erase(ID);
+		ClearDirty(ID);
 		m_availableEntityID.push(ID);
 
 		return true;
@@ -27,6 +27,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "ECS/System/System.h"
 #include "ECS/System/SystemHeader.h"
 #include "ECS/SparseSet.h"
+#include "ECS/EntityTemplate.h"
 
 
 #include "Reflection/IReflectionInvoker.h"
@@ -61,6 +62,13 @@ namespace ecs {
 		EntityID DuplicateEntity(EntityID, std::string scene = {});
 		bool DeleteEntity(EntityID);
 
+		//"root" and its children depth first, with the index of the parent of each or -1 in "parents"
+		std::vector<EntityID> GetSubtree(EntityID root, std::vector<int32_t>* parents = nullptr);
+		//copies "root" and its children, to be instantiated any number of times later
+		EntityTemplate CaptureTemplate(EntityID root);
+		//returns the root of the new entities
+		EntityID InstantiateTemplate(const EntityTemplate& entityTemplate, const std::string& scene);
+
 		template<typename T>
 		T* AddComponent(EntityID ID);
 		template<typename T>
@@ -117,6 +125,14 @@ namespace ecs {
 
 		std::string GetSceneByEntityID(ecs::EntityID entityID);
 
+		//SAVE TRACKING
+		//entities changed since their scene was last saved. Edits made through a component pointer call MarkDirty themselves,
+		//as the editor, the transform and physics systems and the scripting system do
+		void MarkDirty(EntityID ID) { m_dirtyEntities.insert(ID); }
+		bool IsDirty(EntityID ID) const { return m_dirtyEntities.find(ID) != m_dirtyEntities.end(); }
+		void ClearDirty(EntityID ID) { m_dirtyEntities.erase(ID); }
+		const std::unordered_set<EntityID>& GetDirtyEntities() const { return m_dirtyEntities; }
+
 
 		//SCENE DATA
 		std::unordered_map<std::string, SceneData> sceneMap{};
@@ -167,6 +183,7 @@ namespace ecs {
 		std::unordered_map<EntityID, ComponentSignature> m_entityMap;
 		EntityID m_entityCount{};
 		std::stack<EntityID> m_availableEntityID;
+		std::unordered_set<EntityID> m_dirtyEntities;
 
 		static std::shared_ptr<ECS> m_InstancePtr;
 	};
@@ -260,6 +277,7 @@ namespace ecs {
 
 
 		m_entityMap.find(ID)->second.set(GetComponentKey<T>());
+		MarkDirty(ID);
 
 		//checks if new component fufils any of the system requirements
 		RegisterEntity(ID);
@@ -293,6 +311,7 @@ namespace ecs {
 		DeregisterEntity(ID);
 
 		m_entityMap.find(ID)->second.reset(GetComponentKey<T>());
+		MarkDirty(ID);
 
 		//register everything
 		RegisterEntity(ID);
@@ -322,8 +341,8 @@ namespace ecs {
 		}
 
 
-		DeepCopyComponents<T> duplicator;
-		NewComponent->ApplyFunctionPairwise(duplicator, *duplicateComponent);
+		CopyReflected(*NewComponent, *duplicateComponent);
+		MarkDirty(newID);
 
 		return NewComponent;
 	}
@@ -333,8 +352,8 @@ namespace ecs {
 	{
 		T* Component = GetComponent<T>(ID);
 		T EmptyComponent;
-		DeepCopyComponents<T> duplicator;
-		Component->ApplyFunctionPairwise(duplicator, EmptyComponent);
+		CopyReflected(*Component, EmptyComponent);
+		MarkDirty(ID);
 	}
 
 	template <typename T>
@@ -0,0 +1,42 @@
+/******************************************************************/
+/*!
+\file      EntityTemplate.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   EntityTemplate is an entity and its children flattened into
+		   arrays: the parent of each entity and, per component type,
+		   a copy of the component of every entity that has one.
+		   ECS::CaptureTemplate builds one, ECS::InstantiateTemplate
+		   clones it into a scene in one pass, without reading the
+		   file the entities came from again.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "ECS/ECSList.h"
+
+namespace ecs {
+
+	struct EntityTemplate {
+
+		struct Column {
+			std::string component;
+			std::vector<uint32_t> rows;     //entity index of each row
+			std::shared_ptr<void> data;     //std::vector of the component type, one element per row
+		};
+
+		//depth first, index of the parent of each entity or -1, the root is the first entity
+		std::vector<int32_t> parents;
+		std::vector<Column> columns;
+
+		bool Empty() const { return parents.empty(); }
+		size_t EntityCount() const { return parents.size(); }
+	};
+
+}
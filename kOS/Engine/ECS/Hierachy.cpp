@@ -32,6 +32,8 @@ namespace hierachy {
 		}
 
 		parentTransform->m_childID.push_back(child);
+		ecs->MarkDirty(parent);
+		ecs->MarkDirty(child);
 
 		TransformComponent* childTransform = ecs->GetComponent<TransformComponent>(child);
 		childTransform->m_haveParent = true;
@@ -63,6 +65,9 @@ namespace hierachy {
 			pos++;
 		}
 
+		ecs->MarkDirty(parent);
+		ecs->MarkDirty(child);
+
 		TransformComponent* childTransform = ecs->GetComponent<TransformComponent>(child);
 		childTransform->m_haveParent = false;
 		childTransform->m_parentID = 0;
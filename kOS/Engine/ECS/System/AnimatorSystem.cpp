@@ -2,10 +2,36 @@
 #include "ECS/ECS.h"
 
 #include "AnimatorSystem.h"
+#include "ECS/Component/SkinnedMeshRendererComponent.h"
+#include "ECS/Component/AudioComponent.h"
+#include "ECS/Component/CharacterControllerComponent.h"
 #include "Resources/ResourceManager.h"
+#include "Physics/PhysicsManager.h"
+#include "Graphics/GraphicsManager.h"
 
 namespace ecs {
 
+    namespace {
+
+        std::vector<glm::mat4> BoneOffsets(const R_Model& mesh) {
+            std::vector<glm::mat4> offsets;
+            offsets.reserve(mesh.GetBoneInfo().size());
+            for (const BoneInfo& info : mesh.GetBoneInfo()) {
+                offsets.push_back(info.offsetMatrix);
+            }
+            return offsets;
+        }
+
+        int FindJoint(const animation::AnimationClip& skeleton, const std::string& name) {
+            const auto& names = skeleton.GetJointNames();
+            const auto it = std::find(names.begin(), names.end(), name);
+            return it == names.end() ? -1 : static_cast<int>(it - names.begin());
+        }
+
+        // The skin reaches past the joints, hands and head most of all
+        constexpr float LOD_BOUNDS_MARGIN = 1.25f;
+    }
+
     void AnimatorSystem::Init()
     {
         // Initialize animation playback resources if needed
@@ -14,7 +40,12 @@ namespace ecs {
     void AnimatorSystem::Update()
     {
         ECS* ecs = ECS::GetInstance();
+        ResourceManager* rm = ResourceManager::GetInstance();
         const auto& entities = m_entities.Data();
+        const float deltaTime = ecs->m_GetDeltaTime();
+
+        CollectLodCameras();
+        m_lod.BeginFrame();
 
         for (const EntityID id : entities) {
             AnimatorComponent* animator = ecs->GetComponent<AnimatorComponent>(id);
@@ -24,10 +55,276 @@ namespace ecs {
             if (!ecs->layersStack.m_layerBitSet.test(nameComp->Layer) || nameComp->hide)
                 continue;
 
-            // TODO: Advance playback time
-            // TODO: Sample animation curves
-            // TODO: Update bone transforms (stored in ECS transform hierarchy)
+            if (!ecs->HasComponent<SkinnedMeshRendererComponent>(id))
+                continue;
+
+            SkinnedMeshRendererComponent* skinnedMesh = ecs->GetComponent<SkinnedMeshRendererComponent>(id);
+            if (skinnedMesh->skinnedMeshGUID.empty())
+                continue;
+
+            animator->rootMotion = {};
+
+            // Time, events and root motion advance every frame, LOD only throttles the pose
+            if (!animator->controllerGUID.empty()) {
+                animation::ControllerInstance& controller = animator->controller;
+                controller.SetRootMotion(animator->GetRootMotionSettings());
+                if (!UpdateController(*animator, skinnedMesh->skinnedMeshGUID, deltaTime))
+                    continue;
+                DispatchEvents(id, *animator, controller.GetFiredEvents());
+                ApplyRootMotion(id, *animator, controller.GetRootMotion());
+
+                const animation::AnimationClip* skeleton = controller.GetSkeleton();
+                const animation::LodDecision lod = ScheduleLod(id, *animator);
+                if (lod.evaluate) {
+                    controller.Sample(lod.maxImportance);
+                    if (BuildIkConstraints(id, *animator, *skeleton, controller.GetGlobalTransforms())) {
+                        controller.SolveIk(m_ikConstraints);
+                    }
+                }
+                ApplyLod(*animator, lod, *skeleton, controller.GetPose(), controller.GetGlobalTransforms());
+                continue;
+            }
+
+            if (skinnedMesh->skeletonGUID.empty())
+                continue;
+
+            std::shared_ptr<R_Animation> clip = rm->GetResource<R_Animation>(skinnedMesh->skeletonGUID);
+            std::shared_ptr<R_Model> mesh = rm->GetResource<R_Model>(skinnedMesh->skinnedMeshGUID);
+            if (!clip || !mesh)
+                continue;
+
+            animation::AnimationInstance& instance = animator->instance;
+            instance.SetRootMotion(animator->GetRootMotionSettings());
+            instance.Advance(clip->GetClip(), deltaTime * animator->playbackSpeed, animator->loopMode);
+            DispatchEvents(id, *animator, instance.GetFiredEvents());
+            ApplyRootMotion(id, *animator, instance.GetRootMotion());
+
+            // Joint to bone lookups only rerun when the clip or mesh changes
+            if (!instance.IsBound(clip->GetClip(), mesh.get())) {
+                instance.Bind(clip->GetClip(), mesh.get(), mesh->GetBoneMap(), BoneOffsets(*mesh));
+                animator->lod = {};
+            }
+
+            const animation::LodDecision lod = ScheduleLod(id, *animator);
+            if (lod.evaluate) {
+                instance.Sample(clip->GetClip(), glm::mat4(1.f), lod.maxImportance);
+                if (BuildIkConstraints(id, *animator, clip->GetClip(), instance.GetGlobalTransforms())) {
+                    instance.SolveIk(clip->GetClip(), m_ikConstraints);
+                }
+            }
+            ApplyLod(*animator, lod, clip->GetClip(), instance.GetPose(), instance.GetGlobalTransforms());
+        }
+    }
+
+    bool AnimatorSystem::UpdateController(AnimatorComponent& animator, const std::string& meshGUID, float deltaTime)
+    {
+        ResourceManager* rm = ResourceManager::GetInstance();
+        std::shared_ptr<R_AnimationController> controller = rm->GetResource<R_AnimationController>(animator.controllerGUID);
+        std::shared_ptr<R_Model> mesh = rm->GetResource<R_Model>(meshGUID);
+        if (!controller || !mesh)
+            return false;
+
+        animation::ControllerInstance& instance = animator.controller;
+
+        // Clips are only resolved when the controller or mesh changes, the shared_ptrs keep them loaded
+        if (!instance.IsBound(controller->GetController(), mesh.get())) {
+            const animation::AnimationController& data = controller->GetController();
+            std::vector<std::shared_ptr<const animation::AnimationClip>> clips;
+            clips.reserve(data.GetClips().size());
+            for (size_t i = 0; i < data.GetClips().size(); ++i) {
+                std::shared_ptr<R_Animation> clip = rm->GetResource<R_Animation>(std::string(data.GetClipGUID(i)));
+                clips.push_back(clip ? std::shared_ptr<const animation::AnimationClip>(clip, &clip->GetClip()) : nullptr);
+            }
+            instance.Bind(std::shared_ptr<const animation::AnimationController>(controller, &data), std::move(clips),
+                mesh.get(), mesh->GetBoneMap(), BoneOffsets(*mesh));
+            animator.lod = {};
+        }
+
+        instance.Advance(deltaTime * animator.playbackSpeed);
+        return instance.GetSkeleton() != nullptr;
+    }
+
+    void AnimatorSystem::CollectLodCameras()
+    {
+        ECS* ecs = ECS::GetInstance();
+        m_lodCameras.clear();
+
+        // Built the way CameraSystem hands them to the renderer, which only sees them after this system
+        for (const EntityID id : ecs->GetComponentsEnties(CameraComponent::classname())) {
+            CameraComponent* camera = ecs->GetComponent<CameraComponent>(id);
+            TransformComponent* transform = ecs->GetComponent<TransformComponent>(id);
+            NameComponent* nameComp = ecs->GetComponent<NameComponent>(id);
+            if (!camera || !transform || !nameComp)
+                continue;
+            if (!ecs->layersStack.m_layerBitSet.test(nameComp->Layer) || nameComp->hide)
+                continue;
+
+            const CameraData data{ camera->fov, camera->nearPlane, camera->farPlane, camera->size,
+                transform->WorldTransformation.position, transform->LocalTransformation.rotation, camera->target, camera->active };
+            m_lodCameras.push_back(animation::MakeLodCamera(data.position, data.GetViewMtx(), data.GetPerspMtx(), data.fov));
+        }
+
+        if (const CameraData* editor = GraphicsManager::GetInstance()->gm_GetEditorCamera()) {
+            m_lodCameras.push_back(animation::MakeLodCamera(editor->position, editor->GetViewMtx(), editor->GetPerspMtx(), editor->fov));
+        }
+    }
+
+    animation::LodDecision AnimatorSystem::ScheduleLod(EntityID id, AnimatorComponent& animator)
+    {
+        // Without a camera there is no screen to measure against, every pose is evaluated in full
+        animation::LodDecision decision;
+        decision.evaluate = true;
+
+        TransformComponent* transform = ECS::GetInstance()->GetComponent<TransformComponent>(id);
+        if (!animator.useLod || m_lodCameras.empty() || !transform) {
+            animator.lod = {};
+            return decision;
+        }
+
+        const glm::mat4& model = transform->transformation;
+        const float scale = std::max({ glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2])) });
+        const glm::vec3 center{ model * glm::vec4(animator.lodCenter, 1.0f) };
+        decision = m_lod.Schedule(animator.lod, animation::MeasureView(m_lodCameras, center, animator.lodRadius * scale));
+
+        // The shown pose is where the blend to the new evaluation starts
+        if (decision.evaluate && decision.blend < 1.0f) {
+            animator.lodFromPose = animator.GetPose();
+            animator.lodFromJoints = animator.GetJointTransforms();
+        }
+        return decision;
+    }
+
+    void AnimatorSystem::ApplyLod(AnimatorComponent& animator, const animation::LodDecision& decision, const animation::AnimationClip& skeleton,
+        const std::vector<glm::mat4>& pose, const std::vector<glm::mat4>& joints)
+    {
+        if (decision.evaluate) {
+            m_lod.AddJointEvaluations(skeleton.GetSampledJointCount(decision.maxImportance));
+
+            // Bounds of the joints for the next frame's screen size
+            if (!joints.empty()) {
+                glm::vec3 min{ joints[0][3] }, max{ joints[0][3] };
+                for (const glm::mat4& joint : joints) {
+                    min = glm::min(min, glm::vec3(joint[3]));
+                    max = glm::max(max, glm::vec3(joint[3]));
+                }
+                animator.lodCenter = (min + max) * 0.5f;
+                animator.lodRadius = glm::length(max - min) * 0.5f * LOD_BOUNDS_MARGIN;
+            }
+        }
+
+        animator.lodBlending = decision.blend < 1.0f && animator.lodFromPose.size() == pose.size() &&
+            animator.lodFromJoints.size() == joints.size();
+        if (animator.lodBlending) {
+            animation::BlendPoses(animator.lodFromPose, pose, decision.blend, animator.lodPose);
+            animation::BlendPoses(animator.lodFromJoints, joints, decision.blend, animator.lodJoints);
+        }
+    }
+
+    void AnimatorSystem::DispatchEvents(EntityID id, AnimatorComponent& animator, const std::vector<const animation::AnimationEvent*>& events)
+    {
+        if (events.empty())
+            return;
+
+        ECS* ecs = ECS::GetInstance();
+        AudioComponent* audio = ecs->HasComponent<AudioComponent>(id) ? ecs->GetComponent<AudioComponent>(id) : nullptr;
+
+        for (const animation::AnimationEvent* event : events) {
+            // AudioSystem updates after this system and plays the request in the same frame
+            if (audio && !event->sound.empty()) {
+                for (AudioFile& file : audio->audioFiles) {
+                    if (file.audioGUID == event->sound) file.requestPlay = true;
+                }
+            }
+            animator.onEvent.Invoke(*event);
+        }
+    }
+
+    bool AnimatorSystem::BuildIkConstraints(EntityID id, const AnimatorComponent& animator, const animation::AnimationClip& skeleton,
+        const std::vector<glm::mat4>& globals)
+    {
+        m_ikConstraints.clear();
+        if (animator.ikTargets.empty() || globals.size() != skeleton.GetJoints().size())
+            return false;
+
+        ECS* ecs = ECS::GetInstance();
+        TransformComponent* transform = ecs->GetComponent<TransformComponent>(id);
+        if (!transform)
+            return false;
+
+        // Targets are authored in world space, the solvers work in the model space of the pose
+        const glm::mat4& model = transform->transformation;
+        const glm::mat4 modelInverse = glm::inverse(model);
+
+        // The entity's own colliders would catch the ray, the feet sit inside the character's capsule
+        const animation::IkRaycast raycast = [id](const glm::vec3& origin, const glm::vec3& direction, float maxDistance, animation::IkHit& hit) {
+            RaycastHit result;
+            if (!physics::PhysicsManager::GetInstance()->Raycast(origin, direction, maxDistance, result, id))
+                return false;
+            hit.point = result.point;
+            hit.normal = result.normal;
+            hit.distance = result.distance;
+            return true;
+        };
+
+        for (const IkTarget& target : animator.ikTargets) {
+            if (!target.enabled || target.weight <= 0.0f)
+                continue;
+
+            // Unknown joint names leave the pose alone, the skeleton may not have that limb
+            animation::IkConstraint constraint;
+            const int end = FindJoint(skeleton, target.endJoint);
+            if (target.solver == animation::IkSolver::LookAt) {
+                if (end < 0)
+                    continue;
+                constraint.chain.push_back(end);
+            }
+            else if (!animation::BuildChain(skeleton.GetJoints(), FindJoint(skeleton, target.rootJoint), end, constraint.chain)) {
+                continue;
+            }
+
+            constraint.solver = target.solver;
+            constraint.target = glm::vec3(modelInverse * glm::vec4(target.target, 1.0f));
+            constraint.pole = glm::vec3(modelInverse * glm::vec4(target.pole, 1.0f));
+            constraint.usePole = target.usePole;
+            constraint.axis = target.aimAxis;
+            constraint.weight = std::min(target.weight, 1.0f);
+            constraint.minAngle = glm::radians(target.minAngle);
+            constraint.maxAngle = glm::radians(target.maxAngle);
+            constraint.iterations = target.iterations;
+
+            if (target.placeOnGround) {
+                const glm::vec3 effector{ model * globals[end][3] };
+                glm::vec3 grounded;
+                if (!animation::PlaceOnGround(raycast, effector, glm::vec3{ model[3] }, glm::vec3{ 0.0f, 1.0f, 0.0f }, target.groundReach, grounded))
+                    continue;
+                constraint.target = glm::vec3(modelInverse * glm::vec4(grounded, 1.0f));
+            }
+
+            m_ikConstraints.push_back(std::move(constraint));
         }
+
+        return !m_ikConstraints.empty();
+    }
+
+    void AnimatorSystem::ApplyRootMotion(EntityID id, AnimatorComponent& animator, const animation::RootMotion& motion)
+    {
+        if (!animator.applyRootMotion)
+            return;
+
+        // CharacterControllerSystem updates after this system and moves the controller by it,
+        // outside RUNNING rootMotion stays empty and the character plays in place
+        ECS* ecs = ECS::GetInstance();
+        if (ecs->HasComponent<CharacterControllerComponent>(id)) {
+            if (ecs->GetState() == RUNNING)
+                animator.rootMotion = motion;
+            return;
+        }
+
+        TransformComponent* transform = ecs->GetComponent<TransformComponent>(id);
+        if (!transform)
+            return;
+
+        MoveByRootMotion(ecs->GetState(), transform->LocalTransformation, motion);
     }
 
-}
\ No newline at end of file
+}
@@ -14,6 +14,40 @@ namespace ecs {
         void Update() override;
 
         REFLECTABLE(AnimatorSystem)
+
+        // Level of detail of the last update, with its evaluation counters
+        const animation::LodScheduler& GetLodScheduler() const { return m_lod; }
+        animation::LodScheduler& GetLodScheduler() { return m_lod; }
+
+    private:
+
+        // Binds and advances the state machine of an animator with a controller, false if it cannot play
+        bool UpdateController(AnimatorComponent& animator, const std::string& meshGUID, float deltaTime);
+
+        // Every camera the scene is seen through this frame, game cameras and the editor's
+        void CollectLodCameras();
+
+        // Whether and how finely the pose is evaluated this frame, keeps the shown pose to blend from
+        animation::LodDecision ScheduleLod(EntityID id, AnimatorComponent& animator);
+
+        // Counts the evaluation and builds the pose shown this frame from the last evaluated "pose" and "joints"
+        void ApplyLod(AnimatorComponent& animator, const animation::LodDecision& decision, const animation::AnimationClip& skeleton,
+            const std::vector<glm::mat4>& pose, const std::vector<glm::mat4>& joints);
+
+        // Plays the sounds of the fired events and forwards them to the animator's subscribers
+        void DispatchEvents(EntityID id, AnimatorComponent& animator, const std::vector<const animation::AnimationEvent*>& events);
+
+        // Hands root motion to the character controller, or moves the transform when there is none, only while RUNNING
+        void ApplyRootMotion(EntityID id, AnimatorComponent& animator, const animation::RootMotion& motion);
+
+        // Resolves the animator's IK targets against the sampled pose into m_ikConstraints, false if none apply
+        bool BuildIkConstraints(EntityID id, const AnimatorComponent& animator, const animation::AnimationClip& skeleton,
+            const std::vector<glm::mat4>& globals);
+
+        std::vector<animation::IkConstraint> m_ikConstraints;
+
+        animation::LodScheduler m_lod;
+        std::vector<animation::LodCamera> m_lodCameras;
     };
 
 }
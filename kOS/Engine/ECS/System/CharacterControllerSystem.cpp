@@ -131,6 +131,16 @@ namespace ecs {
 
             displacement.y = charctrl->yVelocity * ecs->m_GetDeltaTime();
 
+            // Root motion of locomotion clips, set by AnimatorSystem this frame
+            if (AnimatorComponent* animator = ecs->HasComponent<AnimatorComponent>(id) ? ecs->GetComponent<AnimatorComponent>(id) : nullptr) {
+                if (animator->applyRootMotion) {
+                    const glm::vec3 rootDisplacement = RootMotionDisplacement(trans->LocalTransformation, animator->rootMotion);
+                    displacement += PxVec3{ rootDisplacement.x, rootDisplacement.y, rootDisplacement.z };
+                    trans->LocalTransformation.rotation.y += glm::degrees(animator->rootMotion.yaw);
+                    animator->rootMotion = {};
+                }
+            }
+
             PxControllerCollisionFlags flags = ctrl->move(displacement, charctrl->minMoveDistance, ecs->m_GetDeltaTime(), PxControllerFilters());
 
             if (flags & PxControllerCollisionFlag::eCOLLISION_DOWN) {
@@ -142,6 +152,7 @@ namespace ecs {
             glm::vec3 currPos{ static_cast<float>(pos.x), static_cast<float>(pos.y), static_cast<float>(pos.z) };
 
             trans->LocalTransformation.position = currPos;
+            ecs->MarkDirty(id);
 
             charctrl->prevPos = currPos;
             charctrl->isChanged = true;
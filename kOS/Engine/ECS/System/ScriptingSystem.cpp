@@ -44,6 +44,8 @@ namespace ecs {
 					}
 
 					script->Update();
+					//a script writes its own fields and mostly its own entity's components
+					ecs->MarkDirty(id);
 				}
 			}
 			catch (...) {
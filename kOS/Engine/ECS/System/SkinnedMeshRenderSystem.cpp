@@ -26,6 +26,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "ECS/Component/SkinnedMeshRendererComponent.h"
 #include "ECS/Component/TransformComponent.h"
 #include "ECS/Component/NameComponent.h"
+#include "ECS/Component/AnimatorComponent.h"
 #include "Resources/ResourceManager.h"
 #include "Graphics/GraphicsManager.h"
 
@@ -53,18 +54,19 @@ namespace ecs {
                 continue;
 
             R_Model* mesh{};
-            R_Animation* skeleton{};
             //if (skinnedMesh->cachedSkinnedMeshGUID != skinnedMesh->skinnedMeshGUID)
             {
                 mesh = rm->GetResource<R_Model>(skinnedMesh->skinnedMeshGUID).get();
-                skeleton = rm->GetResource<R_Animation>(skinnedMesh->skeletonGUID).get();
                 skinnedMesh->cachedSkinnedMeshGUID = skinnedMesh->skinnedMeshGUID;
                 skinnedMesh->cachedSkinnedMeshResource = static_cast<void*>(mesh);
 
-                if (skeleton)
+                // Pose was sampled by AnimatorSystem earlier this frame
+                std::vector<glm::mat4> boneMatrices;
+                if (ecs->HasComponent<AnimatorComponent>(id))
                 {
-                    skeleton->m_CurrentTime += skeleton->GetTicksPerSecond() * ecs->m_GetDeltaTime();
-                    skeleton->m_CurrentTime = fmod(skeleton->m_CurrentTime, skeleton->GetDuration());
+                    const AnimatorComponent* animator = ecs->GetComponent<AnimatorComponent>(id);
+                    if (!animator->controllerGUID.empty() || !skinnedMesh->skeletonGUID.empty())
+                        boneMatrices = animator->GetPose();
                 }
 
 
@@ -75,12 +77,11 @@ namespace ecs {
                 std::shared_ptr<R_Texture> rough = rm->GetResource<R_Texture>(skinnedMesh->roughnessMaterialGUID);
 
                 if (mesh)
-                    gm->gm_PushSkinnedMeshData(SkinnedMeshData{ mesh, skeleton, PBRMaterial{diff,spec,rough,ao,norm}, transform->transformation, 0.f,id });
+                    gm->gm_PushSkinnedMeshData(SkinnedMeshData{ mesh, std::move(boneMatrices), PBRMaterial{diff,spec,rough,ao,norm}, transform->transformation, id });
             }
             //else
                // mesh = static_cast<R_Model*>(skinnedMesh->cachedSkinnedMeshResource);
 
-            // TODO: Update bone matrices via AnimatorSystem
             // TODO: Submit skinned mesh (skinnedMesh->meshFile, skinnedMesh->materialFile) for rendering
         }
     }
@@ -21,6 +21,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Utility/MathUtility.h"
 
 namespace ecs {
+
+	namespace {
+		bool SameTransformation(const Transformation& lhs, const Transformation& rhs) {
+			return lhs.position == rhs.position && lhs.rotation == rhs.rotation && lhs.scale == rhs.scale;
+		}
+	}
 	
 	void TransformSystem::Init(){
 		//onRegister.Add([](EntityID id) {
@@ -56,8 +62,21 @@ namespace ecs {
 		if (!transformComp) return;
 
 		CalculateLocalTransformMtx(transformComp);
-		transformComp->transformation = transformComp->m_haveParent ? parentWorldMtx * transformComp->localTransform : transformComp->localTransform;
+		const Transformation previousWorld = transformComp->WorldTransformation;
+		if (transformComp->m_haveParent) {
+			// Attached entities hang off a bone of the parent's pose instead of the parent's origin
+			AttachmentComponent* attachment = ECS::GetInstance()->GetComponent<AttachmentComponent>(transformComp->entity);
+			transformComp->transformation = attachment ? parentWorldMtx * CalculateSocketMtx(attachment, transformComp->m_parentID) * transformComp->localTransform
+													   : parentWorldMtx * transformComp->localTransform;
+		}
+		else {
+			transformComp->transformation = transformComp->localTransform;
+		}
 		math::DecomposeMtxIntoTRS(transformComp->transformation, transformComp->WorldTransformation.position, transformComp->WorldTransformation.rotation, transformComp->WorldTransformation.scale);
+		//the world transform is saved with the entity, it moves when a parent or a bone does
+		if (!SameTransformation(previousWorld, transformComp->WorldTransformation)) {
+			ECS::GetInstance()->MarkDirty(transformComp->entity);
+		}
 		for (const EntityID childID : transformComp->m_childID) {
 			TransformComponent* child = ECS::GetInstance()->GetComponent<TransformComponent>(childID);
 			if (child) {
@@ -66,6 +85,30 @@ namespace ecs {
 		}
 	}
 
+	glm::mat4 TransformSystem::CalculateSocketMtx(AttachmentComponent* attachment, EntityID parentID) {
+		constexpr glm::mat4 identity(1.0f);
+		const glm::mat4 socket = glm::translate(identity, attachment->socket.position) *
+								 glm::mat4_cast(glm::quat(glm::radians(attachment->socket.rotation))) *
+								 glm::scale(identity, attachment->socket.scale);
+
+		AnimatorComponent* animator = ECS::GetInstance()->GetComponent<AnimatorComponent>(parentID);
+		const animation::AnimationClip* skeleton = animator ? animator->GetSkeleton() : nullptr;
+		if (!skeleton) return socket;
+
+		// Bone names are only searched when the skeleton or the name changes
+		if (attachment->resolvedSkeleton != skeleton || attachment->resolvedBoneName != attachment->boneName) {
+			const auto& names = skeleton->GetJointNames();
+			const auto it = std::find(names.begin(), names.end(), attachment->boneName);
+			attachment->joint = it == names.end() ? -1 : static_cast<int>(it - names.begin());
+			attachment->resolvedSkeleton = skeleton;
+			attachment->resolvedBoneName = attachment->boneName;
+		}
+
+		const std::vector<glm::mat4>& joints = animator->GetJointTransforms();
+		if (attachment->joint < 0 || static_cast<size_t>(attachment->joint) >= joints.size()) return socket;
+		return joints[attachment->joint] * socket;
+	}
+
 	// Ideally not great to constantly convert to radians, data should be stored in radians but due to the restriction of ImGui might be tough to show data in deg
 	// Unless TransformComponent is customised
 	void TransformSystem::CalculateLocalTransformMtx(TransformComponent* transformComp) {
@@ -79,6 +122,7 @@ namespace ecs {
 	void TransformSystem::SetImmediateWorldPosition(TransformComponent* transformComp, glm::vec3&& pos){
 		if (!transformComp) return;
 		constexpr glm::mat4 identity(1.0f);
+		ECS::GetInstance()->MarkDirty(transformComp->entity);
 		transformComp->WorldTransformation.position = pos;
 		transformComp->transformation = glm::translate(identity, transformComp->WorldTransformation.position) *
 										glm::mat4_cast(glm::quat(glm::radians(transformComp->WorldTransformation.rotation))) *
@@ -98,6 +142,7 @@ namespace ecs {
 	void TransformSystem::SetImmediateWorldRotation(TransformComponent* transformComp, glm::vec3&& rot){
 		if (!transformComp) return;
 		constexpr glm::mat4 identity(1.0f);
+		ECS::GetInstance()->MarkDirty(transformComp->entity);
 		transformComp->WorldTransformation.rotation = rot;
 		transformComp->transformation = glm::translate(identity, transformComp->WorldTransformation.position) *
 										glm::mat4_cast(glm::quat(glm::radians(transformComp->WorldTransformation.rotation))) *
@@ -117,6 +162,7 @@ namespace ecs {
 	void TransformSystem::SetImmediateWorldScale(TransformComponent* transformComp, glm::vec3&& scale){
 		if (!transformComp) return;
 		constexpr glm::mat4 identity(1.0f);
+		ECS::GetInstance()->MarkDirty(transformComp->entity);
 		transformComp->WorldTransformation.scale = scale;
 		transformComp->transformation = glm::translate(identity, transformComp->WorldTransformation.position) *
 			glm::mat4_cast(glm::quat(glm::radians(transformComp->WorldTransformation.rotation))) *
@@ -136,18 +182,21 @@ namespace ecs {
 	void TransformSystem::SetImmediateLocalPosition(TransformComponent* transformComp, glm::vec3&& pos){
 		if (!transformComp) return;
 		transformComp->LocalTransformation.position = pos;
+		ECS::GetInstance()->MarkDirty(transformComp->entity);
 		CalculateAllTransform(transformComp);
 	}
 
 	void TransformSystem::SetImmediateLocalRotation(TransformComponent* transformComp, glm::vec3&& rot){
 		if (!transformComp) return;
 		transformComp->LocalTransformation.rotation = rot;
+		ECS::GetInstance()->MarkDirty(transformComp->entity);
 		CalculateAllTransform(transformComp);
 	}
 
 	void TransformSystem::SetImmediateLocalScale(TransformComponent* transformComp, glm::vec3&& scale){
 		if (!transformComp) return;
 		transformComp->LocalTransformation.scale = scale;
+		ECS::GetInstance()->MarkDirty(transformComp->entity);
 		CalculateAllTransform(transformComp);
 	}
 }
@@ -26,6 +26,8 @@ namespace ecs {
         void Update() override;
         static void CalculateAllTransform(TransformComponent* transComp, const glm::mat4& parentWorldMtx = glm::mat4(1.0f));
         static void CalculateLocalTransformMtx(TransformComponent* transformComp);
+        // Bone of the parent's sampled pose times the socket offset, in the parent's space
+        static glm::mat4 CalculateSocketMtx(AttachmentComponent* attachment, EntityID parentID);
         static void SetImmediateWorldPosition(TransformComponent* transformComp, glm::vec3&& pos);
         static void SetImmediateWorldRotation(TransformComponent* transformComp, glm::vec3&& rot);
         static void SetImmediateWorldScale(TransformComponent* transformComp, glm::vec3&& scale);
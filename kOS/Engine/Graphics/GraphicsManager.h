@@ -84,6 +84,7 @@ public:
 	//Accessors
 	inline const FrameBuffer& gm_GetEditorBuffer() const { return framebufferManager.editorBuffer; };
 	inline const FrameBuffer& gm_GetGameBuffer() const { return framebufferManager.gameBuffer; };
+	inline const CameraData* gm_GetEditorCamera() const { return editorCameraActive ? &editorCamera : nullptr; };
 	void gm_FillDepthCube(const CameraData&, int);
 
 	//I want my DCMs
@@ -41,10 +41,9 @@ class Animator;
 struct SkinnedMeshData
 {
     R_Model* meshToUse{ nullptr };
-    R_Animation* animationToUse{ nullptr };
+    std::vector<glm::mat4> boneMatrices{}; // Pose sampled by AnimatorSystem, empty draws the bind pose
     PBRMaterial meshMaterial;
     glm::mat4 transformation{ 1.f };
-    float currentDuration{};
     unsigned int entityID{ 0 };
 };
 
@@ -185,10 +185,9 @@ void SkinnedMeshRenderer::Render(const CameraData& camera, Shader& shader)
 	{
 		shader.SetTrans("model", mesh.transformation);
 		shader.SetInt("entityID", mesh.entityID+1);
-		if (mesh.animationToUse)
+		if (!mesh.boneMatrices.empty())
 		{
-			mesh.animationToUse->Update(mesh.animationToUse->GetCurrentTime(), glm::mat4(1.f), glm::mat4(1.f), mesh.meshToUse->GetBoneMap(), mesh.meshToUse->GetBoneInfo());
-			mesh.meshToUse->DrawAnimation(shader, mesh.meshMaterial, mesh.animationToUse->GetBoneFinalMatrices());
+			mesh.meshToUse->DrawAnimation(shader, mesh.meshMaterial, mesh.boneMatrices);
 		}
 		else
 		{
@@ -33,6 +33,36 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Inputs/Input.h"
 
 namespace physics {
+
+	namespace {
+		// Actors carry their entity id in userData
+		class IgnoreEntityFilter : public PxQueryFilterCallback {
+		public:
+			explicit IgnoreEntityFilter(EntityID ignore) : m_ignore{ reinterpret_cast<void*>(static_cast<uintptr_t>(ignore)) } {}
+
+			PxQueryHitType::Enum preFilter(const PxFilterData&, const PxShape*, const PxRigidActor* actor, PxHitFlags&) override {
+				return actor && actor->userData == m_ignore ? PxQueryHitType::eNONE : PxQueryHitType::eBLOCK;
+			}
+
+			PxQueryHitType::Enum postFilter(const PxFilterData&, const PxQueryHit&, const PxShape*, const PxRigidActor*) override {
+				return PxQueryHitType::eBLOCK;
+			}
+
+		private:
+			void* m_ignore;
+		};
+
+		bool ToRaycastHit(bool isHit, const PxRaycastBuffer& hit, RaycastHit& outHit) {
+			if (!isHit || !hit.hasBlock) { return false; }
+			outHit.rigidbody = hit.block.actor;
+			outHit.collider = hit.block.shape;
+			outHit.point = glm::vec3{ hit.block.position.x, hit.block.position.y, hit.block.position.z };
+			outHit.normal = glm::vec3{ hit.block.normal.x, hit.block.normal.y, hit.block.normal.z };
+			outHit.distance = hit.block.distance;
+			return true;
+		}
+	}
+
 	std::shared_ptr<PhysicsManager> PhysicsManager::m_instancePtr = nullptr;
 
 	void PhysicsManager::Init() {
@@ -140,14 +170,17 @@ namespace physics {
 		if (!m_scene) { return false; }
 		PxRaycastBuffer hit;
 		bool isHit = m_scene->raycast(PxVec3{ origin.x, origin.y, origin.z }, PxVec3{ direction.x, direction.y, direction.z }.getNormalized(), maxDistance, hit);
-		if (isHit && hit.hasBlock) {
-			outHit.rigidbody = hit.block.actor;
-			outHit.collider = hit.block.shape;
-			outHit.point = glm::vec3{ hit.block.position.x, hit.block.position.y, hit.block.position.z };
-			outHit.normal = glm::vec3{ hit.block.normal.x, hit.block.normal.y, hit.block.normal.z };
-			outHit.distance = hit.block.distance;
-			return true;
-		}
-		return false;
+		return ToRaycastHit(isHit, hit, outHit);
+	}
+
+	bool PhysicsManager::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit& outHit, EntityID ignore) {
+		if (!m_scene) { return false; }
+		IgnoreEntityFilter filter{ ignore };
+		PxQueryFilterData filterData;
+		filterData.flags |= PxQueryFlag::ePREFILTER;
+		PxRaycastBuffer hit;
+		bool isHit = m_scene->raycast(PxVec3{ origin.x, origin.y, origin.z }, PxVec3{ direction.x, direction.y, direction.z }.getNormalized(), maxDistance, hit,
+			PxHitFlags(PxHitFlag::eDEFAULT), filterData, &filter);
+		return ToRaycastHit(isHit, hit, outHit);
 	}
 }
\ No newline at end of file
@@ -67,6 +67,8 @@ namespace physics {
 		void AddTorque(void*, const glm::vec3&, ForceMode mode = ForceMode::Force);
 
 		bool Raycast(const glm::vec3&, const glm::vec3&, float, RaycastHit&);
+		// Same as above, skipping the actors of the "ignore" entity (such as a character casting from inside its own capsule)
+		bool Raycast(const glm::vec3&, const glm::vec3&, float, RaycastHit&, EntityID ignore);
 
 		Delegate<const Collision&> OnCollisionEnter;
 		Delegate<const Collision&> OnCollisionStay;
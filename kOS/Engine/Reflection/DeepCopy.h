@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 template <typename T>
 struct DeepCopyComponents {
     int count = 0;
@@ -24,7 +26,7 @@ struct DeepCopyComponents {
     }
 
     // String
-    void operator()(std::string& dest, std::string& source) {
+    void operator()(std::string& dest, const std::string& source) {
         dest = source;
         count++;
     }
@@ -87,4 +89,126 @@ struct DeepCopyComponents {
         }
         count++;
     }
-};
\ No newline at end of file
+};
+
+namespace reflect {
+
+    struct CopySpan {
+        std::size_t offset{};
+        std::size_t size{};
+    };
+
+    template <typename M>
+    concept Reflected = std::is_class_v<M> && requires { M::Fields(); };
+
+    template <typename T, std::size_t I>
+    using FieldType = std::remove_reference_t<std::tuple_element_t<I, decltype(std::declval<T&>().member())>>;
+
+    template <typename T>
+    constexpr std::size_t LeafCount();
+
+    template <typename T>
+    struct CopyPlan {
+        std::array<CopySpan, LeafCount<T>()> spans{};
+        std::size_t count{};
+        std::array<bool, T::fieldcount> bulk{};  //member i is copied through the spans
+        bool allBulk{ true };                     //no member needs DeepCopyComponents
+    };
+
+    template <typename T>
+    constexpr CopyPlan<T> MakeCopyPlan();
+
+    //trivially copyable members are copied with memcpy, reflected classes only if all their reflected members are,
+    //and then only those members, DeepCopyComponents never touches the rest of them
+    template <typename M>
+    constexpr bool CopiedByMemcpy() {
+        if constexpr (Reflected<M>) return MakeCopyPlan<M>().allBulk;
+        else return std::is_trivially_copyable_v<M>;
+    }
+
+    template <typename M>
+    constexpr std::size_t LeafCountOf() {
+        if constexpr (Reflected<M>) return CopiedByMemcpy<M>() ? LeafCount<M>() : 1;
+        else return 1;
+    }
+
+    template <typename T>
+    constexpr std::size_t LeafCount() {
+        return [] <std::size_t... I>(std::index_sequence<I...>) {
+            return (std::size_t{ 0 } + ... + LeafCountOf<FieldType<T, I>>());
+        }(std::make_index_sequence<T::fieldcount>{});
+    }
+
+    //appends the spans of the members of T copied with memcpy, "base" is where T sits in the outermost object
+    template <typename T, std::size_t N>
+    constexpr void AppendSpans(std::array<CopySpan, N>& spans, std::size_t& count, std::size_t base) {
+        constexpr auto fields = T::Fields();
+        [&] <std::size_t... I>(std::index_sequence<I...>) {
+            ([&] {
+                using M = FieldType<T, I>;
+                if constexpr (Reflected<M>) {
+                    if constexpr (CopiedByMemcpy<M>()) AppendSpans<M>(spans, count, base + fields[I].offset);
+                }
+                else if constexpr (std::is_trivially_copyable_v<M>) {
+                    spans[count++] = { base + fields[I].offset, fields[I].size };
+                }
+            }(), ...);
+        }(std::make_index_sequence<T::fieldcount>{});
+    }
+
+    template <typename T>
+    constexpr CopyPlan<T> MakeCopyPlan() {
+        CopyPlan<T> plan;
+        [&] <std::size_t... I>(std::index_sequence<I...>) {
+            ((plan.bulk[I] = CopiedByMemcpy<FieldType<T, I>>()), ...);
+        }(std::make_index_sequence<T::fieldcount>{});
+        for (const bool bulk : plan.bulk) plan.allBulk = plan.allBulk && bulk;
+
+        std::array<CopySpan, LeafCount<T>()> leaves{};
+        std::size_t leafCount = 0;
+        AppendSpans<T>(leaves, leafCount, 0);
+
+        //in offset order, so members declared next to each other become one span
+        for (std::size_t i = 1; i < leafCount; ++i) {
+            for (std::size_t j = i; j > 0 && leaves[j].offset < leaves[j - 1].offset; --j) {
+                std::swap(leaves[j], leaves[j - 1]);
+            }
+        }
+        for (std::size_t i = 0; i < leafCount; ++i) {
+            if (plan.count > 0 && plan.spans[plan.count - 1].offset + plan.spans[plan.count - 1].size == leaves[i].offset) {
+                plan.spans[plan.count - 1].size += leaves[i].size;
+            }
+            else {
+                plan.spans[plan.count++] = leaves[i];
+            }
+        }
+        return plan;
+    }
+
+    //every reflected member of T is copied with memcpy
+    template <typename T>
+    constexpr bool IsTriviallyReflected() {
+        return MakeCopyPlan<T>().allBulk;
+    }
+}
+
+//copies the reflected members of source into dest, the same result as DeepCopyComponents through ApplyFunctionPairwise
+template <typename T>
+void CopyReflected(T& dest, const T& source) {
+    static constexpr reflect::CopyPlan<T> plan = reflect::MakeCopyPlan<T>();
+
+    for (std::size_t i = 0; i < plan.count; ++i) {
+        std::memcpy(reinterpret_cast<char*>(&dest) + plan.spans[i].offset, reinterpret_cast<const char*>(&source) + plan.spans[i].offset, plan.spans[i].size);
+    }
+
+    if constexpr (!plan.allBulk) {
+        DeepCopyComponents<T> duplicator;
+        auto membersA = dest.member();
+        auto membersB = source.member();
+        [&] <std::size_t... I>(std::index_sequence<I...>) {
+            ([&] {
+                if constexpr (!plan.bulk[I]) duplicator(std::get<I>(membersA), std::get<I>(membersB));
+            }(), ...);
+        }(std::make_index_sequence<T::fieldcount>{});
+    }
+}
@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "Config/pch.h"
 #include "DeSerialization/json_handler.h"
+#include "DeSerialization/binary_handler.h"
 
 
 class IActionInvoker {
@@ -26,6 +27,16 @@ public:
 
     virtual void Load(ecs::EntityID ID, const rapidjson::Value& entityData) = 0;
 
+    // Cooked binary scenes, one call writes or reads the component of every entity given
+    virtual uint64_t SchemaHash() = 0;
+    virtual void SaveBinary(const std::vector<ecs::EntityID>& entities, Serialization::BinaryWriter& writer) = 0;
+    virtual void LoadBinary(const std::vector<ecs::EntityID>& entities, Serialization::BinaryReader& reader) = 0;
+    // Folds what SaveBinary writes of one component into "hash", without building anything
+    virtual uint64_t HashBinary(ecs::EntityID ID, uint64_t hash) = 0;
+
+    // Streaming JSON scenes fill the component through this
+    virtual const Serialization::SaxType& GetSaxType() = 0;
+
     virtual bool Compare(void* componentData1, void* componentData2) = 0;
     virtual bool Compare(ecs::EntityID ID, ecs::EntityID ID2) = 0;
 
@@ -39,6 +50,21 @@ public:
 
     virtual void* DuplicateComponent(ecs::EntityID duplicateID, ecs::EntityID newID) = 0;
 
+    // Entity templates, the rows are a std::vector<T> holding a copy of the component of each entity
+    virtual std::shared_ptr<void> CaptureRows(const std::vector<ecs::EntityID>& entities) = 0;
+    virtual void InstantiateRows(const void* rows, const std::vector<ecs::EntityID>& entities) = 0;
+    virtual void* GetRow(void* rows, size_t row) = 0;
+
+    // Parallel scene loads fill rows of the same form on worker threads, then instantiate them one at a time
+    virtual std::shared_ptr<void> CreateRows() = 0;
+    virtual void* AddRow(void* rows) = 0;
+    virtual void InstantiateRow(const void* rows, size_t row, ecs::EntityID ID) = 0;
+
+    // Prefab instances, only the members that differ from the prefab's component are written, and prefab edits
+    // reach the members an instance still has at the prefab's old value
+    virtual bool SaveOverrides(void* componentData, void* source, rapidjson::Value& entityData, rapidjson::Document::AllocatorType& allocator) = 0;
+    virtual bool Rebase(void* componentData, void* before, void* after) = 0;
+
     virtual void ApplyFunction(void* component, std::function<void(void*)> func) = 0;
 
     virtual void RegisterAction(const std::string& name, std::function<void(void*, void*)> func) = 0;
@@ -9,9 +9,18 @@
            - REFLECTABLE: Macro to enable reflection on specified class members.
            - CLASSTOSTRING: Macro to retrieve the class name as a string.
            - FOR_EACH: Macro to apply another macro to each argument in a list.
-           - COUNT_ARGS: Counts the number of arguments provided to a macro.
+           - COUNT_ARGS: Counts up to 16 arguments provided to a macro, REFLECTABLE
+             counts its members without it.
            - ApplyFunction: Template function that applies a provided function to
              each member of a class using reflection.
+           - Fields: constexpr descriptor of every reflected member, its
+             name and FNV-1a hash of the name, offset, size, type ID and
+             flags, with no limit on the number of members.
+           - REFLECT_FIELD_FLAGS: Marks members editor only or transient
+             instead of the default, serialized.
+           - REFLECT_SCHEMA_VERSION: The version of the saved form of a
+             class, raised with a migration step whenever its members
+             change in a way old files cannot load as they are.
 
 This file allows users to perform compile-time reflection in C++, enabling
 dynamic access to class members for serialization, inspection, or function
@@ -27,7 +36,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define REFLECT_H
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <functional>
 #include <type_traits>
@@ -66,10 +79,132 @@ prior written consent of DigiPen Institute of Technology is prohibited.
         return #CLASS; \
     }
 
+namespace reflect {
+
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    //64 bit FNV-1a, the same hash Serialization::HashBytes gives at runtime
+    constexpr uint64_t HashName(std::string_view name) {
+        uint64_t hash = FNV_OFFSET;
+        for (const char c : name) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    //hash of the compiler's spelling of T, stable within a build but not across compilers
+    template <typename T>
+    constexpr uint64_t TypeID() {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return HashName(__FUNCSIG__);
+#else
+        return HashName(__PRETTY_FUNCTION__);
+#endif
+    }
+
+    enum FieldFlags : uint32_t {
+        NONE = 0,
+        SERIALIZE = 1 << 0,     //saved, loaded and shown in the editor
+        EDITOR_ONLY = 1 << 1,   //shown in the editor, never saved
+        TRANSIENT = 1 << 2,     //runtime state, neither saved nor shown
+    };
+
+    struct FieldDescriptor {
+        std::string_view name;
+        uint64_t nameHash{};
+        std::size_t offset{};
+        std::size_t size{};
+        uint64_t typeID{};
+        uint32_t flags{};
+        bool trivial{};         //std::is_trivially_copyable, the member can be copied with memcpy
+
+        constexpr bool Has(FieldFlags flag) const { return (flags & flag) != 0; }
+    };
+
+    struct FieldFlagOverride {
+        std::string_view name;
+        uint32_t flags{};
+    };
+
+    //flags of the member "name" of T, SERIALIZE unless T lists it in REFLECT_FIELD_FLAGS
+    template <typename T>
+    constexpr uint32_t FlagsOf(std::string_view name) {
+        if constexpr (requires { T::FieldFlagOverrides; }) {
+            for (const FieldFlagOverride& entry : T::FieldFlagOverrides) {
+                if (entry.name == name) return entry.flags;
+            }
+        }
+        return SERIALIZE;
+    }
+
+    template <typename T, typename M>
+    constexpr FieldDescriptor MakeField(std::string_view name, std::size_t offset) {
+        return { name, HashName(name), offset, sizeof(M), TypeID<M>(), FlagsOf<T>(name), std::is_trivially_copyable_v<M> };
+    }
+
+    //index of the member of T hashed to "nameHash", -1 if there is none
+    template <typename T>
+    constexpr int IndexOf(uint64_t nameHash) {
+        constexpr auto fields = T::Fields();
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            if (fields[i].nameHash == nameHash) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    template <typename T>
+    constexpr int IndexOf(std::string_view name) {
+        const int index = IndexOf<T>(HashName(name));
+        return index >= 0 && T::Fields()[index].name == name ? index : -1;
+    }
+
+    //the saved form's version of T, 1 unless T raises it with REFLECT_SCHEMA_VERSION
+    template <typename T>
+    constexpr uint32_t SchemaVersion() {
+        if constexpr (requires { T::schemaVersion; }) {
+            return T::schemaVersion;
+        }
+        return 1;
+    }
+
+    //false if REFLECT_FIELD_FLAGS names a member that is not reflected
+    template <typename T>
+    constexpr bool OverridesMatchFields() {
+        if constexpr (requires { T::FieldFlagOverrides; }) {
+            for (const FieldFlagOverride& entry : T::FieldFlagOverrides) {
+                if (IndexOf<T>(entry.name) < 0) return false;
+            }
+        }
+        return true;
+    }
+}
+
+//offsetof is only conditionally supported on classes that are not standard layout, the compilers built with all support it
+#if defined(__GNUC__)
+#define REFLECT_OFFSETOF_BEGIN _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Winvalid-offsetof\"")
+#define REFLECT_OFFSETOF_END _Pragma("GCC diagnostic pop")
+#else
+#define REFLECT_OFFSETOF_BEGIN
+#define REFLECT_OFFSETOF_END
+#endif
+
+#define REFLECT_FIELD(ARG) reflect::MakeField<Self, decltype(Self::ARG)>(#ARG, offsetof(Self, ARG)),
+
+// Lists members whose flags are not SERIALIZE, e.g. REFLECT_FIELD_FLAGS({ "hasPlayed", reflect::TRANSIENT })
+#define REFLECT_FIELD_FLAGS(...) \
+    inline static constexpr reflect::FieldFlagOverride FieldFlagOverrides[] = { __VA_ARGS__ };
+
+// Raised from 1 with a migration step for files saved before, see Serialization::SchemaMigrations
+#define REFLECT_SCHEMA_VERSION(VERSION) \
+    inline static constexpr uint32_t schemaVersion = VERSION; \
+    static_assert(VERSION >= 1, "schema versions start at 1");
+
 #define REFLECTABLE(CLASSNAME, ...) \
     CLASSTOSTRING(CLASSNAME) \
+    inline static constexpr std::size_t fieldcount = std::initializer_list<const char*>{ FOR_EACH(TOSTRING, __VA_ARGS__) }.size(); \
     inline auto membercount() const { \
-        return COUNT_ARGS(__VA_ARGS__); \
+        return static_cast<int>(fieldcount); \
     } \
     inline auto member()  { \
         return std::tie(__VA_ARGS__); \
@@ -77,12 +212,18 @@ prior written consent of DigiPen Institute of Technology is prohibited.
     inline auto member() const { \
         return std::tie(__VA_ARGS__); \
     } \
-    inline static const std::array<std::string, COUNT_ARGS(__VA_ARGS__)> Names() { \
+    inline static const std::array<std::string, fieldcount> Names() { \
         return {FOR_EACH(TOSTRING, __VA_ARGS__)}; \
     } \
     inline static const std::vector<std::string> NamesV() { \
         return {FOR_EACH(TOSTRING, __VA_ARGS__)}; \
     } \
+    inline static constexpr std::array<reflect::FieldDescriptor, fieldcount> Fields() { \
+        using Self [[maybe_unused]] = CLASSNAME; \
+        REFLECT_OFFSETOF_BEGIN \
+        return { FOR_EACH(REFLECT_FIELD, __VA_ARGS__) }; \
+        REFLECT_OFFSETOF_END \
+    } \
     template <typename T> \
     void ApplyFunction(T&& function) { \
         std::tuple members = member(); \
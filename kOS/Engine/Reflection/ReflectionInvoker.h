@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "IReflectionInvoker.h"
 #include "DeSerialization/SerializationReflection.h"
+#include "DeSerialization/BinarySerializationReflection.h"
 
 
 
@@ -32,13 +33,44 @@ public:
     }
 
     void Load(ecs::EntityID ID, const rapidjson::Value& entityData) override {
-        T* component = m_ecs->AddComponent<T>(ID);
+        //a prefab instance already has the component, its overrides are loaded over it
+        T* component = m_ecs->HasComponent<T>(ID) ? m_ecs->GetComponent<T>(ID) : m_ecs->AddComponent<T>(ID);
 
         if (component) {
             LoadComponentreflect(component, entityData);
         }
     }
 
+    uint64_t SchemaHash() override {
+        return Serialization::SchemaHash<T>();
+    }
+
+    void SaveBinary(const std::vector<ecs::EntityID>& entities, Serialization::BinaryWriter& writer) override {
+        std::vector<T*> rows;
+        rows.reserve(entities.size());
+        for (ecs::EntityID id : entities) {
+            rows.push_back(m_ecs->GetComponent<T>(id));
+        }
+        Serialization::WriteComponentColumns(rows, writer);
+    }
+
+    void LoadBinary(const std::vector<ecs::EntityID>& entities, Serialization::BinaryReader& reader) override {
+        std::vector<T*> rows;
+        rows.reserve(entities.size());
+        for (ecs::EntityID id : entities) {
+            rows.push_back(m_ecs->AddComponent<T>(id));
+        }
+        Serialization::ReadComponentColumns(rows, reader);
+    }
+
+    uint64_t HashBinary(ecs::EntityID ID, uint64_t hash) override {
+        return Serialization::HashComponent(*m_ecs->GetComponent<T>(ID), hash);
+    }
+
+    const Serialization::SaxType& GetSaxType() override {
+        return Serialization::GetSaxType<T>();
+    }
+
     bool Compare(void* componentData1, void* componentData2) {
         return CompareComponentReflect(static_cast<T*>(componentData1), static_cast<T*>(componentData2));
     }
@@ -78,6 +110,72 @@ public:
         return m_ecs->DuplicateComponent<T>(duplicateID, newID);
     }
 
+    std::shared_ptr<void> CaptureRows(const std::vector<ecs::EntityID>& entities) override {
+        auto rows = std::make_shared<std::vector<T>>(entities.size());
+        for (size_t i = 0; i < entities.size(); ++i) {
+            CopyReflected((*rows)[i], *m_ecs->GetComponent<T>(entities[i]));
+        }
+        return rows;
+    }
+
+    void InstantiateRows(const void* rows, const std::vector<ecs::EntityID>& entities) override {
+        const auto& components = *static_cast<const std::vector<T>*>(rows);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            T* component = m_ecs->HasComponent<T>(entities[i]) ? m_ecs->GetComponent<T>(entities[i]) : m_ecs->AddComponent<T>(entities[i]);
+            CopyReflected(*component, components[i]);
+        }
+    }
+
+    void* GetRow(void* rows, size_t row) override {
+        return &(*static_cast<std::vector<T>*>(rows))[row];
+    }
+
+    std::shared_ptr<void> CreateRows() override {
+        return std::make_shared<std::vector<T>>();
+    }
+
+    void* AddRow(void* rows) override {
+        return &static_cast<std::vector<T>*>(rows)->emplace_back();
+    }
+
+    void InstantiateRow(const void* rows, size_t row, ecs::EntityID ID) override {
+        const T& source = (*static_cast<const std::vector<T>*>(rows))[row];
+        T* component = m_ecs->HasComponent<T>(ID) ? m_ecs->GetComponent<T>(ID) : m_ecs->AddComponent<T>(ID);
+        CopyReflected(*component, source);
+    }
+
+    bool SaveOverrides(void* componentData, void* source, rapidjson::Value& entityData, rapidjson::Document::AllocatorType& allocator) override {
+        return saveOverridesreflect(static_cast<T*>(componentData), static_cast<T*>(source), entityData, allocator);
+    }
+
+    bool Rebase(void* componentData, void* before, void* after) override {
+        auto members = static_cast<T*>(componentData)->member();
+        auto beforeMembers = static_cast<T*>(before)->member();
+        auto afterMembers = static_cast<T*>(after)->member();
+        CompareComponent<decltype(T::Names())> compare{ T::Names() };
+        DeepCopyComponents<T> duplicator;
+        bool changed = false;
+
+        [&] <std::size_t... Is>(std::index_sequence<Is...>) {
+            ([&] {
+                //overridden by the instance
+                compare.result = true;
+                compare(std::get<Is>(members), std::get<Is>(beforeMembers));
+                if (!compare.result) return;
+
+                //not changed in the prefab
+                compare(std::get<Is>(beforeMembers), std::get<Is>(afterMembers));
+                if (compare.result) return;
+
+                duplicator(std::get<Is>(members), std::get<Is>(afterMembers));
+                changed = true;
+            }(), ...);
+        }(std::make_index_sequence<std::tuple_size_v<decltype(members)>>{});
+
+        if (changed) m_ecs->MarkDirty(static_cast<T*>(componentData)->entity);
+        return changed;
+    }
+
     void ApplyFunction(void* component, std::function<void(void*)> func) override {
         T* Component = static_cast<T*>(component);
         Component->ApplyFunction([func](auto& member) {
@@ -0,0 +1,21 @@
+#include "Config/pch.h"
+#include "Resources/R_AnimationController.h"
+#include "AssetPipeline/VirtualFileSystem.h"
+
+void R_AnimationController::Load() {
+    std::string binary;
+    if (!assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(this->m_filePath, binary)) {
+        LOGGING_ERROR("Animation Controller: failed to open " + this->m_filePath.string());
+        return;
+    }
+
+    std::string error;
+    if (!m_Controller.Load(binary, error)) {
+        LOGGING_ERROR("Animation Controller: " + this->m_filePath.string() + ": " + error);
+        m_Controller = {};
+    }
+}
+
+void R_AnimationController::Unload() {
+    m_Controller = {};
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "Config/pch.h"
+#include "Resource.h"
+#include "Animation/AnimationController.h"
+
+class R_AnimationController :public Resource
+{
+public:
+	using Resource::Resource;
+	void Load() override;
+	void Unload() override;
+
+	//shared by every animator that uses this controller, state lives in animation::ControllerInstance
+	const animation::AnimationController& GetController() const { return m_Controller; };
+
+	REFLECTABLE(R_AnimationController);
+private:
+
+	animation::AnimationController m_Controller;
+
+};
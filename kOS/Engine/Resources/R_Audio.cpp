@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 /********************************************************************/
 #include "Config/pch.h"
 #include "R_Audio.h"
+#include "AssetPipeline/VirtualFileSystem.h"
 
 FMOD::System* R_Audio::s_globalSystem = nullptr;
 
@@ -31,7 +32,8 @@ void R_Audio::Load()
 	}
 
 	//Check if file path exist
-	if (!std::filesystem::exists(m_filePath)) {
+	auto vfs = assetpipeline::VirtualFileSystem::GetInstance();
+	if (!vfs->Exists(m_filePath)) {
 		std::cout << "[Audio] file not found: " << m_filePath.string() << "\n";
 		return;
 	}
@@ -45,15 +47,39 @@ void R_Audio::Load()
 	if (m_createFlags != 0) {
 		flags = m_createFlags;
 	}
-	FMOD_RESULT r = sys->createSound(m_filePath.string().c_str(), flags, nullptr, &m_sound);
+	//loose files are opened by FMOD, packed ones are read into m_packedData. FMOD copies a sample out of it,
+	//but a stream keeps reading from it, so it is pointed at the buffer and the buffer lives until Unload
+	m_packedData.clear();
+	const bool packed = vfs->IsPacked(m_filePath) && vfs->ReadFile(m_filePath, m_packedData);
+	FMOD_CREATESOUNDEXINFO info{};
+	info.cbsize = sizeof(info);
+	info.length = static_cast<unsigned int>(m_packedData.size());
+	const std::string path = m_filePath.string();
+
+	auto createSound = [&](unsigned int mode) {
+		if (!packed) {
+			return sys->createSound(path.c_str(), mode, nullptr, &m_sound);
+		}
+		const unsigned int memory = (mode & FMOD_CREATESTREAM) ? FMOD_OPENMEMORY_POINT : FMOD_OPENMEMORY;
+		return sys->createSound(m_packedData.data(), mode | memory, &info, &m_sound);
+		};
+
+	FMOD_RESULT r = createSound(flags);
 
 	if (r != FMOD_OK || !m_sound) {
-		r = sys->createSound(m_filePath.string().c_str(), flags | FMOD_CREATESTREAM, nullptr, &m_sound);
+		flags |= FMOD_CREATESTREAM;
+		r = createSound(flags);
 		if (r != FMOD_OK || !m_sound) {
 			m_sound = nullptr;
+			m_packedData = std::string{};
 			return;
 		}
 	}
+
+	//a sample has its own copy
+	if (!(flags & FMOD_CREATESTREAM)) {
+		m_packedData = std::string{};
+	}
 }
 
 void R_Audio::Unload()
@@ -63,4 +89,6 @@ void R_Audio::Unload()
 		m_sound->release();
 		m_sound = nullptr;
 	}
+	//only after the sound that may be streaming from it is gone
+	m_packedData = std::string{};
 }
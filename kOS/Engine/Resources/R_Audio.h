@@ -35,6 +35,7 @@ public:
     FMOD::System* GetSystem() const { return m_system ? m_system : s_globalSystem; }
 
     void SetSystem(FMOD::System* sys) { m_system = sys; }
+    void SetCreateFlags(unsigned int flags) { m_createFlags = flags; }
     static void SetGlobalSystem(FMOD::System* sys) { s_globalSystem = sys; }
 
 
@@ -44,5 +45,6 @@ private:
     FMOD::System* m_system = nullptr;        
     FMOD::Sound* m_sound = nullptr;       
     unsigned int  m_createFlags = 0;
+    std::string   m_packedData;     //bytes of a packed entry, a stream reads from them until Unload
     static FMOD::System* s_globalSystem;     
 };
@@ -1,6 +1,7 @@
 #include "Config/pch.h"
 #include "R_Font.h"
 #include "STB_IMAGE/stb_image.h"
+#include "AssetPipeline/VirtualFileSystem.h"
 
 void R_Font::Load()
 {
@@ -8,11 +9,12 @@ void R_Font::Load()
     m_characters.clear();
     m_atlasWidth = m_atlasHeight = 0;
 
-    std::ifstream ifs(this->m_filePath.string().c_str(), std::ios::binary);
-    if (!ifs) {
+    std::string file;
+    if (!assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(this->m_filePath, file)) {
         std::cerr << "ERROR: cannot open file: " << this->m_filePath.string() << "\n";
         return;
     }
+    std::istringstream ifs(std::move(file));
 
     char magic[4];
     ifs.read(magic, 4);
@@ -1,5 +1,6 @@
 #include "Config/pch.h"
 #include "R_Model.h"
+#include "AssetPipeline/VirtualFileSystem.h"
 
 void PrintMat4(const glm::mat4& mat) {
     for (int row = 0; row < 4; ++row) {
@@ -157,12 +158,10 @@ void R_Model::LoadModel(std::string path)
 }
 
 void R_Model::LoadMesh(std::string meshFile) {
-    std::ifstream inputFile(meshFile.c_str(), std::ios::binary);
-    if (!inputFile) {
+    std::string serialized;
+    if (!assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(meshFile, serialized)) {
         LOGGING_ASSERT("Failed to open mesh file");
     }
-    std::string serialized((std::istreambuf_iterator<char>(inputFile)),
-        std::istreambuf_iterator<char>());
     int offset = 0;
     // std::cout << "Mesh file path is: " << meshFile << '\n';
      //std::cout<<"Mesh file is: " << serialized << '\n';
@@ -467,6 +466,22 @@ void R_Model::DrawAnimation(Shader& shader, PBRMaterial const& pbrMat, const std
         meshes[i].PBRDraw(shader, pbrMat);
 }
 
+animation::SkinningInput R_Model::GetSkinningInput(size_t mesh) const
+{
+    static_assert(MAX_BONE_INFLUENCE == animation::SKINNING_INFLUENCES, "vertex influences must match the skinning module");
+
+    const std::vector<Vertex>& vertices = meshes[mesh].vertices;
+    animation::SkinningInput input;
+    input.vertices = reinterpret_cast<const std::byte*>(vertices.data());
+    input.stride = sizeof(Vertex);
+    input.count = vertices.size();
+    input.positionOffset = offsetof(Vertex, Position);
+    input.normalOffset = offsetof(Vertex, Normal);
+    input.boneIdOffset = offsetof(Vertex, m_BoneIDs);
+    input.weightOffset = offsetof(Vertex, m_Weights);
+    return input;
+}
+
 glm::mat4 R_Model::ConvertToGLMMat4(const aiMatrix4x4& original)
 {
     glm::mat4 transformed{};
@@ -7,6 +7,7 @@
 #include "Resource.h"
 #include "Graphics/Shader.h"
 #include "Graphics/Material.h"
+#include "Animation/CpuSkinning.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -174,6 +175,10 @@ public:
 	const std::unordered_map<std::string, int>& GetBoneMap() const { return bones_loaded; }
 	std::unordered_map<std::string, int>& GetBoneMap() { return bones_loaded; }
 	glm::mat4 GetGlobalInverse() const { return globalInverseTransform; }
+
+	//vertices of each mesh as input for animation::SkinVertices
+	size_t GetMeshCount() const { return meshes.size(); }
+	animation::SkinningInput GetSkinningInput(size_t mesh) const;
 	void LoadMesh(std::string meshFile);
 
 	/// <summary>
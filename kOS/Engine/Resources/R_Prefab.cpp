@@ -11,24 +11,39 @@ void R_Prefab::Unload()
 {
 
 	//scenes::SceneManager::m_GetInstance()->ClearScene(m_filePath.filename().string());
+	m_template = {};
 
 }
 
 int R_Prefab::DuplicatePrefabIntoScene(const std::string& scene) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	if (ecs->sceneMap.find(scene) == ecs->sceneMap.end()) {
+		LOGGING_WARN("Scene not loaded: {}", scene.c_str());
+		return -1;
+	}
+
+	//packed prefabs have no write time and never change
+	std::error_code ec;
+	const auto writeTime = std::filesystem::last_write_time(m_filePath, ec);
+	if (!m_template.Empty() && (ec || writeTime == m_templateWriteTime)) {
+		return static_cast<int>(ecs->InstantiateTemplate(m_template, scene));
+	}
+
 	auto* sm = ComponentRegistry::GetSceneInstance();
+	const size_t firstNewEntity = ecs->GetSceneData(scene).sceneIDs.size();
 	sm->LoadSceneToCurrent(scene, m_filePath);
-	auto* ecs = ComponentRegistry::GetECSInstance();
 	const auto& sceneData = ecs->GetSceneData(scene);
-	ecs::EntityID newID;
 
-	//retrieve the new id that just spawned (the one without parent) - TODO: improve this later
-	for (auto it = sceneData.sceneIDs.rbegin(); it != sceneData.sceneIDs.rend(); ++it) {
-		const auto& entityID = *it;
+	//the first entity the prefab added without a parent is its root
+	for (size_t i = firstNewEntity; i < sceneData.sceneIDs.size(); ++i) {
+		const ecs::EntityID entityID = sceneData.sceneIDs[i];
 		auto* tc = ecs->GetComponent<ecs::TransformComponent>(entityID);
 		if (tc->m_haveParent == false) {
+			m_template = ecs->CaptureTemplate(entityID);
+			m_templateWriteTime = ec ? std::filesystem::file_time_type{} : writeTime;
 			return static_cast<int>(entityID);
 		}
 	}
 
 	return -1;
-}
\ No newline at end of file
+}
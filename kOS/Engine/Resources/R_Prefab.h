@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "Resource.h"
 #include "ECS/ECSList.h"
+#include "ECS/EntityTemplate.h"
 
 class R_Prefab :public Resource
 {
@@ -26,10 +27,16 @@ public:
 
 	void Unload() override;
 
+	//the first call loads the prefab file and keeps its entities as a template, later calls clone the template
 	int DuplicatePrefabIntoScene(const std::string& scene);
 
 	REFLECTABLE(R_Prefab);
 
+private:
+
+	ecs::EntityTemplate m_template;
+	std::filesystem::file_time_type m_templateWriteTime{};  //of the prefab file the template was loaded from
+
 
 };
 
@@ -2,6 +2,7 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <STB_IMAGE/stb_image.h>
 #include "R_Texture.h"
+#include "AssetPipeline/VirtualFileSystem.h"
 void R_Texture::Load()
 {	
 	std::filesystem::path path = this->GetFilePath();
@@ -33,8 +34,10 @@ void R_Texture::stbiLoad(const char* texturePath) {
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 	//Load texture
+	std::string file;
+	assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(texturePath, file);
 	int nrChannels;
-	unsigned char* data = stbi_load(texturePath, &width, &height, &nrChannels, 0);
+	unsigned char* data = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(file.data()), static_cast<int>(file.size()), &width, &height, &nrChannels, 0);
 	//Load texture
 	if (!data) {
 		std::cout << "FAILED TO LOAD TEXURE";
@@ -62,7 +65,9 @@ void R_Texture::stbiLoad(const char* texturePath) {
 
 void R_Texture::LoadDSSTexture(const char* texturePath) {
 	FreeTexture();
-	gli::texture Texture = gli::load(texturePath);
+	std::string file;
+	assetpipeline::VirtualFileSystem::GetInstance()->ReadFile(texturePath, file);
+	gli::texture Texture = gli::load(file.data(), file.size());
 	if (Texture.empty())std::cout << "ERORR LOADING DSS";
 
 	gli::gl GL(gli::gl::PROFILE_GL33);
@@ -4,6 +4,7 @@
 #include "R_Texture.h"
 #include "R_Scene.h"
 #include "R_Animation.h"
+#include "R_AnimationController.h"
 #include "R_Audio.h"
 #include "R_Material.h"
 #include "R_DepthMapCube.h"
@@ -25,9 +25,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Resources/R_Font.h"
 #include "Resources/R_Scene.h"
 #include "Resources/R_Animation.h"
+#include "Resources/R_AnimationController.h"
 #include "Resources/R_Audio.h"
 #include "Resources/R_Material.h"
 #include "Resources/R_DepthMapCube.h"
+#include "AssetPipeline/VirtualFileSystem.h"
 class ResourceManager {
 
 public:
@@ -38,6 +40,7 @@ public:
 		RegisterResourceType<R_Texture>(".dds");
 		RegisterResourceType<R_Scene>(".scene");
 		RegisterResourceType<R_Animation>(".ani");
+		RegisterResourceType<R_AnimationController>(".ctrl");
 		RegisterResourceType<R_Audio>(".wav");
 		RegisterResourceType<R_Material>(".mat");
 		RegisterResourceType<R_DepthMapCube>(".dcm");
@@ -59,6 +62,11 @@ public:
 		m_resourceDirectory = Directory;
 	}
 
+	//resources in the pack are read from it instead of from loose files
+	bool MountPack(const std::filesystem::path& packPath) {
+		return assetpipeline::VirtualFileSystem::GetInstance()->Mount(packPath, m_resourceDirectory);
+	}
+
 
 
 
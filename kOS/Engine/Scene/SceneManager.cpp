@@ -16,6 +16,8 @@
            - m_SaveAllActiveScenes: Saves all active scenes.
            - m_SwapScenes: Moves an entity from one scene to another.
            - GetSceneByEntityID: Finds the scene that contains a specified entity.
+           - PartitionScene: Splits a scene into world partition cells.
+           - UpdateStreaming: Streams world partition cells in and out.
 
 This file supports scene management by providing functions for creating, saving,
 loading, and clearing scenes within a game, allowing dynamic control of game states.
@@ -224,6 +226,10 @@ namespace scenes {
 			}
             m_loadQueue.clear();
 		}
+
+        if (m_partitionOpen) {
+            UpdateStreaming(GatherStreamingSources());
+        }
 	}
 
 	bool SceneManager::ImmediateLoadScene(const std::filesystem::path& scene, const std::string forcedSceneName)
@@ -238,8 +244,7 @@ namespace scenes {
 
 		// Ensure the JSON file exists
 
-		std::ifstream checkFile(scene.string());
-		if (!checkFile) {
+		if (!assetpipeline::VirtualFileSystem::GetInstance()->Exists(scene)) {
 			if (!CreateNewScene(scene)) {
 				LOGGING_ERROR("Fail to Create file");
 				return false;
@@ -295,6 +300,7 @@ namespace scenes {
         vectorenityid.erase(it);
 
         m_ecs->sceneMap.find(newscene)->second.sceneIDs.push_back(id);
+        m_ecs->MarkDirty(id);
 
     }
 
@@ -321,7 +327,7 @@ namespace scenes {
 		}
     }
 
-    // Files will be cached in the same location with added "filename[Cached].json" label
+    // Files will be cached in the same location with added "filename[Cached].json" label, compact and compressed since only ReloadScene reads them
     void SceneManager::CacheCurrentScene(){
 
         for (auto [fileName, path] : loadScenePath) {
@@ -330,7 +336,7 @@ namespace scenes {
                 if (iter->second.isPrefab) continue;
                 std::string newPath = path.parent_path().string() + '\\' + path.stem().string() + "[Cached]" + path.extension().string();
                 cacheScenePath.push_back(newPath);
-                Serialization::SaveScene(fileName, newPath);
+                Serialization::SaveScene(fileName, newPath, Serialization::RUNTIME_SAVE);
 
                 SetFileAttributesA(newPath.c_str(), GetFileAttributesA(newPath.c_str()) | FILE_ATTRIBUTE_HIDDEN);
             }
@@ -340,6 +346,8 @@ namespace scenes {
     void SceneManager::DeleteAllCacheScenes() {
         for (auto const& filePath : cacheScenePath) {
             std::filesystem::remove(filePath);
+            std::filesystem::remove(Serialization::GetCookedScenePath(filePath));
+            std::filesystem::remove(Serialization::GetSceneIndexPath(filePath));
         }
     }
 
@@ -354,7 +362,215 @@ namespace scenes {
         Serialization::LoadScene(filepath, currentScene);
     }
 
-  
+    bool SceneManager::PartitionScene(const std::string& scene, float cellSize, const std::filesystem::path& layoutPath)
+    {
+        const auto sceneIt = m_ecs->sceneMap.find(scene);
+        if (sceneIt == m_ecs->sceneMap.end() || cellSize <= 0.f) {
+            LOGGING_WARN("Scene not loaded or cell size not above 0");
+            return false;
+        }
+        const std::vector<ecs::EntityID> sceneOrder = sceneIt->second.sceneIDs;
+
+        //roots by the cell they stand in, in scene order
+        std::map<std::pair<int, int>, std::vector<ecs::EntityID>> cellRoots;
+        for (const auto id : sceneOrder) {
+            if (hierachy::GetParent(id)) continue;
+            const glm::vec3& position = m_ecs->GetComponent<ecs::TransformComponent>(id)->WorldTransformation.position;
+            cellRoots[{ static_cast<int>(std::floor(position.x / cellSize)), static_cast<int>(std::floor(position.z / cellSize)) }].push_back(id);
+        }
+
+        WorldPartitionLayout layout;
+        layout.cellSize = cellSize;
+        const std::string stem = layoutPath.stem().string();
+        for (const auto& [coordinate, roots] : cellRoots) {
+            WorldPartitionCell cell{ coordinate.first, coordinate.second, stem + "_" + std::to_string(coordinate.first) + "_" + std::to_string(coordinate.second) + ".json" };
+            if (m_ecs->sceneMap.find(cell.scene) != m_ecs->sceneMap.end()) {
+                LOGGING_ERROR("Cannot partition {}, {} is already loaded", scene, cell.scene);
+                return false;
+            }
+
+            //moved into a scene of the cell's own while it is saved
+            std::vector<ecs::EntityID> entities;
+            for (const auto root : roots) {
+                const std::vector<ecs::EntityID> subtree = m_ecs->GetSubtree(root);
+                entities.insert(entities.end(), subtree.begin(), subtree.end());
+            }
+            m_ecs->AddScene(cell.scene, SceneData{});
+            for (const auto id : entities) {
+                SwapScenes(scene, cell.scene, id);
+            }
+
+            const std::filesystem::path cellPath = layoutPath.parent_path() / cell.scene;
+            Serialization::SaveScene(cell.scene, cellPath);
+
+            for (const auto id : entities) {
+                SwapScenes(cell.scene, scene, id);
+            }
+            m_ecs->sceneMap.erase(cell.scene);
+
+            std::error_code ec;
+            const auto bytes = std::filesystem::file_size(cellPath, ec);
+            if (ec) {
+                LOGGING_ERROR("Fail to save world partition cell {}", cellPath.string());
+                return false;
+            }
+            cell.bytes = static_cast<int>(bytes);
+            layout.cells.push_back(std::move(cell));
+        }
+        m_ecs->sceneMap.at(scene).sceneIDs = sceneOrder;
+
+        return Serialization::WriteJsonFile(layoutPath.string(), &layout);
+    }
+
+    bool SceneManager::OpenWorldPartition(const std::filesystem::path& layoutPath, const StreamingSettings& settings)
+    {
+        CloseWorldPartition();
+
+        if (!assetpipeline::VirtualFileSystem::GetInstance()->Exists(layoutPath)) {
+            LOGGING_WARN("World partition layout {} does not exist", layoutPath.string());
+            return false;
+        }
+        const WorldPartitionLayout layout = Serialization::ReadJsonFile<WorldPartitionLayout>(layoutPath.string());
+        if (layout.cellSize <= 0.f) {
+            LOGGING_WARN("World partition layout {} has no cell size", layoutPath.string());
+            return false;
+        }
+
+        //cells saved without their size count what they are on disk
+        std::vector<size_t> cellBytes;
+        for (const auto& cell : layout.cells) {
+            const std::filesystem::path cellPath = layoutPath.parent_path() / cell.scene;
+            std::error_code ec;
+            const auto bytes = cell.bytes > 0 ? static_cast<uintmax_t>(cell.bytes) : std::filesystem::file_size(cellPath, ec);
+            cellBytes.push_back(ec ? 0 : static_cast<size_t>(bytes));
+            m_cellPaths.push_back(cellPath);
+            m_cellScenes.push_back(cellPath.filename().string());
+        }
+
+        m_partition.SetLayout(layout, std::move(cellBytes));
+        m_partition.SetSettings(settings);
+        m_partitionOpen = true;
+        return true;
+    }
+
+    void SceneManager::CloseWorldPartition()
+    {
+        for (auto& streaming : m_streamingCells) {
+            if (streaming.staging.valid()) streaming.staging.wait();
+        }
+        for (auto& staging : m_abandonedStaging) {
+            staging.wait();
+        }
+        m_streamingCells.clear();
+        m_abandonedStaging.clear();
+
+        for (const size_t cell : m_partition.GetResidentCells()) {
+            const std::string& scene = m_cellScenes[cell];
+            if (m_ecs->sceneMap.find(scene) != m_ecs->sceneMap.end()) {
+                ImmediateClearScene(scene);
+            }
+            loadScenePath.erase(scene);
+        }
+
+        m_partition = WorldPartition{};
+        m_cellScenes.clear();
+        m_cellPaths.clear();
+        m_partitionOpen = false;
+    }
+
+    void SceneManager::UpdateStreaming(const std::vector<StreamingSource>& sources)
+    {
+        if (!m_partitionOpen) return;
+
+        std::erase_if(m_abandonedStaging, [](const auto& staging) {
+            return staging.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+
+        const StreamingPlan plan = m_partition.Update(sources);
+        for (const size_t cell : plan.unload) {
+            const auto it = std::find_if(m_streamingCells.begin(), m_streamingCells.end(), [cell](const StreamingCell& streaming) {
+                return streaming.cell == cell;
+            });
+            if (it != m_streamingCells.end()) {
+                //a thread cannot be stopped halfway, what it stages is dropped
+                if (it->staging.valid()) m_abandonedStaging.push_back(std::move(it->staging));
+                m_streamingCells.erase(it);
+            }
+
+            const std::string& scene = m_cellScenes[cell];
+            if (m_ecs->sceneMap.find(scene) != m_ecs->sceneMap.end()) {
+                ImmediateClearScene(scene);
+            }
+            loadScenePath.erase(scene);
+        }
+
+        //one thread per cell, WorldPartition caps how many are loading
+        Serialization::SceneLoadSettings staging;
+        staging.threadCount = 1;
+        for (const size_t cell : plan.load) {
+            StreamingCell streaming;
+            streaming.cell = cell;
+            streaming.staging = std::async(std::launch::async, Serialization::StageScene, m_cellPaths[cell], staging);
+            m_streamingCells.push_back(std::move(streaming));
+        }
+
+        //committed in the order they were asked for, a cell still being staged holds back those after it
+        const size_t commitBudget = m_partition.GetSettings().commitBudget;
+        size_t steps = commitBudget ? commitBudget : std::numeric_limits<size_t>::max();
+        while (!m_streamingCells.empty() && steps > 0) {
+            StreamingCell& streaming = m_streamingCells.front();
+            if (streaming.staging.valid()) {
+                if (streaming.staging.wait_for(std::chrono::seconds(0)) != std::future_status::ready) break;
+                streaming.staged = streaming.staging.get();
+            }
+
+            const std::string& scene = m_cellScenes[streaming.cell];
+            if (!streaming.committing) {
+                BeginCellCommit(streaming);
+                //loaded whole, it takes what is left of the frame
+                if (!streaming.staged && commitBudget) steps = 0;
+            }
+            if (streaming.staged) {
+                steps -= Serialization::CommitStagedScene(*streaming.staged, scene, steps);
+                if (!Serialization::IsCommitted(*streaming.staged)) break;
+            }
+
+            onSceneLoaded.Invoke(m_ecs->sceneMap.at(scene));
+            m_partition.OnCellLoaded(streaming.cell);
+            m_streamingCells.pop_front();
+        }
+    }
+
+    void SceneManager::BeginCellCommit(StreamingCell& streaming)
+    {
+        const std::string& scene = m_cellScenes[streaming.cell];
+        loadScenePath[scene] = m_cellPaths[streaming.cell];
+        m_ecs->sceneMap[scene];
+        streaming.committing = true;
+
+        //prefab instances, older schema versions and damaged files are left to the streaming loader
+        if (!streaming.staged) {
+            Serialization::LoadScene(m_cellPaths[streaming.cell], scene);
+        }
+    }
+
+    std::vector<StreamingSource> SceneManager::GatherStreamingSources()
+    {
+        std::vector<StreamingSource> sources;
+        auto gather = [&](const std::string& componentName) {
+            for (const ecs::EntityID id : m_ecs->GetComponentsEnties(componentName)) {
+                const auto* transform = m_ecs->GetComponent<ecs::TransformComponent>(id);
+                const auto* nameComp = m_ecs->GetComponent<ecs::NameComponent>(id);
+                if (!transform || !nameComp || nameComp->hide) continue;
+                if (!m_ecs->layersStack.m_layerBitSet.test(nameComp->Layer)) continue;
+                sources.push_back({ transform->WorldTransformation.position });
+            }
+        };
+        gather(ecs::CameraComponent::classname());
+        gather(ecs::CharacterControllerComponent::classname());
+        return sources;
+    }
+
     //void SceneManager::AssignEntityNewScene(const std::string& scene, m_ecs::EntityID id)
     //{
     //    m_ecs::ECS* m_ecs = m_ecs::ComponentRegistry::GetECSInstance();
@@ -16,6 +16,8 @@
 		   - m_SaveAllActiveScenes: Saves all active scenes.
 		   - m_SwapScenes: Moves an entity from one scene to another.
 		   - GetSceneByEntityID: Finds the scene that contains a specified entity.
+		   - PartitionScene: Splits a scene into world partition cells.
+		   - OpenWorldPartition: Streams the cells of a partitioned level.
 
 This file supports camera management by providing functions to calculate
 view and projection matrices for rendering 3D scenes and UI elements.
@@ -33,6 +35,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "DeSerialization/json_handler.h"
 #include "Events/Delegate.h"
 #include "SceneData.h"
+#include "WorldPartition.h"
 #include "ECS/ECS.h"
 
 namespace scenes {
@@ -75,6 +78,21 @@ namespace scenes {
 
 		void LoadSceneToCurrent(const std::string& currentScene, const std::filesystem::path& filepath);
 
+		//saves the root entities of "scene", and everything under them, as one scene per cell of "cellSize" their world
+		//position falls in, beside "layoutPath", and the layout listing them at "layoutPath". The scene is left as it was
+		bool PartitionScene(const std::string& scene, float cellSize, const std::filesystem::path& layoutPath);
+
+		//streams the cells of the layout at "layoutPath" from the next Update, around every camera and character controller
+		bool OpenWorldPartition(const std::filesystem::path& layoutPath, const StreamingSettings& settings);
+		//unloads every cell, waiting for any still being staged
+		void CloseWorldPartition();
+		bool IsWorldPartitionOpen() const { return m_partitionOpen; }
+		const WorldPartition& GetWorldPartition() const { return m_partition; }
+		//one frame of streaming around "sources": unloads, starts staging cells and commits up to the commit budget
+		void UpdateStreaming(const std::vector<StreamingSource>& sources);
+		//scene name a cell is loaded as
+		const std::string& GetCellScene(size_t cell) const { return m_cellScenes[cell]; }
+
 		//void AssignEntityNewScene(const std::string& scene, ecs::EntityID id);
 		//EVENTS
 
@@ -85,7 +103,16 @@ namespace scenes {
 
 	private:
 
+		//a cell from when it starts staging until it is committed
+		struct StreamingCell {
+			size_t cell{};
+			std::future<std::shared_ptr<Serialization::StagedScene>> staging;
+			std::shared_ptr<Serialization::StagedScene> staged;
+			bool committing{};
+		};
 
+		std::vector<StreamingSource> GatherStreamingSources();
+		void BeginCellCommit(StreamingCell& streaming);
 
 		std::vector<std::filesystem::path> m_loadQueue;
 		std::vector<std::string> m_clearQueue;
@@ -95,6 +122,14 @@ namespace scenes {
 		std::unordered_map<std::string, std::filesystem::path> loadScenePath;
 		std::vector<std::filesystem::path> m_recentFiles;
 		std::vector<std::filesystem::path> cacheScenePath;
+
+		WorldPartition m_partition;
+		std::vector<std::string> m_cellScenes;
+		std::vector<std::filesystem::path> m_cellPaths;
+		std::deque<StreamingCell> m_streamingCells;  //committed in the order they were asked for
+		//staging of cells unloaded before it finished, kept until it does
+		std::vector<std::future<std::shared_ptr<Serialization::StagedScene>>> m_abandonedStaging;
+		bool m_partitionOpen{};
 		/******************************************************************/
 		/*!
 		\var     static std::unique_ptr<SceneManager> m_InstancePtr
@@ -0,0 +1,157 @@
+/******************************************************************/
+/*!
+\file      WorldPartition.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Which world partition cells to stream in and out around the
+		   streaming sources.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "WorldPartition.h"
+
+namespace scenes {
+
+	namespace {
+
+		//nearest first, the lower index on a tie
+		struct CellDistance {
+			float distance{};
+			size_t cell{};
+
+			bool operator<(const CellDistance& other) const {
+				return distance != other.distance ? distance < other.distance : cell < other.cell;
+			}
+			bool operator==(const CellDistance& other) const { return cell == other.cell; }
+		};
+	}
+
+	uint64_t WorldPartition::CellKey(int x, int z) {
+		return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z);
+	}
+
+	void WorldPartition::SetLayout(const WorldPartitionLayout& layout, std::vector<size_t> cellBytes) {
+		m_layout = layout;
+		m_cellBytes = std::move(cellBytes);
+		m_cellBytes.resize(m_layout.cells.size());
+		m_states.assign(m_layout.cells.size(), CellState::UNLOADED);
+		m_resident.clear();
+		m_residentBytes = 0;
+		m_loadsInFlight = 0;
+
+		m_cellIndex.clear();
+		for (size_t i = 0; i < m_layout.cells.size(); ++i) {
+			const WorldPartitionCell& cell = m_layout.cells[i];
+			if (!m_cellIndex.emplace(CellKey(cell.x, cell.z), i).second) {
+				LOGGING_WARN("World partition cell ({}, {}) is listed twice, {} is ignored", cell.x, cell.z, cell.scene);
+			}
+		}
+	}
+
+	float WorldPartition::Distance(const std::vector<StreamingSource>& sources, size_t cell) const {
+		const WorldPartitionCell& bounds = m_layout.cells[cell];
+		const float minX = bounds.x * m_layout.cellSize;
+		const float minZ = bounds.z * m_layout.cellSize;
+
+		float nearest = std::numeric_limits<float>::infinity();
+		for (const StreamingSource& source : sources) {
+			if (source.radiusScale <= 0.f) continue;
+			const float dx = std::max({ minX - source.position.x, 0.f, source.position.x - (minX + m_layout.cellSize) });
+			const float dz = std::max({ minZ - source.position.z, 0.f, source.position.z - (minZ + m_layout.cellSize) });
+			nearest = std::min(nearest, std::sqrt(dx * dx + dz * dz) / source.radiusScale);
+		}
+		return nearest;
+	}
+
+	size_t WorldPartition::FindCell(const glm::vec3& position) const {
+		const int x = static_cast<int>(std::floor(position.x / m_layout.cellSize));
+		const int z = static_cast<int>(std::floor(position.z / m_layout.cellSize));
+		const auto it = m_cellIndex.find(CellKey(x, z));
+		return it == m_cellIndex.end() ? npos : it->second;
+	}
+
+	void WorldPartition::Unload(size_t cell, StreamingPlan& plan) {
+		if (m_states[cell] == CellState::LOADING) --m_loadsInFlight;
+		m_states[cell] = CellState::UNLOADED;
+		m_resident.erase(cell);
+		m_residentBytes -= m_cellBytes[cell];
+		plan.unload.push_back(cell);
+	}
+
+	StreamingPlan WorldPartition::Update(const std::vector<StreamingSource>& sources) {
+		StreamingPlan plan;
+
+		//cells every source has left, and those in the band that may make room for nearer ones
+		std::vector<CellDistance> band;
+		const std::vector<size_t> resident(m_resident.begin(), m_resident.end());
+		for (const size_t cell : resident) {
+			const float distance = Distance(sources, cell);
+			if (distance > m_settings.unloadRadius) Unload(cell, plan);
+			else if (distance > m_settings.loadRadius) band.push_back({ distance, cell });
+		}
+		//furthest first
+		std::sort(band.begin(), band.end(), [](const CellDistance& a, const CellDistance& b) {
+			return a.distance != b.distance ? a.distance > b.distance : a.cell < b.cell;
+		});
+
+		//only the cells under each source's reach are looked at, not the whole layout
+		std::vector<CellDistance> wanted;
+		for (const StreamingSource& source : sources) {
+			if (source.radiusScale <= 0.f) continue;
+			const float reach = m_settings.loadRadius * source.radiusScale;
+			//cells whose far edge is just "reach" away included
+			const int minX = static_cast<int>(std::ceil((source.position.x - reach) / m_layout.cellSize)) - 1;
+			const int maxX = static_cast<int>(std::floor((source.position.x + reach) / m_layout.cellSize));
+			const int minZ = static_cast<int>(std::ceil((source.position.z - reach) / m_layout.cellSize)) - 1;
+			const int maxZ = static_cast<int>(std::floor((source.position.z + reach) / m_layout.cellSize));
+			for (int x = minX; x <= maxX; ++x) {
+				for (int z = minZ; z <= maxZ; ++z) {
+					const auto it = m_cellIndex.find(CellKey(x, z));
+					if (it == m_cellIndex.end() || m_states[it->second] != CellState::UNLOADED) continue;
+					const float distance = Distance(sources, it->second);
+					if (distance <= m_settings.loadRadius) wanted.push_back({ distance, it->second });
+				}
+			}
+		}
+		std::sort(wanted.begin(), wanted.end());
+		wanted.erase(std::unique(wanted.begin(), wanted.end()), wanted.end());
+
+		size_t evicted = 0;
+		for (const CellDistance& candidate : wanted) {
+			if (m_settings.maxLoadsInFlight && m_loadsInFlight >= m_settings.maxLoadsInFlight) break;
+
+			const size_t bytes = m_cellBytes[candidate.cell];
+			if (m_settings.memoryBudget) {
+				//evicts only if that makes enough room, a cell that does not fit holds back those behind it
+				size_t freed = 0;
+				size_t count = evicted;
+				while (m_residentBytes - freed + bytes > m_settings.memoryBudget && count < band.size()) {
+					freed += m_cellBytes[band[count++].cell];
+				}
+				if (m_residentBytes - freed + bytes > m_settings.memoryBudget) break;
+				for (; evicted < count; ++evicted) {
+					Unload(band[evicted].cell, plan);
+				}
+			}
+
+			m_states[candidate.cell] = CellState::LOADING;
+			m_resident.insert(candidate.cell);
+			m_residentBytes += bytes;
+			++m_loadsInFlight;
+			plan.load.push_back(candidate.cell);
+		}
+
+		return plan;
+	}
+
+	void WorldPartition::OnCellLoaded(size_t cell) {
+		if (m_states[cell] != CellState::LOADING) return;
+		m_states[cell] = CellState::LOADED;
+		--m_loadsInFlight;
+	}
+}
@@ -0,0 +1,126 @@
+/******************************************************************/
+/*!
+\file      WorldPartition.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     World partition: a level split into square cells on the XZ
+		   plane, each a scene of its own, and the decisions of which
+		   cells to stream in and out around the streaming sources
+		   (cameras and players).
+
+		   A cell starts loading once any source comes within the load
+		   radius of it, and unloads only once every source is beyond
+		   the unload radius, the band between keeps a source walking
+		   along a cell border from loading and unloading it over and
+		   over. Distances are measured to the nearest point of the
+		   cell, a source's radius scale stretches both radii for it.
+
+		   Cells load nearest first, at most a few at once. A cell
+		   counts against the memory budget from when it starts loading
+		   until it is unloaded. A nearer cell that does not fit evicts
+		   the furthest cells in the band, ones no source needs, and
+		   when that is not enough, nothing further away loads either.
+
+		   WorldPartition only decides, SceneManager stages the cells on
+		   background threads and commits them a budgeted number of
+		   steps per frame. The same sources and calls always give the
+		   same plans, ties in distance go to the lower cell index.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+#include "Reflection/Reflection.h"
+
+namespace scenes {
+
+	//the square from (x, z) * cellSize to (x + 1, z + 1) * cellSize
+	struct WorldPartitionCell {
+		int x{};
+		int z{};
+		std::string scene;  //file, relative to the layout
+		int bytes{};        //of the file when it was partitioned, 0 to measure it when the layout is opened
+		REFLECTABLE(WorldPartitionCell, x, z, scene, bytes)
+	};
+
+	//kept in "<level>.partition" beside the cells
+	struct WorldPartitionLayout {
+		float cellSize{ 64.f };
+		std::vector<WorldPartitionCell> cells;
+		REFLECTABLE(WorldPartitionLayout, cellSize, cells)
+	};
+
+	struct StreamingSource {
+		glm::vec3 position{ 0.f };
+		float radiusScale{ 1.f };
+	};
+
+	struct StreamingSettings {
+		float loadRadius{ 128.f };
+		float unloadRadius{ 192.f };   //not below loadRadius
+		size_t memoryBudget{};         //bytes of cells loading or loaded at once, 0 for no limit
+		size_t maxLoadsInFlight{ 2 };  //cells loading at once, 0 for no limit
+		size_t commitBudget{ 2000 };   //entities and components committed per frame, 0 for no limit
+	};
+
+	enum class CellState { UNLOADED, LOADING, LOADED };
+
+	//cell indices to act on, unloads first
+	struct StreamingPlan {
+		std::vector<size_t> unload;
+		std::vector<size_t> load;
+	};
+
+	class WorldPartition {
+	public:
+
+		//every cell unloaded. "cellBytes" is what each cell of the layout counts against the memory budget
+		void SetLayout(const WorldPartitionLayout& layout, std::vector<size_t> cellBytes);
+		const WorldPartitionLayout& GetLayout() const { return m_layout; }
+
+		void SetSettings(const StreamingSettings& settings) { m_settings = settings; }
+		const StreamingSettings& GetSettings() const { return m_settings; }
+
+		//decides what to load and unload for the sources this frame and moves the cells to LOADING and UNLOADED
+		StreamingPlan Update(const std::vector<StreamingSource>& sources);
+
+		//a LOADING cell has been committed
+		void OnCellLoaded(size_t cell);
+
+		//distance from the nearest source to "cell", divided by that source's radius scale
+		float Distance(const std::vector<StreamingSource>& sources, size_t cell) const;
+
+		//the cell holding "position", npos if the layout has none there
+		size_t FindCell(const glm::vec3& position) const;
+
+		size_t GetCellCount() const { return m_layout.cells.size(); }
+		CellState GetState(size_t cell) const { return m_states[cell]; }
+		size_t GetCellBytes(size_t cell) const { return m_cellBytes[cell]; }
+		size_t GetResidentBytes() const { return m_residentBytes; }
+		size_t GetLoadsInFlight() const { return m_loadsInFlight; }
+		//cells not UNLOADED, by index
+		const std::set<size_t>& GetResidentCells() const { return m_resident; }
+
+		static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+	private:
+
+		static uint64_t CellKey(int x, int z);
+
+		void Unload(size_t cell, StreamingPlan& plan);
+
+		WorldPartitionLayout m_layout;
+		StreamingSettings m_settings;
+		std::vector<size_t> m_cellBytes;
+		std::vector<CellState> m_states;
+		std::unordered_map<uint64_t, size_t> m_cellIndex;  //by CellKey
+		std::set<size_t> m_resident;
+		size_t m_residentBytes{};
+		size_t m_loadsInFlight{};
+	};
+}
@@ -12,11 +12,33 @@ AssetManager::AssetManager()
 {
     CompilerData Data = Serialization::ReadJsonFile<CompilerData>(configpath::configFilePath);
 
+    std::vector<assetpipeline::CompilerEntry> compilers;
     Data.ApplyFunction([&](auto& member) {
         for (const auto& inputExtension : member.inputExtensions)
-            m_compilerMap[inputExtension].emplace_back(CompilerD{ member.type, member.path, member.outputExtension });
+            m_compilerMap[inputExtension].emplace_back(CompilerD{ member.type, member.path, member.outputExtension, member.version });
+
+        compilers.push_back({ { member.type, member.path, member.outputExtension, member.version }, member.inputExtensions });
         });
 
+    m_assetBuilder = std::make_unique<assetpipeline::AssetBuilder>(std::move(compilers), &m_buildCache);
+}
+
+namespace {
+    void LogBuildReport(const assetpipeline::BuildReport& report) {
+        for (const auto& asset : report.assets) {
+            for (const auto& diagnostic : asset.diagnostics) {
+                std::string message = "Asset Builder: " + asset.source.filename().string() + " [" + asset.compiler + "] " + diagnostic.message;
+                switch (diagnostic.severity) {
+                case assetpipeline::Severity::Error: LOGGING_ERROR(message); break;
+                case assetpipeline::Severity::Warning: LOGGING_WARN(message); break;
+                default: LOGGING_INFO(message); break;
+                }
+            }
+            if (asset.status == assetpipeline::JobStatus::Skipped) {
+                LOGGING_WARN("Asset Builder: skipped " + asset.source.filename().string() + ", a dependency failed");
+            }
+        }
+    }
 }
 
 AssetManager::~AssetManager() {
@@ -29,11 +51,12 @@ void AssetManager::Init(const std::string& assetDirectory, const std::string& re
 	m_assetDirectory = assetDirectory;
     m_resourceDirectory = resourceDirectory;
 
+    m_buildCache.Init(configpath::buildCacheFilePath);
+
     std::function<void(const std::string&)> readDirectory;
-    std::vector<std::future<void>> compilingAsync;
+    std::vector<std::filesystem::path> assetFiles;
 
     readDirectory = [&](const std::string& Dir) {
-        int count = 0;
         for (const auto& entry : std::filesystem::directory_iterator(Dir)) {
             std::string filepath = entry.path().string();
 
@@ -42,30 +65,7 @@ void AssetManager::Init(const std::string& assetDirectory, const std::string& re
             }
             else {
                 RegisterAsset(entry.path());
-
-                //test if resource is already in the resource folder
-                std::filesystem::path metaPath = filepath + ".meta";
-
-
-                if (std::filesystem::exists(metaPath)) {
-                    AssetData data = Serialization::ReadJsonFile<AssetData>(metaPath.string());
-                    const auto& map = m_compilerMap.at(entry.path().filename().extension().string());
-                    for (const auto& compilerData : map)
-                    {
-                        std::string type = compilerData.type;
-                        std::string outputResourcePath = std::filesystem::absolute(m_resourceDirectory).string() + "/" + data.GUID + compilerData.outputExtension;
-                        if (!std::filesystem::exists(outputResourcePath)) {
-                            std::cout << ++count << std::endl;
-                            compilingAsync.push_back(Compilefile(filepath));
-                        }
-
-                    }
-                }
-                else {
-                    continue;
-                }
-
-
+                assetFiles.push_back(entry.path());
             }
         }
         };
@@ -73,16 +73,25 @@ void AssetManager::Init(const std::string& assetDirectory, const std::string& re
 
 	readDirectory(m_assetDirectory);
 
-    for (size_t i = 0; i < compilingAsync.size(); ) {
-        if (compilingAsync[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
-            compilingAsync[i].get();
-            compilingAsync.erase(compilingAsync.begin() + i);
-        }
-        else {
-            ++i;
+    //every GUID is registered before compiling, so dependencies can be resolved
+    std::vector<std::filesystem::path> compileFiles;
+    for (const auto& filepath : assetFiles) {
+        if (std::filesystem::exists(filepath.string() + ".meta")) {
+            compileFiles.push_back(filepath);
         }
     }
 
+    //the build cache skips assets whose inputs have not changed
+    assetpipeline::BuildReport report = m_assetBuilder->Build(compileFiles, m_resourceDirectory);
+    LogBuildReport(report);
+
+    std::string stageTimes;
+    for (const auto& [stage, milliseconds] : report.stageMilliseconds) {
+        stageTimes += " " + stage + " " + std::to_string(static_cast<int>(milliseconds)) + "ms";
+    }
+    LOGGING_INFO("Asset Builder: " + std::to_string(report.compiled) + " compiled, " + std::to_string(report.upToDate) + " up to date, " +
+        std::to_string(report.restored) + " restored, " + std::to_string(report.failed) + " failed, " + std::to_string(report.skipped) + " skipped;" + stageTimes);
+
 
     //Setup Watchers
 
@@ -110,7 +119,25 @@ void AssetManager::Init(const std::string& assetDirectory, const std::string& re
 			break;
         }
 
-       
+
+        });
+
+    //keep the GUID of a renamed or moved asset by moving its meta file along
+    m_assetWatcher->SetRenameCallback([&](const std::filesystem::path& from, const std::filesystem::path& to) {
+        LOGGING_INFO("Watcher: Renamed - " + from.string() + " -> " + to.string());
+
+        std::filesystem::path fromMeta = from.string() + ".meta";
+        std::filesystem::path toMeta = to.string() + ".meta";
+        std::error_code ec;
+        if (std::filesystem::exists(fromMeta) && !std::filesystem::exists(toMeta)) {
+            std::filesystem::rename(fromMeta, toMeta, ec);
+            if (ec) {
+                LOGGING_WARN("Watcher: failed to move " + fromMeta.string() + ", " + ec.message());
+            }
+        }
+
+        RegisterAsset(to);
+        Compilefile(to);
         });
 
     //Ignore all .meta files
@@ -138,7 +165,8 @@ std::string AssetManager::RegisterAsset(const std::filesystem::path& filePath)
     std::string GUID = m_dataBase.ImportAsset(filePath, type);
 
     m_GUIDtoFilePath[GUID] = filePath;
-    return GUID;;
+    m_assetBuilder->RegisterGUID(GUID, filePath);
+    return GUID;
 }
 
 std::future<void> AssetManager::Compilefile(const std::filesystem::path& filePath)
@@ -170,93 +198,8 @@ std::future<void> AssetManager::Compilefile(const std::filesystem::path& filePat
 			return std::async(std::launch::deferred, []() {});
         }
 	}
-    //get file type from meta
-    AssetData data = Serialization::ReadJsonFile<AssetData>(metaPath.string());
-
-    const auto& map = m_compilerMap.at(inputExtension);
-    for(const auto& compilerData : map)
-    {
-        std::string guid = data.GUID;
-
-        std::string inputPath = std::filesystem::absolute(filePath).string();
-        std::string outputResourcePath =
-            std::filesystem::absolute(m_resourceDirectory).string() + "\\" +
-            data.GUID + compilerData.outputExtension;
-
-
-        //assets that have a compiler
-        if (compilerData.compilerFilePath != "null")
-        {
-            //COMPILING CODE HERE
-            std::string compilerPath = std::filesystem::absolute(compilerData.compilerFilePath).string();
-            std::string absmetaPath = std::filesystem::absolute(metaPath).string();
-
-            //std::string command = "\"" + compilerPath + "\" \"" + inputPath + "\" \"" + absmetaPath + "\" \"" + outputResourcePath + "\"";
-
-            //std::cout << "Running: " << command << std::endl;
-
-            std::string tempBatch = "temp_run_" + guid + ".bat";
-            // Write the batch file
-            std::ofstream batchFile(tempBatch);
-            if (!batchFile) {
-                std::cerr << "Failed to create batch file!" << std::endl;
-                return std::async(std::launch::deferred, []() {});
-            }
-
-            batchFile << "@echo off\n";
-            batchFile << "set EXE=\"" << compilerPath << "\"\n";
-            batchFile << "%EXE% \"" << inputPath << "\" \"" << absmetaPath << "\" \"" << outputResourcePath << "\" \"" << "\"\n";
-            batchFile.close();
-
-            // Run the batch file
-            auto runSystemAsync = [](const std::string& batfile)
-                {
-                    auto future = std::async(std::launch::async, [batfile]() {
-                        int result = std::system(batfile.c_str());
-                        if (result != 0) {
-                            std::cerr << "Command failed with code: " << result << std::endl;
-                        }
-
-                        // Delete the temporary batch file
-                        std::filesystem::remove(batfile);
-                     });
-
-                    return future; // you can store this if you want to wait later
-                };
-
-            auto AsyncCompile = runSystemAsync(tempBatch);
-
-            return AsyncCompile;
-        }
-        else {
-            //assets without
-
-            //check if directory exist, if not create one
-
-            std::filesystem::path dir = std::filesystem::path(outputResourcePath).parent_path();
-
-            if (!std::filesystem::exists(dir)) {
-                if (!std::filesystem::create_directories(dir)) {
-                    LOGGING_ERROR("Fail to create directory");
-                }
-            }
-
-
-            std::filesystem::copy_file(inputPath, outputResourcePath, std::filesystem::copy_options::overwrite_existing);
-
-        }
-
-        return std::async(std::launch::deferred, []() {});
-	}
-
-
-    
-
-
-
-
-
 
+    return std::async(std::launch::async, [this, filePath]() {
+        LogBuildReport(m_assetBuilder->Build({ filePath }, m_resourceDirectory));
+        });
 }
-
-
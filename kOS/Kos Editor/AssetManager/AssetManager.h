@@ -3,6 +3,8 @@
 #include "Config/pch.h"
 #include "AssetDatabase.h"
 #include "Watcher.h"
+#include "AssetPipeline/BuildCache.h"
+#include "AssetPipeline/AssetBuilder.h"
 
 class AssetManager {
 
@@ -57,6 +59,10 @@ public:
         return m_assetWatcher.get();
     }
 
+    assetpipeline::BuildCache& GetBuildCache() {
+        return m_buildCache;
+    }
+
 private:
 
     //template<typename T, typename... U>
@@ -87,6 +93,12 @@ private:
 	std::string m_assetDirectory;
     std::string m_resourceDirectory;
 
+    //Build Cache
+    assetpipeline::BuildCache m_buildCache;
+
+    //Asset Builder, compiles through a job graph
+    std::unique_ptr<assetpipeline::AssetBuilder> m_assetBuilder;
+
     //Watcher
     std::unique_ptr<Watcher> m_assetWatcher;
 	//std::unique_ptr<Watcher> m_scriptWatcher;
@@ -96,6 +108,7 @@ private:
         std::string type;
         std::string compilerFilePath;
         std::string outputExtension;
+        std::string version;
     };
     std::unordered_map<std::string, std::vector<CompilerD>> m_compilerMap;
 public:
@@ -104,6 +104,7 @@ namespace prefab
 
         nc->isPrefab = true;
         nc->prefabName = filename;
+        ecs->MarkDirty(id);
 
         std::string path = m_jsonFilePath + filename;
         scenes::SceneManager::m_GetInstance()->CreateNewScene(path);
@@ -121,6 +122,11 @@ namespace prefab
 
         std::unordered_set<ecs::EntityID> savedEntities;  //track saved entities
 
+        //scene data first, with the schema versions the prefab is saved at
+        rapidjson::Value sceneData(rapidjson::kObjectType);
+        Serialization::SaveSceneDataRecord(SceneData{}, ecs->GetSubtree(id), sceneData, allocator);
+        doc.PushBack(sceneData, allocator);
+
         //Start saving the entities
         Serialization::SaveEntity(id, doc, allocator, savedEntities);
 
@@ -166,6 +172,9 @@ namespace prefab
 
         ecs::EntityID prefabID = prefabData->second.prefabID;
 
+        //instances keep the members they override, unless the prefab gained or lost children
+        if (Serialization::PropagatePrefab(prefabSceneName)) return;
+
         for (const auto& [id, signature] : ecs->GetEntitySignatureData()) {
             ecs::NameComponent* nc = ecs->GetComponent<ecs::NameComponent>(id);
             ecs::TransformComponent* tc = ecs->GetComponent<ecs::TransformComponent>(id);
@@ -332,6 +341,9 @@ namespace prefab
                 break;
             }
         }
+
+        //what its instances are as of now, for UpdateAllPrefab
+        Serialization::FindPrefabSource(scenename.string());
     }
 
     void LoadAllPrefabs() {
@@ -340,6 +352,14 @@ namespace prefab
 
         std::string prefabPath = AssetManager::GetInstance()->GetAssetManagerDirectory() + "/Prefabs/"; // Should have a better way to get file directories
         if (!std::filesystem::exists(prefabPath))return;
+
+        //a prefab holding an instance of another loads that one first
+        Serialization::SetPrefabResolver([prefabPath](const std::string& prefabName) {
+            const std::filesystem::path path = prefabPath + prefabName;
+            if (!std::filesystem::exists(path)) return false;
+            LoadPrefab(path);
+            return true;
+        });
         for (const auto& entry : std::filesystem::directory_iterator(prefabPath)) {
 			auto scenename = entry.path().filename();
 
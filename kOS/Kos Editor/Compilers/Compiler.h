@@ -8,14 +8,16 @@ struct MeshCompiler {
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(MeshCompiler, path, outputExtension, inputExtensions);
+	std::string version; //bump to invalidate every cached output of this compiler
+	REFLECTABLE(MeshCompiler, path, outputExtension, inputExtensions, version);
 };
 struct TextureCompiler {
 	std::string type = R_Texture::classname();
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(TextureCompiler, path, outputExtension, inputExtensions);
+	std::string version;
+	REFLECTABLE(TextureCompiler, path, outputExtension, inputExtensions, version);
 
 };
 struct FontCompiler {
@@ -23,7 +25,8 @@ struct FontCompiler {
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(TextureCompiler, path, outputExtension, inputExtensions);
+	std::string version;
+	REFLECTABLE(TextureCompiler, path, outputExtension, inputExtensions, version);
 
 };
 struct SceneCompiler {
@@ -31,7 +34,8 @@ struct SceneCompiler {
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(SceneCompiler, path, outputExtension, inputExtensions);
+	std::string version;
+	REFLECTABLE(SceneCompiler, path, outputExtension, inputExtensions, version);
 
 };
 struct PrefabCompiler {
@@ -39,7 +43,8 @@ struct PrefabCompiler {
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(SceneCompiler, path, outputExtension, inputExtensions);
+	std::string version;
+	REFLECTABLE(SceneCompiler, path, outputExtension, inputExtensions, version);
 
 };
 
@@ -48,7 +53,8 @@ struct AudioCompiler {
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(AudioCompiler, path, outputExtension, inputExtensions);
+	std::string version;
+	REFLECTABLE(AudioCompiler, path, outputExtension, inputExtensions, version);
 
 };
 struct MaterialCompiler {
@@ -56,7 +62,8 @@ struct MaterialCompiler {
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(R_Material, path, outputExtension, inputExtensions);
+	std::string version;
+	REFLECTABLE(R_Material, path, outputExtension, inputExtensions, version);
 
 };
 struct DepthMapCubeCompiler {
@@ -64,7 +71,26 @@ struct DepthMapCubeCompiler {
 	std::string path;
 	std::string outputExtension;
 	std::vector<std::string> inputExtensions;
-	REFLECTABLE(R_DepthMapCube, path, outputExtension, inputExtensions);
+	std::string version;
+	REFLECTABLE(R_DepthMapCube, path, outputExtension, inputExtensions, version);
+
+};
+struct ControllerCompiler {
+	std::string type = R_AnimationController::classname();
+	std::string path;
+	std::string outputExtension;
+	std::vector<std::string> inputExtensions;
+	std::string version;
+	REFLECTABLE(ControllerCompiler, path, outputExtension, inputExtensions, version);
+
+};
+struct AnimationCompiler {
+	std::string type = R_Animation::classname();
+	std::string path;
+	std::string outputExtension;
+	std::vector<std::string> inputExtensions;
+	std::string version;
+	REFLECTABLE(AnimationCompiler, path, outputExtension, inputExtensions, version);
 
 };
 struct CompilerData {
@@ -76,7 +102,9 @@ struct CompilerData {
 	AudioCompiler audioCompiler;
 	MaterialCompiler materialCompiler;
 	DepthMapCubeCompiler dmcCompiler;
-	REFLECTABLE(CompilerData, meshCompiler,textureCompiler, fontCompiler, sceneCompiler, prefabCompiler, audioCompiler, materialCompiler, dmcCompiler);
+	ControllerCompiler controllerCompiler;
+	AnimationCompiler animationCompiler;
+	REFLECTABLE(CompilerData, meshCompiler,textureCompiler, fontCompiler, sceneCompiler, prefabCompiler, audioCompiler, materialCompiler, dmcCompiler, controllerCompiler, animationCompiler);
 };
 
 
@@ -11,6 +11,13 @@ enum ColorFormat {
 	CS_SRGBO
 };
 
+enum TextureCompression {
+	TC_BC1,
+	TC_BC3,
+	TC_BC5,
+	TC_BC7
+};
+
 struct TextureCompilerData {
 	bool HoriztonalFlip = false;
 	bool VerticalFlip = false;
@@ -19,6 +26,7 @@ struct TextureCompilerData {
 	int MipLevels = 1;
 	WrapMode Wrap = WRAP_CLAMP;
 	ColorFormat ColorSpace = CS_SRGB;
+	TextureCompression Compression = TC_BC3;
 
 	REFLECTABLE(TextureCompilerData,
 		HoriztonalFlip,
@@ -27,6 +35,7 @@ struct TextureCompilerData {
 		Height,
 		MipLevels,
 		Wrap,
-		ColorSpace
+		ColorSpace,
+		Compression
 	);
 };
\ No newline at end of file
@@ -5,6 +5,7 @@ namespace configpath {
 	constexpr const char* configFilePath = "Kos Editor/Configs/Config.json";
     constexpr const char* assetFilePath = "Kos Editor/Assets";
     constexpr const char* resourceFilePath = "Resource";
+    constexpr const char* buildCacheFilePath = "Kos Editor/Cache/BuildCache";
     constexpr const char* logFilePath = "LogFile.txt";
     constexpr const char* editorTagPath = "Kos Editor/Configs/editorTag.txt";
     constexpr const char* imguiINIPath = "Kos Editor/Configs/imgui.ini";
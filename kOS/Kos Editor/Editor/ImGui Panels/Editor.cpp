@@ -98,6 +98,7 @@ namespace gui {
 		RegisterComponent<ecs::SkinnedMeshRendererComponent>();
 		RegisterComponent<ecs::CanvasRendererComponent>();
 		RegisterComponent<ecs::AnimatorComponent>();
+		RegisterComponent<ecs::AttachmentComponent>();
 		RegisterComponent<ecs::LightComponent>();
 		RegisterComponent<ecs::RigidbodyComponent>();
 		RegisterComponent<ecs::BoxColliderComponent>();
@@ -59,6 +59,7 @@ namespace gui {
             TransformSystem::SetImmediateWorldRotation(transComp, std::move(newRotation));
             TransformSystem::SetImmediateWorldScale(transComp, std::move(newScale));
             TransformSystem::CalculateAllTransform(transComp);
+            m_ecs->MarkDirty(m_clickedEntityId);
         }
     }
 }
\ No newline at end of file
@@ -218,6 +218,12 @@ void gui::ImGuiHandler::DrawComponentWindow()
             }
         }
 
+        //the fields above write straight into the components, so any edit or drop in this window dirties the entity
+        if ((ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows) && ImGui::IsAnyItemActive()) ||
+            (ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows | ImGuiHoveredFlags_AllowWhenBlockedByActiveItem) && ImGui::IsMouseReleased(ImGuiMouseButton_Left))) {
+            m_ecs->MarkDirty(entityID);
+        }
+
         //draw invinsible box - currently not doing anything right now
         //if (ImGui::GetContentRegionAvail().x > 0 && ImGui::GetContentRegionAvail().y > 0) {
         //    ImGui::InvisibleButton("##Invinsible", ImVec2{ ImGui::GetContentRegionAvail().x,ImGui::GetContentRegionAvail().y });
@@ -0,0 +1,159 @@
+/******************************************************************/
+/*!
+\file      main.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Brings every scene and prefab under the resource folders up
+		   to the current component schema versions and writes them
+		   back, so loads stop migrating them each time. Files already
+		   current are left untouched.
+
+		   Scenes are ".scene", ".prefab" and editor ".json" files whose
+		   top level array holds a SceneData record. Compressed runtime
+		   saves stay compressed, the rest keep their pretty or compact
+		   layout.
+
+		   Run from the kOS directory:
+		   Kos_SchemaMigrator [--resources dir]... [--check]
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "DeSerialization/schema_migration.h"
+#include "DeSerialization/json_writer.h"
+#include "Scene/SceneData.h"
+
+namespace {
+
+	struct Options {
+		std::vector<std::filesystem::path> resources;
+		bool check = false;   //only report what is out of date
+	};
+
+	enum class Result { CURRENT, MIGRATED, FAILED };
+
+	void PrintUsage(const char* program) {
+		std::cout << "Usage: " << program << " [--resources dir]... [--check]\n";
+	}
+
+	bool ParseOptions(int argc, char* argv[], Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+
+			if (argument == "--resources" && hasValue) options.resources.push_back(argv[++i]);
+			else if (argument == "--check") options.check = true;
+			else return false;
+		}
+		if (options.resources.empty()) options.resources.push_back("Resource");
+		return true;
+	}
+
+	bool IsSceneDocument(const std::filesystem::path& path, const rapidjson::Document& document) {
+		if (!document.IsArray()) return false;
+		const std::string extension = path.extension().string();
+		if (extension == ".scene" || extension == ".prefab") return true;
+		//configs are top level arrays too, only scenes have scene data
+		return std::any_of(document.Begin(), document.End(), [](const rapidjson::Value& record) {
+			return record.IsObject() && record.HasMember(SceneData::classname());
+		});
+	}
+
+	Result MigrateFile(const std::filesystem::path& path, const Serialization::SchemaMigrations& migrations, bool check) {
+		std::string content;
+		{
+			std::ifstream file(path, std::ios::binary);
+			if (!file) {
+				std::cerr << path.string() << ": cannot be read" << std::endl;
+				return Result::FAILED;
+			}
+			content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		}
+
+		const bool compressed = Serialization::IsCompressedJson(content);
+		if (compressed) {
+			std::string json;
+			if (!Serialization::DecompressJson(content, json)) {
+				std::cerr << path.string() << ": corrupt compressed JSON" << std::endl;
+				return Result::FAILED;
+			}
+			content = std::move(json);
+		}
+
+		rapidjson::Document document;
+		document.Parse<rapidjson::kParseFullPrecisionFlag>(content.c_str(), content.size());
+		if (document.HasParseError()) {
+			std::cerr << path.string() << ": JSON parse error at offset " << document.GetErrorOffset() << std::endl;
+			return Result::FAILED;
+		}
+		if (!IsSceneDocument(path, document)) return Result::CURRENT;
+
+		Serialization::SchemaVersions versions;
+		for (const auto& record : document.GetArray()) {
+			if (record.IsObject() && record.HasMember(SceneData::classname())) {
+				versions.Read(record);
+				break;
+			}
+		}
+		if (versions.IsCurrent(migrations)) return Result::CURRENT;
+
+		const size_t migrated = Serialization::MigrateSceneDocument(document, migrations);
+		std::cout << (check ? "Out of date " : "Migrated ") << path.string() << ", " << migrated << " components" << std::endl;
+		if (check) return Result::MIGRATED;
+
+		//SaveScene starts pretty files with "[" and a line break
+		const bool pretty = !compressed && content.size() > 1 && (content[1] == '\n' || content[1] == '\r');
+		std::string output(Serialization::WriteJson(document, pretty ? Serialization::JsonStyle::PRETTY : Serialization::JsonStyle::COMPACT));
+		output += '\n';
+		if (compressed) output = Serialization::CompressJson(output);
+
+		if (!Serialization::WriteFileAtomic(path, output)) {
+			std::cerr << path.string() << ": cannot be written" << std::endl;
+			return Result::FAILED;
+		}
+		return Result::MIGRATED;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options)) {
+		PrintUsage(argv[0]);
+		return 1;
+	}
+
+	LOGGING_INIT_LOGS("SchemaMigrator.log");
+
+	Serialization::SchemaMigrations& migrations = Serialization::SchemaMigrations::GetInstance();
+	Serialization::RegisterSchemaMigrations(migrations);
+
+	size_t scanned{}, migrated{}, failed{};
+	for (const auto& directory : options.resources) {
+		std::error_code ec;
+		if (!std::filesystem::is_directory(directory, ec)) {
+			std::cerr << directory.string() << " is not a directory" << std::endl;
+			return 1;
+		}
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, ec)) {
+			const std::string extension = entry.path().extension().string();
+			if (!entry.is_regular_file() || (extension != ".scene" && extension != ".prefab" && extension != ".json")) continue;
+
+			++scanned;
+			switch (MigrateFile(entry.path(), migrations, options.check)) {
+			case Result::MIGRATED: ++migrated; break;
+			case Result::FAILED: ++failed; break;
+			default: break;
+			}
+		}
+	}
+
+	std::cout << scanned << " files, " << migrated << (options.check ? " out of date, " : " migrated, ") << failed << " failed" << std::endl;
+	return failed > 0 || (options.check && migrated > 0) ? 1 : 0;
+}
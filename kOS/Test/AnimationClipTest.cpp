@@ -0,0 +1,307 @@
+/******************************************************************/
+/*!
+\file      AnimationClipTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases comparing the flattened animation clip sampler with
+		   the recursive node tree sampler it replaced, and a benchmark
+		   of 500 characters with 60 joints each.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationClip.h"
+
+using namespace animation;
+
+namespace {
+
+	//the node tree sampler R_Animation used before the clip was flattened
+	namespace reference {
+
+		struct NodeData {
+			std::string name;
+			glm::mat4 transformation;
+			std::vector<NodeData> children;
+		};
+
+		int FindIndex(const std::vector<float>& times, float animTime) {
+			for (size_t i = 0; i < times.size() - 1; i++) {
+				if (animTime < times[i + 1]) return static_cast<int>(i);
+			}
+			return static_cast<int>(times.size() - 2);
+		}
+
+		float GetFactor(float start, float end, float time) {
+			return (time - start) / (end - start);
+		}
+
+		glm::mat4 Interpolate(const BoneTrack& bone, float time) {
+			glm::mat4 T, R, S;
+			if (bone.positions.size() == 1) {
+				T = glm::translate(glm::mat4(1.0f), bone.positions[0]);
+			}
+			else {
+				int index = FindIndex(bone.positionTimes, time);
+				float factor = GetFactor(bone.positionTimes[index], bone.positionTimes[index + 1], time);
+				T = glm::translate(glm::mat4(1.0f), glm::mix(bone.positions[index], bone.positions[index + 1], factor));
+			}
+			if (bone.rotations.size() == 1) {
+				R = glm::mat4_cast(bone.rotations[0]);
+			}
+			else {
+				int index = FindIndex(bone.rotationTimes, time);
+				float factor = GetFactor(bone.rotationTimes[index], bone.rotationTimes[index + 1], time);
+				R = glm::mat4_cast(glm::slerp(bone.rotations[index], bone.rotations[index + 1], factor));
+			}
+			if (bone.scales.size() == 1) {
+				S = glm::scale(glm::mat4(1.0f), bone.scales[0]);
+			}
+			else {
+				int index = FindIndex(bone.scaleTimes, time);
+				float factor = GetFactor(bone.scaleTimes[index], bone.scaleTimes[index + 1], time);
+				S = glm::scale(glm::mat4(1.0f), glm::mix(bone.scales[index], bone.scales[index + 1], factor));
+			}
+			return T * R * S;
+		}
+
+		void CalculateBoneTransform(const NodeData& node, const glm::mat4& parentTransform, const glm::mat4& globalInverse, float time,
+			const std::unordered_map<std::string, BoneTrack>& bones, const std::unordered_map<std::string, int>& boneMap,
+			const std::vector<glm::mat4>& offsets, std::vector<glm::mat4>& finalTransforms)
+		{
+			glm::mat4 nodeTransform = node.transformation;
+			const auto bone = bones.find(node.name);
+			if (bone != bones.end()) {
+				nodeTransform = Interpolate(bone->second, time);
+			}
+
+			glm::mat4 globalTransform = parentTransform * nodeTransform;
+
+			if (boneMap.find(node.name) != boneMap.end()) {
+				int index = boneMap.at(node.name);
+				finalTransforms[index] = globalInverse * globalTransform * offsets.at(index);
+			}
+
+			for (const NodeData& child : node.children) {
+				CalculateBoneTransform(child, globalTransform, globalInverse, time, bones, boneMap, offsets, finalTransforms);
+			}
+		}
+	}
+
+	struct Character {
+		reference::NodeData root;
+		std::vector<JointDesc> joints;
+		std::unordered_map<std::string, BoneTrack> tracks;
+		std::unordered_map<std::string, int> boneMap;
+		std::vector<glm::mat4> offsets;
+		float duration{};
+	};
+
+	glm::mat4 RandomTransform(std::mt19937& random) {
+		std::uniform_real_distribution<float> unit{ -1.f, 1.f };
+		const glm::quat rotation = glm::normalize(glm::quat{ unit(random), unit(random), unit(random), unit(random) });
+		return glm::translate(glm::mat4(1.f), glm::vec3{ unit(random), unit(random), unit(random) }) * glm::mat4_cast(rotation);
+	}
+
+	std::vector<float> KeyTimes(std::mt19937& random, size_t count, float duration) {
+		std::vector<float> times{ 0.f };
+		for (size_t i = 1; i < count; ++i) {
+			times.push_back(duration * static_cast<float>(i) / static_cast<float>(count - 1));
+		}
+		//uneven spacing, like a clip with keys reduced at import
+		for (size_t i = 1; i + 1 < times.size(); ++i) {
+			times[i] += (std::uniform_real_distribution<float>{ -0.3f, 0.3f }(random)) * (times[i + 1] - times[i]);
+		}
+		return times;
+	}
+
+	BoneTrack RandomTrack(std::mt19937& random, float duration) {
+		std::uniform_real_distribution<float> unit{ -1.f, 1.f };
+		std::uniform_int_distribution<size_t> keyCount{ 1, 24 };
+		BoneTrack track;
+
+		track.positionTimes = KeyTimes(random, keyCount(random), duration);
+		for (size_t i = 0; i < track.positionTimes.size(); ++i) track.positions.push_back({ unit(random), unit(random), unit(random) });
+
+		track.rotationTimes = KeyTimes(random, keyCount(random), duration);
+		for (size_t i = 0; i < track.rotationTimes.size(); ++i) {
+			track.rotations.push_back(glm::normalize(glm::quat{ unit(random), unit(random), unit(random), unit(random) }));
+		}
+
+		track.scaleTimes = KeyTimes(random, keyCount(random), duration);
+		for (size_t i = 0; i < track.scaleTimes.size(); ++i) track.scales.push_back(glm::vec3{ 1.f } + 0.2f * glm::vec3{ unit(random), unit(random), unit(random) });
+		return track;
+	}
+
+	//random tree of "jointCount" nodes, most animated and bound to a mesh bone
+	Character MakeCharacter(unsigned int seed, int jointCount) {
+		std::mt19937 random{ seed };
+		Character character;
+		character.duration = 2.f + static_cast<float>(seed % 5);
+
+		std::vector<reference::NodeData> nodes(jointCount);
+		std::vector<int> parents(jointCount, -1);
+		for (int i = 0; i < jointCount; ++i) {
+			nodes[i].name = "Joint" + std::to_string(i);
+			nodes[i].transformation = RandomTransform(random);
+			if (i > 0) parents[i] = std::uniform_int_distribution<int>{ std::max(0, i - 4), i - 1 }(random);
+
+			if (i % 7 != 3) character.tracks[nodes[i].name] = RandomTrack(random, character.duration);
+			if (i % 11 != 5) {
+				character.boneMap[nodes[i].name] = static_cast<int>(character.offsets.size());
+				character.offsets.push_back(RandomTransform(random));
+			}
+		}
+
+		//nodes are built bottom up so the tree copy holds every grandchild
+		for (int i = jointCount - 1; i > 0; --i) {
+			nodes[parents[i]].children.insert(nodes[parents[i]].children.begin(), nodes[i]);
+		}
+		character.root = nodes[0];
+
+		std::function<void(const reference::NodeData&, int)> flatten = [&](const reference::NodeData& node, int parent) {
+			const int index = static_cast<int>(character.joints.size());
+			character.joints.push_back({ node.name, parent, node.transformation });
+			for (const auto& child : node.children) flatten(child, index);
+			};
+		flatten(character.root, -1);
+		return character;
+	}
+
+	void ExpectNear(const std::vector<glm::mat4>& actual, const std::vector<glm::mat4>& expected, float time) {
+		ASSERT_EQ(actual.size(), expected.size());
+		for (size_t bone = 0; bone < expected.size(); ++bone) {
+			for (int column = 0; column < 4; ++column) {
+				for (int row = 0; row < 4; ++row) {
+					const float tolerance = 1e-4f * std::max(1.f, std::abs(expected[bone][column][row]));
+					ASSERT_NEAR(actual[bone][column][row], expected[bone][column][row], tolerance)
+						<< "bone " << bone << " [" << column << "][" << row << "] at t = " << time;
+				}
+			}
+		}
+	}
+}
+
+TEST(AnimationClip, FlattensParentsBeforeChildren) {
+	const Character character = MakeCharacter(3, 60);
+	AnimationClip clip;
+	clip.Build(character.duration, 25.f, character.joints, character.tracks);
+
+	ASSERT_EQ(clip.GetJoints().size(), 60u);
+	EXPECT_EQ(clip.GetJoints()[0].parent, -1);
+	for (size_t i = 1; i < clip.GetJoints().size(); ++i) {
+		EXPECT_GE(clip.GetJoints()[i].parent, 0);
+		EXPECT_LT(clip.GetJoints()[i].parent, static_cast<int>(i));
+	}
+	EXPECT_EQ(clip.GetTrackCount(), character.tracks.size());
+	EXPECT_EQ(clip.GetJoints()[0].track, 0);
+}
+
+TEST(AnimationClip, MatchesNodeTreeSampler) {
+	for (unsigned int seed = 0; seed < 8; ++seed) {
+		const Character character = MakeCharacter(seed, 60);
+		AnimationClip clip;
+		clip.Build(character.duration, 25.f, character.joints, character.tracks);
+
+		const glm::mat4 parent = glm::translate(glm::mat4(1.f), glm::vec3{ 1.f, 2.f, 3.f });
+		const glm::mat4 globalInverse = glm::inverse(glm::scale(glm::mat4(1.f), glm::vec3{ 2.f }));
+		const auto binding = clip.Bind(character.boneMap, character.offsets);
+		auto cursors = clip.CreateCursors();
+		std::vector<glm::mat4> globals;
+
+		//forward playback over two loops, then random seeks
+		std::vector<float> times;
+		for (float time = 0.f; time < character.duration * 2.f; time += 0.37f) times.push_back(std::fmod(time, character.duration));
+		std::mt19937 random{ seed };
+		for (int i = 0; i < 50; ++i) times.push_back(std::uniform_real_distribution<float>{ 0.f, character.duration }(random));
+		times.push_back(character.duration);
+
+		for (const float time : times) {
+			std::vector<glm::mat4> expected(character.offsets.size(), glm::mat4(0.f));
+			std::vector<glm::mat4> actual(character.offsets.size(), glm::mat4(0.f));
+			reference::CalculateBoneTransform(character.root, parent, globalInverse, time, character.tracks, character.boneMap, character.offsets, expected);
+			clip.SamplePose(time, cursors, binding, parent, globalInverse, globals, actual);
+			ExpectNear(actual, expected, time);
+			if (HasFatalFailure()) return;
+		}
+	}
+}
+
+TEST(AnimationClip, UnanimatedAndUnboundJoints) {
+	AnimationClip clip;
+	const glm::mat4 bind = glm::translate(glm::mat4(1.f), glm::vec3{ 0.f, 1.f, 0.f });
+	std::unordered_map<std::string, BoneTrack> tracks;
+	tracks["Child"].positions = { glm::vec3{ 0.f }, glm::vec3{ 2.f, 0.f, 0.f } };
+	tracks["Child"].positionTimes = { 0.f, 1.f };
+	tracks["Unused"].positions = { glm::vec3{ 5.f } };
+	tracks["Unused"].positionTimes = { 0.f };
+	clip.Build(1.f, 1.f, { { "Root", -1, bind }, { "Child", 0, glm::mat4(1.f) }, { "Tip", 1, bind } }, tracks);
+	EXPECT_EQ(clip.GetTrackCount(), 1u);
+
+	auto cursors = clip.CreateCursors();
+	std::vector<glm::mat4> locals;
+	clip.SampleLocal(0.5f, cursors, locals);
+	EXPECT_EQ(locals[0], bind);
+	EXPECT_NEAR(locals[1][3].x, 1.f, 1e-6f);
+	EXPECT_EQ(locals[2], bind);
+
+	//keys past the end hold the last key instead of extrapolating
+	clip.SampleLocal(3.f, cursors, locals);
+	EXPECT_NEAR(locals[1][3].x, 2.f, 1e-6f);
+
+	std::vector<glm::mat4> globals, finalTransforms(2, glm::mat4(0.f));
+	const auto binding = clip.Bind({ { "Tip", 1 }, { "Missing", 0 } }, { glm::mat4(1.f), glm::mat4(1.f) });
+	clip.SamplePose(0.5f, cursors, binding, glm::mat4(1.f), glm::mat4(1.f), globals, finalTransforms);
+	EXPECT_EQ(finalTransforms[0], glm::mat4(0.f));
+	EXPECT_NEAR(finalTransforms[1][3].x, 1.f, 1e-6f);
+	EXPECT_NEAR(finalTransforms[1][3].y, 2.f, 1e-6f);
+}
+
+TEST(AnimationClipBenchmark, FiveHundredCharacters) {
+	constexpr int CHARACTERS = 500;
+	constexpr int JOINTS = 60;
+	constexpr int FRAMES = 20;
+
+	std::vector<Character> characters;
+	std::vector<AnimationClip> clips(CHARACTERS);
+	std::vector<std::vector<JointBinding>> bindings;
+	std::vector<std::vector<KeyCursor>> cursors;
+	for (int i = 0; i < CHARACTERS; ++i) {
+		characters.push_back(MakeCharacter(i % 16, JOINTS));
+		clips[i].Build(characters[i].duration, 25.f, characters[i].joints, characters[i].tracks);
+		bindings.push_back(clips[i].Bind(characters[i].boneMap, characters[i].offsets));
+		cursors.push_back(clips[i].CreateCursors());
+	}
+
+	using Clock = std::chrono::steady_clock;
+	std::vector<glm::mat4> finalTransforms(JOINTS, glm::mat4(1.f)), globals;
+	float checksum = 0.f;
+
+	const auto treeStart = Clock::now();
+	for (int frame = 0; frame < FRAMES; ++frame) {
+		for (int i = 0; i < CHARACTERS; ++i) {
+			const float time = std::fmod(frame / 60.f + i * 0.01f, characters[i].duration);
+			reference::CalculateBoneTransform(characters[i].root, glm::mat4(1.f), glm::mat4(1.f), time, characters[i].tracks, characters[i].boneMap, characters[i].offsets, finalTransforms);
+			checksum += finalTransforms[0][3].x;
+		}
+	}
+	const double treeMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - treeStart).count() / FRAMES;
+
+	const auto clipStart = Clock::now();
+	for (int frame = 0; frame < FRAMES; ++frame) {
+		for (int i = 0; i < CHARACTERS; ++i) {
+			const float time = std::fmod(frame / 60.f + i * 0.01f, characters[i].duration);
+			clips[i].SamplePose(time, cursors[i], bindings[i], glm::mat4(1.f), glm::mat4(1.f), globals, finalTransforms);
+			checksum -= finalTransforms[0][3].x;
+		}
+	}
+	const double clipMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - clipStart).count() / FRAMES;
+
+	EXPECT_NEAR(checksum, 0.f, 1e-1f);
+	std::cout << "[          ] " << CHARACTERS << " x " << JOINTS << " joints per frame, node tree " << treeMilliseconds
+		<< " ms, flattened " << clipMilliseconds << " ms\n";
+}
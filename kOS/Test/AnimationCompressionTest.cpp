@@ -0,0 +1,287 @@
+/******************************************************************/
+/*!
+\file      AnimationCompressionTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for compressed animation clips: rotation and range
+		   quantization, the error of a compressed clip against its
+		   source per joint, the size of the compressed keys, and event
+		   markers kept through compilation.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationClip.h"
+#include "AssetPipeline/AnimationCompiler.h"
+
+#include <cstring>
+#include <random>
+
+using namespace animation;
+using namespace assetpipeline;
+
+namespace {
+
+	template <typename T>
+	void Write(std::string& raw, const T& value) {
+		raw.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	void WriteString(std::string& raw, const std::string& value) {
+		Write(raw, value.size());
+		raw += value;
+	}
+
+	void WriteNode(std::string& raw, const std::vector<JointDesc>& joints, int joint) {
+		WriteString(raw, joints[joint].name);
+		Write(raw, joints[joint].bindTransform);
+
+		std::vector<int> children;
+		for (int i = 0; i < static_cast<int>(joints.size()); ++i) {
+			if (joints[i].parent == joint) children.push_back(i);
+		}
+		Write(raw, children.size());
+		for (int child : children) WriteNode(raw, joints, child);
+	}
+
+	//same layout as ParseAnimation of the mesh compiler
+	std::string WriteRaw(const RawAnimation& animation) {
+		std::string raw;
+		Write(raw, animation.duration);
+		Write(raw, animation.ticksPerSecond);
+		WriteString(raw, animation.name);
+		Write(raw, animation.tracks.size());
+
+		int id = 0;
+		for (const auto& [name, track] : animation.tracks) {
+			WriteString(raw, name);
+			WriteString(raw, name);
+			Write(raw, id++);
+
+			Write(raw, track.positions.size());
+			for (const glm::vec3& position : track.positions) Write(raw, position);
+			Write(raw, track.positionTimes.size());
+			for (float time : track.positionTimes) Write(raw, time);
+
+			Write(raw, track.rotations.size());
+			for (const glm::quat& rotation : track.rotations) {
+				Write(raw, rotation.x);
+				Write(raw, rotation.y);
+				Write(raw, rotation.z);
+				Write(raw, rotation.w);
+			}
+			Write(raw, track.rotationTimes.size());
+			for (float time : track.rotationTimes) Write(raw, time);
+
+			Write(raw, track.scales.size());
+			for (const glm::vec3& scale : track.scales) Write(raw, scale);
+			Write(raw, track.scaleTimes.size());
+			for (float time : track.scaleTimes) Write(raw, time);
+		}
+
+		WriteNode(raw, animation.joints, 0);
+		return raw;
+	}
+
+	//angle of the rotation between a and b, acos of the dot product loses small angles
+	float Angle(const glm::quat& a, const glm::quat& b) {
+		const glm::quat difference = glm::conjugate(a) * b;
+		return 2.f * std::atan2(glm::length(glm::vec3{ difference.x, difference.y, difference.z }), std::abs(difference.w));
+	}
+
+	//mocap like clip: 30 seconds at 30 keys per second on a 24 joint chain, a
+	//walking root, slow swings on most joints and some joints that hold still
+	RawAnimation MakeMocapClip() {
+		constexpr int JOINTS = 24;
+		constexpr int KEYS = 900;
+
+		RawAnimation animation;
+		animation.name = "Mocap";
+		animation.duration = KEYS - 1;
+		animation.ticksPerSecond = 30.f;
+
+		for (int joint = 0; joint < JOINTS; ++joint) {
+			const std::string name = "Joint" + std::to_string(joint);
+			animation.joints.push_back({ name, joint - 1, glm::translate(glm::mat4(1.f), glm::vec3{ 0.f, 0.25f, 0.f }) });
+
+			BoneTrack& track = animation.tracks[name];
+			const glm::vec3 axis = glm::normalize(glm::vec3{ std::sin(joint * 1.3f), 1.f, std::cos(joint * 0.7f) });
+			const float frequency = 0.1f + 0.05f * static_cast<float>(joint % 5);
+			const bool still = joint % 4 == 3;
+
+			for (int key = 0; key < KEYS; ++key) {
+				const float tick = static_cast<float>(key);
+				const float seconds = tick / animation.ticksPerSecond;
+
+				track.positionTimes.push_back(tick);
+				track.positions.push_back(joint == 0 ? glm::vec3{ 1.2f * seconds, 0.9f + 0.03f * std::sin(seconds * 6.f), 0.f } : glm::vec3{ 0.f, 0.25f, 0.f });
+
+				track.rotationTimes.push_back(tick);
+				const float angle = still ? 0.3f : 0.5f * std::sin(glm::two_pi<float>() * frequency * seconds + joint);
+				track.rotations.push_back(glm::angleAxis(angle, axis));
+
+				track.scaleTimes.push_back(tick);
+				track.scales.push_back(glm::vec3{ 1.f });
+			}
+		}
+		return animation;
+	}
+}
+
+TEST(AnimationCompressionTest, RotationsSurviveSmallestThree) {
+	std::mt19937 random{ 7 };
+	std::uniform_real_distribution<float> component{ -1.f, 1.f };
+
+	for (int i = 0; i < 10000; ++i) {
+		const glm::quat rotation = glm::normalize(glm::quat{ component(random), component(random), component(random), component(random) });
+		uint16_t packed[3];
+		PackRotation(rotation, packed);
+		ASSERT_LT(Angle(rotation, UnpackRotation(packed)), 1.5e-4f);
+	}
+
+	uint16_t packed[3];
+	PackRange(glm::vec3{ -2.f, 0.5f, 3.f }, glm::vec3{ -2.f, 0.f, 1.f }, glm::vec3{ 4.f, 1.f, 0.f }, packed);
+	const glm::vec3 unpacked = UnpackRange(packed, glm::vec3{ -2.f, 0.f, 1.f }, glm::vec3{ 4.f, 1.f, 0.f });
+	EXPECT_NEAR(unpacked.x, -2.f, 1e-6f);
+	EXPECT_NEAR(unpacked.y, 0.5f, 1.f / 65535.f);
+	EXPECT_FLOAT_EQ(unpacked.z, 1.f);
+}
+
+TEST(AnimationCompressionTest, ReadsMeshCompilerLayout) {
+	const RawAnimation source = MakeMocapClip();
+	const std::string raw = WriteRaw(source);
+
+	RawAnimation animation;
+	std::string error;
+	ASSERT_TRUE(ReadRawAnimation(raw, animation, error)) << error;
+	EXPECT_EQ(animation.name, "Mocap");
+	EXPECT_FLOAT_EQ(animation.ticksPerSecond, 30.f);
+	ASSERT_EQ(animation.joints.size(), source.joints.size());
+	EXPECT_EQ(animation.joints[5].parent, 4);
+	EXPECT_EQ(animation.tracks.at("Joint3").rotations.size(), 900u);
+
+	EXPECT_FALSE(ReadRawAnimation(std::string_view{ raw }.substr(0, raw.size() / 2), animation, error));
+	EXPECT_FALSE(error.empty());
+}
+
+TEST(AnimationCompressionTest, ReconstructionErrorIsBoundedPerJoint) {
+	const RawAnimation animation = MakeMocapClip();
+	const AnimationCompressionSettings settings;
+
+	std::string binary, error;
+	AnimationCompressionStats stats;
+	ASSERT_TRUE(CompileAnimation(WriteRaw(animation), settings, binary, stats, error)) << error;
+
+	AnimationClip source, compressed;
+	source.Build(animation.duration, animation.ticksPerSecond, animation.joints, animation.tracks);
+	ASSERT_TRUE(compressed.Load(binary, error)) << error;
+	ASSERT_TRUE(compressed.IsCompressed());
+	ASSERT_EQ(compressed.GetJointNames(), source.GetJointNames());
+	EXPECT_FLOAT_EQ(compressed.GetDuration(), source.GetDuration());
+
+	//16 bit steps over the root's 36 unit walk, on top of the tolerance
+	const float positionBound = settings.positionTolerance + 36.f / 65535.f;
+	const float rotationBound = settings.rotationTolerance + 2e-4f;
+	const float scaleBound = settings.scaleTolerance + 1e-5f;
+
+	std::vector<KeyCursor> sourceCursors = source.CreateCursors(), compressedCursors = compressed.CreateCursors();
+	std::vector<float> worstRotation(source.GetJoints().size(), 0.f);
+	for (int sample = 0; sample <= 3000; ++sample) {
+		const float time = source.GetDuration() * static_cast<float>(sample) / 3000.f;
+		for (size_t joint = 0; joint < source.GetJoints().size(); ++joint) {
+			const JointPose expected = source.SampleJoint(joint, time, sourceCursors);
+			const JointPose actual = compressed.SampleJoint(joint, time, compressedCursors);
+
+			ASSERT_LE(glm::length(expected.position - actual.position), positionBound) << "joint " << joint << " at " << time;
+			ASSERT_LE(Angle(expected.rotation, actual.rotation), rotationBound) << "joint " << joint << " at " << time;
+			ASSERT_LE(glm::length(expected.scale - actual.scale), scaleBound) << "joint " << joint << " at " << time;
+			worstRotation[joint] = std::max(worstRotation[joint], Angle(expected.rotation, actual.rotation));
+		}
+	}
+
+	//joints that hold still and the constant channels keep a single key
+	EXPECT_LT(stats.keptKeys, stats.sourceKeys / 3);
+	EXPECT_LT(worstRotation[3], 2e-4f);
+}
+
+TEST(AnimationCompressionTest, SizeReport) {
+	const RawAnimation animation = MakeMocapClip();
+	const std::string raw = WriteRaw(animation);
+
+	std::cout << "[          ] tolerance    keys kept      key bytes        clip bytes\n";
+	for (const float scale : { 0.f, 1.f, 4.f }) {
+		AnimationCompressionSettings settings;
+		settings.positionTolerance *= scale;
+		settings.rotationTolerance *= scale;
+		settings.scaleTolerance *= scale;
+
+		std::string binary, error;
+		AnimationCompressionStats stats;
+		ASSERT_TRUE(CompileAnimation(raw, settings, binary, stats, error)) << error;
+
+		std::cout << "[          ] x" << scale << "\t\t" << stats.keptKeys << "/" << stats.sourceKeys << "\t" << stats.sourceKeyBytes << " -> "
+			<< stats.compressedKeyBytes << "\t" << raw.size() << " -> " << binary.size() << '\n';
+
+		//quantization alone halves the keys, removal only shrinks them further
+		EXPECT_LT(stats.compressedKeyBytes * 2, stats.sourceKeyBytes);
+		EXPECT_LT(binary.size(), raw.size());
+	}
+}
+
+TEST(AnimationCompressionTest, EventsSurviveCompilation) {
+	const std::vector<AnimationEvent> events = {
+		{ 600.f, "Land", "sound-guid" },
+		{ 12.f, "Footstep", "" },
+		{ 2000.f, "PastTheEnd", "" },
+	};
+
+	std::string binary, error;
+	AnimationCompressionStats stats;
+	ASSERT_TRUE(CompileAnimation(WriteRaw(MakeMocapClip()), AnimationCompressionSettings{}, binary, stats, error, events)) << error;
+
+	AnimationClip clip;
+	ASSERT_TRUE(clip.Load(binary, error)) << error;
+	ASSERT_EQ(clip.GetEvents().size(), 3u);
+	EXPECT_EQ(clip.GetEvents()[0].name, "Footstep");
+	EXPECT_FLOAT_EQ(clip.GetEvents()[0].time, 12.f);
+	EXPECT_EQ(clip.GetEvents()[1].name, "Land");
+	EXPECT_EQ(clip.GetEvents()[1].sound, "sound-guid");
+	EXPECT_FLOAT_EQ(clip.GetEvents()[2].time, clip.GetDuration());
+	EXPECT_EQ(clip.GetJointNames().size(), 24u);
+
+	//a record pointing past the string table is rejected
+	AnimationHeader header;
+	std::memcpy(&header, binary.data(), sizeof(header));
+	const size_t eventsOffset = binary.size() - header.stringSize - sizeof(EventRecord) * header.eventCount;
+	EventRecord record;
+	std::memcpy(&record, binary.data() + eventsOffset, sizeof(record));
+	record.soundLength = header.stringSize + 1;
+	std::memcpy(binary.data() + eventsOffset, &record, sizeof(record));
+	EXPECT_FALSE(clip.Load(binary, error));
+}
+
+TEST(AnimationCompressionTest, RootMotionJointIsMarked) {
+	const std::string raw = WriteRaw(MakeMocapClip());
+	AnimationCompressionSettings settings;
+
+	std::string binary, error;
+	AnimationCompressionStats stats;
+	AnimationClip clip;
+	ASSERT_TRUE(CompileAnimation(raw, settings, binary, stats, error)) << error;
+	ASSERT_TRUE(clip.Load(binary, error)) << error;
+	EXPECT_EQ(clip.GetRootJoint(), 0);
+
+	settings.rootMotionJoint = "Joint3";
+	ASSERT_TRUE(CompileAnimation(raw, settings, binary, stats, error)) << error;
+	ASSERT_TRUE(clip.Load(binary, error)) << error;
+	EXPECT_EQ(clip.GetRootJoint(), 3);
+
+	settings.rootMotionJoint = "Missing";
+	ASSERT_TRUE(CompileAnimation(raw, settings, binary, stats, error)) << error;
+	ASSERT_TRUE(clip.Load(binary, error)) << error;
+	EXPECT_EQ(clip.GetRootJoint(), -1);
+}
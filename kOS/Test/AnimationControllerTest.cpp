@@ -0,0 +1,281 @@
+/******************************************************************/
+/*!
+\file      AnimationControllerTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the animation state machine: controller
+		   compilation, 1D and 2D blend weights, transitions and cross
+		   fades, and that Update does not allocate.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationController.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace animation;
+
+namespace {
+
+	std::atomic<bool> g_countAllocations{ false };
+	std::atomic<int> g_allocations{ 0 };
+}
+
+void* operator new(std::size_t size) {
+	if (g_countAllocations) ++g_allocations;
+	if (void* memory = std::malloc(size ? size : 1)) return memory;
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+namespace {
+
+	constexpr const char* CONTROLLER = R"({
+		"parameters": [
+			{ "name": "speed", "type": "float" },
+			{ "name": "grounded", "type": "bool", "default": 1 },
+			{ "name": "jump", "type": "trigger" },
+			{ "name": "hit", "type": "trigger" },
+			{ "name": "x", "type": "float" },
+			{ "name": "y", "type": "float" }
+		],
+		"defaultState": "Locomotion",
+		"states": [
+			{ "name": "Locomotion", "blend1D": { "parameter": "speed", "samples": [
+				{ "clip": "run", "threshold": 3 },
+				{ "clip": "idle", "threshold": 0 },
+				{ "clip": "walk", "threshold": 1 } ] } },
+			{ "name": "Strafe", "blend2D": { "parameterX": "x", "parameterY": "y", "samples": [
+				{ "clip": "idle", "position": [ 0, 0 ] },
+				{ "clip": "right", "position": [ 1, 0 ] },
+				{ "clip": "forward", "position": [ 0, 1 ] },
+				{ "clip": "left", "position": [ -1, 0 ] } ] } },
+			{ "name": "Jump", "clip": "jump", "loop": false },
+			{ "name": "Stagger", "clip": "idle", "speed": 2 }
+		],
+		"transitions": [
+			{ "from": "Any", "to": "Stagger", "conditions": [ { "parameter": "hit", "mode": "if" } ] },
+			{ "from": "Locomotion", "to": "Jump", "duration": 0.5, "conditions": [
+				{ "parameter": "jump", "mode": "if" }, { "parameter": "grounded", "mode": "if" } ] },
+			{ "from": "Jump", "to": "Locomotion", "exitTime": 1 },
+			{ "from": "Stagger", "to": "Locomotion", "conditions": [ { "parameter": "speed", "mode": "greater", "threshold": 0.5 } ] }
+		]
+	})";
+
+	//one joint clips that hold the root at a fixed position, so the blended position shows the weights
+	class AnimationControllerTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			AddClip("idle", { 0.f, 0.f, 0.f });
+			AddClip("walk", { 10.f, 0.f, 0.f });
+			AddClip("run", { 30.f, 0.f, 0.f });
+			AddClip("right", { 10.f, 0.f, 0.f });
+			AddClip("forward", { 0.f, 10.f, 0.f });
+			AddClip("left", { -10.f, 0.f, 0.f });
+			AddClip("jump", { 0.f, 0.f, 5.f });
+
+			std::string binary, error;
+			ASSERT_TRUE(assetpipeline::CompileController(CONTROLLER, binary, error)) << error;
+			auto controller = std::make_shared<AnimationController>();
+			ASSERT_TRUE(controller->Load(binary, error)) << error;
+			m_controller = controller;
+
+			std::vector<std::shared_ptr<const AnimationClip>> clips;
+			for (size_t i = 0; i < m_controller->GetClips().size(); ++i) {
+				clips.push_back(m_clips.at(std::string(m_controller->GetClipGUID(i))));
+			}
+			m_instance.Bind(m_controller, std::move(clips), this, { { "Root", 0 } }, { glm::mat4(1.f) });
+		}
+
+		void AddClip(const std::string& name, const glm::vec3& position) {
+			BoneTrack track;
+			track.positions = { position };
+			track.positionTimes = { 0.f };
+
+			auto clip = std::make_shared<AnimationClip>();
+			clip->Build(1.f, 1.f, { { "Root", -1 } }, { { "Root", track } });
+			m_clips[name] = clip;
+		}
+
+		int State(std::string_view name) const { return m_controller->FindState(name); }
+		glm::vec3 RootPosition() const { return m_instance.GetLocalPose()[0].position; }
+
+		std::unordered_map<std::string, std::shared_ptr<const AnimationClip>> m_clips;
+		std::shared_ptr<const AnimationController> m_controller;
+		ControllerInstance m_instance;
+	};
+}
+
+TEST(ControllerCompilerTest, RejectsInvalidControllers) {
+	std::string binary, error;
+	EXPECT_FALSE(assetpipeline::CompileController("{ not json", binary, error));
+	EXPECT_FALSE(error.empty());
+
+	error.clear();
+	EXPECT_FALSE(assetpipeline::CompileController(R"({ "states": [ { "name": "A", "clip": "a" } ],
+		"transitions": [ { "from": "A", "to": "B", "exitTime": 1 } ] })", binary, error));
+	EXPECT_NE(error.find("\"B\""), std::string::npos) << error;
+
+	error.clear();
+	EXPECT_FALSE(assetpipeline::CompileController(R"({ "states": [ { "name": "A", "blend1D": { "parameter": "speed",
+		"samples": [ { "clip": "a", "threshold": 0 } ] } } ] })", binary, error));
+	EXPECT_NE(error.find("speed"), std::string::npos) << error;
+
+	AnimationController controller;
+	EXPECT_FALSE(controller.Load("KACT", error));
+}
+
+TEST_F(AnimationControllerTest, LoadsCompiledController) {
+	EXPECT_EQ(m_controller->GetStates().size(), 4u);
+	EXPECT_EQ(m_controller->GetClips().size(), 7u);
+	EXPECT_EQ(m_controller->GetDefaultState(), State("Locomotion"));
+	EXPECT_EQ(m_controller->FindParameter("grounded"), 1);
+	EXPECT_FLOAT_EQ(m_instance.GetFloat(1), 1.f);
+	EXPECT_EQ(m_controller->FindState("Missing"), -1);
+}
+
+TEST_F(AnimationControllerTest, Blend1DWeights) {
+	const int locomotion = State("Locomotion");
+	std::vector<float> weights;
+
+	//samples are sorted by threshold: idle 0, walk 1, run 3
+	m_instance.SetFloat("speed", 2.f);
+	m_instance.GetBlendWeights(locomotion, weights);
+	ASSERT_EQ(weights.size(), 3u);
+	EXPECT_FLOAT_EQ(weights[0], 0.f);
+	EXPECT_FLOAT_EQ(weights[1], 0.5f);
+	EXPECT_FLOAT_EQ(weights[2], 0.5f);
+
+	m_instance.Update(0.f);
+	EXPECT_NEAR(RootPosition().x, 20.f, 1e-4f);
+
+	m_instance.SetFloat("speed", 1.f);
+	m_instance.GetBlendWeights(locomotion, weights);
+	EXPECT_FLOAT_EQ(weights[1], 1.f);
+
+	m_instance.SetFloat("speed", -4.f);
+	m_instance.GetBlendWeights(locomotion, weights);
+	EXPECT_FLOAT_EQ(weights[0], 1.f);
+
+	m_instance.SetFloat("speed", 9.f);
+	m_instance.GetBlendWeights(locomotion, weights);
+	EXPECT_FLOAT_EQ(weights[2], 1.f);
+}
+
+TEST_F(AnimationControllerTest, Blend2DWeights) {
+	const int strafe = State("Strafe");
+	std::vector<float> weights;
+
+	//on a sample only that sample plays
+	m_instance.SetFloat("x", 1.f);
+	m_instance.SetFloat("y", 0.f);
+	m_instance.GetBlendWeights(strafe, weights);
+	ASSERT_EQ(weights.size(), 4u);
+	EXPECT_NEAR(weights[1], 1.f, 1e-5f);
+
+	//halfway to the right sample, shared with the centre
+	m_instance.SetFloat("x", 0.5f);
+	m_instance.GetBlendWeights(strafe, weights);
+	EXPECT_NEAR(weights[0], 0.5f, 1e-5f);
+	EXPECT_NEAR(weights[1], 0.5f, 1e-5f);
+	EXPECT_NEAR(weights[2], 0.f, 1e-5f);
+	EXPECT_NEAR(weights[3], 0.f, 1e-5f);
+
+	//weights always sum to one, even outside the samples
+	for (const glm::vec2 point : { glm::vec2{ 0.3f, 0.6f }, glm::vec2{ -2.f, 3.f }, glm::vec2{ 5.f, -5.f } }) {
+		m_instance.SetFloat("x", point.x);
+		m_instance.SetFloat("y", point.y);
+		m_instance.GetBlendWeights(strafe, weights);
+
+		float total = 0.f;
+		for (float weight : weights) {
+			EXPECT_GE(weight, 0.f);
+			total += weight;
+		}
+		EXPECT_NEAR(total, 1.f, 1e-5f);
+	}
+}
+
+TEST_F(AnimationControllerTest, TriggerFiresTransitionOnce) {
+	m_instance.SetBool(m_controller->FindParameter("grounded"), false);
+	m_instance.SetTrigger("jump");
+	m_instance.Update(0.1f);
+	EXPECT_EQ(m_instance.GetCurrentState(), State("Locomotion"));
+
+	//the trigger waits until every condition holds, then is used up
+	m_instance.SetBool("grounded", true);
+	m_instance.Update(0.1f);
+	EXPECT_EQ(m_instance.GetCurrentState(), State("Jump"));
+	EXPECT_FLOAT_EQ(m_instance.GetFloat(m_controller->FindParameter("jump")), 0.f);
+}
+
+TEST_F(AnimationControllerTest, CrossFadeBlendsPreviousState) {
+	m_instance.SetTrigger("jump");
+	m_instance.Update(0.f);
+	ASSERT_TRUE(m_instance.IsInTransition());
+	EXPECT_EQ(m_instance.GetPreviousState(), State("Locomotion"));
+	EXPECT_NEAR(RootPosition().z, 0.f, 1e-5f);
+
+	//0.5 second fade from idle (z 0) to jump (z 5)
+	m_instance.Update(0.25f);
+	EXPECT_FLOAT_EQ(m_instance.GetTransitionWeight(), 0.5f);
+	EXPECT_NEAR(RootPosition().z, 2.5f, 1e-4f);
+
+	m_instance.Update(0.25f);
+	EXPECT_FALSE(m_instance.IsInTransition());
+	EXPECT_NEAR(RootPosition().z, 5.f, 1e-4f);
+}
+
+TEST_F(AnimationControllerTest, ExitTimeAndAnyState) {
+	m_instance.SetTrigger("jump");
+	m_instance.Update(0.5f);
+	m_instance.Update(0.25f);
+	EXPECT_EQ(m_instance.GetCurrentState(), State("Jump"));
+
+	//jump is 1 second long, the exit transition waits for its end
+	m_instance.Update(0.3f);
+	EXPECT_EQ(m_instance.GetCurrentState(), State("Jump"));
+	m_instance.Update(0.f);
+	EXPECT_EQ(m_instance.GetCurrentState(), State("Locomotion"));
+
+	//any state transitions leave every state, without a fade when no duration is given
+	m_instance.SetTrigger("hit");
+	m_instance.Update(0.1f);
+	EXPECT_EQ(m_instance.GetCurrentState(), State("Stagger"));
+	EXPECT_FALSE(m_instance.IsInTransition());
+	EXPECT_NEAR(m_instance.GetNormalizedTime(), 0.2f, 1e-5f);
+
+	m_instance.SetFloat("speed", 1.f);
+	m_instance.Update(0.1f);
+	EXPECT_EQ(m_instance.GetCurrentState(), State("Locomotion"));
+}
+
+TEST_F(AnimationControllerTest, UpdateDoesNotAllocate) {
+	const int speed = m_controller->FindParameter("speed");
+	const int jump = m_controller->FindParameter("jump");
+
+	g_allocations = 0;
+	g_countAllocations = true;
+	for (int frame = 0; frame < 240; ++frame) {
+		m_instance.SetFloat(speed, static_cast<float>(frame % 40) * 0.1f);
+		if (frame % 60 == 0) m_instance.SetTrigger(jump);
+		m_instance.Update(1.f / 60.f);
+	}
+	g_countAllocations = false;
+
+	EXPECT_EQ(g_allocations, 0);
+}
@@ -0,0 +1,142 @@
+/******************************************************************/
+/*!
+\file      AnimationEventTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for animation event markers: each crossed
+		   marker fires once on loop wrap, reverse playback, ping pong
+		   and steps longer than the clip.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationInstance.h"
+
+using namespace animation;
+
+namespace {
+
+	//10 ticks at 1 tick per second, so delta times are in ticks
+	AnimationClip MakeClip() {
+		AnimationClip clip;
+		clip.Build(10.f, 1.f, { JointDesc{ "Root", -1, glm::mat4(1.f) } }, {});
+		clip.SetEvents({ { 8.f, "Land", "" }, { 0.f, "Start", "" }, { 2.f, "Step", "" } });
+		return clip;
+	}
+
+	std::vector<std::string> Fired(const AnimationInstance& instance) {
+		std::vector<std::string> names;
+		for (const AnimationEvent* event : instance.GetFiredEvents()) names.push_back(event->name);
+		return names;
+	}
+
+	using Names = std::vector<std::string>;
+}
+
+TEST(AnimationEventTest, EventsAreSortedAndClamped) {
+	AnimationClip clip = MakeClip();
+	clip.SetEvents({ { 12.f, "Late", "" }, { 3.f, "Mid", "" }, { -1.f, "Early", "" } });
+
+	ASSERT_EQ(clip.GetEvents().size(), 3u);
+	EXPECT_EQ(clip.GetEvents()[0].name, "Early");
+	EXPECT_EQ(clip.GetEventTimes(), (std::vector<float>{ 0.f, 3.f, 10.f }));
+}
+
+TEST(AnimationEventTest, ForwardLoopWrapsOnce) {
+	const AnimationClip clip = MakeClip();
+	AnimationInstance instance;
+
+	//the first step also reports the marker at the start time
+	instance.Advance(clip, 1.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), Names{ "Start" });
+
+	instance.Advance(clip, 8.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), (Names{ "Step", "Land" }));
+
+	instance.Advance(clip, 3.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), (Names{ "Start", "Step" }));
+	EXPECT_FLOAT_EQ(instance.GetTime(), 2.f);
+
+	//stepping from a marker does not repeat it
+	instance.Advance(clip, 1.f, LoopMode::Loop);
+	EXPECT_TRUE(Fired(instance).empty());
+
+	instance.Advance(clip, 0.f, LoopMode::Loop);
+	EXPECT_TRUE(Fired(instance).empty());
+}
+
+TEST(AnimationEventTest, LandingOnTheClipEndFiresTheStart) {
+	const AnimationClip clip = MakeClip();
+	AnimationInstance instance;
+	instance.Advance(clip, 5.f, LoopMode::Loop);
+
+	instance.Advance(clip, 5.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), (Names{ "Land", "Start" }));
+	EXPECT_FLOAT_EQ(instance.GetTime(), 0.f);
+
+	instance.Advance(clip, 1.f, LoopMode::Loop);
+	EXPECT_TRUE(Fired(instance).empty());
+}
+
+TEST(AnimationEventTest, ReversePlayback) {
+	const AnimationClip clip = MakeClip();
+	AnimationInstance instance;
+	instance.SetTime(5.f);
+	instance.Advance(clip, 0.f, LoopMode::Loop);
+
+	instance.Advance(clip, -4.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), Names{ "Step" });
+
+	//backwards through the start wraps to the clip end
+	instance.Advance(clip, -3.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), (Names{ "Start", "Land" }));
+	EXPECT_FLOAT_EQ(instance.GetTime(), 8.f);
+
+	instance.SetTime(3.f);
+	instance.Advance(clip, -10.f, LoopMode::Once);
+	EXPECT_EQ(Fired(instance), (Names{ "Step", "Start" }));
+	EXPECT_TRUE(instance.IsFinished());
+}
+
+TEST(AnimationEventTest, StepsLongerThanTheClipFireEachEventOnce) {
+	const AnimationClip clip = MakeClip();
+	AnimationInstance instance;
+	instance.SetTime(5.f);
+	instance.Advance(clip, 0.f, LoopMode::Loop);
+
+	instance.Advance(clip, 25.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), (Names{ "Land", "Start", "Step" }));
+	EXPECT_FLOAT_EQ(instance.GetTime(), 0.f);
+
+	instance.Advance(clip, -37.f, LoopMode::Loop);
+	EXPECT_EQ(Fired(instance), (Names{ "Land", "Step" , "Start" }));
+
+	//a clip played once stops at its end and fires nothing more
+	AnimationInstance once;
+	once.Advance(clip, 100.f, LoopMode::Once);
+	EXPECT_EQ(Fired(once), (Names{ "Start", "Step", "Land" }));
+	once.Advance(clip, 100.f, LoopMode::Once);
+	EXPECT_TRUE(Fired(once).empty());
+}
+
+TEST(AnimationEventTest, PingPongTurnsAtTheEnds) {
+	const AnimationClip clip = MakeClip();
+	AnimationInstance instance;
+	instance.SetTime(5.f);
+	instance.Advance(clip, 0.f, LoopMode::PingPong);
+
+	//out to the end and back past the start of the step
+	instance.Advance(clip, 8.f, LoopMode::PingPong);
+	EXPECT_EQ(Fired(instance), Names{ "Land" });
+	EXPECT_FLOAT_EQ(instance.GetTime(), 7.f);
+
+	instance.Advance(clip, 6.f, LoopMode::PingPong);
+	EXPECT_EQ(Fired(instance), Names{ "Step" });
+
+	instance.Advance(clip, 40.f, LoopMode::PingPong);
+	EXPECT_EQ(Fired(instance), (Names{ "Start", "Step", "Land" }));
+}
@@ -0,0 +1,300 @@
+/******************************************************************/
+/*!
+\file      AnimationIkTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the inverse kinematics solvers: reaching
+		   targets, convergence of FABRIK, joint limits, poles, look at
+		   cones and foot placement against a stubbed raycast.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationInstance.h"
+
+#include <random>
+
+using namespace animation;
+
+namespace {
+
+	glm::mat4 Offset(float x, float y, float z) {
+		return glm::translate(glm::mat4(1.f), glm::vec3{ x, y, z });
+	}
+
+	//hip, knee slightly forward, ankle, toe, and a second leg that must not move
+	AnimationClip MakeLegs() {
+		AnimationClip clip;
+		clip.Build(1.f, 1.f, {
+			{ "Pelvis", -1, Offset(0.f, 1.f, 0.f) },
+			{ "Hip", 0, Offset(0.2f, 0.f, 0.f) },
+			{ "Knee", 1, Offset(0.f, -0.5f, 0.05f) },
+			{ "Ankle", 2, Offset(0.f, -0.5f, -0.05f) },
+			{ "Toe", 3, Offset(0.f, -0.05f, 0.15f) },
+			{ "OtherHip", 0, Offset(-0.2f, 0.f, 0.f) },
+			{ "OtherKnee", 5, Offset(0.f, -0.5f, 0.05f) },
+		}, {});
+		return clip;
+	}
+
+	//tail of "count" joints 0.25 apart along +z
+	AnimationClip MakeTail(int count) {
+		std::vector<JointDesc> joints;
+		for (int i = 0; i < count; ++i) {
+			joints.push_back({ "Tail" + std::to_string(i), i - 1, i ? Offset(0.f, 0.f, 0.25f) : glm::mat4(1.f) });
+		}
+		AnimationClip clip;
+		clip.Build(1.f, 1.f, joints, {});
+		return clip;
+	}
+
+	std::vector<glm::mat4> BindGlobals(const AnimationClip& clip) {
+		std::vector<glm::mat4> globals;
+		for (const Joint& joint : clip.GetJoints()) {
+			globals.push_back(joint.parent < 0 ? joint.bindTransform : globals[joint.parent] * joint.bindTransform);
+		}
+		return globals;
+	}
+
+	glm::vec3 At(const std::vector<glm::mat4>& globals, int joint) {
+		return glm::vec3{ globals[joint][3] };
+	}
+
+	float Between(const glm::vec3& a, const glm::vec3& b) {
+		return std::acos(glm::clamp(glm::dot(glm::normalize(a), glm::normalize(b)), -1.f, 1.f));
+	}
+
+	IkConstraint Chain(const AnimationClip& clip, IkSolver solver, int root, int end) {
+		IkConstraint constraint;
+		constraint.solver = solver;
+		EXPECT_TRUE(BuildChain(clip.GetJoints(), root, end, constraint.chain));
+		return constraint;
+	}
+
+	//ground plane rising along +z with the given slope, through the origin
+	IkRaycast Slope(float slope) {
+		return [slope](const glm::vec3& origin, const glm::vec3& direction, float maxDistance, IkHit& hit) {
+			const glm::vec3 normal = glm::normalize(glm::vec3{ 0.f, 1.f, -slope });
+			const float denominator = glm::dot(direction, normal);
+			if (std::abs(denominator) < 1e-6f) return false;
+			const float distance = -glm::dot(origin, normal) / denominator;
+			if (distance < 0.f || distance > maxDistance) return false;
+			hit.point = origin + direction * distance;
+			hit.normal = normal;
+			hit.distance = distance;
+			return true;
+		};
+	}
+}
+
+TEST(AnimationIkTest, BuildChainFollowsParents) {
+	const AnimationClip clip = MakeLegs();
+	std::vector<int> chain;
+	ASSERT_TRUE(BuildChain(clip.GetJoints(), 1, 4, chain));
+	EXPECT_EQ(chain, (std::vector<int>{ 1, 2, 3, 4 }));
+
+	//the other leg is not below the hip
+	EXPECT_FALSE(BuildChain(clip.GetJoints(), 1, 6, chain));
+	EXPECT_TRUE(chain.empty());
+	EXPECT_FALSE(BuildChain(clip.GetJoints(), -1, 4, chain));
+}
+
+TEST(AnimationIkTest, RotateJointCarriesOnlyItsDescendants) {
+	const AnimationClip clip = MakeLegs();
+	std::vector<glm::mat4> globals = BindGlobals(clip);
+	const std::vector<glm::mat4> bind = globals;
+
+	RotateJoint(clip.GetJoints(), globals, 2, glm::angleAxis(glm::half_pi<float>(), glm::vec3{ 1.f, 0.f, 0.f }));
+
+	EXPECT_EQ(globals[1], bind[1]);
+	EXPECT_EQ(globals[6], bind[6]);
+	EXPECT_LT(glm::length(At(globals, 2) - At(bind, 2)), 1e-6f);
+	EXPECT_NEAR(glm::length(At(globals, 3) - At(globals, 2)), glm::length(At(bind, 3) - At(bind, 2)), 1e-6f);
+	EXPECT_NEAR(glm::length(At(globals, 4) - At(globals, 3)), glm::length(At(bind, 4) - At(bind, 3)), 1e-6f);
+}
+
+TEST(AnimationIkTest, TwoBoneReachesEveryTargetInRange) {
+	const AnimationClip clip = MakeLegs();
+	const std::vector<glm::mat4> bind = BindGlobals(clip);
+	const glm::vec3 hip = At(bind, 1);
+	const float upper = glm::length(At(bind, 2) - hip), lower = glm::length(At(bind, 3) - At(bind, 2));
+
+	std::mt19937 random{ 3 };
+	std::uniform_real_distribution<float> value{ -1.f, 1.f };
+	for (int i = 0; i < 200; ++i) {
+		glm::vec3 direction{ value(random), value(random) - 1.f, value(random) };
+		direction = glm::normalize(direction);
+		const float distance = std::abs(upper - lower) + 0.05f + (upper + lower - std::abs(upper - lower) - 0.1f) * (0.5f + 0.5f * value(random));
+
+		std::vector<glm::mat4> globals = bind;
+		IkConstraint constraint = Chain(clip, IkSolver::TwoBone, 1, 3);
+		constraint.target = hip + direction * distance;
+
+		EXPECT_LT(SolveTwoBone(clip.GetJoints(), constraint, globals), 1e-4f);
+		EXPECT_LT(glm::length(At(globals, 3) - constraint.target), 1e-4f);
+		EXPECT_LT(glm::length(At(globals, 1) - hip), 1e-6f);
+		EXPECT_NEAR(glm::length(At(globals, 2) - At(globals, 1)), upper, 1e-5f);
+		EXPECT_NEAR(glm::length(At(globals, 3) - At(globals, 2)), lower, 1e-5f);
+	}
+
+	//out of reach the limb points straight at the target
+	std::vector<glm::mat4> globals = bind;
+	IkConstraint constraint = Chain(clip, IkSolver::TwoBone, 1, 3);
+	constraint.target = hip + glm::vec3{ 0.f, -3.f, 1.f };
+	const float left = SolveTwoBone(clip.GetJoints(), constraint, globals);
+	EXPECT_NEAR(left, glm::length(constraint.target - hip) - (upper + lower), 1e-3f);
+	EXPECT_LT(Between(At(globals, 3) - hip, constraint.target - hip), 1e-3f);
+}
+
+TEST(AnimationIkTest, TwoBoneKeepsTheBendInItsLimitsAndFacesThePole) {
+	const AnimationClip clip = MakeLegs();
+	const std::vector<glm::mat4> bind = BindGlobals(clip);
+	const glm::vec3 hip = At(bind, 1);
+
+	//a target close to the hip needs a deep bend, the limit stops it at 60 degrees
+	std::vector<glm::mat4> globals = bind;
+	IkConstraint constraint = Chain(clip, IkSolver::TwoBone, 1, 3);
+	constraint.target = hip + glm::vec3{ 0.f, -0.3f, 0.f };
+	constraint.maxAngle = glm::radians(60.f);
+	SolveTwoBone(clip.GetJoints(), constraint, globals);
+
+	const float bend = glm::pi<float>() - Between(At(globals, 1) - At(globals, 2), At(globals, 3) - At(globals, 2));
+	EXPECT_NEAR(bend, glm::radians(60.f), 1e-4f);
+	EXPECT_LT(Between(At(globals, 3) - hip, constraint.target - hip), 1e-3f);
+
+	//the knee turns to whichever side the pole is on
+	for (const float side : { 1.f, -1.f }) {
+		globals = bind;
+		constraint = Chain(clip, IkSolver::TwoBone, 1, 3);
+		constraint.target = hip + glm::vec3{ 0.f, -0.7f, 0.1f };
+		constraint.pole = hip + glm::vec3{ side, -0.5f, 0.f };
+		constraint.usePole = true;
+		EXPECT_LT(SolveTwoBone(clip.GetJoints(), constraint, globals), 1e-4f);
+		EXPECT_GT(side * (At(globals, 2).x - hip.x), 0.1f);
+	}
+
+	//half the weight goes half way
+	globals = bind;
+	constraint = Chain(clip, IkSolver::TwoBone, 1, 3);
+	constraint.target = At(bind, 3) + glm::vec3{ 0.f, 0.2f, 0.f };
+	constraint.weight = 0.5f;
+	SolveTwoBone(clip.GetJoints(), constraint, globals);
+	EXPECT_NEAR(At(globals, 3).y, At(bind, 3).y + 0.1f, 1e-4f);
+}
+
+TEST(AnimationIkTest, FabrikConvergesMonotonically) {
+	const AnimationClip clip = MakeTail(8);
+	const std::vector<glm::mat4> bind = BindGlobals(clip);
+
+	IkConstraint constraint = Chain(clip, IkSolver::Fabrik, 0, 7);
+	constraint.target = glm::vec3{ 0.8f, 0.6f, 0.9f };
+	constraint.tolerance = 1e-5f;
+
+	float previous = glm::length(At(bind, 7) - constraint.target);
+	for (int iterations = 1; iterations <= 30; ++iterations) {
+		std::vector<glm::mat4> globals = bind;
+		constraint.iterations = iterations;
+		const float error = SolveFabrik(clip.GetJoints(), constraint, globals);
+		EXPECT_LE(error, previous + 1e-6f) << "iterations " << iterations;
+		previous = error;
+
+		for (int joint = 1; joint < 8; ++joint) {
+			EXPECT_NEAR(glm::length(At(globals, joint) - At(globals, joint - 1)), 0.25f, 1e-5f);
+		}
+	}
+	EXPECT_LT(previous, 1e-4f);
+}
+
+TEST(AnimationIkTest, FabrikSegmentsStayInTheirCones) {
+	const AnimationClip clip = MakeTail(6);
+	const std::vector<glm::mat4> bind = BindGlobals(clip);
+	const float cone = glm::radians(20.f);
+
+	for (const glm::vec3 target : { glm::vec3{ 0.6f, 0.3f, 0.7f }, glm::vec3{ 0.f, 5.f, 0.f }, glm::vec3{ 0.f, 0.f, -1.f } }) {
+		std::vector<glm::mat4> globals = bind;
+		IkConstraint constraint = Chain(clip, IkSolver::Fabrik, 0, 5);
+		constraint.target = target;
+		constraint.maxAngle = cone;
+		constraint.iterations = 50;
+		SolveFabrik(clip.GetJoints(), constraint, globals);
+
+		//the first segment is held to the animated direction, the others to the segment before
+		glm::vec3 reference = At(bind, 1) - At(bind, 0);
+		for (int joint = 1; joint < 6; ++joint) {
+			const glm::vec3 segment = At(globals, joint) - At(globals, joint - 1);
+			EXPECT_LE(Between(reference, segment), cone + 1e-4f);
+			EXPECT_NEAR(glm::length(segment), 0.25f, 1e-5f);
+			reference = segment;
+		}
+	}
+
+	//unlimited and out of reach, the chain lies straight on the line to the target
+	std::vector<glm::mat4> globals = bind;
+	IkConstraint constraint = Chain(clip, IkSolver::Fabrik, 0, 5);
+	constraint.target = glm::vec3{ 0.f, 5.f, 0.f };
+	EXPECT_NEAR(SolveFabrik(clip.GetJoints(), constraint, globals), 5.f - 1.25f, 1e-4f);
+	EXPECT_LT(glm::length(At(globals, 5) - glm::vec3{ 0.f, 1.25f, 0.f }), 1e-4f);
+}
+
+TEST(AnimationIkTest, LookAtTurnsTheAxisWithinItsCone) {
+	const AnimationClip clip = MakeTail(3);
+	const std::vector<glm::mat4> bind = BindGlobals(clip);
+
+	IkConstraint constraint;
+	constraint.solver = IkSolver::LookAt;
+	constraint.chain = { 1 };
+	constraint.target = At(bind, 1) + glm::vec3{ 1.f, 0.f, 1.f };
+
+	std::vector<glm::mat4> globals = bind;
+	EXPECT_LT(SolveLookAt(clip.GetJoints(), constraint, globals), 1e-4f);
+	EXPECT_LT(Between(glm::vec3(At(globals, 2) - At(globals, 1)), glm::vec3{ 1.f, 0.f, 1.f }), 1e-4f);
+	EXPECT_EQ(globals[0], bind[0]);
+
+	//a 45 degree turn held to 30
+	globals = bind;
+	constraint.maxAngle = glm::radians(30.f);
+	EXPECT_NEAR(SolveLookAt(clip.GetJoints(), constraint, globals), glm::radians(15.f), 1e-4f);
+	EXPECT_NEAR(Between(glm::mat3(globals[1]) * glm::vec3{ 0.f, 0.f, 1.f }, glm::vec3{ 0.f, 0.f, 1.f }), glm::radians(30.f), 1e-4f);
+}
+
+TEST(AnimationIkTest, FeetLandOnTheStubbedGround) {
+	const AnimationClip clip = MakeLegs();
+	const std::vector<glm::mat4> bind = BindGlobals(clip);
+	const glm::vec3 ankle = At(bind, 3);
+	const glm::vec3 up{ 0.f, 1.f, 0.f };
+
+	//flat ground at the character's feet leaves the animated foot where it is
+	glm::vec3 target;
+	ASSERT_TRUE(PlaceOnGround(Slope(0.f), ankle, glm::vec3{ 0.f }, up, 0.5f, target));
+	EXPECT_LT(glm::length(target - ankle), 1e-5f);
+
+	//a foot ahead on a slope going up is lifted by the height of the ground under it
+	const glm::vec3 forward = ankle + glm::vec3{ 0.f, 0.f, 0.4f };
+	ASSERT_TRUE(PlaceOnGround(Slope(0.25f), forward, glm::vec3{ 0.f }, up, 0.5f, target));
+	EXPECT_NEAR(target.y, forward.y + 0.25f * forward.z, 1e-5f);
+
+	//nothing within reach
+	target = glm::vec3{ 7.f };
+	EXPECT_FALSE(PlaceOnGround(Slope(0.f), ankle + glm::vec3{ 0.f, 2.f, 0.f }, glm::vec3{ 0.f }, up, 0.5f, target));
+	EXPECT_FALSE(PlaceOnGround(nullptr, ankle, glm::vec3{ 0.f }, up, 0.5f, target));
+	EXPECT_EQ(target, glm::vec3{ 7.f });
+
+	//the leg reaches the placed target through the instance stage and skins with it
+	AnimationInstance instance;
+	instance.Bind(clip, &clip, { { "Hip", 0 }, { "Knee", 1 }, { "Ankle", 2 } }, std::vector<glm::mat4>(3, glm::mat4(1.f)));
+	instance.Sample(clip);
+
+	IkConstraint constraint = Chain(clip, IkSolver::TwoBone, 1, 3);
+	ASSERT_TRUE(PlaceOnGround(Slope(0.25f), ankle + glm::vec3{ 0.f, 0.f, 0.1f }, glm::vec3{ 0.f }, up, 0.5f, constraint.target));
+	instance.SolveIk(clip, { constraint });
+
+	const std::vector<glm::mat4>& solved = instance.GetGlobalTransforms();
+	EXPECT_LT(glm::length(At(solved, 3) - constraint.target), 1e-4f);
+	EXPECT_EQ(instance.GetPose()[0], solved[1]);
+	EXPECT_EQ(instance.GetPose()[2], solved[3]);
+	EXPECT_EQ(solved[6], bind[6]);
+}
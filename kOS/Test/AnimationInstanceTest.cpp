@@ -0,0 +1,172 @@
+/******************************************************************/
+/*!
+\file      AnimationInstanceTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for per entity animation playback: entities sharing
+		   one clip keep their own time and pose, loop modes, and
+		   sampling one clip from several threads.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationInstance.h"
+
+using namespace animation;
+
+namespace {
+
+	//three joint arm, every joint swings a quarter turn over 4 ticks
+	class AnimationInstanceTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			std::unordered_map<std::string, BoneTrack> tracks;
+			for (const char* name : { "Shoulder", "Elbow", "Wrist" }) {
+				BoneTrack& track = tracks[name];
+				track.positions = { glm::vec3{ 0.f, 1.f, 0.f } };
+				track.positionTimes = { 0.f };
+				track.rotations = { glm::quat{ 1.f, 0.f, 0.f, 0.f }, glm::angleAxis(glm::radians(90.f), glm::vec3{ 0.f, 0.f, 1.f }) };
+				track.rotationTimes = { 0.f, 4.f };
+				track.scales = { glm::vec3{ 1.f } };
+				track.scaleTimes = { 0.f };
+			}
+			m_clip.Build(4.f, 2.f, { { "Shoulder", -1 }, { "Elbow", 0 }, { "Wrist", 1 } }, tracks);
+
+			m_boneMap = { { "Shoulder", 0 }, { "Elbow", 1 }, { "Wrist", 2 } };
+			m_offsets.assign(3, glm::mat4(1.f));
+		}
+
+		//pose at "time" sampled from scratch, without any cached cursor
+		std::vector<glm::mat4> Expected(float time) const {
+			std::vector<KeyCursor> cursors = m_clip.CreateCursors();
+			std::vector<glm::mat4> globals, pose(3, glm::mat4(1.f));
+			m_clip.SamplePose(time, cursors, m_clip.Bind(m_boneMap, m_offsets), glm::mat4(1.f), glm::mat4(1.f), globals, pose);
+			return pose;
+		}
+
+		AnimationInstance MakeInstance(float time) const {
+			AnimationInstance instance;
+			instance.Bind(m_clip, this, m_boneMap, m_offsets);
+			instance.SetTime(time);
+			return instance;
+		}
+
+		static float Distance(const std::vector<glm::mat4>& a, const std::vector<glm::mat4>& b) {
+			float distance = 0.f;
+			for (size_t bone = 0; bone < a.size(); ++bone) {
+				for (int column = 0; column < 4; ++column) distance += glm::length(a[bone][column] - b[bone][column]);
+			}
+			return distance;
+		}
+
+		AnimationClip m_clip;
+		std::unordered_map<std::string, int> m_boneMap;
+		std::vector<glm::mat4> m_offsets;
+	};
+}
+
+TEST_F(AnimationInstanceTest, EntitiesSharingClipKeepTheirOwnPose) {
+	constexpr int ENTITIES = 8;
+	std::vector<AnimationInstance> instances;
+	for (int i = 0; i < ENTITIES; ++i) instances.push_back(MakeInstance(0.45f * i));
+
+	//one shared clip, every entity advanced by the same frame time
+	for (int frame = 0; frame < 30; ++frame) {
+		for (auto& instance : instances) {
+			instance.Advance(m_clip, 1.f / 60.f, LoopMode::Loop);
+			instance.Sample(m_clip);
+		}
+	}
+
+	const float advanced = 30.f / 60.f * m_clip.GetTicksPerSecond();
+	for (int i = 0; i < ENTITIES; ++i) {
+		const float time = std::fmod(0.45f * i + advanced, m_clip.GetDuration());
+		EXPECT_NEAR(instances[i].GetTime(), time, 1e-4f);
+		EXPECT_LT(Distance(instances[i].GetPose(), Expected(time)), 1e-4f) << "entity " << i;
+
+		for (int j = 0; j < i; ++j) {
+			EXPECT_GT(Distance(instances[i].GetPose(), instances[j].GetPose()), 1e-3f) << "entities " << i << " and " << j;
+		}
+	}
+}
+
+TEST_F(AnimationInstanceTest, PlaybackSpeedOnlyAffectsItsEntity) {
+	AnimationInstance normal = MakeInstance(0.f);
+	AnimationInstance fast = MakeInstance(0.f);
+
+	normal.Advance(m_clip, 0.5f, LoopMode::Loop);
+	fast.Advance(m_clip, 0.5f * 3.f, LoopMode::Loop);
+
+	EXPECT_NEAR(normal.GetTime(), 1.f, 1e-5f);
+	EXPECT_NEAR(fast.GetTime(), 3.f, 1e-5f);
+}
+
+TEST_F(AnimationInstanceTest, LoopModes) {
+	AnimationInstance loop = MakeInstance(3.f);
+	loop.Advance(m_clip, 1.f, LoopMode::Loop);
+	EXPECT_NEAR(loop.GetTime(), 1.f, 1e-5f);
+	loop.Advance(m_clip, -1.f, LoopMode::Loop);
+	EXPECT_NEAR(loop.GetTime(), 3.f, 1e-5f);
+
+	AnimationInstance once = MakeInstance(3.f);
+	once.Advance(m_clip, 0.25f, LoopMode::Once);
+	EXPECT_FALSE(once.IsFinished());
+	once.Advance(m_clip, 1.f, LoopMode::Once);
+	EXPECT_TRUE(once.IsFinished());
+	EXPECT_FLOAT_EQ(once.GetTime(), m_clip.GetDuration());
+
+	AnimationInstance pingPong = MakeInstance(3.f);
+	pingPong.Advance(m_clip, 1.f, LoopMode::PingPong);
+	EXPECT_NEAR(pingPong.GetTime(), 3.f, 1e-5f);
+	pingPong.Advance(m_clip, 0.25f, LoopMode::PingPong);
+	EXPECT_NEAR(pingPong.GetTime(), 2.5f, 1e-5f);
+	pingPong.Advance(m_clip, 1.5f, LoopMode::PingPong);
+	EXPECT_NEAR(pingPong.GetTime(), 0.5f, 1e-5f);
+	//bounced off the start, so playing forward again
+	pingPong.Advance(m_clip, 0.5f, LoopMode::PingPong);
+	EXPECT_NEAR(pingPong.GetTime(), 1.5f, 1e-5f);
+}
+
+TEST_F(AnimationInstanceTest, ClipIsSampledFromManyThreads) {
+	constexpr int ENTITIES = 64;
+	std::vector<AnimationInstance> serial, parallel;
+	for (int i = 0; i < ENTITIES; ++i) {
+		serial.push_back(MakeInstance(0.0625f * i));
+		parallel.push_back(MakeInstance(0.0625f * i));
+	}
+
+	for (auto& instance : serial) instance.Sample(m_clip);
+
+	std::vector<std::thread> threads;
+	for (int thread = 0; thread < 4; ++thread) {
+		threads.emplace_back([&, thread] {
+			for (int i = thread; i < ENTITIES; i += 4) parallel[i].Sample(m_clip);
+			});
+	}
+	for (auto& thread : threads) thread.join();
+
+	for (int i = 0; i < ENTITIES; ++i) {
+		EXPECT_EQ(Distance(serial[i].GetPose(), parallel[i].GetPose()), 0.f) << "entity " << i;
+	}
+}
+
+TEST_F(AnimationInstanceTest, RebindsWhenSkeletonChanges) {
+	AnimationInstance instance = MakeInstance(1.f);
+	EXPECT_TRUE(instance.IsBound(m_clip, this));
+
+	int otherSkeleton = 0;
+	EXPECT_FALSE(instance.IsBound(m_clip, &otherSkeleton));
+
+	//a mesh with only two of the joints as bones
+	instance.Bind(m_clip, &otherSkeleton, { { "Wrist", 0 }, { "Shoulder", 1 } }, { glm::mat4(1.f), glm::mat4(1.f) });
+	instance.Sample(m_clip);
+	ASSERT_EQ(instance.GetPose().size(), 2u);
+
+	const auto expected = Expected(1.f);
+	EXPECT_LT(Distance({ instance.GetPose()[0] }, { expected[2] }), 1e-5f);
+	EXPECT_LT(Distance({ instance.GetPose()[1] }, { expected[0] }), 1e-5f);
+}
@@ -0,0 +1,400 @@
+/******************************************************************/
+/*!
+\file      AnimationLodTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for animation level of detail: joint importance
+		   from the bind pose, screen size and visibility, and the
+		   scheduler spreading, budgeting, freezing and blending pose
+		   evaluations, without a renderer. Ends with the joint
+		   evaluations per frame of a crowd of a thousand.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationLod.h"
+#include "Animation/AnimationInstance.h"
+#include "AssetPipeline/AnimationCompiler.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace animation;
+
+namespace {
+
+	glm::mat4 Offset(float x, float y, float z) {
+		return glm::translate(glm::mat4(1.f), glm::vec3{ x, y, z });
+	}
+
+	//1.9 units tall, one arm with a finger and one leg, every joint swinging about x
+	assetpipeline::RawAnimation MakeHumanoid() {
+		assetpipeline::RawAnimation animation;
+		animation.duration = 30.f;
+		animation.ticksPerSecond = 30.f;
+		animation.joints = {
+			{ "Hips", -1, Offset(0.f, 1.f, 0.f) },
+			{ "Spine", 0, Offset(0.f, 0.2f, 0.f) },
+			{ "Chest", 1, Offset(0.f, 0.25f, 0.f) },
+			{ "Neck", 2, Offset(0.f, 0.15f, 0.f) },
+			{ "Head", 3, Offset(0.f, 0.1f, 0.f) },
+			{ "HeadEnd", 4, Offset(0.f, 0.2f, 0.f) },
+			{ "UpperArm", 2, Offset(0.2f, 0.05f, 0.f) },
+			{ "ForeArm", 6, Offset(0.3f, 0.f, 0.f) },
+			{ "Hand", 7, Offset(0.25f, 0.f, 0.f) },
+			{ "Finger1", 8, Offset(0.1f, 0.f, 0.f) },
+			{ "Finger2", 9, Offset(0.03f, 0.f, 0.f) },
+			{ "FingerTip", 10, Offset(0.02f, 0.f, 0.f) },
+			{ "Thigh", 0, Offset(0.1f, -0.05f, 0.f) },
+			{ "Shin", 12, Offset(0.f, -0.45f, 0.f) },
+			{ "Foot", 13, Offset(0.f, -0.45f, 0.f) },
+			{ "Toe", 14, Offset(0.f, -0.05f, 0.12f) },
+		};
+
+		for (size_t i = 0; i < animation.joints.size(); ++i) {
+			const JointDesc& joint = animation.joints[i];
+			BoneTrack& track = animation.tracks[joint.name];
+			for (int key = 0; key <= 30; key += 5) {
+				const float angle = 0.3f * std::sin(glm::two_pi<float>() * key / 30.f + static_cast<float>(i));
+				track.positionTimes.push_back(static_cast<float>(key));
+				track.positions.push_back(glm::vec3(joint.bindTransform[3]));
+				track.rotationTimes.push_back(static_cast<float>(key));
+				track.rotations.push_back(glm::angleAxis(angle, glm::vec3{ 1.f, 0.f, 0.f }));
+			}
+			track.scaleTimes.push_back(0.f);
+			track.scales.push_back(glm::vec3{ 1.f });
+		}
+		return animation;
+	}
+
+	AnimationClip BuildHumanoid() {
+		const assetpipeline::RawAnimation animation = MakeHumanoid();
+		AnimationClip clip;
+		clip.Build(animation.duration, animation.ticksPerSecond, animation.joints, animation.tracks);
+		return clip;
+	}
+
+	int Find(const AnimationClip& clip, const std::string& name) {
+		const auto& names = clip.GetJointNames();
+		return static_cast<int>(std::find(names.begin(), names.end(), name) - names.begin());
+	}
+
+	//at the origin looking down -z, 60 degrees of vertical field of view
+	LodCamera MakeCamera() {
+		const glm::vec3 position{ 0.f };
+		const glm::mat4 view = glm::lookAt(position, glm::vec3{ 0.f, 0.f, -1.f }, glm::vec3{ 0.f, 1.f, 0.f });
+		const glm::mat4 projection = glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 500.f);
+		return MakeLodCamera(position, view, projection, 60.f);
+	}
+
+	//levels of the default table: full, half rate, quarter rate, eighth rate
+	constexpr float FULL = 0.5f, HALF = 0.15f, QUARTER = 0.05f, EIGHTH = 0.01f;
+}
+
+TEST(AnimationLodTest, JointImportanceFollowsTheBindPose) {
+	const AnimationClip clip = BuildHumanoid();
+	const auto& joints = clip.GetJoints();
+
+	for (const char* name : { "Hips", "Spine", "Chest", "UpperArm", "ForeArm", "Thigh", "Shin" }) {
+		EXPECT_EQ(joints[Find(clip, name)].importance, JOINT_ESSENTIAL) << name;
+	}
+	for (const char* name : { "Head", "Hand", "Foot" }) {
+		EXPECT_EQ(joints[Find(clip, name)].importance, JOINT_DETAIL) << name;
+	}
+	for (const char* name : { "Finger1", "Finger2", "FingerTip" }) {
+		EXPECT_EQ(joints[Find(clip, name)].importance, JOINT_FINE) << name;
+	}
+
+	//a joint is never kept while its parent is dropped
+	for (const Joint& joint : joints) {
+		if (joint.parent >= 0) EXPECT_GE(joint.importance, joints[joint.parent].importance);
+	}
+
+	EXPECT_EQ(clip.GetSampledJointCount(), joints.size());
+	EXPECT_LT(clip.GetSampledJointCount(JOINT_DETAIL), clip.GetSampledJointCount(ALL_JOINTS));
+	EXPECT_LT(clip.GetSampledJointCount(JOINT_ESSENTIAL), clip.GetSampledJointCount(JOINT_DETAIL));
+}
+
+TEST(AnimationLodTest, CompiledClipsCarryTheImportanceMask) {
+	const assetpipeline::RawAnimation animation = MakeHumanoid();
+	std::string binary, error;
+	assetpipeline::AnimationCompressionStats stats;
+	assetpipeline::CompressAnimation(animation, {}, binary, stats);
+
+	AnimationClip compiled;
+	ASSERT_TRUE(compiled.Load(binary, error)) << error;
+
+	const AnimationClip built = BuildHumanoid();
+	ASSERT_EQ(compiled.GetJoints().size(), built.GetJoints().size());
+	for (size_t i = 0; i < built.GetJoints().size(); ++i) {
+		EXPECT_EQ(compiled.GetJoints()[i].importance, built.GetJoints()[i].importance) << built.GetJointNames()[i];
+	}
+	EXPECT_EQ(compiled.GetSampledJointCount(JOINT_ESSENTIAL), built.GetSampledJointCount(JOINT_ESSENTIAL));
+}
+
+TEST(AnimationLodTest, SamplingHoldsJointsAboveTheLimit) {
+	const AnimationClip clip = BuildHumanoid();
+	std::unordered_map<std::string, int> boneMap;
+	for (size_t i = 0; i < clip.GetJointNames().size(); ++i) boneMap[clip.GetJointNames()[i]] = static_cast<int>(i);
+	const std::vector<glm::mat4> offsets(clip.GetJoints().size(), glm::mat4(1.f));
+
+	AnimationInstance full, reduced;
+	full.Bind(clip, &clip, boneMap, offsets);
+	reduced.Bind(clip, &clip, boneMap, offsets);
+	full.Advance(clip, 0.3f, LoopMode::Loop);
+	reduced.Advance(clip, 0.3f, LoopMode::Loop);
+	full.Sample(clip);
+	reduced.Sample(clip, glm::mat4(1.f), JOINT_ESSENTIAL);
+
+	const auto& joints = clip.GetJoints();
+	const auto& fullGlobals = full.GetGlobalTransforms();
+	const auto& reducedGlobals = reduced.GetGlobalTransforms();
+	for (size_t i = 0; i < joints.size(); ++i) {
+		const int parent = joints[i].parent;
+		if (joints[i].importance == JOINT_ESSENTIAL) {
+			EXPECT_EQ(reducedGlobals[i], fullGlobals[i]) << clip.GetJointNames()[i];
+		}
+		else {
+			//held in bind pose under its parent
+			const glm::mat4 local = glm::inverse(reducedGlobals[parent]) * reducedGlobals[i];
+			const glm::mat4 bind = joints[i].bindTransform;
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 4; ++r) EXPECT_NEAR(local[c][r], bind[c][r], 1e-5f) << clip.GetJointNames()[i];
+			}
+		}
+	}
+}
+
+TEST(AnimationLodTest, ScreenSizeAndVisibility) {
+	const LodCamera camera = MakeCamera();
+
+	//a unit sphere ten units away covers 1 / (10 tan 30) of the screen height
+	EXPECT_NEAR(ScreenSize(camera, glm::vec3{ 0.f, 0.f, -10.f }, 1.f), 1.f / (10.f * std::tan(glm::radians(30.f))), 1e-5f);
+	EXPECT_NEAR(ScreenSize(camera, glm::vec3{ 0.f, 0.f, -20.f }, 1.f), 0.5f * ScreenSize(camera, glm::vec3{ 0.f, 0.f, -10.f }, 1.f), 1e-5f);
+	EXPECT_FLOAT_EQ(ScreenSize(camera, glm::vec3{ 0.f, 0.f, -0.5f }, 1.f), 1.f);
+
+	EXPECT_TRUE(IsVisible(camera, glm::vec3{ 0.f, 0.f, -10.f }, 1.f));
+	EXPECT_FALSE(IsVisible(camera, glm::vec3{ 0.f, 0.f, 10.f }, 1.f));
+	EXPECT_FALSE(IsVisible(camera, glm::vec3{ 0.f, 0.f, -600.f }, 1.f));
+	EXPECT_FALSE(IsVisible(camera, glm::vec3{ 0.f, 50.f, -10.f }, 1.f));
+	//the edge of the sphere pokes into the side of the view
+	const float edge = 10.f * std::tan(glm::radians(30.f));
+	EXPECT_TRUE(IsVisible(camera, glm::vec3{ 0.f, edge + 0.5f, -10.f }, 1.f));
+
+	//the largest size of every camera that sees it
+	LodCamera behind = camera;
+	behind.viewProjection = glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 500.f) *
+		glm::lookAt(glm::vec3{ 0.f }, glm::vec3{ 0.f, 0.f, 1.f }, glm::vec3{ 0.f, 1.f, 0.f });
+	const LodView view = MeasureView({ behind, camera }, glm::vec3{ 0.f, 0.f, -10.f }, 1.f);
+	EXPECT_TRUE(view.visible);
+	EXPECT_FLOAT_EQ(view.screenSize, ScreenSize(camera, glm::vec3{ 0.f, 0.f, -10.f }, 1.f));
+	EXPECT_FALSE(MeasureView({ behind }, glm::vec3{ 0.f, 0.f, -10.f }, 1.f).visible);
+}
+
+TEST(AnimationLodTest, LevelsArePickedBySize) {
+	LodScheduler scheduler;
+	EXPECT_EQ(scheduler.PickLevel(FULL), 0);
+	EXPECT_EQ(scheduler.PickLevel(HALF), 1);
+	EXPECT_EQ(scheduler.PickLevel(QUARTER), 2);
+	EXPECT_EQ(scheduler.PickLevel(EIGHTH), 3);
+	EXPECT_EQ(scheduler.PickLevel(0.f), 3);
+
+	scheduler.SetLevels({ { 0.f, 3, JOINT_ESSENTIAL }, { 0.2f, 0, ALL_JOINTS } });
+	ASSERT_EQ(scheduler.GetLevels().size(), 2u);
+	EXPECT_EQ(scheduler.GetLevels()[0].interval, 1);
+	EXPECT_EQ(scheduler.PickLevel(0.3f), 0);
+	EXPECT_EQ(scheduler.PickLevel(0.1f), 1);
+}
+
+TEST(AnimationLodTest, EvaluationsAreSpreadEvenlyOverFrames) {
+	constexpr size_t CHARACTERS = 1000;
+	LodScheduler scheduler;
+	std::vector<LodState> states(CHARACTERS);
+	std::vector<int> evaluations(CHARACTERS, 0);
+
+	//every character needs a pose on its first frame
+	scheduler.BeginFrame();
+	for (LodState& state : states) EXPECT_TRUE(scheduler.Schedule(state, { QUARTER, true }).evaluate);
+	EXPECT_EQ(scheduler.GetEvaluations(), CHARACTERS);
+
+	//then a quarter of them every frame, each one every fourth frame
+	for (int frame = 0; frame < 16; ++frame) {
+		scheduler.BeginFrame();
+		for (size_t i = 0; i < CHARACTERS; ++i) {
+			const LodDecision decision = scheduler.Schedule(states[i], { QUARTER, true });
+			if (decision.evaluate) {
+				++evaluations[i];
+				EXPECT_EQ(decision.maxImportance, JOINT_ESSENTIAL);
+			}
+		}
+		EXPECT_EQ(scheduler.GetEvaluations(), CHARACTERS / 4) << "frame " << frame;
+	}
+	for (const int count : evaluations) EXPECT_EQ(count, 4);
+
+	//characters walking up to the camera go to full rate at once
+	scheduler.BeginFrame();
+	for (LodState& state : states) EXPECT_TRUE(scheduler.Schedule(state, { FULL, true }).evaluate);
+}
+
+TEST(AnimationLodTest, OffscreenPosesFreezeUntilSeenAgain) {
+	LodScheduler scheduler;
+	LodState state;
+
+	//offscreen from the start still gets one pose to hold
+	scheduler.BeginFrame();
+	EXPECT_TRUE(scheduler.Schedule(state, { 0.f, false }).evaluate);
+
+	for (int frame = 0; frame < 20; ++frame) {
+		scheduler.BeginFrame();
+		const LodDecision decision = scheduler.Schedule(state, { FULL, false });
+		EXPECT_FALSE(decision.evaluate);
+		EXPECT_TRUE(decision.frozen);
+		EXPECT_EQ(scheduler.GetFrozen(), 1u);
+	}
+
+	//back on screen the stale pose is replaced at once, even at a low rate
+	scheduler.BeginFrame();
+	const LodDecision seen = scheduler.Schedule(state, { EIGHTH, true });
+	EXPECT_TRUE(seen.evaluate);
+	EXPECT_FALSE(seen.frozen);
+	EXPECT_FLOAT_EQ(seen.blend, 1.f);
+}
+
+TEST(AnimationLodTest, BudgetDefersEvaluationsWithoutStarving) {
+	constexpr size_t CHARACTERS = 100;
+	LodScheduler scheduler;
+	scheduler.SetBudget(30);
+	std::vector<LodState> states(CHARACTERS);
+
+	scheduler.BeginFrame();
+	for (LodState& state : states) scheduler.Schedule(state, { QUARTER, true });
+
+	//25 due a frame fit in the budget
+	for (int frame = 0; frame < 12; ++frame) {
+		scheduler.BeginFrame();
+		for (LodState& state : states) scheduler.Schedule(state, { QUARTER, true });
+		EXPECT_LE(scheduler.GetEvaluations(), 30u);
+	}
+
+	//100 due every frame do not, the ones that miss out catch up within another interval
+	std::vector<uint32_t> last(CHARACTERS, scheduler.GetFrame());
+	for (int frame = 0; frame < 12; ++frame) {
+		scheduler.BeginFrame();
+		for (size_t i = 0; i < CHARACTERS; ++i) {
+			if (scheduler.Schedule(states[i], { FULL, true }).evaluate) {
+				EXPECT_LE(scheduler.GetFrame() - last[i], 2u);
+				last[i] = scheduler.GetFrame();
+			}
+		}
+		EXPECT_LT(scheduler.GetEvaluations(), CHARACTERS);
+	}
+	for (const uint32_t frame : last) EXPECT_GE(frame + 2, scheduler.GetFrame());
+}
+
+TEST(AnimationLodTest, EvaluationsBlendInOverTheirInterval) {
+	LodScheduler scheduler;
+	LodState state;
+
+	scheduler.BeginFrame();
+	LodDecision decision = scheduler.Schedule(state, { QUARTER, true });
+	ASSERT_TRUE(decision.evaluate);
+	EXPECT_FLOAT_EQ(decision.blend, 1.f);
+
+	//wait for the next evaluation on the character's phase
+	do {
+		scheduler.BeginFrame();
+		decision = scheduler.Schedule(state, { QUARTER, true });
+		if (!decision.evaluate) EXPECT_FLOAT_EQ(decision.blend, 1.f);
+	} while (!decision.evaluate);
+
+	const float expected[] = { 0.25f, 0.5f, 0.75f, 1.f };
+	for (int frame = 0; frame < 4; ++frame) {
+		if (frame > 0) {
+			scheduler.BeginFrame();
+			decision = scheduler.Schedule(state, { QUARTER, true });
+			EXPECT_FALSE(decision.evaluate);
+		}
+		EXPECT_FLOAT_EQ(decision.blend, expected[frame]) << "frame " << frame;
+	}
+
+	const std::vector<glm::mat4> from{ Offset(0.f, 0.f, 0.f) }, to{ Offset(4.f, 0.f, 0.f) };
+	std::vector<glm::mat4> shown;
+	BlendPoses(from, to, 0.25f, shown);
+	EXPECT_FLOAT_EQ(shown[0][3].x, 1.f);
+	BlendPoses(from, to, 1.f, shown);
+	EXPECT_EQ(shown, to);
+	BlendPoses({}, to, 0.5f, shown);
+	EXPECT_EQ(shown, to);
+}
+
+TEST(AnimationLodBenchmark, ThousandCharacterCrowd) {
+	constexpr int CHARACTERS = 1000;
+	constexpr int FRAMES = 64;
+	constexpr float RADIUS = 1.f;
+
+	const AnimationClip clip = BuildHumanoid();
+	std::unordered_map<std::string, int> boneMap;
+	for (size_t i = 0; i < clip.GetJointNames().size(); ++i) boneMap[clip.GetJointNames()[i]] = static_cast<int>(i);
+	const std::vector<glm::mat4> offsets(clip.GetJoints().size(), glm::mat4(1.f));
+
+	//a crowd spread from 3 to 200 units in every direction around the camera, a quarter of it in view
+	std::vector<glm::vec3> positions;
+	std::vector<AnimationInstance> full(CHARACTERS), lod(CHARACTERS);
+	std::vector<LodState> states(CHARACTERS);
+	for (int i = 0; i < CHARACTERS; ++i) {
+		const float angle = glm::two_pi<float>() * std::fmod(i * 0.618034f, 1.f);
+		const float distance = 3.f + 197.f * static_cast<float>(i) / CHARACTERS;
+		positions.push_back(glm::vec3{ std::sin(angle) * distance, 0.f, -std::cos(angle) * distance });
+		full[i].Bind(clip, &clip, boneMap, offsets);
+		lod[i].Bind(clip, &clip, boneMap, offsets);
+	}
+	const std::vector<LodCamera> cameras{ MakeCamera() };
+
+	using Clock = std::chrono::steady_clock;
+	size_t fullJoints = 0;
+	const auto fullStart = Clock::now();
+	for (int frame = 0; frame < FRAMES; ++frame) {
+		for (AnimationInstance& instance : full) {
+			instance.Advance(clip, 1.f / 60.f, LoopMode::Loop);
+			instance.Sample(clip);
+			fullJoints += clip.GetSampledJointCount();
+		}
+	}
+	const double fullMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - fullStart).count() / FRAMES;
+
+	LodScheduler scheduler;
+	size_t lodJoints = 0, lodEvaluations = 0, frozen = 0, peakJoints = 0;
+	const auto lodStart = Clock::now();
+	for (int frame = 0; frame < FRAMES; ++frame) {
+		scheduler.BeginFrame();
+		for (int i = 0; i < CHARACTERS; ++i) {
+			lod[i].Advance(clip, 1.f / 60.f, LoopMode::Loop);
+			const LodDecision decision = scheduler.Schedule(states[i], MeasureView(cameras, positions[i], RADIUS));
+			if (!decision.evaluate) continue;
+			lod[i].Sample(clip, glm::mat4(1.f), decision.maxImportance);
+			scheduler.AddJointEvaluations(clip.GetSampledJointCount(decision.maxImportance));
+		}
+		//the first frame poses everyone once
+		if (frame > 0) {
+			lodJoints += scheduler.GetJointEvaluations();
+			lodEvaluations += scheduler.GetEvaluations();
+			frozen += scheduler.GetFrozen();
+			peakJoints = std::max(peakJoints, scheduler.GetJointEvaluations());
+		}
+	}
+	const double lodMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - lodStart).count() / FRAMES;
+
+	const double fullPerFrame = static_cast<double>(fullJoints) / FRAMES;
+	const double lodPerFrame = static_cast<double>(lodJoints) / (FRAMES - 1);
+	EXPECT_LT(lodPerFrame * 5.0, fullPerFrame);
+	EXPECT_LT(peakJoints, 2 * static_cast<size_t>(lodPerFrame) + clip.GetSampledJointCount());
+
+	std::cout << "[          ] " << CHARACTERS << " characters, joint evaluations per frame: full rate " << fullPerFrame
+		<< " (" << fullMilliseconds << " ms), LOD " << lodPerFrame << " peak " << peakJoints << " (" << lodMilliseconds << " ms), "
+		<< static_cast<double>(lodEvaluations) / (FRAMES - 1) << " poses and " << static_cast<double>(frozen) / (FRAMES - 1)
+		<< " frozen per frame\n";
+}
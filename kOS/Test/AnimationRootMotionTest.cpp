@@ -0,0 +1,220 @@
+/******************************************************************/
+/*!
+\file      AnimationRootMotionTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for root motion: accumulated displacement
+		   against the clip's own displacement under variable frame
+		   times, locked axes, yaw and the pose the root motion is
+		   taken out of, and the transform only moving while the
+		   game runs.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/AnimationInstance.h"
+#include "ECS/Component/AnimatorComponent.h"
+
+#include <random>
+
+using namespace animation;
+
+namespace {
+
+	constexpr int KEYS = 31;  //one second at 30 ticks per second
+
+	/*
+	  Armature turned 90 degrees about x as exporters do, so the hips walking
+	  along their parent's +y walk along +z in model space, 1.5 units a second,
+	  swaying in x and bobbing in y.
+	*/
+	AnimationClip MakeWalk() {
+		std::vector<JointDesc> joints = {
+			{ "Armature", -1, glm::rotate(glm::mat4(1.f), glm::half_pi<float>(), glm::vec3{ 1.f, 0.f, 0.f }) },
+			{ "Hips", 0, glm::mat4(1.f) },
+			{ "Spine", 1, glm::translate(glm::mat4(1.f), glm::vec3{ 0.f, 0.f, -0.3f }) },
+		};
+
+		BoneTrack hips;
+		for (int key = 0; key < KEYS; ++key) {
+			const float seconds = static_cast<float>(key) / 30.f;
+			const float phase = glm::two_pi<float>() * seconds;
+			hips.positionTimes.push_back(static_cast<float>(key));
+			hips.positions.push_back(glm::vec3{ 0.05f * std::sin(phase), 1.5f * seconds, -(0.9f + 0.03f * std::sin(2.f * phase)) });
+			hips.rotationTimes.push_back(static_cast<float>(key));
+			hips.rotations.push_back(glm::quat{ 1.f, 0.f, 0.f, 0.f });
+		}
+		hips.scaleTimes.push_back(0.f);
+		hips.scales.push_back(glm::vec3{ 1.f });
+
+		AnimationClip clip;
+		clip.Build(static_cast<float>(KEYS - 1), 30.f, joints, { { "Hips", hips } });
+		return clip;
+	}
+
+	//a quarter turn to the left over one second on the spot
+	AnimationClip MakeTurn() {
+		BoneTrack root;
+		for (int key = 0; key < KEYS; ++key) {
+			root.positionTimes.push_back(static_cast<float>(key));
+			root.positions.push_back(glm::vec3{ 0.f, 1.f, 0.f });
+			root.rotationTimes.push_back(static_cast<float>(key));
+			root.rotations.push_back(glm::angleAxis(glm::half_pi<float>() * static_cast<float>(key) / (KEYS - 1), glm::vec3{ 0.f, 1.f, 0.f }));
+		}
+
+		AnimationClip clip;
+		clip.Build(static_cast<float>(KEYS - 1), 30.f, { JointDesc{ "Root", -1, glm::mat4(1.f) } }, { { "Root", root } });
+		return clip;
+	}
+
+	glm::vec3 RootAt(const AnimationClip& clip, float time) {
+		std::vector<KeyCursor> cursors = clip.CreateCursors();
+		return clip.RootPosition(clip.SampleJoint(static_cast<size_t>(clip.GetRootJoint()), time, cursors));
+	}
+
+	//plays "seconds" in steps of "steps" seconds and sums the root motion
+	RootMotion Play(const AnimationClip& clip, const RootMotionSettings& settings, const std::vector<float>& steps) {
+		AnimationInstance instance;
+		instance.SetRootMotion(settings);
+
+		RootMotion total;
+		for (const float step : steps) {
+			instance.Advance(clip, step, LoopMode::Loop);
+			total.translation += glm::angleAxis(total.yaw, glm::vec3{ 0.f, 1.f, 0.f }) * instance.GetRootMotion().translation;
+			total.yaw += instance.GetRootMotion().yaw;
+		}
+		return total;
+	}
+}
+
+TEST(AnimationRootMotionTest, RootJointIsTheFirstAnimatedJoint) {
+	const AnimationClip clip = MakeWalk();
+	EXPECT_EQ(clip.GetRootJoint(), 1);
+
+	//parent in bind pose carries the hips into model space
+	const glm::vec3 start = RootAt(clip, 0.f);
+	EXPECT_NEAR(start.y, 0.9f, 1e-5f);
+	EXPECT_NEAR(start.z, 0.f, 1e-5f);
+	EXPECT_NEAR(RootAt(clip, clip.GetDuration()).z, 1.5f, 1e-5f);
+}
+
+TEST(AnimationRootMotionTest, AccumulatesTheClipDisplacementUnderVariableFrameTimes) {
+	const AnimationClip clip = MakeWalk();
+	RootMotionSettings settings;
+	settings.enabled = true;
+
+	//3.7 seconds: three whole cycles and 0.7 of the next
+	std::mt19937 random{ 5 };
+	std::uniform_real_distribution<float> frame{ 0.001f, 0.05f };
+	std::vector<float> variable;
+	float played = 0.f;
+	while (played < 3.7f) {
+		variable.push_back(std::min(frame(random), 3.7f - played));
+		played += variable.back();
+	}
+	const std::vector<float> fixed(37, 0.1f);
+
+	const glm::vec3 cycle = RootAt(clip, clip.GetDuration()) - RootAt(clip, 0.f);
+	glm::vec3 expected = 3.f * cycle + (RootAt(clip, 21.f) - RootAt(clip, 0.f));
+	expected.y = 0.f;
+
+	const RootMotion fixedMotion = Play(clip, settings, fixed);
+	const RootMotion variableMotion = Play(clip, settings, variable);
+	EXPECT_LT(glm::length(fixedMotion.translation - expected), 1e-4f);
+	EXPECT_LT(glm::length(variableMotion.translation - expected), 1e-4f);
+	EXPECT_NEAR(variableMotion.translation.z, 3.7f * 1.5f, 1e-3f);
+	EXPECT_FLOAT_EQ(variableMotion.yaw, 0.f);
+
+	//steps longer than the clip cover every cycle they pass
+	const RootMotion longSteps = Play(clip, settings, { 1.7f, 2.f });
+	EXPECT_LT(glm::length(longSteps.translation - expected), 1e-4f);
+
+	//backwards undoes it
+	const RootMotion back = Play(clip, settings, { 0.5f, -0.5f });
+	EXPECT_LT(glm::length(back.translation), 1e-5f);
+}
+
+TEST(AnimationRootMotionTest, LockedAxesDoNotMove) {
+	const AnimationClip clip = MakeWalk();
+	RootMotionSettings settings;
+	settings.enabled = true;
+	settings.lockY = false;
+	settings.lockX = true;
+
+	const std::vector<float> steps(7, 0.1f);
+	const RootMotion motion = Play(clip, settings, steps);
+	EXPECT_FLOAT_EQ(motion.translation.x, 0.f);
+	EXPECT_NEAR(motion.translation.y, RootAt(clip, 21.f).y - RootAt(clip, 0.f).y, 1e-5f);
+	EXPECT_NEAR(motion.translation.z, 0.7f * 1.5f, 1e-4f);
+
+	settings.enabled = false;
+	EXPECT_EQ(Play(clip, settings, steps).translation, glm::vec3{ 0.f });
+}
+
+TEST(AnimationRootMotionTest, PoseStaysInPlaceOnExtractedAxes) {
+	const AnimationClip clip = MakeWalk();
+	AnimationInstance instance;
+	RootMotionSettings settings;
+	settings.enabled = true;
+	instance.SetRootMotion(settings);
+	instance.Bind(clip, &clip, { { "Armature", 0 }, { "Hips", 1 }, { "Spine", 2 } }, std::vector<glm::mat4>(3, glm::mat4(1.f)));
+
+	for (int frame = 0; frame < 20; ++frame) {
+		instance.Advance(clip, 1.f / 30.f, LoopMode::Loop);
+		instance.Sample(clip);
+
+		//x and z are carried by the character, y still bobs in the pose
+		const glm::vec3 hips{ instance.GetGlobalTransforms()[1][3] };
+		const glm::vec3 expected = RootAt(clip, instance.GetTime());
+		EXPECT_NEAR(hips.x, 0.f, 1e-5f);
+		EXPECT_NEAR(hips.z, 0.f, 1e-5f);
+		EXPECT_NEAR(hips.y, expected.y, 1e-5f);
+	}
+}
+
+TEST(AnimationRootMotionTest, YawTurnsTheCharacter) {
+	const AnimationClip clip = MakeTurn();
+	RootMotionSettings settings;
+	settings.enabled = true;
+
+	const RootMotion motion = Play(clip, settings, std::vector<float>(15, 0.1f));
+	EXPECT_NEAR(motion.yaw, 1.5f * glm::half_pi<float>(), 1e-4f);
+	EXPECT_LT(glm::length(motion.translation), 1e-5f);
+
+	//the turn leaves the pose
+	AnimationInstance instance;
+	instance.SetRootMotion(settings);
+	instance.Bind(clip, &clip, { { "Root", 0 } }, { glm::mat4(1.f) });
+	instance.Advance(clip, 0.5f, LoopMode::Loop);
+	instance.Sample(clip);
+	const glm::vec3 forward = glm::mat3(instance.GetGlobalTransforms()[0]) * glm::vec3{ 0.f, 0.f, 1.f };
+	EXPECT_NEAR(forward.x, 0.f, 1e-5f);
+	EXPECT_NEAR(forward.z, 1.f, 1e-5f);
+
+	settings.lockYaw = true;
+	EXPECT_FLOAT_EQ(Play(clip, settings, std::vector<float>(5, 0.1f)).yaw, 0.f);
+}
+
+TEST(AnimationRootMotionTest, TransformStaysPutWhileStopped) {
+	const AnimationClip clip = MakeWalk();
+	RootMotionSettings settings;
+	settings.enabled = true;
+	const RootMotion motion = Play(clip, settings, std::vector<float>(10, 0.1f));
+	ASSERT_GT(glm::length(motion.translation), 1.f);
+
+	//editor frames leave the transform where it was saved
+	ecs::Transformation transformation;
+	transformation.position = glm::vec3{ 2.f, 0.f, 3.f };
+	for (int frame = 0; frame < 100; ++frame) {
+		EXPECT_FALSE(ecs::MoveByRootMotion(ecs::STOP, transformation, motion));
+	}
+	EXPECT_EQ(transformation.position, (glm::vec3{ 2.f, 0.f, 3.f }));
+	EXPECT_FLOAT_EQ(transformation.rotation.y, 0.f);
+
+	EXPECT_TRUE(ecs::MoveByRootMotion(ecs::RUNNING, transformation, motion));
+	EXPECT_GT(glm::length(transformation.position - glm::vec3{ 2.f, 0.f, 3.f }), 1.f);
+}
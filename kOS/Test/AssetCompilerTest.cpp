@@ -0,0 +1,150 @@
+/******************************************************************/
+/*!
+\file      AssetCompilerTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the in process asset compiler entry points.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "AssetPipeline/AssetCompiler.h"
+
+using namespace assetpipeline;
+
+namespace {
+
+	using EntryPoint = bool(*)(const CompileRequest&, std::vector<Diagnostic>&);
+
+	void WriteFile(const std::filesystem::path& path, const std::string& content) {
+		std::filesystem::create_directories(path.parent_path());
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file << content;
+	}
+
+	std::string ReadFile(const std::filesystem::path& path) {
+		std::ifstream file(path, std::ios::binary);
+		return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	}
+
+	EntryPoint Target(const CompileFunction& function) {
+		const EntryPoint* target = function.target<EntryPoint>();
+		return target ? *target : nullptr;
+	}
+
+	class AssetCompilerTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			m_root = std::filesystem::temp_directory_path() / ("kos_assetcompiler_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+			std::filesystem::remove_all(m_root);
+		}
+
+		void TearDown() override {
+			std::filesystem::remove_all(m_root);
+		}
+
+		CompileRequest Request(const std::string& type, const std::filesystem::path& source, const std::string& extension) const {
+			return CompileRequest{ source, source.string() + ".meta", m_root / "Resource" / ("guid" + extension), { type, "null", extension, "1" } };
+		}
+
+		std::filesystem::path m_root;
+	};
+}
+
+
+TEST_F(AssetCompilerTest, EveryConfiguredTypeRunsInProcess) {
+	EXPECT_EQ(Target(GetCompileFunction({ "R_Texture", "TextureWrapper.exe", ".dds", "2" })), &CompileTextureAsset);
+	EXPECT_EQ(Target(GetCompileFunction({ "R_Model", "MeshCompiler.exe", ".mesh", "1" })), &CompileMeshAsset);
+	EXPECT_EQ(Target(GetCompileFunction({ "R_Font", "FontCompiler.exe", ".fntc", "1" })), &CompileFontAsset);
+	EXPECT_EQ(Target(GetCompileFunction({ "R_Material", "null", ".mat", "1" })), &CompileMaterialAsset);
+	EXPECT_EQ(Target(GetCompileFunction({ "R_Prefab", "null", ".prefab", "1" })), &CompilePrefabAsset);
+	EXPECT_EQ(Target(GetCompileFunction({ "R_Audio", "null", ".wav", "1" })), &CopyAsset);
+}
+
+TEST_F(AssetCompilerTest, UnknownCompilerIsNotLaunched) {
+	const std::filesystem::path source = m_root / "Assets" / "thing.xyz";
+	WriteFile(source, "data");
+
+	CompileRequest request = Request("R_Unknown", source, ".xyz");
+	request.compiler.compilerFilePath = "SomeTool.exe";
+
+	std::vector<Diagnostic> diagnostics;
+	EXPECT_FALSE(GetCompileFunction(request.compiler)(request, diagnostics));
+	ASSERT_FALSE(diagnostics.empty());
+	EXPECT_EQ(diagnostics[0].severity, Severity::Error);
+	EXPECT_FALSE(std::filesystem::exists(request.output));
+}
+
+TEST_F(AssetCompilerTest, MaterialIsCheckedThenCopied) {
+	const std::filesystem::path source = m_root / "Assets" / "wood.mat";
+	const std::string material = "[{\"MaterialData\":{\"diffuseMaterialGUID\":\"4d8deac8\"}}]";
+	WriteFile(source, material);
+
+	const CompileRequest request = Request("R_Material", source, ".mat");
+	std::vector<Diagnostic> diagnostics;
+	ASSERT_TRUE(CompileMaterialAsset(request, diagnostics));
+	EXPECT_EQ(ReadFile(request.output), material);
+
+	//a broken save fails the build instead of the game
+	for (const std::string bad : { "[{\"MaterialData\":{\"diffuse", "[{\"Other\":{}}]", "{\"MaterialData\":{}}" }) {
+		WriteFile(source, bad);
+		std::filesystem::remove(request.output);
+		diagnostics.clear();
+		EXPECT_FALSE(CompileMaterialAsset(request, diagnostics)) << bad;
+		EXPECT_FALSE(diagnostics.empty());
+		EXPECT_FALSE(std::filesystem::exists(request.output));
+	}
+}
+
+TEST_F(AssetCompilerTest, PrefabIsCheckedThenCopied) {
+	const std::filesystem::path source = m_root / "Assets" / "crate.prefab";
+	const std::string prefab = "[{\"SceneData\":{}},{\"NameComponent\":{\"entityName\":\"crate\"}}]";
+	WriteFile(source, prefab);
+
+	const CompileRequest request = Request("R_Prefab", source, ".prefab");
+	std::vector<Diagnostic> diagnostics;
+	ASSERT_TRUE(CompilePrefabAsset(request, diagnostics));
+	EXPECT_EQ(ReadFile(request.output), prefab);
+
+	WriteFile(source, "[{\"SceneData\":{}},42]");
+	std::filesystem::remove(request.output);
+	diagnostics.clear();
+	EXPECT_FALSE(CompilePrefabAsset(request, diagnostics));
+	EXPECT_FALSE(std::filesystem::exists(request.output));
+}
+
+TEST_F(AssetCompilerTest, FontCompilesInProcess) {
+#ifndef KOS_SAMPLE_FONT_DIR
+	GTEST_SKIP() << "no sample fonts";
+#else
+	const std::filesystem::path source = std::filesystem::path(KOS_SAMPLE_FONT_DIR) / "fnt_silkscreenRegular.ttf";
+	const CompileRequest request = Request("R_Font", source, ".fntc");
+
+	std::vector<Diagnostic> diagnostics;
+	ASSERT_TRUE(CompileFontAsset(request, diagnostics)) << (diagnostics.empty() ? "" : diagnostics[0].message);
+
+	//header R_Font reads: magic, version, atlas size, then the PNG atlas
+	const std::string data = ReadFile(request.output);
+	ASSERT_GT(data.size(), 28u);
+	EXPECT_EQ(data.substr(0, 4), "FNTC");
+	uint32_t pngSize = 0;
+	std::memcpy(&pngSize, data.data() + 16, sizeof(pngSize));
+	ASSERT_GT(data.size(), 20u + pngSize + 4u);
+	EXPECT_EQ(data.substr(21, 3), "PNG");
+
+	uint32_t characters = 0;
+	std::memcpy(&characters, data.data() + 20 + pngSize, sizeof(characters));
+	EXPECT_EQ(characters, 95u); //printable ASCII
+
+	//not a font
+	const std::filesystem::path text = m_root / "Assets" / "notes.txt";
+	WriteFile(text, "hello");
+	diagnostics.clear();
+	EXPECT_FALSE(CompileFontAsset(Request("R_Font", text, ".fntc"), diagnostics));
+	EXPECT_FALSE(diagnostics.empty());
+#endif
+}
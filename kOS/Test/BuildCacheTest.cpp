@@ -0,0 +1,235 @@
+/******************************************************************/
+/*!
+\file      BuildCacheTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the asset build cache invalidation rules, and a
+		   cold versus warm rebuild benchmark.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "AssetPipeline/BuildCache.h"
+
+using namespace assetpipeline;
+
+namespace {
+
+	void WriteFile(const std::filesystem::path& path, const std::string& content) {
+		std::filesystem::create_directories(path.parent_path());
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file << content;
+	}
+
+	std::string ReadFile(const std::filesystem::path& path) {
+		std::ifstream file(path, std::ios::binary);
+		return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	}
+
+	//stand in for an external compiler
+	void FakeCompile(const std::filesystem::path& source, const std::filesystem::path& output) {
+		WriteFile(output, "compiled:" + ReadFile(source));
+	}
+
+	class BuildCacheTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			m_root = std::filesystem::temp_directory_path() / ("kos_buildcache_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+			std::filesystem::remove_all(m_root);
+
+			m_source = m_root / "Assets" / "texture.png";
+			m_meta = m_root / "Assets" / "texture.png.meta";
+			m_output = m_root / "Resource" / "guid.dds";
+			WriteFile(m_source, "pixels");
+			WriteFile(m_meta, "[{\"AssetData\":{\"GUID\":\"guid\"}}]");
+
+			m_cache.Init(m_root / "Cache");
+		}
+
+		void TearDown() override {
+			std::filesystem::remove_all(m_root);
+		}
+
+		BuildInput Input() const {
+			return BuildInput{ m_source, m_meta, { "R_Texture", "null", ".dds", "1" }, {} };
+		}
+
+		//compile through the cache, returns true if the compiler ran
+		bool Build(const BuildInput& input) {
+			std::string key = m_cache.ComputeKey(input);
+			if (m_cache.Fetch(key, m_output) != CacheResult::MISS) return false;
+			FakeCompile(input.source, m_output);
+			m_cache.Store(key, m_output);
+			return true;
+		}
+
+		std::filesystem::path m_root, m_source, m_meta, m_output;
+		BuildCache m_cache;
+	};
+}
+
+
+TEST(BuildCacheHash, StableAndContentSensitive) {
+	EXPECT_EQ(HashString("abc"), HashString("abc"));
+	EXPECT_NE(HashString("abc"), HashString("abd"));
+	EXPECT_NE(HashString("ab", HashString("c")), HashString("a", HashString("bc")));
+	EXPECT_EQ(ToHex(0x0123456789abcdefull), "0123456789abcdef");
+}
+
+TEST_F(BuildCacheTest, FindGUIDReferences) {
+	std::filesystem::path material = m_root / "Assets" / "test.mat";
+	WriteFile(material, "[{\"MaterialData\":{\"diffuseMaterialGUID\":\"4d8deac8-5e30-9e34-6f12-37721db6eb53\","
+		"\"normalMaterialGUID\":\"dc87b22b-a90f-e566-c503-d27ea05bc74a\",\"specularMaterialGUID\":\"4d8deac8-5e30-9e34-6f12-37721db6eb53\"}}]");
+
+	std::vector<std::string> guids = FindGUIDReferences(material);
+	ASSERT_EQ(guids.size(), 2u);
+	EXPECT_EQ(guids[0], "4d8deac8-5e30-9e34-6f12-37721db6eb53");
+	EXPECT_EQ(guids[1], "dc87b22b-a90f-e566-c503-d27ea05bc74a");
+}
+
+TEST_F(BuildCacheTest, UnchangedInputsSkipCompile) {
+	EXPECT_TRUE(Build(Input()));
+	EXPECT_FALSE(Build(Input()));
+	EXPECT_EQ(m_cache.GetMissCount(), 1u);
+	EXPECT_EQ(m_cache.GetHitCount(), 1u);
+}
+
+TEST_F(BuildCacheTest, SourceChangeInvalidates) {
+	EXPECT_TRUE(Build(Input()));
+	WriteFile(m_source, "pixelz");
+	EXPECT_TRUE(Build(Input()));
+	EXPECT_EQ(ReadFile(m_output), "compiled:pixelz");
+}
+
+TEST_F(BuildCacheTest, MetaChangeInvalidates) {
+	EXPECT_TRUE(Build(Input()));
+	WriteFile(m_meta, "[{\"AssetData\":{\"GUID\":\"guid\"}},{\"TextureCompilerData\":{\"MipLevels\":0}}]");
+	EXPECT_TRUE(Build(Input()));
+}
+
+TEST_F(BuildCacheTest, CompilerVersionInvalidates) {
+	EXPECT_TRUE(Build(Input()));
+
+	BuildInput input = Input();
+	input.compiler.version = "2";
+	EXPECT_TRUE(Build(input));
+
+	input.compiler.outputExtension = ".ktx";
+	EXPECT_NE(m_cache.ComputeKey(input), m_cache.ComputeKey(Input()));
+}
+
+TEST_F(BuildCacheTest, DependencyChangeInvalidates) {
+	std::filesystem::path texture = m_root / "Assets" / "albedo.png";
+	WriteFile(texture, "albedo");
+
+	BuildInput input = Input();
+	input.dependencies.push_back(texture);
+	EXPECT_TRUE(Build(input));
+	EXPECT_FALSE(Build(input));
+
+	WriteFile(texture, "albedo v2");
+	EXPECT_TRUE(Build(input));
+
+	std::filesystem::remove(texture);
+	EXPECT_TRUE(Build(input));
+}
+
+TEST_F(BuildCacheTest, RevertRestoresFromStore) {
+	EXPECT_TRUE(Build(Input()));
+	WriteFile(m_source, "edited");
+	EXPECT_TRUE(Build(Input()));
+
+	//going back to content the cache has seen restores without compiling
+	WriteFile(m_source, "pixels");
+	std::string key = m_cache.ComputeKey(Input());
+	EXPECT_EQ(m_cache.Fetch(key, m_output), CacheResult::RESTORED);
+	EXPECT_EQ(ReadFile(m_output), "compiled:pixels");
+}
+
+TEST_F(BuildCacheTest, DeletedOutputIsRestored) {
+	EXPECT_TRUE(Build(Input()));
+	std::filesystem::remove(m_output);
+
+	std::string key = m_cache.ComputeKey(Input());
+	EXPECT_EQ(m_cache.Fetch(key, m_output), CacheResult::RESTORED);
+	EXPECT_TRUE(std::filesystem::exists(m_output));
+}
+
+TEST_F(BuildCacheTest, InvalidateRewritesOutput) {
+	EXPECT_TRUE(Build(Input()));
+	m_cache.Invalidate(m_output);
+
+	//a restore from the store is still allowed, it is the same key
+	std::string key = m_cache.ComputeKey(Input());
+	EXPECT_EQ(m_cache.Fetch(key, m_output), CacheResult::RESTORED);
+}
+
+TEST_F(BuildCacheTest, MissingSourceIsMiss) {
+	std::filesystem::remove(m_source);
+	std::string key = m_cache.ComputeKey(Input());
+	EXPECT_TRUE(key.empty());
+	EXPECT_EQ(m_cache.Fetch(key, m_output), CacheResult::MISS);
+}
+
+TEST_F(BuildCacheTest, OutputWithoutRecordIsRebuilt) {
+	//left by an older compiler, its bytes are not what this key builds
+	WriteFile(m_output, "stale");
+	EXPECT_TRUE(Build(Input()));
+	EXPECT_EQ(ReadFile(m_output), "compiled:pixels");
+	EXPECT_FALSE(Build(Input()));
+
+	//the cache deleted under a built output
+	std::filesystem::remove_all(m_root / "Cache");
+	m_cache.Init(m_root / "Cache");
+	std::string key = m_cache.ComputeKey(Input());
+	EXPECT_EQ(m_cache.Fetch(key, m_output), CacheResult::MISS);
+}
+
+TEST_F(BuildCacheTest, ColdVersusWarmRebuild) {
+	constexpr int assetCount = 200;
+	const std::string payload(64 * 1024, 'x');
+
+	std::vector<BuildInput> inputs;
+	for (int i = 0; i < assetCount; ++i) {
+		BuildInput input = Input();
+		input.source = m_root / "Assets" / ("asset" + std::to_string(i) + ".png");
+		input.meta = input.source.string() + ".meta";
+		WriteFile(input.source, payload + std::to_string(i));
+		WriteFile(input.meta, std::to_string(i));
+		inputs.push_back(input);
+	}
+
+	auto rebuild = [&]() {
+		int compiled = 0;
+		for (int i = 0; i < assetCount; ++i) {
+			std::filesystem::path output = m_root / "Resource" / ("asset" + std::to_string(i) + ".dds");
+			std::string key = m_cache.ComputeKey(inputs[static_cast<size_t>(i)]);
+			if (m_cache.Fetch(key, output) == CacheResult::MISS) {
+				FakeCompile(inputs[static_cast<size_t>(i)].source, output);
+				m_cache.Store(key, output);
+				++compiled;
+			}
+		}
+		return compiled;
+		};
+
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_EQ(rebuild(), assetCount);
+	std::chrono::duration<double, std::milli> cold = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	EXPECT_EQ(rebuild(), 0);
+	std::chrono::duration<double, std::milli> warm = std::chrono::steady_clock::now() - start;
+
+	//wipe the resource folder, everything comes back from the store
+	std::filesystem::remove_all(m_root / "Resource");
+	start = std::chrono::steady_clock::now();
+	EXPECT_EQ(rebuild(), 0);
+	std::chrono::duration<double, std::milli> restored = std::chrono::steady_clock::now() - start;
+
+	std::cout << "Cold: " << cold.count() << "ms, Warm: " << warm.count() << "ms, Restore: " << restored.count() << "ms" << std::endl;
+}
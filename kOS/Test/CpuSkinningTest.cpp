@@ -0,0 +1,218 @@
+/******************************************************************/
+/*!
+\file      CpuSkinningTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for CPU skinning: linear blend against the
+		   skinning shader math, the SSE and threaded paths against the
+		   scalar one, and dual quaternion skinning on rigid and
+		   twisting joints.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Animation/CpuSkinning.h"
+
+#include <random>
+
+using namespace animation;
+
+namespace {
+
+	//same layout as the vertices of R_Model
+	struct Vertex {
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::vec2 TexCoords;
+		glm::vec3 Tangent;
+		glm::vec3 Bitangent;
+		int m_BoneIDs[4];
+		float m_Weights[4];
+	};
+
+	SkinningInput MakeInput(const std::vector<Vertex>& vertices) {
+		SkinningInput input;
+		input.vertices = reinterpret_cast<const std::byte*>(vertices.data());
+		input.stride = sizeof(Vertex);
+		input.count = vertices.size();
+		input.positionOffset = offsetof(Vertex, Position);
+		input.normalOffset = offsetof(Vertex, Normal);
+		input.boneIdOffset = offsetof(Vertex, m_BoneIDs);
+		input.weightOffset = offsetof(Vertex, m_Weights);
+		return input;
+	}
+
+	std::vector<glm::mat4> MakePalette(std::mt19937& random, int bones) {
+		std::uniform_real_distribution<float> value{ -1.f, 1.f };
+		std::vector<glm::mat4> palette;
+		for (int i = 0; i < bones; ++i) {
+			const glm::vec3 axis = glm::normalize(glm::vec3{ value(random), value(random), value(random) } + glm::vec3{ 0.f, 0.f, 2.f });
+			glm::mat4 bone = glm::translate(glm::mat4(1.f), glm::vec3{ value(random), value(random), value(random) });
+			bone = glm::rotate(bone, 3.f * value(random), axis);
+			palette.push_back(glm::scale(bone, glm::vec3{ 1.f + 0.2f * value(random) }));
+		}
+		return palette;
+	}
+
+	//normalized weights over up to four bones, as the model loader leaves them
+	std::vector<Vertex> MakeVertices(std::mt19937& random, size_t count, int bones) {
+		std::uniform_real_distribution<float> value{ -1.f, 1.f };
+		std::uniform_int_distribution<int> bone{ 0, bones - 1 };
+		std::uniform_int_distribution<int> influences{ 1, 4 };
+
+		std::vector<Vertex> vertices(count);
+		for (Vertex& vertex : vertices) {
+			vertex.Position = glm::vec3{ value(random), value(random), value(random) } * 2.f;
+			vertex.Normal = glm::normalize(glm::vec3{ value(random), value(random), value(random) } + glm::vec3{ 0.f, 0.01f, 0.f });
+
+			const int used = influences(random);
+			float total = 0.f;
+			for (int i = 0; i < 4; ++i) {
+				vertex.m_BoneIDs[i] = i < used ? bone(random) : -1;
+				vertex.m_Weights[i] = i < used ? 0.1f + std::abs(value(random)) : 0.f;
+				total += vertex.m_Weights[i];
+			}
+			for (float& weight : vertex.m_Weights) weight /= total;
+		}
+		return vertices;
+	}
+
+	void ExpectNear(const std::vector<glm::vec3>& expected, const std::vector<glm::vec3>& actual, float bound) {
+		ASSERT_EQ(expected.size(), actual.size());
+		for (size_t i = 0; i < expected.size(); ++i) {
+			ASSERT_LE(glm::length(expected[i] - actual[i]), bound) << "vertex " << i;
+		}
+	}
+}
+
+TEST(CpuSkinningTest, LinearBlendMatchesShader) {
+	std::mt19937 random{ 11 };
+	const std::vector<glm::mat4> palette = MakePalette(random, 40);
+	const std::vector<Vertex> vertices = MakeVertices(random, 5000, 40);
+
+	//GBuffPBRShader.vs, the unused slots have no weight
+	std::vector<glm::vec3> shaderPositions, shaderNormals;
+	for (const Vertex& vertex : vertices) {
+		glm::mat4 boneTransform{ 0.f };
+		for (int i = 0; i < 4; ++i) {
+			if (vertex.m_BoneIDs[i] >= 0) boneTransform += palette[vertex.m_BoneIDs[i]] * vertex.m_Weights[i];
+		}
+		shaderPositions.push_back(glm::vec3(boneTransform * glm::vec4(vertex.Position, 1.f)));
+		shaderNormals.push_back(glm::mat3(boneTransform) * vertex.Normal);
+	}
+
+	for (const bool simd : { false, true }) {
+		SkinningSettings settings;
+		settings.simd = simd;
+
+		std::vector<glm::vec3> positions, normals;
+		SkinVertices(MakeInput(vertices), palette, settings, positions, normals);
+		ExpectNear(shaderPositions, positions, 1e-5f);
+		ExpectNear(shaderNormals, normals, 1e-5f);
+	}
+}
+
+TEST(CpuSkinningTest, ThreadedRangesMatchSingleThread) {
+	std::mt19937 random{ 12 };
+	const std::vector<glm::mat4> palette = MakePalette(random, 16);
+	const std::vector<Vertex> vertices = MakeVertices(random, 10007, 16);
+
+	for (const SkinningMethod method : { SkinningMethod::LinearBlend, SkinningMethod::DualQuaternion }) {
+		SkinningSettings single;
+		single.method = method;
+		std::vector<glm::vec3> expectedPositions, expectedNormals;
+		SkinVertices(MakeInput(vertices), palette, single, expectedPositions, expectedNormals);
+
+		SkinningSettings threaded = single;
+		threaded.threadCount = 4;
+		threaded.minVerticesPerThread = 1;
+		std::vector<glm::vec3> positions, normals;
+		SkinVertices(MakeInput(vertices), palette, threaded, positions, normals);
+
+		//every vertex is skinned by exactly one range with the same code
+		EXPECT_EQ(positions, expectedPositions);
+		EXPECT_EQ(normals, expectedNormals);
+	}
+}
+
+TEST(CpuSkinningTest, DualQuaternionMatchesRigidBones) {
+	std::mt19937 random{ 13 };
+	std::uniform_real_distribution<float> value{ -1.f, 1.f };
+
+	//rigid palette: every method agrees when a vertex follows one bone
+	std::vector<glm::mat4> palette;
+	for (int i = 0; i < 8; ++i) {
+		const glm::mat4 translation = glm::translate(glm::mat4(1.f), glm::vec3{ value(random), value(random), value(random) } * 3.f);
+		palette.push_back(glm::rotate(translation, 3.f * value(random), glm::normalize(glm::vec3{ value(random), 1.f, value(random) })));
+	}
+
+	std::vector<Vertex> vertices = MakeVertices(random, 2000, 8);
+	for (Vertex& vertex : vertices) {
+		for (int i = 0; i < 4; ++i) {
+			vertex.m_BoneIDs[i] = i == 0 ? vertex.m_BoneIDs[0] : -1;
+			vertex.m_Weights[i] = i == 0 ? 1.f : 0.f;
+		}
+	}
+
+	SkinningSettings settings;
+	std::vector<glm::vec3> linearPositions, linearNormals;
+	SkinVertices(MakeInput(vertices), palette, settings, linearPositions, linearNormals);
+
+	settings.method = SkinningMethod::DualQuaternion;
+	for (const bool simd : { false, true }) {
+		settings.simd = simd;
+		std::vector<glm::vec3> positions, normals;
+		SkinVertices(MakeInput(vertices), palette, settings, positions, normals);
+		ExpectNear(linearPositions, positions, 1e-4f);
+		ExpectNear(linearNormals, normals, 1e-4f);
+	}
+}
+
+TEST(CpuSkinningTest, DualQuaternionKeepsVolumeOnTwist) {
+	//half way between no twist and a 170 degree twist around x
+	const std::vector<glm::mat4> palette = { glm::mat4(1.f), glm::rotate(glm::mat4(1.f), glm::radians(170.f), glm::vec3{ 1.f, 0.f, 0.f }) };
+	std::vector<Vertex> vertices(1);
+	vertices[0].Position = glm::vec3{ 0.5f, 1.f, 0.f };
+	vertices[0].Normal = glm::vec3{ 0.f, 1.f, 0.f };
+	vertices[0].m_BoneIDs[0] = 0; vertices[0].m_BoneIDs[1] = 1; vertices[0].m_BoneIDs[2] = -1; vertices[0].m_BoneIDs[3] = -1;
+	vertices[0].m_Weights[0] = 0.5f; vertices[0].m_Weights[1] = 0.5f; vertices[0].m_Weights[2] = 0.f; vertices[0].m_Weights[3] = 0.f;
+
+	SkinningSettings settings;
+	std::vector<glm::vec3> positions, normals;
+	SkinVertices(MakeInput(vertices), palette, settings, positions, normals);
+	const float linearRadius = glm::length(glm::vec2{ positions[0].y, positions[0].z });
+	EXPECT_LT(linearRadius, 0.1f);
+
+	settings.method = SkinningMethod::DualQuaternion;
+	SkinVertices(MakeInput(vertices), palette, settings, positions, normals);
+	EXPECT_NEAR(glm::length(glm::vec2{ positions[0].y, positions[0].z }), 1.f, 1e-5f);
+	EXPECT_NEAR(positions[0].x, 0.5f, 1e-5f);
+	EXPECT_NEAR(glm::length(normals[0]), 1.f, 1e-5f);
+}
+
+TEST(CpuSkinningTest, UnboundVerticesKeepRestPose) {
+	const std::vector<glm::mat4> palette = { glm::translate(glm::mat4(1.f), glm::vec3{ 5.f, 0.f, 0.f }) };
+	std::vector<Vertex> vertices(2);
+	for (Vertex& vertex : vertices) {
+		vertex.Position = glm::vec3{ 1.f, 2.f, 3.f };
+		vertex.Normal = glm::vec3{ 0.f, 0.f, 1.f };
+		for (int i = 0; i < 4; ++i) { vertex.m_BoneIDs[i] = -1; vertex.m_Weights[i] = 0.f; }
+	}
+	//id past the palette is skipped, the next influence still applies
+	vertices[1].m_BoneIDs[0] = 7; vertices[1].m_Weights[0] = 0.5f;
+	vertices[1].m_BoneIDs[1] = 0; vertices[1].m_Weights[1] = 1.f;
+
+	for (const SkinningMethod method : { SkinningMethod::LinearBlend, SkinningMethod::DualQuaternion }) {
+		SkinningSettings settings;
+		settings.method = method;
+		std::vector<glm::vec3> positions, normals;
+		SkinVertices(MakeInput(vertices), palette, settings, positions, normals);
+		EXPECT_EQ(positions[0], glm::vec3(1.f, 2.f, 3.f));
+		EXPECT_EQ(normals[0], glm::vec3(0.f, 0.f, 1.f));
+		EXPECT_NEAR(glm::length(positions[1] - glm::vec3{ 6.f, 2.f, 3.f }), 0.f, 1e-5f);
+	}
+}
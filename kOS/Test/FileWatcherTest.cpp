@@ -0,0 +1,217 @@
+/******************************************************************/
+/*!
+\file      FileWatcherTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the file watcher. Every case drives a temporary
+		   directory tree through both the event driven and the polling
+		   backend, and checks the reported event sequence.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "AssetPipeline/FileWatcher.h"
+
+#include <condition_variable>
+#include <mutex>
+
+using namespace assetpipeline;
+
+namespace {
+
+	constexpr std::chrono::milliseconds DEBOUNCE{ 50 };
+	constexpr std::chrono::milliseconds POLL_INTERVAL{ 25 };
+	constexpr std::chrono::milliseconds EVENT_TIMEOUT{ 3000 };
+
+	void WriteFile(const std::filesystem::path& path, const std::string& content) {
+		std::filesystem::create_directories(path.parent_path());
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file << content;
+	}
+
+	class FileWatcherTest : public ::testing::TestWithParam<FileWatcher::Backend> {
+	protected:
+		void SetUp() override {
+			std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+			std::replace(name.begin(), name.end(), '/', '_');
+			m_root = std::filesystem::temp_directory_path() / ("kos_watcher_" + name);
+			std::filesystem::remove_all(m_root);
+			std::filesystem::create_directories(m_root);
+		}
+
+		void TearDown() override {
+			m_watcher.reset();
+			std::filesystem::remove_all(m_root);
+		}
+
+		void StartWatcher(bool renameCallback = true) {
+			m_watcher = std::make_unique<FileWatcher>(m_root.string(), POLL_INTERVAL);
+			m_watcher->SetBackend(GetParam());
+			m_watcher->SetDebounce(DEBOUNCE);
+			m_watcher->SetIgnoreExtension(".meta");
+			m_watcher->SetCallback([this](ACTION action, const std::filesystem::path& path) {
+				static const char* names[] = { "ADDED", "MODIFIED", "REMOVED" };
+				Record(std::string(names[action]) + " " + Relative(path));
+				});
+			if (renameCallback) {
+				m_watcher->SetRenameCallback([this](const std::filesystem::path& from, const std::filesystem::path& to) {
+					Record("RENAMED " + Relative(from) + " -> " + Relative(to));
+					});
+			}
+			m_watcher->Start();
+
+			if (GetParam() == FileWatcher::Backend::Inotify) {
+				ASSERT_STREQ(m_watcher->GetBackendName(), "inotify");
+			}
+		}
+
+		//waits for "count" events, then a little longer to catch anything extra
+		std::vector<std::string> WaitForEvents(size_t count) {
+			std::unique_lock lock{ m_mutex };
+			m_condition.wait_for(lock, EVENT_TIMEOUT, [&] { return m_events.size() >= count; });
+			lock.unlock();
+
+			std::this_thread::sleep_for(DEBOUNCE * 6);
+
+			lock.lock();
+			std::vector<std::string> events = m_events;
+			m_events.clear();
+			return events;
+		}
+
+		std::string Relative(const std::filesystem::path& path) const {
+			return path.lexically_relative(m_root).generic_string();
+		}
+
+		void Record(const std::string& event) {
+			{
+				std::lock_guard lock{ m_mutex };
+				m_events.push_back(event);
+				m_lastEvent = std::chrono::steady_clock::now();
+			}
+			m_condition.notify_all();
+		}
+
+		std::filesystem::path m_root;
+		std::unique_ptr<FileWatcher> m_watcher;
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::vector<std::string> m_events;
+		std::chrono::steady_clock::time_point m_lastEvent;
+	};
+
+	std::string BackendName(const ::testing::TestParamInfo<FileWatcher::Backend>& info) {
+		return info.param == FileWatcher::Backend::Inotify ? "Inotify" : "Polling";
+	}
+}
+
+TEST_P(FileWatcherTest, ReportsAddModifyRemove) {
+	WriteFile(m_root / "existing.png", "old");
+	StartWatcher();
+
+	WriteFile(m_root / "Textures" / "new.png", "pixels");
+	EXPECT_EQ(WaitForEvents(1), std::vector<std::string>{ "ADDED Textures/new.png" });
+
+	WriteFile(m_root / "existing.png", "new content");
+	EXPECT_EQ(WaitForEvents(1), std::vector<std::string>{ "MODIFIED existing.png" });
+
+	std::filesystem::remove(m_root / "existing.png");
+	EXPECT_EQ(WaitForEvents(1), std::vector<std::string>{ "REMOVED existing.png" });
+}
+
+TEST_P(FileWatcherTest, CoalescesSaveBurst) {
+	WriteFile(m_root / "scene.json", "0");
+	StartWatcher();
+
+	for (int i = 1; i <= 20; ++i) {
+		WriteFile(m_root / "scene.json", std::string(static_cast<size_t>(i), 'x'));
+	}
+	EXPECT_EQ(WaitForEvents(1), std::vector<std::string>{ "MODIFIED scene.json" });
+}
+
+TEST_P(FileWatcherTest, IgnoresShortLivedTemporaryFile) {
+	StartWatcher();
+
+	WriteFile(m_root / "scene.json.tmp", "partial");
+	std::filesystem::remove(m_root / "scene.json.tmp");
+	EXPECT_TRUE(WaitForEvents(0).empty());
+}
+
+TEST_P(FileWatcherTest, AtomicSaveIsModified) {
+	WriteFile(m_root / "scene.json", "old");
+	StartWatcher();
+
+	WriteFile(m_root / "scene.json.tmp", "new scene");
+	std::filesystem::rename(m_root / "scene.json.tmp", m_root / "scene.json");
+	EXPECT_EQ(WaitForEvents(1), std::vector<std::string>{ "MODIFIED scene.json" });
+}
+
+TEST_P(FileWatcherTest, DetectsRename) {
+	WriteFile(m_root / "old.png", "pixels");
+	StartWatcher();
+
+	std::filesystem::rename(m_root / "old.png", m_root / "new.png");
+	EXPECT_EQ(WaitForEvents(1), std::vector<std::string>{ "RENAMED old.png -> new.png" });
+}
+
+TEST_P(FileWatcherTest, RenameWithoutCallbackIsRemovedThenAdded) {
+	WriteFile(m_root / "old.png", "pixels");
+	StartWatcher(false);
+
+	std::filesystem::rename(m_root / "old.png", m_root / "new.png");
+	EXPECT_EQ(WaitForEvents(2), (std::vector<std::string>{ "REMOVED old.png", "ADDED new.png" }));
+}
+
+TEST_P(FileWatcherTest, DetectsDirectoryMove) {
+	WriteFile(m_root / "Models" / "a.fbx", "a");
+	WriteFile(m_root / "Models" / "b.fbx", "bb");
+	StartWatcher();
+
+	std::filesystem::rename(m_root / "Models", m_root / "Meshes");
+	std::vector<std::string> events = WaitForEvents(2);
+	std::sort(events.begin(), events.end());
+	EXPECT_EQ(events, (std::vector<std::string>{ "RENAMED Models/a.fbx -> Meshes/a.fbx", "RENAMED Models/b.fbx -> Meshes/b.fbx" }));
+}
+
+TEST_P(FileWatcherTest, IgnoresExtension) {
+	StartWatcher();
+
+	WriteFile(m_root / "texture.png.meta", "{}");
+	EXPECT_TRUE(WaitForEvents(0).empty());
+}
+
+TEST_P(FileWatcherTest, PauseDefersEvents) {
+	StartWatcher();
+	m_watcher->Pause();
+
+	WriteFile(m_root / "audio.wav", "riff");
+	EXPECT_TRUE(WaitForEvents(0).empty());
+
+	m_watcher->Resume();
+	EXPECT_EQ(WaitForEvents(1), std::vector<std::string>{ "ADDED audio.wav" });
+}
+
+TEST_P(FileWatcherTest, Latency) {
+	StartWatcher();
+
+	const auto start = std::chrono::steady_clock::now();
+	WriteFile(m_root / "latency.png", "pixels");
+	ASSERT_EQ(WaitForEvents(1).size(), 1u);
+
+	const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(m_lastEvent - start);
+	std::cout << "[          ] " << BackendName({ GetParam(), 0 }) << " latency " << latency.count() << " ms\n";
+
+	//debounce plus one poll, far below the old one second walk
+	EXPECT_LT(latency.count(), 500);
+}
+
+#ifdef __linux__
+INSTANTIATE_TEST_SUITE_P(Backends, FileWatcherTest, ::testing::Values(FileWatcher::Backend::Inotify, FileWatcher::Backend::Polling), BackendName);
+#else
+INSTANTIATE_TEST_SUITE_P(Backends, FileWatcherTest, ::testing::Values(FileWatcher::Backend::Polling), BackendName);
+#endif
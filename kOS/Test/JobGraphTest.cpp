@@ -0,0 +1,164 @@
+/******************************************************************/
+/*!
+\file      JobGraphTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the asset job graph scheduling, failure
+		   propagation and the asset builder dependency ordering.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "AssetPipeline/AssetBuilder.h"
+#include "AssetPipeline/JobGraph.h"
+
+#include <mutex>
+
+using namespace assetpipeline;
+
+namespace {
+
+	void WriteFile(const std::filesystem::path& path, const std::string& content) {
+		std::filesystem::create_directories(path.parent_path());
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file << content;
+	}
+
+	void WriteAsset(const std::filesystem::path& path, const std::string& guid, const std::string& content) {
+		WriteFile(path, content);
+		WriteFile(path.string() + ".meta", "[{\"AssetData\":{\"GUID\":\"" + guid + "\"}}]");
+	}
+}
+
+TEST(JobGraphTest, RunsDependenciesFirst) {
+	JobGraph graph;
+	std::mutex mutex;
+	std::vector<std::string> order;
+
+	auto record = [&](const std::string& name) {
+		return [&, name](std::vector<Diagnostic>&) {
+			std::lock_guard lock{ mutex };
+			order.push_back(name);
+			return true;
+			};
+		};
+
+	JobID texture = graph.AddJob("texture", "R_Texture", record("texture"));
+	JobID material = graph.AddJob("material", "R_Material", record("material"));
+	JobID prefab = graph.AddJob("prefab", "R_Prefab", record("prefab"));
+	graph.AddDependency(material, texture);
+	graph.AddDependency(prefab, material);
+
+	EXPECT_TRUE(graph.Execute(4));
+	ASSERT_EQ(order.size(), 3u);
+	EXPECT_EQ(order[0], "texture");
+	EXPECT_EQ(order[1], "material");
+	EXPECT_EQ(order[2], "prefab");
+	EXPECT_EQ(graph.CountStatus(JobStatus::Succeeded), 3u);
+}
+
+TEST(JobGraphTest, RespectsThreadCount) {
+	JobGraph graph;
+	std::atomic<int> running{ 0 }, peak{ 0 };
+
+	for (int i = 0; i < 16; ++i) {
+		graph.AddJob("job" + std::to_string(i), "stage", [&](std::vector<Diagnostic>&) {
+			int now = ++running;
+			int expected = peak.load();
+			while (now > expected && !peak.compare_exchange_weak(expected, now)) {}
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			--running;
+			return true;
+			});
+	}
+
+	EXPECT_TRUE(graph.Execute(2));
+	EXPECT_LE(peak.load(), 2);
+	EXPECT_EQ(graph.CountStatus(JobStatus::Succeeded), 16u);
+}
+
+TEST(JobGraphTest, FailureSkipsDependents) {
+	JobGraph graph;
+	bool dependentRan = false;
+
+	JobID mesh = graph.AddJob("mesh", "R_Model", [](std::vector<Diagnostic>& diagnostics) {
+		diagnostics.push_back({ Severity::Error, "bad fbx" });
+		return false;
+		});
+	JobID scene = graph.AddJob("scene", "R_Scene", [&](std::vector<Diagnostic>&) { dependentRan = true; return true; });
+	JobID other = graph.AddJob("other", "R_Audio", [](std::vector<Diagnostic>&) { return true; });
+	graph.AddDependency(scene, mesh);
+
+	EXPECT_FALSE(graph.Execute(2));
+	EXPECT_FALSE(dependentRan);
+	EXPECT_EQ(graph.GetJob(mesh).status, JobStatus::Failed);
+	ASSERT_EQ(graph.GetJob(mesh).diagnostics.size(), 1u);
+	EXPECT_EQ(graph.GetJob(mesh).diagnostics[0].message, "bad fbx");
+	EXPECT_EQ(graph.GetJob(scene).status, JobStatus::Skipped);
+	EXPECT_EQ(graph.GetJob(other).status, JobStatus::Succeeded);
+}
+
+TEST(JobGraphTest, DetectsCycles) {
+	JobGraph graph;
+	JobID a = graph.AddJob("a", "stage", [](std::vector<Diagnostic>&) { return true; });
+	JobID b = graph.AddJob("b", "stage", [](std::vector<Diagnostic>&) { return true; });
+	JobID c = graph.AddJob("c", "stage", [](std::vector<Diagnostic>&) { return true; });
+	graph.AddDependency(a, b);
+	graph.AddDependency(b, a);
+
+	EXPECT_FALSE(graph.Execute(2));
+	EXPECT_EQ(graph.GetJob(a).status, JobStatus::Failed);
+	EXPECT_EQ(graph.GetJob(b).status, JobStatus::Failed);
+	EXPECT_EQ(graph.GetJob(c).status, JobStatus::Succeeded);
+}
+
+TEST(JobGraphTest, CapturesExceptions) {
+	JobGraph graph;
+	JobID job = graph.AddJob("throws", "stage", [](std::vector<Diagnostic>&) -> bool {
+		throw std::runtime_error("decoder crashed");
+		});
+
+	EXPECT_FALSE(graph.Execute(1));
+	EXPECT_EQ(graph.GetJob(job).status, JobStatus::Failed);
+	ASSERT_FALSE(graph.GetJob(job).diagnostics.empty());
+	EXPECT_NE(graph.GetJob(job).diagnostics.back().message.find("decoder crashed"), std::string::npos);
+}
+
+TEST(AssetBuilderTest, BuildsDirectoryAndSkipsUnchanged) {
+	const std::filesystem::path root = std::filesystem::temp_directory_path() / "kos_assetbuilder_test";
+	std::filesystem::remove_all(root);
+
+	WriteAsset(root / "Assets" / "a.mat", "mat-guid", "[{\"MaterialData\":{\"diffuseMaterialGUID\":\"snd-guid\"}}]");
+	WriteAsset(root / "Assets" / "b.wav", "snd-guid", "riff");
+	WriteFile(root / "Assets" / "untracked.wav", "no meta");
+
+	std::vector<CompilerEntry> compilers{
+		{ { "R_Material", "null", ".mat", "1" }, { ".mat" } },
+		{ { "R_Audio", "null", ".wav", "1" }, { ".wav" } }
+	};
+
+	BuildCache cache;
+	cache.Init(root / "Cache");
+
+	{
+		AssetBuilder builder{ compilers, &cache };
+		BuildReport report = builder.BuildDirectory(root / "Assets", root / "Resource");
+		EXPECT_TRUE(report.Succeeded());
+		EXPECT_EQ(report.compiled, 2u);
+		EXPECT_TRUE(std::filesystem::exists(root / "Resource" / "mat-guid.mat"));
+		EXPECT_TRUE(std::filesystem::exists(root / "Resource" / "snd-guid.wav"));
+	}
+	{
+		AssetBuilder builder{ compilers, &cache };
+		BuildReport report = builder.BuildDirectory(root / "Assets", root / "Resource");
+		EXPECT_TRUE(report.Succeeded());
+		EXPECT_EQ(report.compiled, 0u);
+		EXPECT_EQ(report.upToDate, 2u);
+	}
+
+	std::filesystem::remove_all(root);
+}
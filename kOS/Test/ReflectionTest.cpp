@@ -0,0 +1,183 @@
+/******************************************************************/
+/*!
+\file      ReflectionTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the field descriptors REFLECTABLE generates.
+		   Every component ECS::Load registers, from the list in
+		   Config/ComponentRegistry.h, and every reflected class they
+		   hold, is checked at compile time: one descriptor per member,
+		   matching size and type, offsets inside the object that do
+		   not overlap and unique name hashes. The offsets are then
+		   checked against real members at runtime, CopyReflected
+		   against DeepCopyComponents, and the ECS against the list.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Config/ComponentRegistry.h"
+#include "DeSerialization/BinarySerializationReflection.h"
+#include "common.h"
+
+using namespace ecs;
+using Serialization::MemberTuple;
+using Serialization::MemberType;
+
+namespace {
+
+	struct Fixture {
+		float speed{};
+		std::string label;
+		int a{}, b{}, c{}, d{}, e{}, f{}, g{}, h{}, i{}, j{}, k{}, l{}, m{}, n{}, o{}, p{}, q{};
+		REFLECTABLE(Fixture, speed, label, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q)
+		REFLECT_FIELD_FLAGS({ "label", reflect::EDITOR_ONLY }, { "q", reflect::TRANSIENT })
+	};
+
+	template <typename T>
+	constexpr bool ValidDescriptors();
+
+	//reflected classes held by value or in a vector are checked too
+	template <typename M>
+	constexpr bool ValidNested() {
+		if constexpr (Serialization::IsVector<M>::value) return ValidNested<typename M::value_type>();
+		else if constexpr (Serialization::Reflectable<M>) return ValidDescriptors<M>();
+		else return true;
+	}
+
+	template <typename T, size_t... I>
+	constexpr bool MembersMatch(std::index_sequence<I...>) {
+		[[maybe_unused]] constexpr auto fields = T::Fields();
+		return ((fields[I].size == sizeof(MemberType<T, I>)
+			&& fields[I].typeID == reflect::TypeID<MemberType<T, I>>()
+			&& fields[I].nameHash == reflect::HashName(fields[I].name)
+			&& fields[I].offset + fields[I].size <= sizeof(T)
+			&& ValidNested<MemberType<T, I>>()) && ...);
+	}
+
+	template <typename T>
+	constexpr bool ValidDescriptors() {
+		constexpr auto fields = T::Fields();
+		if (fields.size() != std::tuple_size_v<MemberTuple<T>>) return false;
+		if (!MembersMatch<T>(std::make_index_sequence<std::tuple_size_v<MemberTuple<T>>>{})) return false;
+
+		for (size_t i = 0; i < fields.size(); ++i) {
+			//the entity of the Component base is never reflected
+			if constexpr (std::is_base_of_v<Component, T>) {
+				if (fields[i].offset < sizeof(Component)) return false;
+			}
+			const uint32_t flags = fields[i].flags;
+			if (flags != reflect::SERIALIZE && flags != reflect::EDITOR_ONLY && flags != reflect::TRANSIENT) return false;
+
+			for (size_t j = i + 1; j < fields.size(); ++j) {
+				if (fields[i].nameHash == fields[j].nameHash) return false;
+				const bool apart = fields[i].offset + fields[i].size <= fields[j].offset || fields[j].offset + fields[j].size <= fields[i].offset;
+				if (!apart) return false;
+			}
+		}
+		return reflect::OverridesMatchFields<T>();
+	}
+
+	template <typename Tuple>
+	struct CheckAll;
+
+	template <typename... T>
+	struct CheckAll<std::tuple<T...>> {
+		static_assert((ValidDescriptors<T>() && ...), "A registered component has descriptors that do not match its members");
+		static constexpr bool checked = true;
+	};
+
+	static_assert(CheckAll<RegisteredComponents>::checked);
+	static_assert(ValidDescriptors<SceneData>());
+
+	//no limit on the number of members, and flags apply by name
+	static_assert(Fixture::fieldcount == 19);
+	static_assert(ValidDescriptors<Fixture>());
+	static_assert(Fixture::Fields()[0].flags == reflect::SERIALIZE);
+	static_assert(Fixture::Fields()[1].Has(reflect::EDITOR_ONLY));
+	static_assert(Fixture::Fields()[18].Has(reflect::TRANSIENT));
+	static_assert(reflect::IndexOf<Fixture>("q") == 18);
+	static_assert(reflect::IndexOf<Fixture>("r") == -1);
+	static_assert(reflect::IndexOf<TransformComponent>(reflect::HashName("LocalTransformation")) == 1);
+	static_assert(CubeRendererComponent::Fields().empty());
+
+	//components holding only trivially copyable members are copied by memcpy alone
+	static_assert(reflect::IsTriviallyReflected<TransformComponent>());
+	static_assert(reflect::IsTriviallyReflected<BoxColliderComponent>());
+	static_assert(reflect::MakeCopyPlan<TransformComponent>().count == 1);
+	static_assert(!reflect::IsTriviallyReflected<NameComponent>());
+	static_assert(!reflect::IsTriviallyReflected<AnimatorComponent>());
+
+	//offset of every member of T against its address in a real object
+	template <typename T>
+	void ExpectOffsetsMatch() {
+		auto object = std::make_unique<T>();
+		const auto* base = reinterpret_cast<const char*>(object.get());
+		const auto names = T::Names();
+		constexpr auto fields = T::Fields();
+
+		std::vector<ptrdiff_t> offsets;
+		[&] <size_t... I>(std::index_sequence<I...>) {
+			(offsets.push_back(reinterpret_cast<const char*>(&std::get<I>(object->member())) - base), ...);
+		}(std::make_index_sequence<fields.size()>{});
+
+		for (size_t i = 0; i < fields.size(); ++i) {
+			EXPECT_EQ(offsets[i], static_cast<ptrdiff_t>(fields[i].offset)) << T::classname() << "::" << names[i];
+			EXPECT_EQ(fields[i].name, names[i]) << T::classname();
+			EXPECT_EQ(fields[i].nameHash, Serialization::HashBytes(names[i])) << T::classname() << "::" << names[i];
+		}
+	}
+
+	//CopyReflected gives what DeepCopyComponents through ApplyFunctionPairwise gives
+	template <typename T>
+	void ExpectCopiesMatch() {
+		auto source = std::make_unique<T>();
+		source->ApplyFunction(RandomizeComponents<decltype(T::Names())>{T::Names()});
+
+		auto copied = std::make_unique<T>();
+		auto visited = std::make_unique<T>();
+		CopyReflected(*copied, *source);
+		DeepCopyComponents<T> duplicator;
+		visited->ApplyFunctionPairwise(duplicator, *source);
+		EXPECT_TRUE(CompareComponentReflect(copied.get(), visited.get())) << T::classname();
+		EXPECT_TRUE(CompareComponentReflect(copied.get(), source.get())) << T::classname();
+	}
+}
+
+TEST(Reflection, DescriptorsMatchRegisteredComponents) {
+	[] <typename... T>(std::tuple<T...>*) {
+		(ExpectOffsetsMatch<T>(), ...);
+	}(static_cast<RegisteredComponents*>(nullptr));
+
+	ExpectOffsetsMatch<Transformation>();
+	ExpectOffsetsMatch<AudioFile>();
+	ExpectOffsetsMatch<IkTarget>();
+	ExpectOffsetsMatch<Fixture>();
+}
+
+//the list the descriptors are checked over is the one the ECS registers, name for name and in key order
+TEST(Reflection, RegisteredComponentsMatchTheEcs) {
+	ECS* ecs = ECS::GetInstance();
+	if (ecs->GetComponentKeyData().empty()) RegisterComponents(*ecs);
+
+	const auto& keys = ecs->GetComponentKeyData();
+	EXPECT_EQ(keys.size(), std::tuple_size_v<RegisteredComponents>);
+	[&keys] <typename... T>(std::tuple<T...>*) {
+		size_t key = 0;
+		([&keys, &key] {
+			++key;
+			const auto it = keys.find(T::classname());
+			ASSERT_NE(it, keys.end()) << T::classname() << " is not registered";
+			EXPECT_EQ(it->second, key) << T::classname();
+		}(), ...);
+	}(static_cast<RegisteredComponents*>(nullptr));
+}
+
+TEST(Reflection, CopyReflectedMatchesDeepCopy) {
+	[] <typename... T>(std::tuple<T...>*) {
+		(ExpectCopiesMatch<T>(), ...);
+	}(static_cast<RegisteredComponents*>(nullptr));
+}
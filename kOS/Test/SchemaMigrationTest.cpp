@@ -0,0 +1,228 @@
+/******************************************************************/
+/*!
+\file      SchemaMigrationTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for component schema migration. Chains of rename,
+		   default and transform steps are run over components saved at
+		   old versions, with members missing and members no version
+		   has, then over whole scene documents with children and
+		   prefab overrides.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "DeSerialization/schema_migration.h"
+#include "Scene/SceneData.h"
+
+#include <RAPIDJSON/writer.h>
+
+using namespace Serialization;
+
+namespace {
+
+	struct VersionedFixture {
+		float range{};
+		REFLECTABLE(VersionedFixture, range)
+		REFLECT_SCHEMA_VERSION(3)
+	};
+
+	struct UnversionedFixture {
+		float range{};
+		REFLECTABLE(UnversionedFixture, range)
+	};
+
+	//"Light" at version 3: "colour" became "color" at 2, "range" was added and "intensity" doubled at 3
+	SchemaMigrations LightMigrations() {
+		SchemaMigrations migrations;
+		migrations.SetVersion("Light", 3);
+		migrations.Add("Light", 1, migrate::Rename("colour", "color"));
+		migrations.Add("Light", 2, [](rapidjson::Value& object, JsonAllocator& allocator, bool partial) {
+			migrate::Default("range", 10.f)(object, allocator, partial);
+			migrate::Transform("intensity", [](rapidjson::Value& member, JsonAllocator&) {
+				member.SetFloat(member.GetFloat() * 2.f);
+			})(object, allocator, partial);
+		});
+		return migrations;
+	}
+
+	rapidjson::Document Parse(const char* json) {
+		rapidjson::Document document;
+		document.Parse(json);
+		EXPECT_FALSE(document.HasParseError());
+		return document;
+	}
+
+	std::string Write(const rapidjson::Value& value) {
+		rapidjson::StringBuffer buffer;
+		rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+		value.Accept(writer);
+		return buffer.GetString();
+	}
+}
+
+TEST(SchemaMigration, VersionDefaultsToOne) {
+	static_assert(reflect::SchemaVersion<VersionedFixture>() == 3);
+	static_assert(reflect::SchemaVersion<UnversionedFixture>() == 1);
+
+	SchemaMigrations migrations;
+	migrations.SetVersion<VersionedFixture>();
+	EXPECT_EQ(migrations.GetVersion("VersionedFixture"), 3u);
+	EXPECT_EQ(migrations.GetVersion("UnknownComponent"), 1u);
+	EXPECT_FALSE(migrations.IsKnown("UnknownComponent"));
+}
+
+TEST(SchemaMigration, ChainRunsEveryStep) {
+	const SchemaMigrations migrations = LightMigrations();
+	rapidjson::Document document = Parse(R"({"colour":"red","intensity":1.5})");
+
+	ASSERT_TRUE(migrations.Migrate("Light", 1, document, document.GetAllocator()));
+	EXPECT_FALSE(document.HasMember("colour"));
+	EXPECT_STREQ(document["color"].GetString(), "red");
+	EXPECT_FLOAT_EQ(document["intensity"].GetFloat(), 3.f);
+	EXPECT_FLOAT_EQ(document["range"].GetFloat(), 10.f);
+}
+
+TEST(SchemaMigration, ChainStartsAtSavedVersion) {
+	const SchemaMigrations migrations = LightMigrations();
+	rapidjson::Document document = Parse(R"({"color":"blue","intensity":1.0,"range":4.0})");
+
+	ASSERT_TRUE(migrations.Migrate("Light", 2, document, document.GetAllocator()));
+	EXPECT_STREQ(document["color"].GetString(), "blue");
+	EXPECT_FLOAT_EQ(document["intensity"].GetFloat(), 2.f);
+	//a member the file has is never replaced by a default
+	EXPECT_FLOAT_EQ(document["range"].GetFloat(), 4.f);
+
+	EXPECT_FALSE(migrations.Migrate("Light", 3, document, document.GetAllocator()));
+}
+
+TEST(SchemaMigration, MissingFields) {
+	const SchemaMigrations migrations = LightMigrations();
+	rapidjson::Document document = Parse(R"({})");
+
+	ASSERT_TRUE(migrations.Migrate("Light", 1, document, document.GetAllocator()));
+	//nothing to rename or transform, only the default is added
+	EXPECT_FALSE(document.HasMember("color"));
+	EXPECT_FALSE(document.HasMember("intensity"));
+	EXPECT_FLOAT_EQ(document["range"].GetFloat(), 10.f);
+	EXPECT_EQ(document.MemberCount(), 1u);
+}
+
+TEST(SchemaMigration, ExtraFieldsAreKept) {
+	const SchemaMigrations migrations = LightMigrations();
+	rapidjson::Document document = Parse(R"({"flicker":true,"colour":"red","color":"green","notes":{"a":[1,2]}})");
+
+	ASSERT_TRUE(migrations.Migrate("Light", 1, document, document.GetAllocator()));
+	//members no version has are left for the loader to ignore, and a rename never overwrites
+	EXPECT_TRUE(document["flicker"].GetBool());
+	EXPECT_EQ(Write(document["notes"]), R"({"a":[1,2]})");
+	EXPECT_STREQ(document["color"].GetString(), "green");
+	EXPECT_FALSE(document.HasMember("colour"));
+	//members keep their order
+	EXPECT_STREQ(document.MemberBegin()->name.GetString(), "flicker");
+}
+
+TEST(SchemaMigration, PartialObjectsTakeNoDefaults) {
+	const SchemaMigrations migrations = LightMigrations();
+	rapidjson::Document document = Parse(R"({"colour":"red"})");
+
+	ASSERT_TRUE(migrations.Migrate("Light", 1, document, document.GetAllocator(), true));
+	EXPECT_STREQ(document["color"].GetString(), "red");
+	EXPECT_FALSE(document.HasMember("range"));
+}
+
+TEST(SchemaMigration, BrokenChainLeavesObject) {
+	SchemaMigrations migrations = LightMigrations();
+	migrations.SetVersion("Light", 4);
+	rapidjson::Document document = Parse(R"({"colour":"red","intensity":1.0})");
+	const std::string before = Write(document);
+
+	//no step from 3
+	EXPECT_FALSE(migrations.Migrate("Light", 1, document, document.GetAllocator()));
+	EXPECT_EQ(Write(document), before);
+
+	//saved by a newer build
+	EXPECT_FALSE(migrations.Migrate("Light", 5, document, document.GetAllocator()));
+	EXPECT_EQ(Write(document), before);
+}
+
+TEST(SchemaMigration, VersionsTable) {
+	SchemaMigrations migrations = LightMigrations();
+
+	SchemaVersions legacy;
+	legacy.Read(Parse(R"({"SceneData":{}})"));
+	EXPECT_FALSE(legacy.HasTable());
+	EXPECT_EQ(legacy.Get("Light", 3), 1u);
+	EXPECT_FALSE(legacy.IsCurrent(migrations));
+
+	SchemaVersions saved;
+	saved.Read(Parse(R"({"SceneData":{},"schemaVersions":{"Light":3,"Retired":7}})"));
+	EXPECT_EQ(saved.Get("Light", 3), 3u);
+	//left out of a table: not in the file when it was saved
+	EXPECT_EQ(saved.Get("Camera", 2), 2u);
+	//classes this build does not know do not hold the file back
+	EXPECT_TRUE(saved.IsCurrent(migrations));
+
+	migrations.SetVersion("Light", 1);
+	EXPECT_FALSE(saved.IsCurrent(migrations));
+	SchemaMigrations unversioned;
+	EXPECT_TRUE(legacy.IsCurrent(unversioned));
+}
+
+TEST(SchemaMigration, SceneDocument) {
+	SchemaMigrations migrations = LightMigrations();
+	migrations.SetVersion("Camera", 1);
+	rapidjson::Document document = Parse(R"([
+		{"SceneData":{"ambientIntensity":1.0}},
+		{"Light":{"colour":"red","intensity":1.0},"Camera":{"fov":60.0},
+		 "children":[{"Light":{"colour":"blue"},"children":[{"Light":{}}]}]},
+		{"prefab":"Lamp.prefab","overrides":[{"Light":{"colour":"green"}},{"removed":["Light"]}]}
+	])");
+
+	//the root, its child and grandchild, and the override
+	EXPECT_EQ(MigrateSceneDocument(document, migrations), 4u);
+
+	const rapidjson::Value& root = document[1];
+	EXPECT_STREQ(root["Light"]["color"].GetString(), "red");
+	EXPECT_FLOAT_EQ(root["Light"]["intensity"].GetFloat(), 2.f);
+	EXPECT_EQ(Write(root["Camera"]), R"({"fov":60.0})");
+	const rapidjson::Value& child = root["children"][0];
+	EXPECT_STREQ(child["Light"]["color"].GetString(), "blue");
+	EXPECT_FLOAT_EQ(child["children"][0]["Light"]["range"].GetFloat(), 10.f);
+
+	const rapidjson::Value& overridden = document[2]["overrides"][0]["Light"];
+	EXPECT_STREQ(overridden["color"].GetString(), "green");
+	EXPECT_FALSE(overridden.HasMember("range"));
+	EXPECT_EQ(Write(document[2]["overrides"][1]), R"({"removed":["Light"]})");
+
+	EXPECT_EQ(Write(document[0][SchemaVersions::KEY]), R"({"Camera":1,"Light":3})");
+
+	//a second pass has nothing to do and changes nothing
+	const std::string migrated = Write(document);
+	EXPECT_EQ(MigrateSceneDocument(document, migrations), 0u);
+	EXPECT_EQ(Write(document), migrated);
+}
+
+TEST(SchemaMigration, DocumentWithoutSceneDataGainsIt) {
+	const SchemaMigrations migrations = LightMigrations();
+	rapidjson::Document document = Parse(R"([{"Light":{"colour":"red"}}])");
+
+	EXPECT_EQ(MigrateSceneDocument(document, migrations), 1u);
+	ASSERT_EQ(document.Size(), 2u);
+	EXPECT_TRUE(document[0].HasMember(SceneData::classname()));
+	EXPECT_EQ(document[0][SchemaVersions::KEY]["Light"].GetUint(), 3u);
+	EXPECT_STREQ(document[1]["Light"]["color"].GetString(), "red");
+}
+
+TEST(SchemaMigration, CurrentDocumentIsUntouched) {
+	const SchemaMigrations migrations = LightMigrations();
+	rapidjson::Document document = Parse(R"([{"SceneData":{},"schemaVersions":{"Light":3}},{"Light":{"colour":"red"}}])");
+	const std::string before = Write(document);
+
+	EXPECT_EQ(MigrateSceneDocument(document, migrations), 0u);
+	EXPECT_EQ(Write(document), before);
+}
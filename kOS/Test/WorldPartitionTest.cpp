@@ -0,0 +1,311 @@
+/******************************************************************/
+/*!
+\file      WorldPartitionTest.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test cases for the world partition streaming decisions:
+		   load order, the hysteresis band, loads in flight, the memory
+		   budget and several sources, then a walk through a grid of
+		   400 cells with loads finishing a few frames late. No scene
+		   is loaded, only the plans are checked.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Scene/WorldPartition.h"
+
+using namespace scenes;
+
+namespace {
+
+	constexpr float CELL_SIZE = 10.f;
+
+	//"width" by "depth" cells from (0, 0), indexed x first
+	WorldPartitionLayout Grid(int width, int depth) {
+		WorldPartitionLayout layout;
+		layout.cellSize = CELL_SIZE;
+		for (int z = 0; z < depth; ++z) {
+			for (int x = 0; x < width; ++x) {
+				layout.cells.push_back({ x, z, "cell_" + std::to_string(x) + "_" + std::to_string(z) + ".json" });
+			}
+		}
+		return layout;
+	}
+
+	StreamingSettings Settings(float loadRadius, float unloadRadius, size_t memoryBudget = 0, size_t maxLoadsInFlight = 0) {
+		StreamingSettings settings;
+		settings.loadRadius = loadRadius;
+		settings.unloadRadius = unloadRadius;
+		settings.memoryBudget = memoryBudget;
+		settings.maxLoadsInFlight = maxLoadsInFlight;
+		return settings;
+	}
+
+	WorldPartition Partition(const WorldPartitionLayout& layout, const StreamingSettings& settings, size_t cellBytes = 100) {
+		WorldPartition partition;
+		partition.SetLayout(layout, std::vector<size_t>(layout.cells.size(), cellBytes));
+		partition.SetSettings(settings);
+		return partition;
+	}
+
+	std::vector<StreamingSource> At(float x, float z) {
+		return { StreamingSource{ { x, 0.f, z } } };
+	}
+
+	void LoadAll(WorldPartition& partition, const StreamingPlan& plan) {
+		for (const size_t cell : plan.load) partition.OnCellLoaded(cell);
+	}
+
+	std::vector<size_t> Sorted(std::vector<size_t> cells) {
+		std::sort(cells.begin(), cells.end());
+		return cells;
+	}
+}
+
+TEST(WorldPartition, LoadsNearestFirst) {
+	//one row of cells, the source in the middle of cell 3
+	WorldPartition partition = Partition(Grid(8, 1), Settings(12.f, 20.f));
+	const StreamingPlan plan = partition.Update(At(35.f, 5.f));
+
+	//cell 3 holds the source, 2 and 4 are 5 away, 1 and 5 are 15, the lower index first on a tie
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 3, 2, 4 }));
+	EXPECT_TRUE(plan.unload.empty());
+	EXPECT_EQ(partition.GetState(3), CellState::LOADING);
+	EXPECT_EQ(partition.GetState(1), CellState::UNLOADED);
+	EXPECT_EQ(partition.GetLoadsInFlight(), 3u);
+
+	LoadAll(partition, plan);
+	EXPECT_EQ(partition.GetState(2), CellState::LOADED);
+	EXPECT_EQ(partition.GetLoadsInFlight(), 0u);
+	//nothing new to do for a source that stays put
+	const StreamingPlan again = partition.Update(At(35.f, 5.f));
+	EXPECT_TRUE(again.load.empty());
+	EXPECT_TRUE(again.unload.empty());
+}
+
+TEST(WorldPartition, HysteresisBand) {
+	WorldPartition partition = Partition(Grid(8, 1), Settings(5.f, 15.f));
+	LoadAll(partition, partition.Update(At(5.f, 5.f)));
+	EXPECT_EQ(Sorted({ partition.GetResidentCells().begin(), partition.GetResidentCells().end() }), (std::vector<size_t>{ 0, 1 }));
+
+	//cell 0 is 12 away, inside the band it stays
+	StreamingPlan plan = partition.Update(At(22.f, 5.f));
+	EXPECT_TRUE(plan.unload.empty());
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 2 }));
+	LoadAll(partition, plan);
+
+	//walking back and forth over the border of cells 1 and 2 changes nothing
+	for (float x : { 19.f, 21.f, 18.f, 22.f, 20.f }) {
+		plan = partition.Update(At(x, 5.f));
+		EXPECT_TRUE(plan.unload.empty()) << x;
+		EXPECT_TRUE(plan.load.empty()) << x;
+	}
+
+	//cell 0 is 16 away, past the band
+	plan = partition.Update(At(26.f, 5.f));
+	EXPECT_EQ(plan.unload, (std::vector<size_t>{ 0 }));
+	EXPECT_EQ(partition.GetState(0), CellState::UNLOADED);
+
+	//coming back inside the band does not load it again, only the load radius does
+	plan = partition.Update(At(24.f, 5.f));
+	EXPECT_TRUE(plan.load.empty());
+	plan = partition.Update(At(15.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 0 }));
+}
+
+TEST(WorldPartition, LoadsInFlight) {
+	WorldPartition partition = Partition(Grid(12, 1), Settings(25.f, 30.f, 0, 2));
+	StreamingPlan plan = partition.Update(At(35.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 3, 2 }));
+
+	//still loading, nothing more starts
+	EXPECT_TRUE(partition.Update(At(35.f, 5.f)).load.empty());
+
+	partition.OnCellLoaded(3);
+	plan = partition.Update(At(35.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 4 }));
+
+	//a loading cell unloaded frees its place
+	plan = partition.Update(At(105.f, 5.f));
+	EXPECT_EQ(Sorted(plan.unload), (std::vector<size_t>{ 2, 3, 4 }));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 10, 9 }));
+	EXPECT_EQ(partition.GetLoadsInFlight(), 2u);
+}
+
+TEST(WorldPartition, MemoryBudget) {
+	//room for three cells of 100 bytes
+	WorldPartition partition = Partition(Grid(10, 1), Settings(6.f, 40.f, 300));
+	StreamingPlan plan = partition.Update(At(5.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 0, 1 }));
+	LoadAll(partition, plan);
+
+	//cell 3 needs room, cell 0 is the furthest the band holds and goes, 1 stays
+	plan = partition.Update(At(25.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 2, 3 }));
+	EXPECT_EQ(plan.unload, (std::vector<size_t>{ 0 }));
+	EXPECT_LE(partition.GetResidentBytes(), 300u);
+	LoadAll(partition, plan);
+
+	//with every resident cell within the load radius nothing is evicted, and nothing further away loads either
+	WorldPartition tight = Partition(Grid(10, 1), Settings(16.f, 40.f, 250));
+	plan = tight.Update(At(15.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 1, 0 }));
+	EXPECT_TRUE(plan.unload.empty());
+	EXPECT_EQ(tight.GetResidentBytes(), 200u);
+
+	//a cell bigger than the whole budget never loads and holds back those behind it
+	WorldPartition large;
+	large.SetLayout(Grid(3, 1), { 50, 400, 50 });
+	large.SetSettings(Settings(12.f, 20.f, 300));
+	plan = large.Update(At(15.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{}));
+	plan = large.Update(At(5.f, 5.f));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 0 }));
+}
+
+TEST(WorldPartition, SeveralSources) {
+	WorldPartition partition = Partition(Grid(10, 10), Settings(4.f, 8.f));
+	std::vector<StreamingSource> sources = { StreamingSource{ { 5.f, 0.f, 5.f } }, StreamingSource{ { 95.f, 0.f, 95.f } } };
+	StreamingPlan plan = partition.Update(sources);
+	EXPECT_EQ(Sorted(plan.load), (std::vector<size_t>{ 0, 99 }));
+	LoadAll(partition, plan);
+
+	//a cell stays while any source needs it
+	sources[1].position = { 5.f, 0.f, 13.f };
+	plan = partition.Update(sources);
+	EXPECT_EQ(plan.unload, (std::vector<size_t>{ 99 }));
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 10 }));
+
+	//a source's scale stretches both radii for it
+	partition = Partition(Grid(10, 1), Settings(4.f, 8.f));
+	plan = partition.Update({ StreamingSource{ { 5.f, 0.f, 5.f }, 4.f } });
+	EXPECT_EQ(plan.load, (std::vector<size_t>{ 0, 1, 2 }));
+
+	//no source, nothing is needed
+	LoadAll(partition, plan);
+	plan = partition.Update({});
+	EXPECT_EQ(Sorted(plan.unload), (std::vector<size_t>{ 0, 1, 2 }));
+	EXPECT_EQ(partition.GetResidentBytes(), 0u);
+}
+
+TEST(WorldPartition, CellsOutsideTheLayout) {
+	//a layout with holes, only listed cells exist
+	WorldPartitionLayout layout;
+	layout.cellSize = CELL_SIZE;
+	layout.cells = { { 0, 0, "a.json" }, { -3, 2, "b.json" }, { 5, -1, "c.json" } };
+	WorldPartition partition = Partition(layout, Settings(1.f, 2.f));
+
+	EXPECT_EQ(partition.FindCell({ -25.f, 0.f, 21.f }), 1u);
+	EXPECT_EQ(partition.FindCell({ 55.f, 3.f, -0.5f }), 2u);
+	EXPECT_EQ(partition.FindCell({ 15.f, 0.f, 5.f }), WorldPartition::npos);
+
+	EXPECT_EQ(partition.Update(At(-25.f, 25.f)).load, (std::vector<size_t>{ 1 }));
+	EXPECT_TRUE(partition.Update(At(-500.f, 500.f)).load.empty());
+}
+
+TEST(WorldPartition, SamePlansForSameSources) {
+	const WorldPartitionLayout layout = Grid(20, 20);
+	std::vector<size_t> cellBytes;
+	for (size_t i = 0; i < layout.cells.size(); ++i) cellBytes.push_back(100 + (i * 37) % 200);
+
+	WorldPartition first, second;
+	for (WorldPartition* partition : { &first, &second }) {
+		partition->SetLayout(layout, cellBytes);
+		partition->SetSettings(Settings(25.f, 35.f, 4000, 3));
+	}
+
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> step(-4.f, 4.f);
+	glm::vec3 position{ 100.f, 0.f, 100.f };
+	for (int frame = 0; frame < 500; ++frame) {
+		position += glm::vec3{ step(random), 0.f, step(random) };
+		const std::vector<StreamingSource> sources{ StreamingSource{ position } };
+		const StreamingPlan a = first.Update(sources);
+		const StreamingPlan b = second.Update(sources);
+		ASSERT_EQ(a.load, b.load) << "frame " << frame;
+		ASSERT_EQ(a.unload, b.unload) << "frame " << frame;
+		if (frame % 3 == 0) {
+			LoadAll(first, a);
+			LoadAll(second, b);
+		}
+	}
+}
+
+// a source walking every row of a 20 by 20 grid and back, loads finishing a few frames after they start. Every frame
+// the resident cells stay within the budget, the partition's count of them matches their states, and the cell the
+// source stands in is loaded once the walk is under way
+TEST(WorldPartition, SoakWalkThroughFourHundredCells) {
+	constexpr int GRID = 20;
+	constexpr size_t BUDGET = 48 * 1024;
+	const WorldPartitionLayout layout = Grid(GRID, GRID);
+
+	std::mt19937 random(2026);
+	std::uniform_int_distribution<size_t> size(1024, 3 * 1024);
+	std::vector<size_t> cellBytes(layout.cells.size());
+	for (size_t& bytes : cellBytes) bytes = size(random);
+
+	WorldPartition partition;
+	partition.SetLayout(layout, cellBytes);
+	partition.SetSettings(Settings(15.f, 35.f, BUDGET, 3));
+
+	//rows there and back, one unit per frame, each row half a cell after the last
+	std::vector<glm::vec3> path;
+	for (int row = 0; row < GRID * 2; ++row) {
+		const float z = row * CELL_SIZE * 0.5f + 2.5f;
+		for (int step = 0; step <= GRID * static_cast<int>(CELL_SIZE); ++step) {
+			const float x = row % 2 == 0 ? static_cast<float>(step) : GRID * CELL_SIZE - step;
+			path.push_back({ std::clamp(x, 0.5f, GRID * CELL_SIZE - 0.5f), 0.f, z });
+		}
+	}
+
+	//loads finish 1 to 4 frames after they start
+	std::deque<std::pair<size_t, size_t>> loading;  //frame it finishes, cell
+	std::vector<bool> everLoaded(layout.cells.size());
+	size_t evictions = 0, loads = 0, peakBytes = 0, waitedFrames = 0;
+	for (size_t frame = 0; frame < path.size(); ++frame) {
+		const StreamingPlan plan = partition.Update({ StreamingSource{ path[frame] } });
+		for (const size_t cell : plan.unload) {
+			if (partition.Distance({ StreamingSource{ path[frame] } }, cell) <= 35.f) ++evictions;
+		}
+		std::erase_if(loading, [&](const auto& load) { return partition.GetState(load.second) != CellState::LOADING; });
+		for (const size_t cell : plan.load) {
+			loading.push_back({ frame + 1 + (cell * 7 + frame) % 4, cell });
+			++loads;
+		}
+		while (!loading.empty() && loading.front().first <= frame) {
+			partition.OnCellLoaded(loading.front().second);
+			everLoaded[loading.front().second] = true;
+			loading.pop_front();
+		}
+		std::sort(loading.begin(), loading.end());
+
+		size_t resident = 0, inFlight = 0;
+		for (size_t cell = 0; cell < layout.cells.size(); ++cell) {
+			if (partition.GetState(cell) != CellState::UNLOADED) resident += cellBytes[cell];
+			if (partition.GetState(cell) == CellState::LOADING) ++inFlight;
+		}
+		ASSERT_LE(partition.GetResidentBytes(), BUDGET) << "frame " << frame;
+		ASSERT_EQ(partition.GetResidentBytes(), resident) << "frame " << frame;
+		ASSERT_EQ(partition.GetLoadsInFlight(), inFlight) << "frame " << frame;
+		ASSERT_LE(inFlight, 3u) << "frame " << frame;
+		peakBytes = std::max(peakBytes, resident);
+
+		if (frame > 20 && partition.GetState(partition.FindCell(path[frame])) != CellState::LOADED) ++waitedFrames;
+	}
+
+	//every cell was walked through, the band was trimmed to fit and the source never stood in an unloaded cell
+	EXPECT_TRUE(std::all_of(everLoaded.begin(), everLoaded.end(), [](bool loaded) { return loaded; }));
+	EXPECT_GT(evictions, 0u);
+	EXPECT_EQ(waitedFrames, 0u);
+	std::cout << "[          ] " << path.size() << " frames, " << loads << " loads, " << evictions << " evictions, peak "
+		<< peakBytes / 1024 << " of " << BUDGET / 1024 << " KB\n";
+
+	//leaving the grid unloads everything
+	partition.Update({ StreamingSource{ { -1000.f, 0.f, -1000.f } } });
+	EXPECT_EQ(partition.GetResidentBytes(), 0u);
+	EXPECT_TRUE(partition.GetResidentCells().empty());
+}
@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "ECS/Component/ComponentHeader.h"
 #include "Config/pch.h"
 #include "DeSerialization/json_handler.h"
+#include "DeSerialization/binary_handler.h"
 
 #define SERIALIZE_DESERIALIZE_COMPARE_TEST(ComponentType) \
 TEST(DeSerializeTest, ComponentType##Test) { \
@@ -26,6 +27,7 @@ TEST(DeSerializeTest, ComponentType##Test) { \
     ComponentType comp2 = Serialization::ReadJsonFile<ComponentType>(file); \
     CompareComponents<ComponentType> comparer; \
     EXPECT_NO_THROW(comp.ApplyFunctionPairwise(comparer, comp2)); \
+    ExpectBinaryRoundTrip(comp, #ComponentType ".bin"); \
 }
 
 template <typename T>
@@ -237,4 +239,13 @@ struct CompareComponents {
         }
         count++;
     }
-};
\ No newline at end of file
+};
+
+// Same round trip as the JSON test, through the cooked binary columns
+template <typename T>
+void ExpectBinaryRoundTrip(T& comp, const std::string& file) {
+    EXPECT_TRUE(Serialization::WriteBinaryFile(file, &comp));
+    T comp2 = Serialization::ReadBinaryFile<T>(file);
+    CompareComponents<T> comparer;
+    EXPECT_NO_THROW(comp.ApplyFunctionPairwise(comparer, comp2));
+}
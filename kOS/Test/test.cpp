@@ -16,10 +16,25 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "common.h"
 #include "ECS/ECS.h"
 #include "Scene/SceneManager.h"
+#include "ECS/Hierachy.h"
+#include "ECS/System/TransformSystem.h"
+#include "Resources/R_Prefab.h"
 #include "Utility/MathUtility.h"
 #include "glm/gtx/euler_angles.hpp"
 #include <glm/gtx/matrix_decompose.hpp>
 #include <glm/gtx/string_cast.hpp>
+#include <RAPIDJSON/prettywriter.h>
+#include <chrono>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
 
 using namespace ecs;
 
@@ -34,6 +49,7 @@ SERIALIZE_DESERIALIZE_COMPARE_TEST(MeshFilterComponent)
 SERIALIZE_DESERIALIZE_COMPARE_TEST(MeshRendererComponent)
 SERIALIZE_DESERIALIZE_COMPARE_TEST(SkinnedMeshRendererComponent)
 SERIALIZE_DESERIALIZE_COMPARE_TEST(AnimatorComponent)
+SERIALIZE_DESERIALIZE_COMPARE_TEST(AttachmentComponent)
 SERIALIZE_DESERIALIZE_COMPARE_TEST(LightComponent)
 SERIALIZE_DESERIALIZE_COMPARE_TEST(ScriptComponent)
 SERIALIZE_DESERIALIZE_COMPARE_TEST(BoxColliderComponent)
@@ -44,6 +60,1265 @@ SERIALIZE_DESERIALIZE_COMPARE_TEST(CharacterControllerComponent)
 // Add more component tests as needed
 
 
+// MaxEntity keeps a live scene well under 20k entities, so this times what dominates loading one:
+// turning the saved text or bytes back into components, each file laid out as SaveScene writes it
+TEST(DeSerializeBenchmark, TwentyThousandEntityScene) {
+	constexpr size_t ENTITY_COUNT = 20000;
+	using Clock = std::chrono::steady_clock;
+
+	std::vector<TransformComponent> transforms(ENTITY_COUNT);
+	std::vector<NameComponent> names(ENTITY_COUNT);
+	std::vector<MeshFilterComponent> meshes(ENTITY_COUNT);
+	std::vector<BoxColliderComponent> colliders(ENTITY_COUNT);
+	for (size_t i = 0; i < ENTITY_COUNT; ++i) {
+		transforms[i].ApplyFunction(RandomizeComponents<decltype(TransformComponent::Names())>{TransformComponent::Names()});
+		names[i].ApplyFunction(RandomizeComponents<decltype(NameComponent::Names())>{NameComponent::Names()});
+		meshes[i].ApplyFunction(RandomizeComponents<decltype(MeshFilterComponent::Names())>{MeshFilterComponent::Names()});
+		colliders[i].ApplyFunction(RandomizeComponents<decltype(BoxColliderComponent::Names())>{BoxColliderComponent::Names()});
+	}
+
+	std::string json;
+	{
+		rapidjson::Document doc;
+		doc.SetArray();
+		for (size_t i = 0; i < ENTITY_COUNT; ++i) {
+			rapidjson::Value entity(rapidjson::kObjectType);
+			saveComponentreflect(&transforms[i], entity, doc.GetAllocator());
+			saveComponentreflect(&names[i], entity, doc.GetAllocator());
+			saveComponentreflect(&meshes[i], entity, doc.GetAllocator());
+			saveComponentreflect(&colliders[i], entity, doc.GetAllocator());
+			doc.PushBack(entity, doc.GetAllocator());
+		}
+		rapidjson::StringBuffer buffer;
+		rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+		doc.Accept(writer);
+		json.assign(buffer.GetString(), buffer.GetSize());
+	}
+
+	auto pointers = [](auto& components) {
+		std::vector<typename std::remove_reference_t<decltype(components)>::value_type*> rows;
+		for (auto& component : components) rows.push_back(&component);
+		return rows;
+	};
+
+	std::string binary;
+	{
+		Serialization::StringTable strings;
+		Serialization::BinaryWriter columns(strings);
+		Serialization::WriteComponentColumns(pointers(transforms), columns);
+		Serialization::WriteComponentColumns(pointers(names), columns);
+		Serialization::WriteComponentColumns(pointers(meshes), columns);
+		Serialization::WriteComponentColumns(pointers(colliders), columns);
+
+		Serialization::BinaryWriter file(strings);
+		file.Write(static_cast<uint32_t>(strings.GetStrings().size()));
+		Serialization::WriteStringTable(strings, file);
+		file.WriteBytes(columns.GetData().data(), columns.GetData().size());
+		binary = std::move(file.GetData());
+	}
+
+	std::vector<TransformComponent> jsonTransforms(ENTITY_COUNT);
+	std::vector<NameComponent> jsonNames(ENTITY_COUNT);
+	std::vector<MeshFilterComponent> jsonMeshes(ENTITY_COUNT);
+	std::vector<BoxColliderComponent> jsonColliders(ENTITY_COUNT);
+	const auto jsonStart = Clock::now();
+	{
+		rapidjson::Document doc;
+		doc.Parse(json.c_str());
+		ASSERT_TRUE(doc.IsArray());
+		ASSERT_EQ(doc.Size(), ENTITY_COUNT);
+		for (rapidjson::SizeType i = 0; i < doc.Size(); ++i) {
+			LoadComponentreflect(&jsonTransforms[i], doc[i]);
+			LoadComponentreflect(&jsonNames[i], doc[i]);
+			LoadComponentreflect(&jsonMeshes[i], doc[i]);
+			LoadComponentreflect(&jsonColliders[i], doc[i]);
+		}
+	}
+	const double jsonMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - jsonStart).count();
+
+	std::vector<TransformComponent> binaryTransforms(ENTITY_COUNT);
+	std::vector<NameComponent> binaryNames(ENTITY_COUNT);
+	std::vector<MeshFilterComponent> binaryMeshes(ENTITY_COUNT);
+	std::vector<BoxColliderComponent> binaryColliders(ENTITY_COUNT);
+	const auto binaryStart = Clock::now();
+	{
+		Serialization::BinaryReader reader(binary.data(), binary.size());
+		std::vector<std::string> strings;
+		Serialization::ReadStringTable(reader, reader.Read<uint32_t>(), strings);
+		reader.SetStrings(&strings);
+		Serialization::ReadComponentColumns(pointers(binaryTransforms), reader);
+		Serialization::ReadComponentColumns(pointers(binaryNames), reader);
+		Serialization::ReadComponentColumns(pointers(binaryMeshes), reader);
+		Serialization::ReadComponentColumns(pointers(binaryColliders), reader);
+		EXPECT_EQ(reader.Remaining(), 0u);
+	}
+	const double binaryMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - binaryStart).count();
+
+	for (size_t i = 0; i < ENTITY_COUNT; i += 997) {
+		CompareComponents<TransformComponent> jsonComparer, binaryComparer;
+		EXPECT_NO_THROW(transforms[i].ApplyFunctionPairwise(jsonComparer, jsonTransforms[i]));
+		EXPECT_NO_THROW(transforms[i].ApplyFunctionPairwise(binaryComparer, binaryTransforms[i]));
+		EXPECT_TRUE(CompareComponentReflect(&names[i], &binaryNames[i]));
+		EXPECT_TRUE(CompareComponentReflect(&meshes[i], &binaryMeshes[i]));
+		EXPECT_TRUE(CompareComponentReflect(&colliders[i], &binaryColliders[i]));
+	}
+	EXPECT_LT(binaryMilliseconds, jsonMilliseconds);
+
+	std::cout << "[          ] " << ENTITY_COUNT << " entities, JSON " << json.size() / 1024 << " KB loaded in " << jsonMilliseconds
+		<< " ms, binary " << binary.size() / 1024 << " KB loaded in " << binaryMilliseconds << " ms\n";
+}
+
+
+// entities with random components, every third one a child of an earlier entity
+static std::vector<EntityID> CreateRandomEntities(const std::string& scene, size_t count) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	std::mt19937 gen{ 7 };
+	std::vector<EntityID> ids;
+	for (size_t i = 0; i < count; ++i) {
+		const EntityID id = ecs->CreateEntity(scene);
+		ecs->GetComponent<TransformComponent>(id)->ApplyFunction(RandomizeComponents<decltype(TransformComponent::Names())>{TransformComponent::Names()});
+		ecs->GetComponent<NameComponent>(id)->ApplyFunction(RandomizeComponents<decltype(NameComponent::Names())>{NameComponent::Names()});
+		if (gen() % 2) ecs->AddComponent<MeshFilterComponent>(id)->ApplyFunction(RandomizeComponents<decltype(MeshFilterComponent::Names())>{MeshFilterComponent::Names()});
+		if (gen() % 2) ecs->AddComponent<MeshRendererComponent>(id)->ApplyFunction(RandomizeComponents<decltype(MeshRendererComponent::Names())>{MeshRendererComponent::Names()});
+		if (gen() % 3 == 0) ecs->AddComponent<BoxColliderComponent>(id)->ApplyFunction(RandomizeComponents<decltype(BoxColliderComponent::Names())>{BoxColliderComponent::Names()});
+		if (gen() % 5 == 0) ecs->AddComponent<LightComponent>(id)->ApplyFunction(RandomizeComponents<decltype(LightComponent::Names())>{LightComponent::Names()});
+		if (i % 3 == 2) hierachy::m_SetParent(ids[gen() % ids.size()], id);
+		ids.push_back(id);
+	}
+	return ids;
+}
+
+// saves the entities as a scene file, without its cooked copy so loading reads the JSON
+static std::filesystem::path SaveRandomScene(const std::string& file, size_t count) {
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	std::filesystem::remove(file);
+	sm->ImmediateLoadScene(file);
+	CreateRandomEntities(file, count);
+	Serialization::SaveScene(file);
+	sm->ImmediateClearScene(file);
+	std::filesystem::remove(Serialization::GetCookedScenePath(file));
+	return file;
+}
+
+static size_t PeakResidentBytes() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters{};
+	GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+	return counters.PeakWorkingSetSize;
+#else
+	rusage usage{};
+	getrusage(RUSAGE_SELF, &usage);
+	return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+// LoadScene follows "settings" until this goes out of scope
+class ScopedSceneLoadSettings {
+public:
+	explicit ScopedSceneLoadSettings(const Serialization::SceneLoadSettings& settings) : m_previous(Serialization::GetSceneLoadSettings()) {
+		Serialization::SetSceneLoadSettings(settings);
+	}
+	~ScopedSceneLoadSettings() { Serialization::SetSceneLoadSettings(m_previous); }
+
+private:
+	Serialization::SceneLoadSettings m_previous;
+};
+
+static Serialization::SceneLoadSettings StreamingLoad() {
+	Serialization::SceneLoadSettings settings;
+	settings.threadCount = 1;
+	return settings;
+}
+
+TEST(Scene, StreamingLoaderMatchesDocumentLoader) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	const std::filesystem::path file = SaveRandomScene("StreamingScene.json", 600);
+	ScopedSceneLoadSettings streaming(StreamingLoad());
+
+	ecs->sceneMap["Document"];
+	ecs->sceneMap["Stream"];
+	Serialization::LoadSceneDocument(file, "Document");
+	Serialization::LoadScene(file, "Stream");
+
+	const std::vector<EntityID> documentIDs = ecs->sceneMap.at("Document").sceneIDs;
+	const std::vector<EntityID> streamIDs = ecs->sceneMap.at("Stream").sceneIDs;
+	ASSERT_EQ(documentIDs.size(), 600u);
+	ASSERT_EQ(streamIDs.size(), documentIDs.size());
+
+	auto indexOf = [](const std::vector<EntityID>& ids, std::optional<EntityID> id) -> ptrdiff_t {
+		return id.has_value() ? std::find(ids.begin(), ids.end(), id.value()) - ids.begin() : -1;
+	};
+	for (size_t i = 0; i < documentIDs.size(); ++i) {
+		const EntityID documentID = documentIDs[i];
+		const EntityID streamID = streamIDs[i];
+		ASSERT_EQ(ecs->GetEntitySignature(documentID), ecs->GetEntitySignature(streamID)) << "entity " << i;
+		for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+			if (ecs->GetEntitySignature(documentID).test(key)) {
+				EXPECT_TRUE(ecs->componentAction.at(componentName)->Compare(documentID, streamID)) << componentName << " of entity " << i;
+			}
+		}
+		EXPECT_EQ(indexOf(documentIDs, hierachy::GetParent(documentID)), indexOf(streamIDs, hierachy::GetParent(streamID))) << "entity " << i;
+	}
+
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	sm->ImmediateClearScene("Document");
+	sm->ImmediateClearScene("Stream");
+}
+
+// peak RSS only grows, so the streaming load runs first and each load reports how far it raised it
+TEST(DeSerializeBenchmark, StreamingSceneLoad) {
+	constexpr size_t ENTITY_COUNT = 1500;
+	using Clock = std::chrono::steady_clock;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::filesystem::path file = SaveRandomScene("StreamingBenchmark.json", ENTITY_COUNT);
+	ScopedSceneLoadSettings streaming(StreamingLoad());
+
+	auto measure = [&](auto load, const std::string& scene, double& milliseconds, size_t& peakGrowth) {
+		ecs->sceneMap[scene];
+		const size_t peakBefore = PeakResidentBytes();
+		const auto start = Clock::now();
+		load(file, scene);
+		milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		peakGrowth = PeakResidentBytes() - peakBefore;
+		EXPECT_EQ(ecs->sceneMap.at(scene).sceneIDs.size(), ENTITY_COUNT);
+		sm->ImmediateClearScene(scene);
+	};
+
+	double streamMilliseconds{}, documentMilliseconds{};
+	size_t streamPeak{}, documentPeak{};
+	measure([](const std::filesystem::path& path, const std::string& scene) { Serialization::LoadScene(path, scene); }, "Stream", streamMilliseconds, streamPeak);
+	measure([](const std::filesystem::path& path, const std::string& scene) { Serialization::LoadSceneDocument(path, scene); }, "Document", documentMilliseconds, documentPeak);
+
+	std::cout << "[          ] " << ENTITY_COUNT << " entities, " << std::filesystem::file_size(file) / 1024 << " KB of JSON: streamed in "
+		<< streamMilliseconds << " ms, peak RSS +" << streamPeak / 1024 << " KB; document in " << documentMilliseconds
+		<< " ms, peak RSS +" << documentPeak / 1024 << " KB\n";
+}
+
+
+static std::string ReadWholeFile(const std::filesystem::path& path) {
+	std::ifstream file(path, std::ios::binary);
+	return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+static void WriteWholeFile(const std::filesystem::path& path, std::string_view data) {
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+static void RemoveSceneFiles(const std::filesystem::path& file) {
+	std::filesystem::remove(file);
+	std::filesystem::remove(Serialization::GetCookedScenePath(file));
+	std::filesystem::remove(Serialization::GetSceneIndexPath(file));
+}
+
+
+// what two loads of the same file made is the same entity by entity: signatures, components, parents, children in
+// order, where each component sits in its pool, and the scenes save to the same bytes
+static void ExpectSameLoad(const std::string& expectedScene, const std::string& actualScene) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	const std::vector<EntityID> expectedIDs = ecs->sceneMap.at(expectedScene).sceneIDs;
+	const std::vector<EntityID> actualIDs = ecs->sceneMap.at(actualScene).sceneIDs;
+	ASSERT_EQ(expectedIDs.size(), actualIDs.size());
+
+	auto indexOf = [](const std::vector<EntityID>& ids, std::optional<EntityID> id) -> ptrdiff_t {
+		return id.has_value() ? std::find(ids.begin(), ids.end(), id.value()) - ids.begin() : -1;
+	};
+	auto childIndices = [&](const std::vector<EntityID>& ids, EntityID id) {
+		std::vector<ptrdiff_t> indices;
+		if (const auto children = hierachy::m_GetChild(id)) {
+			for (EntityID child : children.value()) indices.push_back(indexOf(ids, child));
+		}
+		return indices;
+	};
+	for (size_t i = 0; i < expectedIDs.size(); ++i) {
+		ASSERT_EQ(ecs->GetEntitySignature(expectedIDs[i]), ecs->GetEntitySignature(actualIDs[i])) << "entity " << i;
+		for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+			if (ecs->GetEntitySignature(expectedIDs[i]).test(key)) {
+				EXPECT_TRUE(ecs->componentAction.at(componentName)->Compare(expectedIDs[i], actualIDs[i])) << componentName << " of entity " << i;
+			}
+		}
+		EXPECT_EQ(indexOf(expectedIDs, hierachy::GetParent(expectedIDs[i])), indexOf(actualIDs, hierachy::GetParent(actualIDs[i]))) << "entity " << i;
+		EXPECT_EQ(childIndices(expectedIDs, expectedIDs[i]), childIndices(actualIDs, actualIDs[i])) << "entity " << i;
+	}
+
+	// pools are dense arrays, the address of a component is its place in the pool
+	for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+		auto poolOrder = [&, &name = componentName, key = key](const std::vector<EntityID>& ids) {
+			std::vector<std::pair<ecs::Component*, size_t>> components;
+			for (size_t i = 0; i < ids.size(); ++i) {
+				if (ecs->GetEntitySignature(ids[i]).test(key)) components.emplace_back(ecs->GetIComponent<ecs::Component*>(name, ids[i]), i);
+			}
+			std::sort(components.begin(), components.end());
+			std::vector<size_t> order;
+			for (const auto& component : components) order.push_back(component.second);
+			return order;
+		};
+		EXPECT_EQ(poolOrder(expectedIDs), poolOrder(actualIDs)) << componentName;
+	}
+
+	Serialization::SaveScene(expectedScene, "ExpectedLoad.json");
+	Serialization::SaveScene(actualScene, "ActualLoad.json");
+	EXPECT_EQ(ReadWholeFile("ExpectedLoad.json"), ReadWholeFile("ActualLoad.json"));
+	std::filesystem::remove("ExpectedLoad.json");
+	std::filesystem::remove("ActualLoad.json");
+}
+
+static Serialization::SceneLoadSettings ParallelLoad(unsigned int threads, size_t minBytesPerThread = 1) {
+	Serialization::SceneLoadSettings settings;
+	settings.threadCount = threads;
+	settings.minBytesPerThread = minBytesPerThread;
+	return settings;
+}
+
+TEST(Scene, ParallelLoaderMatchesStreamingLoader) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::filesystem::path file = SaveRandomScene("ParallelScene.json", 600);
+
+	ecs->sceneMap["Stream"];
+	{
+		ScopedSceneLoadSettings streaming(StreamingLoad());
+		Serialization::LoadScene(file, "Stream");
+	}
+	for (unsigned int threads : { 2u, 7u }) {
+		ecs->sceneMap["Parallel"];
+		{
+			ScopedSceneLoadSettings parallel(ParallelLoad(threads));
+			ASSERT_TRUE(Serialization::LoadSceneParallel(file, "Parallel", Serialization::GetSceneLoadSettings()));
+		}
+		ASSERT_EQ(ecs->sceneMap.at("Parallel").sceneIDs.size(), 600u);
+		ExpectSameLoad("Stream", "Parallel");
+		sm->ImmediateClearScene("Parallel");
+	}
+
+	sm->ImmediateClearScene("Stream");
+	RemoveSceneFiles(file);
+}
+
+// records split between workers anywhere, holding what the streaming loader reads in its own way: empty entities, the
+// first of two equal keys, unknown components, components after the children, a component added with another before
+// its own key, and scene data the file starts with
+TEST(Scene, ParallelLoaderMatchesStreamingLoaderOnOddRecords) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string file = "ParallelOddRecords.json";
+	WriteWholeFile(file, R"([
+		{"SceneData":{"ambientIntensity":0.25}},
+		{},
+		{"NameComponent":{"entityName":"first"},"NameComponent":{"entityName":"second"},"Unknown":{"value":1},
+		 "children":[{"TransformComponent":{}},{}],"LightComponent":{}},
+		{"SkinnedMeshRendererComponent":{},"AnimatorComponent":{}},
+		{"children":[{"children":[{"NameComponent":{"entityName":"deep"}}]}],"children":[{}]},
+		{"NameComponent":{"entityName":"child scene data"},"children":[{"SceneData":{"ambientIntensity":4.0}}]},
+		{"SceneData":{"ambientIntensity":9.0}}
+	])");
+
+	for (unsigned int threads : { 2u, 3u, 16u }) {
+		ecs->sceneMap["Stream"];
+		ecs->sceneMap["Parallel"];
+		{
+			ScopedSceneLoadSettings streaming(StreamingLoad());
+			Serialization::LoadScene(file, "Stream");
+		}
+		{
+			ScopedSceneLoadSettings parallel(ParallelLoad(threads));
+			ASSERT_TRUE(Serialization::LoadSceneParallel(file, "Parallel", Serialization::GetSceneLoadSettings()));
+		}
+		EXPECT_FLOAT_EQ(ecs->sceneMap.at("Parallel").ambientIntensity, 0.25f);
+		ASSERT_EQ(ecs->sceneMap.at("Parallel").sceneIDs.size(), 10u);
+		ExpectSameLoad("Stream", "Parallel");
+		sm->ImmediateClearScene("Stream");
+		sm->ImmediateClearScene("Parallel");
+	}
+	std::filesystem::remove(file);
+}
+
+// prefab instances, damaged files and files saved at older versions are left to the streaming loader untouched
+TEST(Scene, ParallelLoaderLeavesOtherFilesToStreaming) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	const std::string file = "ParallelFallback.json";
+	ecs->sceneMap["Parallel"];
+	for (const char* json : {
+		R"([{"NameComponent":{}},{"prefab":"Missing.prefab"}])",
+		R"([{"NameComponent":{}},{"NameComponent":{"entityName":}}])",
+		R"([{"NameComponent":{}}{"NameComponent":{}}])",
+		R"([{"NameComponent":{}},{"NameComponent":{}}] trailing)",
+		R"([{"SceneData":{},"schemaVersions":{"NameComponent":0}},{"NameComponent":{}}])" }) {
+		WriteWholeFile(file, json);
+		EXPECT_FALSE(Serialization::LoadSceneParallel(file, "Parallel", ParallelLoad(4))) << json;
+		EXPECT_TRUE(ecs->sceneMap.at("Parallel").sceneIDs.empty()) << json;
+	}
+	ecs->sceneMap.erase("Parallel");
+	std::filesystem::remove(file);
+}
+
+// the speedup of the two phase load over streaming, the best of a few loads at each thread count. Both phases share
+// the file: the staging is what spreads over the workers, the commit into the pools stays on the calling thread
+TEST(DeSerializeBenchmark, ParallelSceneLoad) {
+	constexpr size_t ENTITY_COUNT = 1800;
+	constexpr int RUNS = 3;
+	using Clock = std::chrono::steady_clock;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::filesystem::path file = SaveRandomScene("ParallelBenchmark.json", ENTITY_COUNT);
+
+	auto bestOf = [&](const Serialization::SceneLoadSettings& settings) {
+		ScopedSceneLoadSettings scoped(settings);
+		double best = std::numeric_limits<double>::max();
+		for (int run = 0; run < RUNS; ++run) {
+			ecs->sceneMap["Benchmark"];
+			const auto start = Clock::now();
+			Serialization::LoadScene(file, "Benchmark");
+			best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+			EXPECT_EQ(ecs->sceneMap.at("Benchmark").sceneIDs.size(), ENTITY_COUNT);
+			sm->ImmediateClearScene("Benchmark");
+		}
+		return best;
+	};
+
+	const double streamMilliseconds = bestOf(StreamingLoad());
+	std::cout << "[          ] " << ENTITY_COUNT << " entities, " << std::filesystem::file_size(file) / 1024 << " KB of JSON on "
+		<< std::thread::hardware_concurrency() << " hardware threads: streamed in " << streamMilliseconds << " ms\n";
+	for (unsigned int threads : { 4u, 8u, 16u }) {
+		const double milliseconds = bestOf(ParallelLoad(threads, Serialization::SceneLoadSettings{}.minBytesPerThread));
+		std::cout << "[          ] " << threads << " threads: " << milliseconds << " ms, " << streamMilliseconds / milliseconds << "x\n";
+	}
+	RemoveSceneFiles(file);
+}
+
+// staged on another thread and committed a few steps at a time, with the ECS free to run between the steps, a scene ends
+// up as the streaming loader leaves it
+TEST(Scene, StagedSceneCommitsInSteps) {
+	constexpr size_t STEPS = 7;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::filesystem::path file = SaveRandomScene("StagedScene.json", 300);
+
+	ecs->sceneMap["Stream"];
+	{
+		ScopedSceneLoadSettings streaming(StreamingLoad());
+		Serialization::LoadScene(file, "Stream");
+	}
+	for (unsigned int threads : { 1u, 3u }) {
+		auto staging = std::async(std::launch::async, Serialization::StageScene, file, ParallelLoad(threads));
+		const std::shared_ptr<Serialization::StagedScene> staged = staging.get();
+		ASSERT_TRUE(staged);
+
+		ecs->sceneMap["Staged"];
+		size_t calls = 0, entities = 0;
+		while (!Serialization::IsCommitted(*staged)) {
+			EXPECT_LE(Serialization::CommitStagedScene(*staged, "Staged", STEPS), STEPS);
+			EXPECT_GE(ecs->sceneMap.at("Staged").sceneIDs.size(), entities);
+			entities = ecs->sceneMap.at("Staged").sceneIDs.size();
+			++calls;
+		}
+		EXPECT_GT(calls, 300 / STEPS);
+		EXPECT_EQ(Serialization::CommitStagedScene(*staged, "Staged", STEPS), 0u);
+		ExpectSameLoad("Stream", "Staged");
+		sm->ImmediateClearScene("Staged");
+	}
+	sm->ImmediateClearScene("Stream");
+	RemoveSceneFiles(file);
+
+	const std::string prefabFile = "StagedPrefabInstance.json";
+	WriteWholeFile(prefabFile, R"([{"NameComponent":{}},{"prefab":"Missing.prefab"}])");
+	EXPECT_FALSE(Serialization::StageScene(prefabFile, ParallelLoad(1)));
+	std::filesystem::remove(prefabFile);
+}
+
+// a level of 400 cells partitioned and walked through, every row there and back, its cells staged on background
+// threads and committed a few steps per frame. Every frame the cells loading and loaded stay within the memory budget,
+// the cell scenes loaded are the ones the partition holds and each loaded cell has all its entities
+TEST(WorldPartition, SoakStreamingPartitionedLevel) {
+	constexpr int GRID = 20;
+	constexpr float CELL_SIZE = 10.f;
+	constexpr size_t ENTITIES_PER_CELL = 3;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string level = "StreamingLevel.json";
+	const std::filesystem::path layoutPath = "StreamingLevel.partition";
+	RemoveSceneFiles(level);
+	ASSERT_TRUE(sm->ImmediateLoadScene(level));
+
+	// a root with a light under it and another root, in every cell
+	auto place = [&](EntityID id, const glm::vec3& position) {
+		TransformComponent* transform = ecs->GetComponent<TransformComponent>(id);
+		transform->LocalTransformation.position = position;
+		transform->WorldTransformation.position = position;
+	};
+	for (int z = 0; z < GRID; ++z) {
+		for (int x = 0; x < GRID; ++x) {
+			const EntityID root = ecs->CreateEntity(level);
+			place(root, { x * CELL_SIZE + 2.f, 0.f, z * CELL_SIZE + 3.f });
+			const EntityID light = ecs->CreateEntity(level);
+			hierachy::m_SetParent(root, light);
+			ecs->AddComponent<LightComponent>(light)->intesnity = static_cast<float>(x + z);
+			place(ecs->CreateEntity(level), { x * CELL_SIZE + 7.f, 0.f, z * CELL_SIZE + 8.f });
+		}
+	}
+	const std::vector<EntityID> levelOrder = ecs->sceneMap.at(level).sceneIDs;
+	ASSERT_TRUE(sm->PartitionScene(level, CELL_SIZE, layoutPath));
+	EXPECT_EQ(ecs->sceneMap.at(level).sceneIDs, levelOrder);
+	sm->ImmediateClearScene(level);
+
+	const scenes::WorldPartitionLayout layout = Serialization::ReadJsonFile<scenes::WorldPartitionLayout>(layoutPath.string());
+	ASSERT_EQ(layout.cells.size(), static_cast<size_t>(GRID * GRID));
+	size_t largestCell = 0;
+	for (const auto& cell : layout.cells) largestCell = std::max(largestCell, static_cast<size_t>(cell.bytes));
+
+	scenes::StreamingSettings settings;
+	settings.loadRadius = 15.f;
+	settings.unloadRadius = 35.f;
+	settings.memoryBudget = 24 * largestCell;
+	settings.maxLoadsInFlight = 4;
+	settings.commitBudget = 10;
+	const size_t baseline = ecs->GetEntitySignatureData().size();
+	const size_t peakBefore = PeakResidentBytes();
+	ASSERT_TRUE(sm->OpenWorldPartition(layoutPath, settings));
+	const scenes::WorldPartition& partition = sm->GetWorldPartition();
+
+	auto cellIsScene = [&](size_t cell) { return ecs->sceneMap.find(sm->GetCellScene(cell)) != ecs->sceneMap.end(); };
+	auto checkFrame = [&](size_t frame) {
+		ASSERT_LE(partition.GetResidentBytes(), settings.memoryBudget) << "frame " << frame;
+		size_t resident = 0;
+		for (size_t cell = 0; cell < partition.GetCellCount(); ++cell) {
+			const scenes::CellState state = partition.GetState(cell);
+			if (state == scenes::CellState::UNLOADED) {
+				ASSERT_FALSE(cellIsScene(cell)) << "frame " << frame;
+				continue;
+			}
+			++resident;
+			if (state == scenes::CellState::LOADED) {
+				ASSERT_TRUE(cellIsScene(cell)) << "frame " << frame;
+				ASSERT_EQ(ecs->sceneMap.at(sm->GetCellScene(cell)).sceneIDs.size(), ENTITIES_PER_CELL) << "frame " << frame;
+			}
+		}
+		ASSERT_LE(ecs->GetEntitySignatureData().size(), baseline + resident * ENTITIES_PER_CELL) << "frame " << frame;
+	};
+
+	// frames of a tenth of a millisecond, the staging threads get what the walk leaves them
+	std::vector<bool> everLoaded(partition.GetCellCount());
+	glm::vec3 position{};
+	size_t frame = 0, peakBytes = 0;
+	for (int row = 0; row < GRID * 2; ++row) {
+		for (int step = 0; step <= GRID * static_cast<int>(CELL_SIZE); ++step, ++frame) {
+			const float x = row % 2 == 0 ? static_cast<float>(step) : GRID * CELL_SIZE - step;
+			position = { std::clamp(x, 0.5f, GRID * CELL_SIZE - 0.5f), 0.f, row * CELL_SIZE * 0.5f + 2.5f };
+			sm->UpdateStreaming({ scenes::StreamingSource{ position } });
+			checkFrame(frame);
+			if (HasFatalFailure()) {
+				row = GRID * 2;
+				break;
+			}
+			for (size_t cell : partition.GetResidentCells()) {
+				if (partition.GetState(cell) == scenes::CellState::LOADED) everLoaded[cell] = true;
+			}
+			peakBytes = std::max(peakBytes, partition.GetResidentBytes());
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+	}
+	EXPECT_TRUE(std::all_of(everLoaded.begin(), everLoaded.end(), [](bool loaded) { return loaded; }));
+
+	// standing still, what is loading finishes
+	for (int wait = 0; wait < 1000 && partition.GetLoadsInFlight() > 0; ++wait, ++frame) {
+		sm->UpdateStreaming({ scenes::StreamingSource{ position } });
+		checkFrame(frame);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(partition.GetState(partition.FindCell(position)), scenes::CellState::LOADED);
+	std::cout << "[          ] " << frame << " frames, cells held at most " << peakBytes / 1024 << " of "
+		<< settings.memoryBudget / 1024 << " KB, peak RSS grew " << (PeakResidentBytes() - peakBefore) / 1024 << " KB\n";
+
+	sm->CloseWorldPartition();
+	EXPECT_EQ(ecs->GetEntitySignatureData().size(), baseline);
+	for (const auto& cell : layout.cells) {
+		EXPECT_EQ(ecs->sceneMap.find(cell.scene), ecs->sceneMap.end());
+		RemoveSceneFiles(cell.scene);
+	}
+	std::filesystem::remove(layoutPath);
+	RemoveSceneFiles(level);
+}
+
+// roots with nothing dirty under them keep the bytes of the last save, the file still has to come out as a full save writes it
+TEST(Scene, IncrementalSaveMatchesFullSave) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string file = "IncrementalScene.json";
+	const std::string fullFile = "IncrementalSceneFull.json";
+	RemoveSceneFiles(file);
+	ASSERT_TRUE(sm->ImmediateLoadScene(file));
+	std::vector<EntityID> ids = CreateRandomEntities(file, 300);
+	Serialization::SaveScene(file);
+
+	ecs->AddComponent<LightComponent>(ids[10]);
+	ecs->GetComponent<NameComponent>(ids[20])->entityName = "renamed";
+	ecs->MarkDirty(ids[20]);
+	ecs->RemoveComponent<NameComponent>(ids[25]);
+	hierachy::m_SetParent(ids[30], ids[31]);
+	hierachy::m_RemoveParent(ids[299]);
+	ecs->DeleteEntity(ids[50]);
+	const EntityID added = ecs->CreateEntity(file);
+	Serialization::SaveScene(file);
+	const std::string incremental = ReadWholeFile(file);
+	EXPECT_NE(incremental.find("renamed"), std::string::npos);
+
+	// an edit nobody marked is trusted away by default, and found by a save that verifies the clean roots
+	ecs->GetComponent<NameComponent>(added)->entityName = "unmarked";
+	Serialization::SaveScene(file);
+	EXPECT_EQ(ReadWholeFile(file), incremental);
+	Serialization::JsonSaveOptions verify;
+	verify.verifyCleanRoots = true;
+	Serialization::SaveScene(file, {}, verify);
+	EXPECT_NE(ReadWholeFile(file).find("unmarked"), std::string::npos);
+
+	ecs->GetComponent<NameComponent>(added)->entityName = NameComponent{}.entityName;
+	Serialization::SaveScene(file, {}, verify);
+	EXPECT_EQ(ReadWholeFile(file), incremental);
+	Serialization::SaveScene(file, fullFile);
+	EXPECT_EQ(ReadWholeFile(fullFile), incremental);
+
+	// and it loads back as the scene it was saved from
+	const size_t entityCount = ecs->sceneMap.at(file).sceneIDs.size();
+	ecs->sceneMap["Reloaded"];
+	Serialization::LoadSceneDocument(file, "Reloaded");
+	EXPECT_EQ(ecs->sceneMap.at("Reloaded").sceneIDs.size(), entityCount);
+
+	sm->ImmediateClearScene("Reloaded");
+	sm->ImmediateClearScene(file);
+	RemoveSceneFiles(file);
+	RemoveSceneFiles(fullFile);
+}
+
+// "root" and its children, depth first
+static std::vector<EntityID> Subtree(EntityID root) {
+	std::vector<EntityID> ids{ root };
+	for (size_t i = 0; i < ids.size(); ++i) {
+		const auto children = hierachy::m_GetChild(ids[i]);
+		if (children.has_value()) ids.insert(ids.begin() + i + 1, children->begin(), children->end());
+	}
+	return ids;
+}
+
+// the two subtrees have the same shape and equal components entity by entity
+static void ExpectSameSubtree(EntityID expected, EntityID actual) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	const std::vector<EntityID> expectedIDs = Subtree(expected);
+	const std::vector<EntityID> actualIDs = Subtree(actual);
+	ASSERT_EQ(expectedIDs.size(), actualIDs.size());
+
+	auto indexOf = [](const std::vector<EntityID>& ids, std::optional<EntityID> id) -> ptrdiff_t {
+		return id.has_value() ? std::find(ids.begin(), ids.end(), id.value()) - ids.begin() : -1;
+	};
+	for (size_t i = 0; i < expectedIDs.size(); ++i) {
+		ASSERT_EQ(ecs->GetEntitySignature(expectedIDs[i]), ecs->GetEntitySignature(actualIDs[i])) << "entity " << i;
+		for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+			if (ecs->GetEntitySignature(expectedIDs[i]).test(key)) {
+				EXPECT_TRUE(ecs->componentAction.at(componentName)->Compare(expectedIDs[i], actualIDs[i])) << componentName << " of entity " << i;
+			}
+		}
+		if (i > 0) {
+			EXPECT_EQ(indexOf(expectedIDs, hierachy::GetParent(expectedIDs[i])), indexOf(actualIDs, hierachy::GetParent(actualIDs[i]))) << "entity " << i;
+		}
+	}
+}
+
+// a prefab file of "count" random entities under one root
+static std::filesystem::path SaveRandomPrefab(const std::string& file, size_t count) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	RemoveSceneFiles(file);
+	sm->ImmediateLoadScene(file);
+	const EntityID root = ecs->CreateEntity(file);
+	for (EntityID id : CreateRandomEntities(file, count - 1)) {
+		if (!hierachy::GetParent(id).has_value()) hierachy::m_SetParent(root, id);
+	}
+	Serialization::SaveScene(file);
+	sm->ImmediateClearScene(file);
+	std::filesystem::remove(Serialization::GetCookedScenePath(file));
+	return file;
+}
+
+TEST(Entity, DuplicateEntityCopiesComponents) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string scene = "Duplicate Scene";
+	sm->ImmediateLoadScene(scene);
+
+	for (EntityID id : CreateRandomEntities(scene, 60)) {
+		if (!hierachy::GetParent(id).has_value()) {
+			ExpectSameSubtree(id, ecs->DuplicateEntity(id));
+		}
+	}
+
+	sm->ImmediateClearScene(scene);
+}
+
+TEST(Prefab, TemplateMatchesLoadedPrefab) {
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	ComponentRegistry::SetSceneInstance(sm);
+	const std::string scene = "Prefab Scene";
+	const auto file = SaveRandomPrefab("TemplatePrefab.json", 40);
+	sm->ImmediateLoadScene(scene);
+
+	// the first instance is loaded from the file, the rest are cloned from its template
+	R_Prefab prefab("TemplatePrefab", file);
+	const int loaded = prefab.DuplicatePrefabIntoScene(scene);
+	const int cloned = prefab.DuplicatePrefabIntoScene(scene);
+	ASSERT_GE(loaded, 0);
+	ASSERT_GE(cloned, 0);
+	EXPECT_NE(loaded, cloned);
+	ExpectSameSubtree(static_cast<EntityID>(loaded), static_cast<EntityID>(cloned));
+	EXPECT_EQ(Subtree(static_cast<EntityID>(cloned)).size(), 40u);
+
+	sm->ImmediateClearScene(scene);
+	RemoveSceneFiles(file);
+}
+
+// MaxEntity only fits a few thousand entities at once, so each instance is deleted once spawned
+TEST(DeSerializeBenchmark, PrefabInstancesPerSecond) {
+	constexpr size_t INSTANCE_COUNT = 1000;
+	constexpr size_t LOADED_COUNT = 50;
+	constexpr size_t PREFAB_SIZE = 20;
+	using Clock = std::chrono::steady_clock;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	ComponentRegistry::SetSceneInstance(sm);
+	const std::string scene = "Prefab Benchmark";
+	const auto file = SaveRandomPrefab("BenchmarkPrefab.json", PREFAB_SIZE);
+	sm->ImmediateLoadScene(scene);
+
+	// reading the prefab file for every instance
+	auto start = Clock::now();
+	for (size_t i = 0; i < LOADED_COUNT; ++i) {
+		R_Prefab prefab("BenchmarkPrefab", file);
+		const int root = prefab.DuplicatePrefabIntoScene(scene);
+		ASSERT_GE(root, 0);
+		ecs->DeleteEntity(static_cast<EntityID>(root));
+	}
+	const double loadedSeconds = std::chrono::duration<double>(Clock::now() - start).count() / LOADED_COUNT;
+
+	R_Prefab prefab("BenchmarkPrefab", file);
+	ecs->DeleteEntity(static_cast<EntityID>(prefab.DuplicatePrefabIntoScene(scene)));
+	start = Clock::now();
+	for (size_t i = 0; i < INSTANCE_COUNT; ++i) {
+		const int root = prefab.DuplicatePrefabIntoScene(scene);
+		ASSERT_GE(root, 0);
+		ecs->DeleteEntity(static_cast<EntityID>(root));
+	}
+	const double clonedSeconds = std::chrono::duration<double>(Clock::now() - start).count() / INSTANCE_COUNT;
+
+	EXPECT_GT(1.0 / clonedSeconds, 1000.0);
+	EXPECT_LT(clonedSeconds, loadedSeconds);
+	std::cout << "[          ] " << PREFAB_SIZE << " entity prefab, " << 1.0 / loadedSeconds << " loaded instances per second, "
+		<< 1.0 / clonedSeconds << " cloned from its template\n";
+
+	sm->ImmediateClearScene(scene);
+	RemoveSceneFiles(file);
+}
+
+// a prefab of "count" random entities, loaded as prefab::LoadPrefab leaves it
+static EntityID LoadRandomPrefab(const std::string& file, size_t count) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	sm->ImmediateLoadScene(SaveRandomPrefab(file, count));
+
+	SceneData& prefabData = ecs->sceneMap.at(file);
+	prefabData.isPrefab = true;
+	prefabData.isActive = false;
+	for (EntityID id : prefabData.sceneIDs) {
+		if (!hierachy::GetParent(id).has_value()) {
+			prefabData.prefabID = id;
+			break;
+		}
+	}
+	NameComponent* nc = ecs->GetComponent<NameComponent>(prefabData.prefabID);
+	nc->isPrefab = true;
+	nc->prefabName = file;
+	Serialization::FindPrefabSource(file);
+	return prefabData.prefabID;
+}
+
+// an instance as prefab::m_CreatePrefab makes one, every entity named after the prefab
+static EntityID InstantiatePrefab(EntityID source, const std::string& prefab, const std::string& scene) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	const EntityID root = ecs->InstantiateTemplate(ecs->CaptureTemplate(source), scene);
+	for (EntityID id : Subtree(root)) {
+		NameComponent* nc = ecs->GetComponent<NameComponent>(id);
+		nc->isPrefab = true;
+		nc->prefabName = prefab;
+	}
+	return root;
+}
+
+static std::vector<EntityID> SceneRoots(const std::string& scene) {
+	std::vector<EntityID> roots;
+	for (EntityID id : ComponentRegistry::GetECSInstance()->sceneMap.at(scene).sceneIDs) {
+		if (!hierachy::GetParent(id).has_value()) roots.push_back(id);
+	}
+	return roots;
+}
+
+// instances are saved as what they override and come back as they were, through both loaders
+TEST(Prefab, OverridesRoundTrip) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string prefab = "OverridePrefab.prefab";
+	const std::string level = "OverrideLevel.json";
+	const EntityID source = LoadRandomPrefab(prefab, 12);
+	RemoveSceneFiles(level);
+	sm->ImmediateLoadScene(level);
+
+	std::vector<EntityID> instances;
+	for (int i = 0; i < 4; ++i) {
+		instances.push_back(InstantiatePrefab(source, prefab, level));
+	}
+	// untouched, moved and renamed, a child losing and gaining components, and under an entity of the level
+	ecs->GetComponent<TransformComponent>(instances[1])->LocalTransformation.position = { 1.0f, 2.0f, 3.0f };
+	ecs->GetComponent<NameComponent>(instances[1])->entityName = "Moved";
+	const std::vector<EntityID> children = Subtree(instances[2]);
+	const auto removed = std::find_if(children.begin(), children.end(), [&](EntityID id) { return ecs->HasComponent<MeshRendererComponent>(id); });
+	ASSERT_NE(removed, children.end());
+	ecs->RemoveComponent<MeshRendererComponent>(*removed);
+	ecs->AddComponent<SphereColliderComponent>(children.back())->isTrigger = true;
+	ecs->GetComponent<NameComponent>(children.back())->entityTag = "Changed";
+	hierachy::m_SetParent(ecs->CreateEntity(level), instances[3]);
+
+	Serialization::SaveScene(level);
+	const std::string saved = ReadWholeFile(level);
+	EXPECT_NE(saved.find("\"prefab\""), std::string::npos);
+	EXPECT_NE(saved.find("\"removed\""), std::string::npos);
+	EXPECT_FALSE(std::filesystem::exists(Serialization::GetCookedScenePath(level)));
+
+	// what the level held, kept while it is loaded again
+	const std::string expectedScene = "Override Expected";
+	ecs->sceneMap[expectedScene];
+	std::vector<EntityID> expected;
+	for (EntityID root : SceneRoots(level)) {
+		expected.push_back(ecs->DuplicateEntity(root, expectedScene));
+	}
+	sm->ImmediateClearScene(level);
+
+	sm->ImmediateLoadScene(level);
+	const std::vector<EntityID> streamed = SceneRoots(level);
+	ASSERT_EQ(streamed.size(), expected.size());
+	for (size_t i = 0; i < expected.size(); ++i) {
+		ExpectSameSubtree(expected[i], streamed[i]);
+	}
+
+	ecs->sceneMap["Override Document"];
+	Serialization::LoadSceneDocument(level, "Override Document");
+	const std::vector<EntityID> document = SceneRoots("Override Document");
+	ASSERT_EQ(document.size(), expected.size());
+	for (size_t i = 0; i < expected.size(); ++i) {
+		ExpectSameSubtree(expected[i], document[i]);
+	}
+
+	sm->ImmediateClearScene("Override Document");
+	sm->ImmediateClearScene(expectedScene);
+	sm->ImmediateClearScene(level);
+	sm->ImmediateClearScene(prefab);
+	RemoveSceneFiles(level);
+	RemoveSceneFiles(prefab);
+}
+
+// prefab edits reach every member an instance did not override, in place and when a level is loaded again
+TEST(Prefab, EditsReachUnmodifiedFields) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string prefab = "PropagatePrefab.prefab";
+	const std::string level = "PropagateLevel.json";
+	const EntityID source = LoadRandomPrefab(prefab, 6);
+	RemoveSceneFiles(level);
+	sm->ImmediateLoadScene(level);
+
+	const EntityID untouched = InstantiatePrefab(source, prefab, level);
+	const EntityID renamed = InstantiatePrefab(source, prefab, level);
+	ecs->GetComponent<NameComponent>(renamed)->entityName = "Mine";
+
+	ecs->GetComponent<NameComponent>(source)->entityName = "Edited";
+	ecs->GetComponent<NameComponent>(Subtree(source).back())->entityTag = "Edited Tag";
+	ASSERT_TRUE(Serialization::PropagatePrefab(prefab));
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(untouched)->entityName, "Edited");
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(renamed)->entityName, "Mine");
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(Subtree(untouched).back())->entityTag, "Edited Tag");
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(Subtree(renamed).back())->entityTag, "Edited Tag");
+
+	// a prefab that gained an entity leaves its instances to the editor
+	const EntityID added = ecs->CreateEntity(prefab);
+	hierachy::m_SetParent(source, added);
+	EXPECT_FALSE(Serialization::PropagatePrefab(prefab));
+	ecs->DeleteEntity(added);
+	EXPECT_FALSE(Serialization::PropagatePrefab(prefab));
+
+	Serialization::SaveScene(level);
+	sm->ImmediateClearScene(level);
+	ecs->GetComponent<NameComponent>(source)->entityName = "Edited Again";
+	sm->ImmediateLoadScene(level);
+	const std::vector<EntityID> roots = SceneRoots(level);
+	ASSERT_EQ(roots.size(), 2u);
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(roots[0])->entityName, "Edited Again");
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(roots[1])->entityName, "Mine");
+
+	sm->ImmediateClearScene(level);
+	sm->ImmediateClearScene(prefab);
+	RemoveSceneFiles(level);
+	RemoveSceneFiles(prefab);
+}
+
+// the size of a level made of prefab instances, saved whole and saved as overrides
+TEST(DeSerializeBenchmark, PrefabInstanceSceneSize) {
+	constexpr size_t INSTANCE_COUNT = 80;
+	constexpr size_t PREFAB_SIZE = 20;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string prefab = "SizePrefab.prefab";
+	const std::string level = "SizeLevel.json";
+	const std::string fullLevel = "SizeLevelFull.json";
+	const EntityID source = LoadRandomPrefab(prefab, PREFAB_SIZE);
+	RemoveSceneFiles(level);
+	RemoveSceneFiles(fullLevel);
+	sm->ImmediateLoadScene(level);
+
+	// every instance placed on its own, every fourth with a child renamed
+	for (size_t i = 0; i < INSTANCE_COUNT; ++i) {
+		const EntityID root = InstantiatePrefab(source, prefab, level);
+		ecs->GetComponent<TransformComponent>(root)->LocalTransformation.position = { static_cast<float>(i), 0.0f, static_cast<float>(i % 7) };
+		if (i % 4 == 0) ecs->GetComponent<NameComponent>(Subtree(root)[i % PREFAB_SIZE])->entityName = "Instance " + std::to_string(i);
+	}
+
+	Serialization::SaveScene(level);
+	// without the prefab loaded every instance is saved whole
+	sm->ImmediateClearScene(prefab);
+	Serialization::SaveScene(level, fullLevel);
+
+	const size_t overrideSize = std::filesystem::file_size(level);
+	const size_t fullSize = std::filesystem::file_size(fullLevel);
+	EXPECT_LT(overrideSize * 4, fullSize);
+	std::cout << "[          ] " << INSTANCE_COUNT << " instances of a " << PREFAB_SIZE << " entity prefab: saved whole "
+		<< fullSize / 1024 << " KB, as overrides " << overrideSize / 1024 << " KB ("
+		<< 100.0 - 100.0 * static_cast<double>(overrideSize) / static_cast<double>(fullSize) << "% smaller)\n";
+
+	sm->ImmediateClearScene(level);
+	RemoveSceneFiles(level);
+	RemoveSceneFiles(fullLevel);
+	RemoveSceneFiles(prefab);
+}
+
+// a save cut short must never cost the scene that was on disk before it
+TEST(Scene, SaveSurvivesTruncatedWrites) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string file = "TruncatedScene.json";
+	RemoveSceneFiles(file);
+	ASSERT_TRUE(sm->ImmediateLoadScene(file));
+	CreateRandomEntities(file, 200);
+	Serialization::SaveScene(file);
+	const std::string saved = ReadWholeFile(file);
+	const size_t entityCount = ecs->sceneMap.at(file).sceneIDs.size();
+	std::filesystem::remove(Serialization::GetCookedScenePath(file));
+
+	const std::vector<size_t> cuts = { 0, 1, saved.size() / 3, saved.size() / 2, saved.size() - 1 };
+
+	// a save killed while it writes: the temporary file is cut, the scene, its index and snapshot stay as they were
+	CreateRandomEntities(file, 50);
+	for (size_t cut : cuts) {
+		Serialization::SetWriteFileCut(cut);
+		Serialization::SaveScene(file);
+		Serialization::SetWriteFileCut(std::nullopt);
+		EXPECT_EQ(std::filesystem::file_size(file + ".tmp"), cut) << "cut at " << cut;
+		EXPECT_EQ(ReadWholeFile(file), saved) << "cut at " << cut;
+
+		ecs->sceneMap["Check"];
+		Serialization::LoadScene(file, "Check");
+		EXPECT_EQ(ecs->sceneMap.at("Check").sceneIDs.size(), entityCount) << "cut at " << cut;
+		sm->ImmediateClearScene("Check");
+	}
+
+	// the edits were not lost with the save, the next one writes them
+	Serialization::SaveScene(file);
+	EXPECT_FALSE(std::filesystem::exists(file + ".tmp"));
+	ecs->sceneMap["Check"];
+	Serialization::LoadScene(file, "Check");
+	const size_t editedCount = ecs->sceneMap.at(file).sceneIDs.size();
+	EXPECT_EQ(ecs->sceneMap.at("Check").sceneIDs.size(), editedCount);
+	sm->ImmediateClearScene("Check");
+	const std::string edited = ReadWholeFile(file);
+	std::filesystem::remove(Serialization::GetCookedScenePath(file));
+
+	// the scene file itself cut short, by a tool that writes in place: it no longer matches the index, so the next save writes it all
+	for (size_t cut : cuts) {
+		WriteWholeFile(file, std::string_view(edited).substr(0, cut));
+		Serialization::SaveScene(file);
+		EXPECT_EQ(ReadWholeFile(file), edited) << "cut at " << cut;
+	}
+	EXPECT_FALSE(std::filesystem::exists(file + ".tmp"));
+
+	// a cut index is ignored, the scene still loads whole
+	const std::string index = ReadWholeFile(Serialization::GetSceneIndexPath(file));
+	for (size_t cut : { size_t{ 0 }, index.size() / 2, index.size() - 1 }) {
+		WriteWholeFile(Serialization::GetSceneIndexPath(file), std::string_view(index).substr(0, cut));
+		ecs->sceneMap["Check"];
+		Serialization::LoadScene(file, "Check");
+		EXPECT_EQ(ecs->sceneMap.at("Check").sceneIDs.size(), editedCount) << "index cut at " << cut;
+		sm->ImmediateClearScene("Check");
+	}
+
+	sm->ImmediateClearScene(file);
+	RemoveSceneFiles(file);
+}
+
+// a save with the records of the last one writes again only the roots marked dirty, so what it costs over a save with
+// nothing to write follows the edits and not the scene. That floor is the file written whole, it grows with the bytes
+TEST(DeSerializeBenchmark, IncrementalSceneSave) {
+	constexpr size_t SMALL_SCENE = 400;
+	constexpr size_t LARGE_SCENE = 1600;
+	constexpr size_t FEW_EDITS = 10;
+	constexpr size_t MANY_EDITS = 200;
+	using Clock = std::chrono::steady_clock;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string file = "IncrementalBenchmark.json";
+	const std::string fullFile = "IncrementalBenchmarkFull.json";
+
+	struct Timings {
+		double full{};
+		double unchanged{};
+		double fewEdits{};
+		double manyEdits{};
+	};
+	auto measure = [&](size_t entityCount) {
+		RemoveSceneFiles(file);
+		EXPECT_TRUE(sm->ImmediateLoadScene(file));
+		const std::vector<EntityID> ids = CreateRandomEntities(file, entityCount);
+		Serialization::SaveScene(file);
+
+		// the fastest of a few saves, each after editing entities spread over the scene
+		auto timeSave = [&](size_t editCount, const std::string& target) {
+			double fastest = std::numeric_limits<double>::max();
+			for (int run = 0; run < 5; ++run) {
+				Serialization::SaveScene(file);
+				for (size_t i = 0; i < editCount; ++i) {
+					const EntityID id = ids[i * (entityCount / editCount)];
+					ecs->GetComponent<TransformComponent>(id)->LocalTransformation.position.x += 1.f;
+					ecs->MarkDirty(id);
+				}
+				const auto start = Clock::now();
+				Serialization::SaveScene(file, target);
+				fastest = std::min(fastest, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+			}
+			return fastest;
+		};
+
+		// another file has no records of this scene, so it is written whole
+		Timings timings;
+		timings.full = timeSave(0, fullFile);
+		timings.unchanged = timeSave(0, "");
+		timings.fewEdits = timeSave(FEW_EDITS, "");
+		timings.manyEdits = timeSave(MANY_EDITS, "");
+
+		std::cout << "[          ] " << entityCount << " entities, full save " << timings.full << " ms, nothing edited "
+			<< timings.unchanged << " ms, " << FEW_EDITS << " edited " << timings.fewEdits << " ms, " << MANY_EDITS
+			<< " edited " << timings.manyEdits << " ms\n";
+
+		sm->ImmediateClearScene(file);
+		RemoveSceneFiles(file);
+		RemoveSceneFiles(fullFile);
+		return timings;
+	};
+
+	const Timings small = measure(SMALL_SCENE);
+	const Timings large = measure(LARGE_SCENE);
+
+	EXPECT_LT(small.fewEdits, small.manyEdits);
+	EXPECT_LT(large.fewEdits, large.manyEdits);
+	EXPECT_LT(large.manyEdits, large.full);
+	// a few edits in four times the scene cost less over the floor than many edits in the small one
+	EXPECT_LT(large.fewEdits - large.unchanged, small.manyEdits - small.unchanged);
+}
+
+
+// every style loads back to the same components, through both loaders
+TEST(Scene, CompactSaveLoadsAsPretty) {
+	constexpr size_t ENTITY_COUNT = 400;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::string file = "CompactScene.json";
+	const std::vector<std::pair<std::string, Serialization::JsonSaveOptions>> saves = {
+		{ "CompactScenePretty.json", {} },
+		{ "CompactSceneCompact.json", { Serialization::JsonStyle::COMPACT, false } },
+		{ "CompactSceneCompressed.json", Serialization::RUNTIME_SAVE },
+		{ "CompactScenePrettyCompressed.json", { Serialization::JsonStyle::PRETTY, true } },
+	};
+	RemoveSceneFiles(file);
+	ASSERT_TRUE(sm->ImmediateLoadScene(file));
+	CreateRandomEntities(file, ENTITY_COUNT);
+	for (const auto& [target, options] : saves) {
+		Serialization::SaveScene(file, target, options);
+		// loads read the JSON, not the cooked copy
+		std::filesystem::remove(Serialization::GetCookedScenePath(target));
+	}
+	sm->ImmediateClearScene(file);
+
+	const std::string compressed = ReadWholeFile(saves[2].first);
+	EXPECT_TRUE(Serialization::IsCompressedJson(compressed));
+	EXPECT_FALSE(std::filesystem::exists(Serialization::GetSceneIndexPath(saves[2].first)));
+	EXPECT_LT(std::filesystem::file_size(saves[1].first), std::filesystem::file_size(saves[0].first));
+
+	ecs->sceneMap["Expected"];
+	Serialization::LoadScene(saves[0].first, "Expected");
+	const std::vector<EntityID> expectedIDs = ecs->sceneMap.at("Expected").sceneIDs;
+	ASSERT_EQ(expectedIDs.size(), ENTITY_COUNT);
+
+	auto expectSame = [&](const std::string& scene) {
+		const std::vector<EntityID> ids = ecs->sceneMap.at(scene).sceneIDs;
+		ASSERT_EQ(ids.size(), expectedIDs.size()) << scene;
+		for (size_t i = 0; i < ids.size(); ++i) {
+			ASSERT_EQ(ecs->GetEntitySignature(ids[i]), ecs->GetEntitySignature(expectedIDs[i])) << scene << " entity " << i;
+			for (const auto& [componentName, key] : ecs->GetComponentKeyData()) {
+				if (ecs->GetEntitySignature(ids[i]).test(key)) {
+					EXPECT_TRUE(ecs->componentAction.at(componentName)->Compare(ids[i], expectedIDs[i])) << scene << " " << componentName << " of entity " << i;
+				}
+			}
+		}
+		sm->ImmediateClearScene(scene);
+	};
+	for (size_t i = 1; i < saves.size(); ++i) {
+		ecs->sceneMap["Stream"];
+		Serialization::LoadScene(saves[i].first, "Stream");
+		expectSame("Stream");
+		ecs->sceneMap["Document"];
+		Serialization::LoadSceneDocument(saves[i].first, "Document");
+		expectSame("Document");
+	}
+
+	// saving compact over a pretty file does not reuse the pretty records
+	ASSERT_TRUE(sm->ImmediateLoadScene(saves[0].first));
+	Serialization::SaveScene(saves[0].first, "", { Serialization::JsonStyle::COMPACT, false });
+	EXPECT_EQ(ReadWholeFile(saves[0].first), ReadWholeFile(saves[1].first));
+	sm->ImmediateClearScene(saves[0].first);
+
+	sm->ImmediateClearScene("Expected");
+	RemoveSceneFiles(file);
+	for (const auto& [target, options] : saves) {
+		RemoveSceneFiles(target);
+	}
+}
+
+// a scene saved before a component's schema version was raised streams no further than its versions,
+// and is loaded through a migrated document instead
+TEST(Scene, OutdatedSceneIsMigratedOnLoad) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	auto& migrations = Serialization::SchemaMigrations::GetInstance();
+	const std::string file = "OutdatedScene.json";
+	RemoveSceneFiles(file);
+	{
+		std::ofstream output(file, std::ios::binary);
+		output << R"([{"SceneData":{"ambientIntensity":0.5},"schemaVersions":{"SceneData":1,"NameComponent":1}},)"
+			R"({"NameComponent":{"name":"Parent","Layer":2},"children":[{"NameComponent":{"name":"Child"}}]}])";
+	}
+
+	// NameComponent as if "entityName" had been "name" before version 2
+	migrations.SetVersion("NameComponent", 2);
+	migrations.Add<NameComponent>(1, Serialization::migrate::Rename("name", "entityName"));
+	ecs->sceneMap["Migrated"];
+	Serialization::LoadScene(file, "Migrated");
+	migrations.SetVersion<NameComponent>();
+
+	const std::vector<EntityID> ids = ecs->sceneMap.at("Migrated").sceneIDs;
+	ASSERT_EQ(ids.size(), 2u);
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(ids[0])->entityName, "Parent");
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(ids[0])->Layer, 2);
+	EXPECT_EQ(ecs->GetComponent<NameComponent>(ids[1])->entityName, "Child");
+	EXPECT_FLOAT_EQ(ecs->sceneMap.at("Migrated").ambientIntensity, 0.5f);
+
+	// saves record the versions of what the scene holds
+	Serialization::SaveScene("Migrated", file);
+	rapidjson::Document saved;
+	saved.Parse(ReadWholeFile(file).c_str());
+	ASSERT_TRUE(saved.IsArray() && saved.Size() == 2);
+	const rapidjson::Value& versions = saved[0][Serialization::SchemaVersions::KEY];
+	EXPECT_EQ(versions["NameComponent"].GetUint(), 1u);
+	EXPECT_EQ(versions["SceneData"].GetUint(), 1u);
+	const ComponentSignature held = ecs->GetEntitySignature(ids[0]) | ecs->GetEntitySignature(ids[1]);
+	for (const auto& entry : versions.GetObject()) {
+		const std::string name = entry.name.GetString();
+		EXPECT_TRUE(name == SceneData::classname() || held.test(ecs->GetComponentKey(name))) << name;
+	}
+
+	sm->ImmediateClearScene("Migrated");
+	RemoveSceneFiles(file);
+}
+
+// the scenes the editor ships with, each saved the way the editor and the running game save
+TEST(DeSerializeBenchmark, CompactSampleSceneSave) {
+#ifndef KOS_SAMPLE_SCENE_DIR
+	GTEST_SKIP() << "no sample scenes";
+#else
+	constexpr int REPEAT = 20;
+	using Clock = std::chrono::steady_clock;
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	const std::vector<std::pair<std::string, Serialization::JsonSaveOptions>> styles = {
+		{ "pretty", {} },
+		{ "compact", { Serialization::JsonStyle::COMPACT, false } },
+		{ "compact+LZ4", Serialization::RUNTIME_SAVE },
+	};
+	std::vector<size_t> totalBytes(styles.size());
+	std::vector<double> totalMilliseconds(styles.size());
+
+	for (const auto& entry : std::filesystem::directory_iterator(KOS_SAMPLE_SCENE_DIR)) {
+		const std::filesystem::path path = entry.path();
+		if (path.extension() != ".json" || path.filename().string().find("[Cached]") != std::string::npos) continue;
+
+		const std::string scene = "Sample " + path.filename().string();
+		ecs->sceneMap[scene];
+		Serialization::LoadScene(path, scene);
+		const size_t entityCount = ecs->sceneMap.at(scene).sceneIDs.size();
+		if (entityCount == 0) {
+			sm->ImmediateClearScene(scene);
+			continue;
+		}
+
+		std::cout << "[          ] " << path.filename().string() << ", " << entityCount << " entities:";
+		std::vector<size_t> bytes(styles.size());
+		for (size_t s = 0; s < styles.size(); ++s) {
+			// alternating files keeps every save whole, records are only reused in the file they were saved to
+			const std::string targets[2] = { "SampleSave0.json", "SampleSave1.json" };
+			const auto start = Clock::now();
+			for (int i = 0; i < REPEAT; ++i) {
+				Serialization::SaveScene(scene, targets[i % 2], styles[s].second);
+			}
+			const double milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / REPEAT;
+			bytes[s] = std::filesystem::file_size(targets[0]);
+			totalBytes[s] += bytes[s];
+			totalMilliseconds[s] += milliseconds;
+			std::cout << " " << styles[s].first << " " << bytes[s] << " B " << milliseconds << " ms;";
+
+			std::filesystem::remove(Serialization::GetCookedScenePath(targets[0]));
+			ecs->sceneMap["Reloaded"];
+			Serialization::LoadScene(targets[0], "Reloaded");
+			EXPECT_EQ(ecs->sceneMap.at("Reloaded").sceneIDs.size(), entityCount) << styles[s].first << " " << path;
+			sm->ImmediateClearScene("Reloaded");
+			for (const std::string& target : targets) {
+				RemoveSceneFiles(target);
+			}
+		}
+		std::cout << "\n";
+		EXPECT_LT(bytes[1], bytes[0]) << path;
+		EXPECT_LT(bytes[2], bytes[1]) << path;
+		sm->ImmediateClearScene(scene);
+	}
+
+	std::cout << "[          ] all samples:";
+	for (size_t s = 0; s < styles.size(); ++s) {
+		std::cout << " " << styles[s].first << " " << totalBytes[s] / 1024 << " KB " << totalMilliseconds[s] << " ms;";
+	}
+	std::cout << "\n";
+#endif
+}
+
 TEST(Scene, CreateScene) {
 	auto* sm = scenes::SceneManager::m_GetInstance();
 	EXPECT_TRUE(sm->ImmediateLoadScene("Test Scene"));
@@ -82,6 +1357,70 @@ TEST(Entity, SpawnMaxEntities) {
 
 
 
+TEST(Transform, AttachmentFollowsBoneThroughHierarchy) {
+	auto* ecs = ComponentRegistry::GetECSInstance();
+	auto* sm = scenes::SceneManager::m_GetInstance();
+	EXPECT_TRUE(sm->ImmediateLoadScene("Test Scene"));
+
+	auto trs = [](const Transformation& t) {
+		return glm::translate(glm::mat4(1.f), t.position) * glm::mat4_cast(glm::quat(glm::radians(t.rotation))) * glm::scale(glm::mat4(1.f), t.scale);
+	};
+
+	// vehicle > character (animated) > weapon held in the hand > scope on the weapon
+	const EntityID vehicle = ecs->CreateEntity("Test Scene");
+	const EntityID character = ecs->CreateEntity("Test Scene");
+	const EntityID weapon = ecs->CreateEntity("Test Scene");
+	const EntityID scope = ecs->CreateEntity("Test Scene");
+	hierachy::m_SetParent(vehicle, character);
+	hierachy::m_SetParent(character, weapon);
+	hierachy::m_SetParent(weapon, scope);
+
+	ecs->GetComponent<TransformComponent>(vehicle)->LocalTransformation = { { 10.f, 0.f, -4.f }, { 0.f, 90.f, 0.f }, { 1.f, 1.f, 1.f } };
+	ecs->GetComponent<TransformComponent>(character)->LocalTransformation = { { 0.f, 1.f, 0.f }, { 0.f, 30.f, 0.f }, { 2.f, 2.f, 2.f } };
+	ecs->GetComponent<TransformComponent>(weapon)->LocalTransformation = { { 0.f, 0.f, 0.1f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f } };
+	ecs->GetComponent<TransformComponent>(scope)->LocalTransformation = { { 0.f, 0.05f, 0.2f }, { 10.f, 0.f, 0.f }, { 1.f, 1.f, 1.f } };
+
+	// shoulder bent 90 degrees about z, the hand half a unit along the arm
+	animation::AnimationClip clip;
+	clip.Build(1.f, 1.f, {
+		{ "Spine", -1, glm::translate(glm::mat4(1.f), glm::vec3{ 0.f, 1.f, 0.f }) },
+		{ "Arm", 0, glm::rotate(glm::translate(glm::mat4(1.f), glm::vec3{ 0.3f, 0.f, 0.f }), glm::half_pi<float>(), glm::vec3{ 0.f, 0.f, 1.f }) },
+		{ "Hand", 1, glm::translate(glm::mat4(1.f), glm::vec3{ 0.5f, 0.f, 0.f }) },
+	}, {});
+	AnimatorComponent* animator = ecs->AddComponent<AnimatorComponent>(character);
+	animator->instance.Bind(clip, &clip, {}, {});
+	animator->instance.Sample(clip);
+
+	AttachmentComponent* attachment = ecs->AddComponent<AttachmentComponent>(weapon);
+	attachment->boneName = "Hand";
+	attachment->socket = { { 0.f, 0.02f, 0.f }, { 0.f, 0.f, -90.f }, { 1.f, 1.f, 1.f } };
+
+	TransformSystem::CalculateAllTransform(ecs->GetComponent<TransformComponent>(vehicle));
+
+	const glm::mat4 characterWorld = trs(ecs->GetComponent<TransformComponent>(vehicle)->LocalTransformation) *
+		trs(ecs->GetComponent<TransformComponent>(character)->LocalTransformation);
+	const glm::mat4 weaponWorld = characterWorld * animator->instance.GetGlobalTransforms()[2] * trs(attachment->socket) *
+		trs(ecs->GetComponent<TransformComponent>(weapon)->LocalTransformation);
+	const glm::mat4 scopeWorld = weaponWorld * trs(ecs->GetComponent<TransformComponent>(scope)->LocalTransformation);
+
+	auto position = [&](EntityID id) { return glm::vec3(ecs->GetComponent<TransformComponent>(id)->transformation[3]); };
+	EXPECT_LT(glm::length(position(weapon) - glm::vec3(weaponWorld[3])), 1e-4f);
+	EXPECT_LT(glm::length(position(scope) - glm::vec3(scopeWorld[3])), 1e-4f);
+	EXPECT_EQ(attachment->joint, 2);
+
+	// the hand in model space is (0.3, 1.5, 0), the vehicle turn and character scale carry it
+	EXPECT_LT(glm::length(glm::vec3(animator->instance.GetGlobalTransforms()[2][3]) - glm::vec3{ 0.3f, 1.5f, 0.f }), 1e-5f);
+
+	// an unknown bone hangs the weapon off the character's origin
+	attachment->boneName = "Tail";
+	TransformSystem::CalculateAllTransform(ecs->GetComponent<TransformComponent>(vehicle));
+	EXPECT_EQ(attachment->joint, -1);
+	const glm::mat4 unattached = characterWorld * trs(attachment->socket) * trs(ecs->GetComponent<TransformComponent>(weapon)->LocalTransformation);
+	EXPECT_LT(glm::length(position(weapon) - glm::vec3(unattached[3])), 1e-4f);
+
+	sm->ImmediateClearScene("Test Scene");
+}
+
 TEST(Math, RandomDecomposeTRS) {
     constexpr int NUM_TESTS = 100;
     constexpr float EPS_POS = 0.0001f;